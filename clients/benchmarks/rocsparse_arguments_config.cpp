@@ -124,6 +124,7 @@ rocsparse_arguments_config::rocsparse_arguments_config()
         this->tolm                 = static_cast<double>(0);
         this->graph_test           = static_cast<bool>(0);
         this->skip_reproducibility = static_cast<bool>(0);
+        this->host_timing          = static_cast<bool>(0);
         this->filename[0]          = '\0';
         this->function[0]          = '\0';
         this->name[0]              = '\0';
@@ -343,6 +344,10 @@ void rocsparse_arguments_config::set_description(options_description& desc)
      value<rocsparse_int>(&this->device_id)->default_value(0),
      "Set default device to be used for subsequent program runs")
 
+    ("host_timing",
+     value<rocsparse_int>(&this->b_host_timing)->default_value(0),
+     "Time the host reference implementation instead of the GPU routine? 0 = No, 1 = Yes (default: No). Supported by: csr2csc")
+
     ("direction",
      value<rocsparse_int>(&this->b_dir)->default_value(rocsparse_direction_row),
      "Indicates whether BSR blocks should be laid out in row-major storage or by column-major storage: row-major storage = 0, column-major storage = 1 (default: 0)")
@@ -607,6 +612,7 @@ int rocsparse_arguments_config::parse(int&argc,char**&argv, options_description&
   this->formatA = (rocsparse_format)this->b_formatA;
   this->formatB = (rocsparse_format)this->b_formatB;
   this->spmv_alg = (rocsparse_spmv_alg)this->b_spmv_alg;
+  this->host_timing = (this->b_host_timing != 0);
   this->itilu0_alg = (rocsparse_itilu0_alg)this->b_itilu0_alg;
   this->spmm_alg = (rocsparse_spmm_alg)this->b_spmm_alg;
   this->sddmm_alg = (rocsparse_sddmm_alg)this->b_sddmm_alg;
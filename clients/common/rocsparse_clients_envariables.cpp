@@ -40,13 +40,23 @@ static constexpr size_t s_var_string_size
     = countof(rocsparse_clients_envariables::s_var_string_all);
 
 static constexpr const char* s_var_bool_names[s_var_bool_size]
-    = {"ROCSPARSE_CLIENTS_VERBOSE", "ROCSPARSE_CLIENTS_TEST_DEBUG_ARGUMENTS"};
+    = {"ROCSPARSE_CLIENTS_VERBOSE",
+       "ROCSPARSE_CLIENTS_TEST_DEBUG_ARGUMENTS",
+       "ROCSPARSE_CLIENTS_MATRICES_CACHE",
+       "ROCSPARSE_CLIENTS_MATRICES_SIDECAR"};
 static constexpr const char* s_var_string_names[s_var_string_size]
-    = {"ROCSPARSE_CLIENTS_MATRICES_DIR", "ROCSPARSE_TEST_DATA"};
+    = {"ROCSPARSE_CLIENTS_MATRICES_DIR",
+       "ROCSPARSE_TEST_DATA",
+       "ROCSPARSE_CLIENTS_MATRICES_CACHE_SIZE"};
 static constexpr const char* s_var_bool_descriptions[s_var_bool_size]
-    = {"0: disabled, 1: enabled", "0: disabled, 1: enabled"};
+    = {"0: disabled, 1: enabled",
+       "0: disabled, 1: enabled",
+       "0: disabled (default), 1: enabled",
+       "0: disabled (default), 1: enabled"};
 static constexpr const char* s_var_string_descriptions[s_var_string_size]
-    = {"Full path of the matrices directory", "The path where the test data file is located"};
+    = {"Full path of the matrices directory",
+       "The path where the test data file is located",
+       "Maximum size in MB of the matrices cache (default 8192)"};
 
 ///
 /// @brief Grab an environment variable value.
@@ -200,6 +210,30 @@ private:
                 }
                 break;
             }
+            case rocsparse_clients_envariables::MATRICES_CACHE:
+            {
+                const bool success = rocsparse_getenv(
+                    s_var_bool_names[tag], this->m_var_bool_defined[tag], this->m_var_bool[tag]);
+                if(!success)
+                {
+                    std::cerr << "rocsparse_getenv failed on fetching " << s_var_bool_names[tag]
+                              << std::endl;
+                    throw(rocsparse_status_invalid_value);
+                }
+                break;
+            }
+            case rocsparse_clients_envariables::MATRICES_SIDECAR:
+            {
+                const bool success = rocsparse_getenv(
+                    s_var_bool_names[tag], this->m_var_bool_defined[tag], this->m_var_bool[tag]);
+                if(!success)
+                {
+                    std::cerr << "rocsparse_getenv failed on fetching " << s_var_bool_names[tag]
+                              << std::endl;
+                    throw(rocsparse_status_invalid_value);
+                }
+                break;
+            }
             }
         }
 
@@ -233,6 +267,19 @@ private:
                 }
                 break;
             }
+            case rocsparse_clients_envariables::MATRICES_CACHE_SIZE:
+            {
+                const bool success = rocsparse_getenv(s_var_string_names[tag],
+                                                      this->m_var_string_defined[tag],
+                                                      this->m_var_string[tag]);
+                if(!success)
+                {
+                    std::cerr << "rocsparse_getenv failed on fetching " << s_var_string_names[tag]
+                              << std::endl;
+                    throw(rocsparse_status_invalid_value);
+                }
+                break;
+            }
             }
         }
 
@@ -262,6 +309,26 @@ private:
                               << std::endl;
                     break;
                 }
+                case rocsparse_clients_envariables::MATRICES_CACHE:
+                {
+                    const bool v = this->m_var_bool[tag];
+                    std::cout << ""
+                              << "env variable " << s_var_bool_names[tag] << " : "
+                              << ((this->m_var_bool_defined[tag]) ? ((v) ? "enabled" : "disabled")
+                                                                  : "<undefined>")
+                              << std::endl;
+                    break;
+                }
+                case rocsparse_clients_envariables::MATRICES_SIDECAR:
+                {
+                    const bool v = this->m_var_bool[tag];
+                    std::cout << ""
+                              << "env variable " << s_var_bool_names[tag] << " : "
+                              << ((this->m_var_bool_defined[tag]) ? ((v) ? "enabled" : "disabled")
+                                                                  : "<undefined>")
+                              << std::endl;
+                    break;
+                }
                 }
             }
 
@@ -289,6 +356,16 @@ private:
                               << std::endl;
                     break;
                 }
+                case rocsparse_clients_envariables::MATRICES_CACHE_SIZE:
+                {
+                    const std::string v = this->m_var_string[tag];
+                    std::cout << ""
+                              << "env variable " << s_var_string_names[tag] << " : "
+                              << ((this->m_var_string_defined[tag]) ? this->m_var_string[tag]
+                                                                    : "<undefined>")
+                              << std::endl;
+                    break;
+                }
                 }
             }
         }
@@ -23,6 +23,10 @@
  * ************************************************************************ */
 
 #include "rocsparse_exporter_rocalution.hpp"
+#include "rocsparse_importer.hpp"
+
+#include <chrono>
+#include <limits>
 template <typename X, typename Y>
 rocsparse_status rocsparse_type_conversion(const X& x, Y& y);
 
@@ -31,7 +35,15 @@ rocsparse_exporter_rocalution::~rocsparse_exporter_rocalution()
     const char* env = getenv("GTEST_LISTENER");
     if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
     {
-        std::cout << "Export done." << std::endl;
+        if(this->m_elapsed > 0.0)
+        {
+            std::cout << "Export done (" << this->m_nbytes / this->m_elapsed / 1e6 << " MB/s, "
+                      << this->m_elapsed << " s)." << std::endl;
+        }
+        else
+        {
+            std::cout << "Export done." << std::endl;
+        }
     }
 }
 
@@ -46,62 +58,106 @@ rocsparse_exporter_rocalution::rocsparse_exporter_rocalution(const std::string&
     }
 }
 
+//
+// Values are stored as double, or double complex, whatever the exported type is.
+//
 template <typename T>
-rocsparse_status rocalution_write_sparse_csx(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const T* val)
+struct rocalution_value_traits
+{
+    using file_t = double;
+};
+
+template <>
+struct rocalution_value_traits<rocsparse_float_complex>
 {
-    std::ofstream out(filename, std::ios::out | std::ios::binary);
+    using file_t = rocsparse_double_complex;
+};
 
-    if(!out.is_open())
+template <>
+struct rocalution_value_traits<rocsparse_double_complex>
+{
+    using file_t = rocsparse_double_complex;
+};
+
+//
+// Number of elements converted per block when the exported type differs from the stored type.
+//
+static constexpr size_t s_rocalution_block_size = size_t(1) << 20;
+
+//
+// Write size indices as zero-based int, either directly from x if no conversion is needed,
+// or block by block through a bounded staging buffer filled in parallel.
+//
+template <typename X>
+static rocsparse_status rocalution_write_indices(FILE*                f,
+                                                size_t               size,
+                                                const X* __restrict__ x,
+                                                rocsparse_index_base base)
+{
+    if(std::is_same<X, int>() && base == rocsparse_index_base_zero)
     {
-        return rocsparse_status_internal_error;
+        return (fwrite(x, sizeof(int), size, f) == size) ? rocsparse_status_success
+                                                          : rocsparse_status_internal_error;
     }
 
-    // Header
-    out << "#rocALUTION binary csr file" << std::endl;
-
-    // rocALUTION version
-    int version = 10602;
-    out.write((char*)&version, sizeof(int));
+    const int64_t    shift      = (base == rocsparse_index_base_one) ? 1 : 0;
+    const size_t     block_size = std::min(size, s_rocalution_block_size);
+    std::vector<int> buffer(block_size);
+    int*             p = buffer.data();
+    for(size_t offset = 0; offset < size; offset += block_size)
+    {
+        const size_t n        = std::min(block_size, size - offset);
+        bool         overflow = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(|| : overflow)
+#endif
+        for(size_t i = 0; i < n; ++i)
+        {
+            const int64_t v = static_cast<int64_t>(x[offset + i]) - shift;
+            overflow = overflow || (v < std::numeric_limits<int>::min())
+                       || (v > std::numeric_limits<int>::max());
+            p[i] = static_cast<int>(v);
+        }
 
-    // Data
-    out.write((char*)&m, sizeof(int));
-    out.write((char*)&n, sizeof(int));
-    out.write((char*)&nnz, sizeof(int));
-    out.write((char*)ptr, (m + 1) * sizeof(int));
-    out.write((char*)col, nnz * sizeof(int));
-    out.write((char*)val, nnz * sizeof(T));
-    out.close();
+        if(overflow)
+        {
+            std::cerr << "rocsparse_exporter_rocalution: index does not fit in int." << std::endl;
+            return rocsparse_status_invalid_value;
+        }
 
+        if(fwrite(p, sizeof(int), n, f) != n)
+        {
+            return rocsparse_status_internal_error;
+        }
+    }
     return rocsparse_status_success;
 }
 
-template <typename T>
-void convert_array(int nnz, const void* data, void* mem)
+//
+// Write size values as F, either directly from x if the types are identical,
+// or block by block through a bounded staging buffer and a parallel conversion.
+//
+template <typename F, typename T>
+static rocsparse_status rocalution_write_values(FILE* f, size_t size, const T* __restrict__ x)
 {
-    memcpy(mem, data, sizeof(T) * nnz);
-}
-
-template <>
-void convert_array<rocsparse_float_complex>(int nnz, const void* data, void* mem)
-{
-    rocsparse_double_complex*      pmem  = (rocsparse_double_complex*)mem;
-    const rocsparse_float_complex* pdata = (const rocsparse_float_complex*)data;
-    for(int i = 0; i < nnz; ++i)
+    if(std::is_same<F, T>())
     {
-        pmem[i] = rocsparse_double_complex(std::real(pdata[i]), std::imag(pdata[i]));
+        return (fwrite(x, sizeof(T), size, f) == size) ? rocsparse_status_success
+                                                        : rocsparse_status_internal_error;
     }
-}
 
-template <>
-void convert_array<float>(int nnz, const void* data, void* mem)
-{
-    double*      pmem  = (double*)mem;
-    const float* pdata = (const float*)data;
-    for(int i = 0; i < nnz; ++i)
+    const size_t   block_size = std::min(size, s_rocalution_block_size);
+    std::vector<F> buffer(block_size);
+    for(size_t offset = 0; offset < size; offset += block_size)
     {
-        pmem[i] = pdata[i];
+        const size_t n = std::min(block_size, size - offset);
+        rocsparse_importer_copy_mixed_arrays(n, buffer.data(), x + offset);
+        if(fwrite(buffer.data(), sizeof(F), n, f) != n)
+        {
+            return rocsparse_status_internal_error;
+        }
     }
+    return rocsparse_status_success;
 }
 
 template <typename T, typename I, typename J>
@@ -114,6 +170,7 @@ rocsparse_status rocsparse_exporter_rocalution::write_sparse_csx(rocsparse_direc
                                                                  const T* __restrict__ val_,
                                                                  rocsparse_index_base base_)
 {
+    using F = typename rocalution_value_traits<T>::file_t;
 
     if(dir_ != rocsparse_direction_row)
     {
@@ -142,116 +199,48 @@ rocsparse_status rocsparse_exporter_rocalution::write_sparse_csx(rocsparse_direc
         return status;
     }
 
-    const int*    ptr = nullptr;
-    const int*    ind = nullptr;
-    const double* val = nullptr;
-
-    int*                  ptr_mem  = nullptr;
-    int*                  ind_mem  = nullptr;
-    double*               val_mem  = nullptr;
-    static constexpr bool ptr_same = std::is_same<I, int>();
-    static constexpr bool ind_same = std::is_same<J, int>();
-    static constexpr bool val_same
-        = std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>();
-
-    bool is_T_complex = (std::is_same<T, rocsparse_double_complex>()
-                         || std::is_same<T, rocsparse_float_complex>());
-
-    ptr_mem = nullptr;
-    if(!ptr_same && (base_ != rocsparse_index_base_zero))
-    {
-        rocsparse_hipHostMalloc(&ptr_mem, sizeof(int) * (m + 1));
-    }
-
-    ind_mem = nullptr;
-    if(!ind_same && (base_ != rocsparse_index_base_zero))
+    FILE* f = fopen(this->m_filename.c_str(), "wb");
+    if(f == nullptr)
     {
-        rocsparse_hipHostMalloc(&ind_mem, sizeof(int) * nnz);
+        return rocsparse_status_internal_error;
     }
 
-    val_mem = nullptr;
-    if(!val_same)
-    {
-        rocsparse_hipHostMalloc(&val_mem, sizeof(double) * (is_T_complex ? (2 * nnz) : nnz));
-    }
+    const auto t0 = std::chrono::steady_clock::now();
 
-    ptr = (ptr_same || (base_ == rocsparse_index_base_zero)) ? ((const int*)ptr_) : ptr_mem;
-    ind = (ind_same || (base_ == rocsparse_index_base_zero)) ? ((const int*)ind_) : ind_mem;
-    val = (val_same) ? ((const double*)val_) : val_mem;
+    // Header, rocALUTION version and sizes.
+    static const char header[] = "#rocALUTION binary csr file\n";
+    const int         sizes[4] = {10602, m, n, nnz};
+    status = (fwrite(header, 1, sizeof(header) - 1, f) == sizeof(header) - 1
+              && fwrite(sizes, sizeof(int), 4, f) == 4)
+                 ? rocsparse_status_success
+                 : rocsparse_status_internal_error;
 
-    if(ptr_mem != nullptr)
+    if(status == rocsparse_status_success)
     {
-        for(int i = 0; i < m + 1; ++i)
-        {
-            status = rocsparse_type_conversion(ptr_[i], ptr_mem[i]);
-            if(status != rocsparse_status_success)
-            {
-                break;
-            }
-        }
-
-        if(base_ == rocsparse_index_base_one)
-        {
-            for(int i = 0; i < m + 1; ++i)
-            {
-                ptr_mem[i] = ptr_mem[i] - 1;
-            }
-        }
-
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
+        status = rocalution_write_indices(f, size_t(m) + 1, ptr_, base_);
     }
 
-    if(ind_mem != nullptr)
+    if(status == rocsparse_status_success)
     {
-        for(int i = 0; i < nnz; ++i)
-        {
-            status = rocsparse_type_conversion(ind_[i], ind_mem[i]);
-            if(status != rocsparse_status_success)
-            {
-                break;
-            }
-        }
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-        if(base_ == rocsparse_index_base_one)
-        {
-            for(int i = 0; i < nnz; ++i)
-            {
-                ind_mem[i] = ind_mem[i] - 1;
-            }
-        }
+        status = rocalution_write_indices(f, size_t(nnz), ind_, base_);
     }
 
-    if(val_mem != nullptr)
+    if(status == rocsparse_status_success)
     {
-        convert_array<T>(nnz, (const void*)val_, (void*)val_mem);
+        status = rocalution_write_values<F>(f, size_t(nnz), val_);
     }
 
-    if(status != rocsparse_status_success)
+    if(fclose(f) != 0 && status == rocsparse_status_success)
     {
-        return status;
+        status = rocsparse_status_internal_error;
     }
 
-    status = rocalution_write_sparse_csx(this->m_filename.c_str(), m, n, nnz, ptr, ind, val);
-    if(val_mem != nullptr)
-    {
-        rocsparse_hipFree(val_mem);
-        val_mem = nullptr;
-    }
-    if(ind_mem != nullptr)
+    if(status == rocsparse_status_success)
     {
-        rocsparse_hipFree(ind_mem);
-        ind_mem = nullptr;
-    }
-    if(ptr_mem != nullptr)
-    {
-        rocsparse_hipFree(ptr_mem);
-        ptr_mem = nullptr;
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+
+        this->m_nbytes += sizeof(int) * (size_t(m) + 1) + (sizeof(int) + sizeof(F)) * size_t(nnz);
+        this->m_elapsed += elapsed.count();
     }
 
     return status;
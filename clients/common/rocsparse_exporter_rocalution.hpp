@@ -32,6 +32,8 @@ class rocsparse_exporter_rocalution : public rocsparse_exporter<rocsparse_export
 {
 protected:
     std::string m_filename{};
+    double      m_nbytes{};
+    double      m_elapsed{};
 
 public:
     ~rocsparse_exporter_rocalution();
@@ -21,9 +21,15 @@
  * THE SOFTWARE.
  *
  * ************************************************************************ */
-#include "utility.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_traits.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
 #include <limits>
+#include <type_traits>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -129,6 +135,197 @@ void host_sctr(I nnz, const T* x_val, const I* x_ind, T* y, rocsparse_index_base
  *    level 2 SPARSE
  * ===========================================================================
  */
+// Invoke f(DIR, BLOCK_DIM) with compile time direction and block dimension, for all block
+// dimensions that have a dedicated host kernel. Returns false if there is none.
+template <typename F>
+static bool host_bsr_block_dim_dispatch(rocsparse_direction dir, int64_t block_dim, F&& f)
+{
+    auto dispatch_dir = [&](auto BLOCK_DIM) {
+        if(dir == rocsparse_direction_row)
+        {
+            f(std::integral_constant<rocsparse_direction, rocsparse_direction_row>{}, BLOCK_DIM);
+        }
+        else
+        {
+            f(std::integral_constant<rocsparse_direction, rocsparse_direction_column>{},
+              BLOCK_DIM);
+        }
+
+        return true;
+    };
+
+    switch(block_dim)
+    {
+    case 1:
+        return dispatch_dir(std::integral_constant<uint32_t, 1>{});
+    case 2:
+        return dispatch_dir(std::integral_constant<uint32_t, 2>{});
+    case 3:
+        return dispatch_dir(std::integral_constant<uint32_t, 3>{});
+    case 4:
+        return dispatch_dir(std::integral_constant<uint32_t, 4>{});
+    case 5:
+        return dispatch_dir(std::integral_constant<uint32_t, 5>{});
+    case 6:
+        return dispatch_dir(std::integral_constant<uint32_t, 6>{});
+    case 7:
+        return dispatch_dir(std::integral_constant<uint32_t, 7>{});
+    case 8:
+        return dispatch_dir(std::integral_constant<uint32_t, 8>{});
+    case 16:
+        return dispatch_dir(std::integral_constant<uint32_t, 16>{});
+    default:
+        return false;
+    }
+}
+
+// Block row kernel of (ge)bsrmv with compile time row block dimension, and column block
+// dimension unless COL_BLOCK_DIM is zero. All rows of the block are computed in a single
+// sweep over the blocks. The partial sums of each row are
+// distributed over WFSIZE lanes by the column within the block and reduced like on the
+// device, such that the results match the runtime block dimension kernels bit by bit.
+template <rocsparse_direction DIR,
+          uint32_t            ROW_BLOCK_DIM,
+          uint32_t            COL_BLOCK_DIM,
+          typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y>
+static inline void host_bsrmv_block_row(J                    row,
+                                        I                    row_begin,
+                                        I                    row_end,
+                                        const J*             bsr_col_ind,
+                                        const A*             bsr_val,
+                                        J                    col_block_dim,
+                                        const X*             x,
+                                        T                    alpha,
+                                        T                    beta,
+                                        Y*                   y,
+                                        rocsparse_index_base base)
+{
+    static constexpr uint32_t WFSIZE
+        = (ROW_BLOCK_DIM <= 8) ? 8 : ((ROW_BLOCK_DIM <= 16) ? 16 : 32);
+
+    const J row_dim = ROW_BLOCK_DIM;
+    const J col_dim = (COL_BLOCK_DIM != 0) ? COL_BLOCK_DIM : col_block_dim;
+
+    T sum[ROW_BLOCK_DIM][WFSIZE];
+
+    for(uint32_t bi = 0; bi < ROW_BLOCK_DIM; ++bi)
+    {
+        for(uint32_t k = 0; k < WFSIZE; ++k)
+        {
+            sum[bi][k] = static_cast<T>(0);
+        }
+    }
+
+    for(I j = row_begin; j < row_end; ++j)
+    {
+        J col = bsr_col_ind[j] - base;
+
+        const A* block   = bsr_val + row_dim * col_dim * j;
+        const X* x_block = x + col_dim * col;
+
+        if(DIR == rocsparse_direction_row)
+        {
+            for(uint32_t bi = 0; bi < ROW_BLOCK_DIM; ++bi)
+            {
+                for(J bj = 0; bj < col_dim; ++bj)
+                {
+                    T& lane = sum[bi][bj % WFSIZE];
+
+                    lane = std::fma(static_cast<T>(block[col_dim * bi + bj]),
+                                    static_cast<T>(x_block[bj]),
+                                    static_cast<T>(lane));
+                }
+            }
+        }
+        else
+        {
+            for(J bj = 0; bj < col_dim; ++bj)
+            {
+                for(uint32_t bi = 0; bi < ROW_BLOCK_DIM; ++bi)
+                {
+                    T& lane = sum[bi][bj % WFSIZE];
+
+                    lane = std::fma(static_cast<T>(block[row_dim * bj + bi]),
+                                    static_cast<T>(x_block[bj]),
+                                    static_cast<T>(lane));
+                }
+            }
+        }
+    }
+
+    for(uint32_t bi = 0; bi < ROW_BLOCK_DIM; ++bi)
+    {
+        for(uint32_t j = 1; j < WFSIZE; j <<= 1)
+        {
+            for(uint32_t k = 0; k < WFSIZE - j; ++k)
+            {
+                sum[bi][k] += sum[bi][k + j];
+            }
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[row * row_dim + bi] = std::fma(static_cast<T>(beta),
+                                             static_cast<T>(y[row * row_dim + bi]),
+                                             static_cast<T>(alpha * sum[bi][0]));
+        }
+        else
+        {
+            y[row * row_dim + bi] = alpha * sum[bi][0];
+        }
+    }
+}
+
+// Process all block rows, or the block rows listed in bsr_mask_ptr, with the compile time
+// block dimension kernel
+template <rocsparse_direction DIR,
+          uint32_t            ROW_BLOCK_DIM,
+          uint32_t            COL_BLOCK_DIM,
+          typename T,
+          typename I,
+          typename J,
+          typename A,
+          typename X,
+          typename Y>
+static void host_bsrmv_block_rows(J                    size_of_mask,
+                                  const J*             bsr_mask_ptr,
+                                  const I*             bsr_row_ptr,
+                                  const I*             bsr_end_ptr,
+                                  const J*             bsr_col_ind,
+                                  const A*             bsr_val,
+                                  J                    col_block_dim,
+                                  const X*             x,
+                                  T                    alpha,
+                                  T                    beta,
+                                  Y*                   y,
+                                  rocsparse_index_base base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J mask_idx = 0; mask_idx < size_of_mask; ++mask_idx)
+    {
+        J row = (bsr_mask_ptr != nullptr) ? bsr_mask_ptr[mask_idx] - base : mask_idx;
+
+        host_bsrmv_block_row<DIR, ROW_BLOCK_DIM, COL_BLOCK_DIM>(row,
+                                                                bsr_row_ptr[row] - base,
+                                                                bsr_end_ptr[row] - base,
+                                                                bsr_col_ind,
+                                                                bsr_val,
+                                                                col_block_dim,
+                                                                x,
+                                                                alpha,
+                                                                beta,
+                                                                y,
+                                                                base);
+    }
+}
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_bsrmv(rocsparse_direction  dir,
                 rocsparse_operation  trans,
@@ -200,6 +397,29 @@ void host_bsrmv(rocsparse_direction  dir,
         WFSIZE = 32;
     }
 
+    // Block dimensions with a dedicated kernel, 2x2 blocks reduce over the blocks of a row
+    // instead
+    if(bsr_dim != 2
+       && host_bsr_block_dim_dispatch(dir, bsr_dim, [&](auto DIR, auto BSR_DIM) {
+              host_bsrmv_block_rows<decltype(DIR)::value,
+                                    decltype(BSR_DIM)::value,
+                                    decltype(BSR_DIM)::value>(mb,
+                                                              static_cast<const J*>(nullptr),
+                                                              bsr_row_ptr,
+                                                              bsr_end_ptr,
+                                                              bsr_col_ind,
+                                                              bsr_val,
+                                                              bsr_dim,
+                                                              x,
+                                                              alpha,
+                                                              beta,
+                                                              y,
+                                                              base);
+          }))
+    {
+        return;
+    }
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
@@ -476,6 +696,29 @@ void host_bsrxmv(rocsparse_direction  dir,
         WFSIZE = 32;
     }
 
+    // Block dimensions with a dedicated kernel, 2x2 blocks reduce over the blocks of a row
+    // instead
+    if(bsr_dim != 2
+       && host_bsr_block_dim_dispatch(dir, bsr_dim, [&](auto DIR, auto BSR_DIM) {
+              host_bsrmv_block_rows<decltype(DIR)::value,
+                                    decltype(BSR_DIM)::value,
+                                    decltype(BSR_DIM)::value>(size_of_mask,
+                                                              bsr_mask_ptr,
+                                                              bsr_row_ptr,
+                                                              bsr_end_ptr,
+                                                              bsr_col_ind,
+                                                              bsr_val,
+                                                              bsr_dim,
+                                                              x,
+                                                              alpha,
+                                                              beta,
+                                                              y,
+                                                              base);
+          }))
+    {
+        return;
+    }
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
@@ -699,6 +942,28 @@ void host_gebsrmv(rocsparse_direction  dir,
         WFSIZE = 32;
     }
 
+    // Row block dimensions with a dedicated kernel, row block dimensions 2 to 4 reduce over
+    // the blocks of a row instead
+    if(row_block_dim > 4
+       && host_bsr_block_dim_dispatch(dir, row_block_dim, [&](auto DIR, auto ROW_BLOCK_DIM) {
+              host_bsrmv_block_rows<decltype(DIR)::value, decltype(ROW_BLOCK_DIM)::value, 0>(
+                  mb,
+                  static_cast<const rocsparse_int*>(nullptr),
+                  bsr_row_ptr,
+                  bsr_row_ptr + 1,
+                  bsr_col_ind,
+                  bsr_val,
+                  col_block_dim,
+                  x,
+                  alpha,
+                  beta,
+                  y,
+                  base);
+          }))
+    {
+        return;
+    }
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
@@ -1462,6 +1727,150 @@ inline A conj_val(A val, bool conj)
     return conj ? rocsparse_conj(val) : val;
 }
 
+// Merge path search: find the coordinate (row, idx) where the given diagonal of the merge
+// grid, spanned by the row end offsets and the natural numbers of the nnz, intersects the
+// merge path. All rows < row are complete, all entries < idx are consumed.
+template <typename I, typename J>
+static void host_csrmv_merge_path_search(int64_t              diagonal,
+                                         J                    M,
+                                         I                    nnz,
+                                         const I*             csr_row_ptr,
+                                         rocsparse_index_base base,
+                                         J*                   row,
+                                         I*                   idx)
+{
+    int64_t row_min = std::max(diagonal - static_cast<int64_t>(nnz), static_cast<int64_t>(0));
+    int64_t row_max = std::min(diagonal, static_cast<int64_t>(M));
+
+    while(row_min < row_max)
+    {
+        const int64_t pivot = row_min + (row_max - row_min) / 2;
+
+        if(static_cast<int64_t>(csr_row_ptr[pivot + 1] - base) <= diagonal - pivot - 1)
+        {
+            row_min = pivot + 1;
+        }
+        else
+        {
+            row_max = pivot;
+        }
+    }
+
+    *row = static_cast<J>(row_min);
+    *idx = static_cast<I>(diagonal - row_min);
+}
+
+// Non-transposed CSR SpMV, where the work (rows + nnz) is evenly partitioned using merge
+// path, such that the load is balanced independently of the row length distribution.
+// Rows that are shared by multiple threads are completed in a serial fix-up step using
+// the carry-out of each thread.
+template <typename T, typename I, typename J, typename A, typename X, typename Y>
+static void host_csrmv_merge_path(J                    M,
+                                  T                    alpha,
+                                  const I*             csr_row_ptr,
+                                  const J*             csr_col_ind,
+                                  const A*             csr_val,
+                                  const X*             x,
+                                  T                    beta,
+                                  Y*                   y,
+                                  rocsparse_index_base base,
+                                  bool                 conj)
+{
+#ifdef _OPENMP
+    const int max_threads = omp_get_max_threads();
+#else
+    const int max_threads = 1;
+#endif
+
+    // Carry-out of each thread, rows >= M indicate that there is no carry-out
+    std::vector<J> carry_row(max_threads, M);
+    std::vector<T> carry_val(max_threads, static_cast<T>(0));
+
+    const I       nnz        = csr_row_ptr[M] - base;
+    const int64_t merge_size = static_cast<int64_t>(M) + nnz;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(max_threads)
+#endif
+    {
+#ifdef _OPENMP
+        const int tid      = omp_get_thread_num();
+        const int nthreads = omp_get_num_threads();
+#else
+        const int tid      = 0;
+        const int nthreads = 1;
+#endif
+
+        const int64_t items_per_thread = (merge_size + nthreads - 1) / nthreads;
+        const int64_t diagonal_begin   = std::min(items_per_thread * tid, merge_size);
+        const int64_t diagonal_end     = std::min(diagonal_begin + items_per_thread, merge_size);
+
+        J row_begin;
+        J row_end;
+        I idx_begin;
+        I idx_end;
+
+        host_csrmv_merge_path_search(
+            diagonal_begin, M, nnz, csr_row_ptr, base, &row_begin, &idx_begin);
+        host_csrmv_merge_path_search(
+            diagonal_end, M, nnz, csr_row_ptr, base, &row_end, &idx_end);
+
+        I j = idx_begin;
+
+        // Rows completed by this thread
+        for(J i = row_begin; i < row_end; ++i)
+        {
+            T sum = static_cast<T>(0);
+            T err = static_cast<T>(0);
+
+            const I end = csr_row_ptr[i + 1] - base;
+
+            for(; j < end; ++j)
+            {
+                T old  = sum;
+                T prod = alpha * conj_val(csr_val[j], conj) * x[csr_col_ind[j] - base];
+
+                sum = sum + prod;
+                err = (old - (sum - (sum - old))) + (prod - (sum - old)) + err;
+            }
+
+            if(beta != static_cast<T>(0))
+            {
+                y[i] = std::fma(beta, y[i], sum + err);
+            }
+            else
+            {
+                y[i] = sum + err;
+            }
+        }
+
+        // Partial row at the end of the partition
+        T sum = static_cast<T>(0);
+        T err = static_cast<T>(0);
+
+        for(; j < idx_end; ++j)
+        {
+            T old  = sum;
+            T prod = alpha * conj_val(csr_val[j], conj) * x[csr_col_ind[j] - base];
+
+            sum = sum + prod;
+            err = (old - (sum - (sum - old))) + (prod - (sum - old)) + err;
+        }
+
+        carry_row[tid] = row_end;
+        carry_val[tid] = sum + err;
+    }
+
+    // Carry-out fix-up, the row owning the carry-out has been completed by a subsequent thread
+    for(int tid = 0; tid < max_threads; ++tid)
+    {
+        if(carry_row[tid] < M)
+        {
+            y[carry_row[tid]] += carry_val[tid];
+        }
+    }
+}
+
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 static void host_csrmv_general(rocsparse_operation  trans,
                                J                    M,
@@ -1476,7 +1885,8 @@ static void host_csrmv_general(rocsparse_operation  trans,
                                Y*                   y,
                                rocsparse_index_base base,
                                rocsparse_spmv_alg   algo,
-                               bool                 force_conj)
+                               bool                 force_conj,
+                               uint32_t             warp_size)
 {
     bool conj = (trans == rocsparse_operation_conjugate_transpose || force_conj);
 
@@ -1484,13 +1894,6 @@ static void host_csrmv_general(rocsparse_operation  trans,
     {
         if(algo == rocsparse_spmv_alg_csr_stream)
         {
-            // Get device properties
-            int             dev;
-            hipDeviceProp_t prop;
-
-            hipGetDevice(&dev);
-            hipGetDeviceProperties(&prop, dev);
-
             int WF_SIZE;
             J   nnz_per_row = (M == 0) ? 0 : (nnz / M);
 
@@ -1502,7 +1905,7 @@ static void host_csrmv_general(rocsparse_operation  trans,
                 WF_SIZE = 8;
             else if(nnz_per_row < 32)
                 WF_SIZE = 16;
-            else if(nnz_per_row < 64 || prop.warpSize == 32)
+            else if(nnz_per_row < 64 || warp_size == 32)
                 WF_SIZE = 32;
             else
                 WF_SIZE = 64;
@@ -1550,35 +1953,8 @@ static void host_csrmv_general(rocsparse_operation  trans,
         }
         else
         {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-            for(J i = 0; i < M; ++i)
-            {
-                T sum = static_cast<T>(0);
-                T err = static_cast<T>(0);
-
-                I row_begin = csr_row_ptr[i] - base;
-                I row_end   = csr_row_ptr[i + 1] - base;
-
-                for(I j = row_begin; j < row_end; ++j)
-                {
-                    T old  = sum;
-                    T prod = alpha * conj_val(csr_val[j], conj) * x[csr_col_ind[j] - base];
-
-                    sum = sum + prod;
-                    err = (old - (sum - (sum - old))) + (prod - (sum - old)) + err;
-                }
-
-                if(beta != static_cast<T>(0))
-                {
-                    y[i] = std::fma(beta, y[i], sum + err);
-                }
-                else
-                {
-                    y[i] = sum + err;
-                }
-            }
+            host_csrmv_merge_path(
+                M, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, base, conj);
         }
     }
     else
@@ -1621,19 +1997,13 @@ static void host_csrmv_symmetric(rocsparse_operation  trans,
                                  Y*                   y,
                                  rocsparse_index_base base,
                                  rocsparse_spmv_alg   algo,
-                                 bool                 force_conj)
+                                 bool                 force_conj,
+                                 uint32_t             warp_size)
 {
     bool conj = (trans == rocsparse_operation_conjugate_transpose || force_conj);
 
     if(algo == rocsparse_spmv_alg_csr_stream || trans != rocsparse_operation_none)
     {
-        // Get device properties
-        int             dev;
-        hipDeviceProp_t prop;
-
-        hipGetDevice(&dev);
-        hipGetDeviceProperties(&prop, dev);
-
         int WF_SIZE;
         J   nnz_per_row = (M == 0) ? 0 : (nnz / M);
 
@@ -1645,7 +2015,7 @@ static void host_csrmv_symmetric(rocsparse_operation  trans,
             WF_SIZE = 8;
         else if(nnz_per_row < 32)
             WF_SIZE = 16;
-        else if(nnz_per_row < 64 || prop.warpSize == 32)
+        else if(nnz_per_row < 64 || warp_size == 32)
             WF_SIZE = 32;
         else
             WF_SIZE = 64;
@@ -1775,7 +2145,8 @@ void host_csrmv(rocsparse_operation   trans,
                 rocsparse_index_base  base,
                 rocsparse_matrix_type matrix_type,
                 rocsparse_spmv_alg    algo,
-                bool                  force_conj)
+                bool                  force_conj,
+                uint32_t              warp_size)
 {
     switch(matrix_type)
     {
@@ -1794,7 +2165,8 @@ void host_csrmv(rocsparse_operation   trans,
                              y,
                              base,
                              algo,
-                             force_conj);
+                             force_conj,
+                             warp_size);
         break;
     }
     default:
@@ -1812,7 +2184,8 @@ void host_csrmv(rocsparse_operation   trans,
                            y,
                            base,
                            algo,
-                           force_conj);
+                           force_conj,
+                           warp_size);
         break;
     }
     }
@@ -1832,7 +2205,8 @@ void host_cscmv(rocsparse_operation trans,
                 Y* __restrict y,
                 rocsparse_index_base  base,
                 rocsparse_matrix_type matrix_type,
-                rocsparse_spmv_alg    algo)
+                rocsparse_spmv_alg    algo,
+                uint32_t              warp_size)
 {
     switch(trans)
     {
@@ -1852,7 +2226,8 @@ void host_cscmv(rocsparse_operation trans,
                           base,
                           matrix_type,
                           algo,
-                          false);
+                          false,
+                          warp_size);
     }
     case rocsparse_operation_transpose:
     {
@@ -1870,7 +2245,8 @@ void host_cscmv(rocsparse_operation trans,
                           base,
                           matrix_type,
                           algo,
-                          false);
+                          false,
+                          warp_size);
     }
     case rocsparse_operation_conjugate_transpose:
     {
@@ -1888,243 +2264,353 @@ void host_cscmv(rocsparse_operation trans,
                           base,
                           matrix_type,
                           algo,
-                          true);
+                          true,
+                          warp_size);
     }
     }
 }
 
-template <typename I, typename J, typename T>
-static void host_csr_lsolve(J                    M,
-                            T                    alpha,
-                            const I*             csr_row_ptr,
-                            const J*             csr_col_ind,
-                            const T*             csr_val,
-                            const T*             x,
-                            int64_t              x_inc,
-                            T*                   y,
-                            rocsparse_diag_type  diag_type,
-                            rocsparse_index_base base,
-                            J*                   struct_pivot,
-                            J*                   numeric_pivot)
+template <typename I, typename J>
+void host_csrsv_analysis(rocsparse_operation  trans,
+                         J                    M,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         rocsparse_fill_mode  fill_mode,
+                         rocsparse_index_base base,
+                         host_trm_info<J>*    info)
 {
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
+    // Transposed lower (upper) solves are upper (lower) solves on the transposed matrix
+    const bool forward
+        = ((trans == rocsparse_operation_none) == (fill_mode == rocsparse_fill_mode_lower));
 
-    std::vector<T> temp(prop.warpSize);
+    // Level of each row, rows are visited in the order of the solve. In the non-transposed
+    // case, a row pulls the level of the rows it depends on (its columns). In the transposed
+    // case, a row pushes its level to the rows depending on it (its columns).
+    std::vector<J> level(M, 0);
+    J              depth = 0;
 
-    // Process lower triangular part
-    for(J row = 0; row < M; ++row)
+    for(J k = 0; k < M; ++k)
     {
-        temp.assign(prop.warpSize, static_cast<T>(0));
-        temp[0] = alpha * x[x_inc * row];
+        J row = forward ? k : M - 1 - k;
 
-        I diag      = -1;
         I row_begin = csr_row_ptr[row] - base;
         I row_end   = csr_row_ptr[row + 1] - base;
 
-        T diag_val = static_cast<T>(0);
-
-        for(I l = row_begin; l < row_end; l += prop.warpSize)
+        for(I j = row_begin; j < row_end; ++j)
         {
-            for(uint32_t k = 0; k < prop.warpSize; ++k)
-            {
-                I j = l + k;
-
-                // Do not run out of bounds
-                if(j >= row_end)
-                {
-                    break;
-                }
-
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+            J col = csr_col_ind[j] - base;
 
-                if(local_val == static_cast<T>(0) && local_col == row
-                   && diag_type == rocsparse_diag_type_non_unit)
+            if(trans == rocsparse_operation_none)
+            {
+                if(forward ? (col < row) : (col > row))
                 {
-                    // Numerical zero pivot found, avoid division by 0
-                    // and store index for later use.
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = static_cast<T>(1);
+                    level[row] = std::max(level[row], level[col] + 1);
                 }
-
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
+            }
+            else
+            {
+                if(forward ? (col > row) : (col < row))
                 {
-                    break;
+                    level[col] = std::max(level[col], level[row] + 1);
                 }
+            }
+        }
 
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == rocsparse_diag_type_non_unit)
-                    {
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
+        depth = std::max(depth, level[row] + 1);
+    }
 
-                    break;
-                }
+    // Group rows by level
+    info->level_ptr.assign(depth + 1, 0);
+    info->level_ind.resize(M);
 
-                // Lower triangular part
-                temp[k] = std::fma(-local_val, y[local_col], temp[k]);
-            }
-        }
+    for(J row = 0; row < M; ++row)
+    {
+        ++info->level_ptr[level[row] + 1];
+    }
 
-        for(uint32_t j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(uint32_t k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] += temp[k + j];
-            }
-        }
+    for(J i = 0; i < depth; ++i)
+    {
+        info->level_ptr[i + 1] += info->level_ptr[i];
+    }
 
-        if(diag_type == rocsparse_diag_type_non_unit)
-        {
-            if(diag == -1)
-            {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
+    std::vector<J> offset(info->level_ptr.begin(), info->level_ptr.begin() + depth);
 
-            y[row] = temp[0] * diag_val;
-        }
-        else
-        {
-            y[row] = temp[0];
-        }
+    for(J row = 0; row < M; ++row)
+    {
+        info->level_ind[offset[level[row]]++] = row;
     }
 }
 
 template <typename I, typename J, typename T>
-static void host_csr_usolve(J                    M,
-                            T                    alpha,
-                            const I*             csr_row_ptr,
-                            const J*             csr_col_ind,
-                            const T*             csr_val,
-                            const T*             x,
-                            int64_t              x_inc,
-                            T*                   y,
-                            rocsparse_diag_type  diag_type,
-                            rocsparse_index_base base,
-                            J*                   struct_pivot,
-                            J*                   numeric_pivot)
+static void host_csr_lsolve(J                       M,
+                            T                       alpha,
+                            const I*                csr_row_ptr,
+                            const J*                csr_col_ind,
+                            const T*                csr_val,
+                            const T*                x,
+                            int64_t                 x_inc,
+                            T*                      y,
+                            rocsparse_diag_type     diag_type,
+                            rocsparse_index_base    base,
+                            J*                      struct_pivot,
+                            J*                      numeric_pivot,
+                            const host_trm_info<J>& info,
+                            uint32_t                warp_size)
 {
-
-    // Get device properties
-    int             dev;
-    hipDeviceProp_t prop;
-
-    hipGetDevice(&dev);
-    hipGetDeviceProperties(&prop, dev);
-
-    std::vector<T> temp(prop.warpSize);
-
-    // Process upper triangular part
-    for(J row = M - 1; row >= 0; --row)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
+        std::vector<T> temp(warp_size);
 
-        temp.assign(prop.warpSize, static_cast<T>(0));
-        temp[0] = alpha * x[x_inc * row];
+        J local_struct_pivot  = M + 1;
+        J local_numeric_pivot = M + 1;
 
-        I diag      = -1;
-        I row_begin = csr_row_ptr[row] - base;
-        I row_end   = csr_row_ptr[row + 1] - base;
-
-        T diag_val = static_cast<T>(0);
-
-        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
+        // Process lower triangular part level by level, rows of a level are independent
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
         {
-            for(uint32_t k = 0; k < prop.warpSize; ++k)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(J k = info.level_ptr[level - 1]; k < info.level_ptr[level]; ++k)
             {
-                I j = l - k;
+                J row = info.level_ind[k];
 
-                // Do not run out of bounds
-                if(j < row_begin)
-                {
-                    break;
-                }
+                temp.assign(warp_size, static_cast<T>(0));
+                temp[0] = alpha * x[x_inc * row];
 
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+                I diag      = -1;
+                I row_begin = csr_row_ptr[row] - base;
+                I row_end   = csr_row_ptr[row + 1] - base;
 
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
-                {
-                    continue;
-                }
+                T diag_val = static_cast<T>(0);
 
-                // Diagonal entry
-                if(local_col == row)
+                for(I l = row_begin; l < row_end; l += warp_size)
                 {
-                    if(diag_type == rocsparse_diag_type_non_unit)
+                    for(uint32_t k = 0; k < warp_size; ++k)
                     {
-                        // Check for numerical zero
-                        if(local_val == static_cast<T>(0))
+                        I j = l + k;
+
+                        // Do not run out of bounds
+                        if(j >= row_end)
                         {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = static_cast<T>(1);
+                            break;
                         }
 
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
+                        J local_col = csr_col_ind[j] - base;
+                        T local_val = csr_val[j];
 
-                    continue;
-                }
+                        if(local_val == static_cast<T>(0) && local_col == row
+                           && diag_type == rocsparse_diag_type_non_unit)
+                        {
+                            // Numerical zero pivot found, avoid division by 0
+                            // and store index for later use.
+                            local_numeric_pivot = std::min(local_numeric_pivot, row + base);
+                            local_val           = static_cast<T>(1);
+                        }
 
-                // Upper triangular part
-                temp[k] = std::fma(-local_val, y[local_col], temp[k]);
-            }
-        }
+                        // Ignore all entries that are above the diagonal
+                        if(local_col > row)
+                        {
+                            break;
+                        }
 
-        for(uint32_t j = 1; j < prop.warpSize; j <<= 1)
-        {
-            for(uint32_t k = 0; k < prop.warpSize - j; ++k)
-            {
-                temp[k] += temp[k + j];
-            }
+                        // Diagonal entry
+                        if(local_col == row)
+                        {
+                            // If diagonal type is non unit, do division by diagonal entry
+                            // This is not required for unit diagonal for obvious reasons
+                            if(diag_type == rocsparse_diag_type_non_unit)
+                            {
+                                diag     = j;
+                                diag_val = static_cast<T>(1) / local_val;
+                            }
+
+                            break;
+                        }
+
+                        // Lower triangular part
+                        temp[k] = std::fma(-local_val, y[local_col], temp[k]);
+                    }
+                }
+
+                for(uint32_t j = 1; j < warp_size; j <<= 1)
+                {
+                    for(uint32_t k = 0; k < warp_size - j; ++k)
+                    {
+                        temp[k] += temp[k + j];
+                    }
+                }
+
+                if(diag_type == rocsparse_diag_type_non_unit)
+                {
+                    if(diag == -1)
+                    {
+                        local_struct_pivot = std::min(local_struct_pivot, row + base);
+                    }
+
+                    y[row] = temp[0] * diag_val;
+                }
+                else
+                {
+                    y[row] = temp[0];
+                }
+            }
         }
 
-        if(diag_type == rocsparse_diag_type_non_unit)
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
+        }
+    }
+}
+
+template <typename I, typename J, typename T>
+static void host_csr_usolve(J                       M,
+                            T                       alpha,
+                            const I*                csr_row_ptr,
+                            const J*                csr_col_ind,
+                            const T*                csr_val,
+                            const T*                x,
+                            int64_t                 x_inc,
+                            T*                      y,
+                            rocsparse_diag_type     diag_type,
+                            rocsparse_index_base    base,
+                            J*                      struct_pivot,
+                            J*                      numeric_pivot,
+                            const host_trm_info<J>& info,
+                            uint32_t                warp_size)
+{
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<T> temp(warp_size);
+
+        J local_struct_pivot  = M + 1;
+        J local_numeric_pivot = M + 1;
+
+        // Process upper triangular part level by level, rows of a level are independent
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
         {
-            if(diag == -1)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(J k = info.level_ptr[level - 1]; k < info.level_ptr[level]; ++k)
             {
-                *struct_pivot = std::min(*struct_pivot, row + base);
-            }
+                J row = info.level_ind[k];
+
+                temp.assign(warp_size, static_cast<T>(0));
+                temp[0] = alpha * x[x_inc * row];
+
+                I diag      = -1;
+                I row_begin = csr_row_ptr[row] - base;
+                I row_end   = csr_row_ptr[row + 1] - base;
+
+                T diag_val = static_cast<T>(0);
+
+                for(I l = row_end - 1; l >= row_begin; l -= warp_size)
+                {
+                    for(uint32_t k = 0; k < warp_size; ++k)
+                    {
+                        I j = l - k;
+
+                        // Do not run out of bounds
+                        if(j < row_begin)
+                        {
+                            break;
+                        }
+
+                        J local_col = csr_col_ind[j] - base;
+                        T local_val = csr_val[j];
+
+                        // Ignore all entries that are below the diagonal
+                        if(local_col < row)
+                        {
+                            continue;
+                        }
+
+                        // Diagonal entry
+                        if(local_col == row)
+                        {
+                            if(diag_type == rocsparse_diag_type_non_unit)
+                            {
+                                // Check for numerical zero
+                                if(local_val == static_cast<T>(0))
+                                {
+                                    local_numeric_pivot
+                                        = std::min(local_numeric_pivot, row + base);
+                                    local_val = static_cast<T>(1);
+                                }
+
+                                diag     = j;
+                                diag_val = static_cast<T>(1) / local_val;
+                            }
+
+                            continue;
+                        }
+
+                        // Upper triangular part
+                        temp[k] = std::fma(-local_val, y[local_col], temp[k]);
+                    }
+                }
+
+                for(uint32_t j = 1; j < warp_size; j <<= 1)
+                {
+                    for(uint32_t k = 0; k < warp_size - j; ++k)
+                    {
+                        temp[k] += temp[k + j];
+                    }
+                }
+
+                if(diag_type == rocsparse_diag_type_non_unit)
+                {
+                    if(diag == -1)
+                    {
+                        local_struct_pivot = std::min(local_struct_pivot, row + base);
+                    }
 
-            y[row] = temp[0] * diag_val;
+                    y[row] = temp[0] * diag_val;
+                }
+                else
+                {
+                    y[row] = temp[0];
+                }
+            }
         }
-        else
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
         {
-            y[row] = temp[0];
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
         }
     }
 }
 
 template <typename I, typename J, typename T>
-void host_csrsv(rocsparse_operation  trans,
-                J                    M,
-                I                    nnz,
-                T                    alpha,
-                const I*             csr_row_ptr,
-                const J*             csr_col_ind,
-                const T*             csr_val,
-                const T*             x,
-                int64_t              x_inc,
-                T*                   y,
-                rocsparse_diag_type  diag_type,
-                rocsparse_fill_mode  fill_mode,
-                rocsparse_index_base base,
-                J*                   struct_pivot,
-                J*                   numeric_pivot)
+void host_csrsv(rocsparse_operation     trans,
+                J                       M,
+                I                       nnz,
+                T                       alpha,
+                const I*                csr_row_ptr,
+                const J*                csr_col_ind,
+                const T*                csr_val,
+                const T*                x,
+                int64_t                 x_inc,
+                T*                      y,
+                rocsparse_diag_type     diag_type,
+                rocsparse_fill_mode     fill_mode,
+                rocsparse_index_base    base,
+                J*                      struct_pivot,
+                J*                      numeric_pivot,
+                const host_trm_info<J>& info,
+                uint32_t                warp_size)
 {
-
     // Initialize pivot
     *struct_pivot  = M + 1;
     *numeric_pivot = M + 1;
@@ -2144,7 +2630,9 @@ void host_csrsv(rocsparse_operation  trans,
                             diag_type,
                             base,
                             struct_pivot,
-                            numeric_pivot);
+                            numeric_pivot,
+                            info,
+                            warp_size);
         }
         else
         {
@@ -2159,7 +2647,9 @@ void host_csrsv(rocsparse_operation  trans,
                             diag_type,
                             base,
                             struct_pivot,
-                            numeric_pivot);
+                            numeric_pivot,
+                            info,
+                            warp_size);
         }
     }
     else if(trans == rocsparse_operation_transpose
@@ -2203,7 +2693,9 @@ void host_csrsv(rocsparse_operation  trans,
                             diag_type,
                             base,
                             struct_pivot,
-                            numeric_pivot);
+                            numeric_pivot,
+                            info,
+                            warp_size);
         }
         else
         {
@@ -2218,7 +2710,9 @@ void host_csrsv(rocsparse_operation  trans,
                             diag_type,
                             base,
                             struct_pivot,
-                            numeric_pivot);
+                            numeric_pivot,
+                            info,
+                            warp_size);
         }
     }
 
@@ -2228,6 +2722,46 @@ void host_csrsv(rocsparse_operation  trans,
     *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
+template <typename I, typename J, typename T>
+void host_csrsv(rocsparse_operation  trans,
+                J                    M,
+                I                    nnz,
+                T                    alpha,
+                const I*             csr_row_ptr,
+                const J*             csr_col_ind,
+                const T*             csr_val,
+                const T*             x,
+                int64_t              x_inc,
+                T*                   y,
+                rocsparse_diag_type  diag_type,
+                rocsparse_fill_mode  fill_mode,
+                rocsparse_index_base base,
+                J*                   struct_pivot,
+                J*                   numeric_pivot,
+                uint32_t             warp_size)
+{
+    host_trm_info<J> info;
+    host_csrsv_analysis(trans, M, csr_row_ptr, csr_col_ind, fill_mode, base, &info);
+
+    host_csrsv(trans,
+               M,
+               nnz,
+               alpha,
+               csr_row_ptr,
+               csr_col_ind,
+               csr_val,
+               x,
+               x_inc,
+               y,
+               diag_type,
+               fill_mode,
+               base,
+               struct_pivot,
+               numeric_pivot,
+               info,
+               warp_size);
+}
+
 template <typename I, typename T>
 void host_coosv(rocsparse_operation  trans,
                 I                    M,
@@ -2242,7 +2776,8 @@ void host_coosv(rocsparse_operation  trans,
                 rocsparse_fill_mode  fill_mode,
                 rocsparse_index_base base,
                 I*                   struct_pivot,
-                I*                   numeric_pivot)
+                I*                   numeric_pivot,
+                uint32_t             warp_size)
 {
     if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
     {
@@ -2264,7 +2799,8 @@ void host_coosv(rocsparse_operation  trans,
                                fill_mode,
                                base,
                                struct_pivot,
-                               numeric_pivot);
+                               numeric_pivot,
+                               warp_size);
     }
     else
     {
@@ -2286,7 +2822,8 @@ void host_coosv(rocsparse_operation  trans,
                    fill_mode,
                    base,
                    struct_pivot,
-                   numeric_pivot);
+                   numeric_pivot,
+                   warp_size);
     }
 }
 
@@ -2429,29 +2966,101 @@ void host_hybmv(rocsparse_operation  trans,
  *    level 3 SPARSE
  * ===========================================================================
  */
-template <typename T>
-void host_bsrmm(rocsparse_handle          handle,
-                rocsparse_direction       dir,
-                rocsparse_operation       transA,
-                rocsparse_operation       transB,
-                rocsparse_int             Mb,
-                rocsparse_int             N,
-                rocsparse_int             Kb,
-                rocsparse_int             nnzb,
-                const T*                  alpha,
-                const rocsparse_mat_descr descr,
-                const T*                  bsr_val_A,
-                const rocsparse_int*      bsr_row_ptr_A,
-                const rocsparse_int*      bsr_col_ind_A,
-                rocsparse_int             block_dim,
-                const T*                  B,
-                int64_t                   ldb,
-                const T*                  beta,
-                T*                        C,
-                int64_t                   ldc)
+// bsrmm with compile time block dimension. All rows of a block row are accumulated at
+// once, such that each entry of B is loaded once per block.
+template <rocsparse_direction DIR, uint32_t BLOCK_DIM, typename T>
+static void host_bsrmm_block_dim(rocsparse_operation  transB,
+                                 rocsparse_int        Mb,
+                                 rocsparse_int        N,
+                                 T                    alpha,
+                                 rocsparse_index_base base,
+                                 const T*             bsr_val_A,
+                                 const rocsparse_int* bsr_row_ptr_A,
+                                 const rocsparse_int* bsr_col_ind_A,
+                                 const T*             B,
+                                 int64_t              ldb,
+                                 T                    beta,
+                                 T*                   C,
+                                 int64_t              ldc)
 {
-    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
+    const rocsparse_int block_dim = BLOCK_DIM;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for(rocsparse_int row = 0; row < Mb; row++)
+    {
+        rocsparse_int row_begin = bsr_row_ptr_A[row] - base;
+        rocsparse_int row_end   = bsr_row_ptr_A[row + 1] - base;
+
+        for(rocsparse_int j = 0; j < N; j++)
+        {
+            T sum[BLOCK_DIM];
+
+            for(uint32_t bi = 0; bi < BLOCK_DIM; ++bi)
+            {
+                sum[bi] = static_cast<T>(0);
+            }
+
+            for(rocsparse_int s = row_begin; s < row_end; s++)
+            {
+                const T* block = bsr_val_A + block_dim * block_dim * s;
+                int64_t  col   = block_dim * (bsr_col_ind_A[s] - base);
 
+                for(rocsparse_int t = 0; t < block_dim; t++)
+                {
+                    int64_t idx_B = (transB == rocsparse_operation_none) ? j * ldb + col + t
+                                                                         : (col + t) * ldb + j;
+
+                    T val_B = B[idx_B];
+
+                    for(rocsparse_int bi = 0; bi < block_dim; bi++)
+                    {
+                        T val_A = (DIR == rocsparse_direction_row) ? block[block_dim * bi + t]
+                                                                   : block[block_dim * t + bi];
+
+                        sum[bi] = std::fma(val_A, val_B, sum[bi]);
+                    }
+                }
+            }
+
+            for(rocsparse_int bi = 0; bi < block_dim; bi++)
+            {
+                int64_t idx_C = block_dim * row + bi + j * ldc;
+
+                if(beta == static_cast<T>(0))
+                {
+                    C[idx_C] = alpha * sum[bi];
+                }
+                else
+                {
+                    C[idx_C] = std::fma(beta, C[idx_C], alpha * sum[bi]);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_bsrmm(rocsparse_direction  dir,
+                rocsparse_operation  transA,
+                rocsparse_operation  transB,
+                rocsparse_int        Mb,
+                rocsparse_int        N,
+                rocsparse_int        Kb,
+                rocsparse_int        nnzb,
+                const T*             alpha,
+                rocsparse_index_base base,
+                const T*             bsr_val_A,
+                const rocsparse_int* bsr_row_ptr_A,
+                const rocsparse_int* bsr_col_ind_A,
+                rocsparse_int        block_dim,
+                const T*             B,
+                int64_t              ldb,
+                const T*             beta,
+                T*                   C,
+                int64_t              ldc)
+{
     if(transA != rocsparse_operation_none)
     {
         return;
@@ -2462,6 +3071,25 @@ void host_bsrmm(rocsparse_handle          handle,
         return;
     }
 
+    if(host_bsr_block_dim_dispatch(dir, block_dim, [&](auto DIR, auto BLOCK_DIM) {
+           host_bsrmm_block_dim<decltype(DIR)::value, decltype(BLOCK_DIM)::value>(transB,
+                                                                                  Mb,
+                                                                                  N,
+                                                                                  *alpha,
+                                                                                  base,
+                                                                                  bsr_val_A,
+                                                                                  bsr_row_ptr_A,
+                                                                                  bsr_col_ind_A,
+                                                                                  B,
+                                                                                  ldb,
+                                                                                  *beta,
+                                                                                  C,
+                                                                                  ldc);
+       }))
+    {
+        return;
+    }
+
     rocsparse_int M = Mb * block_dim;
 
 #ifdef _OPENMP
@@ -2508,26 +3136,25 @@ void host_bsrmm(rocsparse_handle          handle,
 }
 
 template <typename T>
-void host_gebsrmm(rocsparse_handle          handle,
-                  rocsparse_direction       dir,
-                  rocsparse_operation       transA,
-                  rocsparse_operation       transB,
-                  rocsparse_int             Mb,
-                  rocsparse_int             N,
-                  rocsparse_int             Kb,
-                  rocsparse_int             nnzb,
-                  const T*                  alpha,
-                  const rocsparse_mat_descr descr,
-                  const T*                  bsr_val_A,
-                  const rocsparse_int*      bsr_row_ptr_A,
-                  const rocsparse_int*      bsr_col_ind_A,
-                  rocsparse_int             row_block_dim,
-                  rocsparse_int             col_block_dim,
-                  const T*                  B,
-                  int64_t                   ldb,
-                  const T*                  beta,
-                  T*                        C,
-                  int64_t                   ldc)
+void host_gebsrmm(rocsparse_direction  dir,
+                  rocsparse_operation  transA,
+                  rocsparse_operation  transB,
+                  rocsparse_int        Mb,
+                  rocsparse_int        N,
+                  rocsparse_int        Kb,
+                  rocsparse_int        nnzb,
+                  const T*             alpha,
+                  rocsparse_index_base base,
+                  const T*             bsr_val_A,
+                  const rocsparse_int* bsr_row_ptr_A,
+                  const rocsparse_int* bsr_col_ind_A,
+                  rocsparse_int        row_block_dim,
+                  rocsparse_int        col_block_dim,
+                  const T*             B,
+                  int64_t              ldb,
+                  const T*             beta,
+                  T*                   C,
+                  int64_t              ldc)
 {
     if(transA != rocsparse_operation_none)
     {
@@ -2538,7 +3165,6 @@ void host_gebsrmm(rocsparse_handle          handle,
     {
         return;
     }
-    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
 
     rocsparse_int M = Mb * row_block_dim;
 
@@ -2594,6 +3220,78 @@ void host_gebsrmm(rocsparse_handle          handle,
     }
 }
 
+// Number of columns of B and C processed at once by the host SpMM kernels. The partial
+// results of such a column panel are kept in registers.
+static constexpr int64_t host_spmm_panel_width = 16;
+
+// Panel width used when column panels are distributed over the threads, narrow enough to
+// give every thread at least one panel
+static int64_t host_spmm_parallel_panel_width(int64_t N)
+{
+#ifdef _OPENMP
+    int64_t nthreads = omp_get_max_threads();
+#else
+    int64_t nthreads = 1;
+#endif
+    return std::max(static_cast<int64_t>(1),
+                    std::min(host_spmm_panel_width, (N - 1) / nthreads + 1));
+}
+
+// Compute a single row of a column panel C(i, j:j+nb) = alpha * op(A)(i, :) * op(B)(:, j:j+nb)
+// + beta * C(i, j:j+nb). dense_B and dense_C point to the first column of the panel.
+template <typename T, typename I, typename J, typename A, typename B, typename C>
+static void host_csrmm_row_panel(I                    row_begin,
+                                 I                    row_end,
+                                 const J*             csr_col_ind_A,
+                                 const A*             csr_val_A,
+                                 bool                 conj_A,
+                                 const B*             dense_B,
+                                 int64_t              ldb_k,
+                                 int64_t              ldb_j,
+                                 bool                 conj_B,
+                                 T                    alpha,
+                                 T                    beta,
+                                 C*                   dense_C,
+                                 int64_t              ldc_j,
+                                 int64_t              nb,
+                                 rocsparse_index_base base)
+{
+    T sum[host_spmm_panel_width];
+
+    for(int64_t jj = 0; jj < nb; ++jj)
+    {
+        sum[jj] = static_cast<T>(0);
+    }
+
+    for(I k = row_begin; k < row_end; ++k)
+    {
+        const A  val_A = conj_val(csr_val_A[k], conj_A);
+        const B* row_B = dense_B + (csr_col_ind_A[k] - base) * ldb_k;
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int64_t jj = 0; jj < nb; ++jj)
+        {
+            sum[jj] = std::fma(val_A, conj_val(row_B[jj * ldb_j], conj_B), sum[jj]);
+        }
+    }
+
+    for(int64_t jj = 0; jj < nb; ++jj)
+    {
+        int64_t idx_C = jj * ldc_j;
+
+        if(beta == static_cast<T>(0))
+        {
+            dense_C[idx_C] = alpha * sum[jj];
+        }
+        else
+        {
+            dense_C[idx_C] = std::fma(beta, dense_C[idx_C], alpha * sum[jj]);
+        }
+    }
+}
+
 template <typename T, typename I, typename J, typename A, typename B, typename C>
 void host_csrmm(J                    M,
                 J                    N,
@@ -2617,96 +3315,95 @@ void host_csrmm(J                    M,
     bool conj_A = (transA == rocsparse_operation_conjugate_transpose || force_conj_A);
     bool conj_B = (transB == rocsparse_operation_conjugate_transpose);
 
+    // Strides of op(B) along its rows (k) and columns (j), and of C along its rows (i) and
+    // columns (j)
+    const bool B_col_major
+        = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
+          || (transB != rocsparse_operation_none && order_B == rocsparse_order_row);
+
+    const int64_t ldb_k = B_col_major ? 1 : ldb;
+    const int64_t ldb_j = B_col_major ? ldb : 1;
+    const int64_t ldc_i = (order_C == rocsparse_order_column) ? 1 : ldc;
+    const int64_t ldc_j = (order_C == rocsparse_order_column) ? ldc : 1;
+
     if(transA == rocsparse_operation_none)
     {
+        // Sweep C panel by panel, such that the current panel of B stays in cache while
+        // all rows of A are processed
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-        for(J i = 0; i < M; i++)
+        for(int64_t j = 0; j < N; j += host_spmm_panel_width)
         {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
+            int64_t nb = std::min(host_spmm_panel_width, N - j);
 
-            for(J j = 0; j < N; ++j)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024) nowait
+#endif
+            for(J i = 0; i < M; i++)
             {
-                T sum = static_cast<T>(0);
+                host_csrmm_row_panel(csr_row_ptr_A[i] - base,
+                                     csr_row_ptr_A[i + 1] - base,
+                                     csr_col_ind_A,
+                                     csr_val_A,
+                                     conj_A,
+                                     dense_B + j * ldb_j,
+                                     ldb_k,
+                                     ldb_j,
+                                     conj_B,
+                                     alpha,
+                                     beta,
+                                     dense_C + i * ldc_i + j * ldc_j,
+                                     ldc_j,
+                                     nb,
+                                     base);
+            }
+        }
+    }
+    else
+    {
+        // Rows of A scatter into rows of C, each thread owns a set of column panels of C
+        int64_t panel = host_spmm_parallel_panel_width(N);
 
-                for(I k = row_begin; k < row_end; ++k)
-                {
-                    int64_t idx_B = 0;
-                    if((transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                       || (transB == rocsparse_operation_transpose
-                           && order_B == rocsparse_order_row)
-                       || (transB == rocsparse_operation_conjugate_transpose
-                           && order_B == rocsparse_order_row))
-                    {
-                        idx_B = (csr_col_ind_A[k] - base + j * ldb);
-                    }
-                    else
-                    {
-                        idx_B = (j + (csr_col_ind_A[k] - base) * ldb);
-                    }
-
-                    sum = std::fma(
-                        conj_val(csr_val_A[k], conj_A), conj_val(dense_B[idx_B], conj_B), sum);
-                }
-
-                int64_t idx_C = (order_C == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t j = 0; j < N; j += panel)
+        {
+            int64_t nb = std::min(panel, N - j);
 
-                if(beta == static_cast<T>(0))
-                {
-                    dense_C[idx_C] = alpha * sum;
-                }
-                else
+            // scale C by beta
+            for(J i = 0; i < K; i++)
+            {
+                for(int64_t jj = 0; jj < nb; ++jj)
                 {
-                    dense_C[idx_C] = std::fma(beta, dense_C[idx_C], alpha * sum);
+                    int64_t idx_C  = i * ldc_i + (j + jj) * ldc_j;
+                    dense_C[idx_C] = beta * dense_C[idx_C];
                 }
             }
-        }
-    }
-    else
-    {
-        // scale C by beta
-        for(J i = 0; i < K; i++)
-        {
-            for(J j = 0; j < N; ++j)
+
+            for(J i = 0; i < M; i++)
             {
-                int64_t idx_C  = (order_C == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
-                dense_C[idx_C] = beta * dense_C[idx_C];
-            }
-        }
+                I row_begin = csr_row_ptr_A[i] - base;
+                I row_end   = csr_row_ptr_A[i + 1] - base;
 
-        for(J i = 0; i < M; i++)
-        {
-            I row_begin = csr_row_ptr_A[i] - base;
-            I row_end   = csr_row_ptr_A[i + 1] - base;
+                const B* row_B = dense_B + i * ldb_k + j * ldb_j;
 
-            for(J j = 0; j < N; ++j)
-            {
                 for(I k = row_begin; k < row_end; ++k)
                 {
                     J col = csr_col_ind_A[k] - base;
                     T val = conj_val(csr_val_A[k], conj_A);
 
-                    int64_t idx_B = 0;
+                    T  alpha_val = alpha * val;
+                    C* row_C     = dense_C + col * ldc_i + j * ldc_j;
 
-                    if((transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                       || (transB == rocsparse_operation_transpose
-                           && order_B == rocsparse_order_row)
-                       || (transB == rocsparse_operation_conjugate_transpose
-                           && order_B == rocsparse_order_row))
-                    {
-                        idx_B = (i + j * ldb);
-                    }
-                    else
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for(int64_t jj = 0; jj < nb; ++jj)
                     {
-                        idx_B = (j + i * ldb);
+                        row_C[jj * ldc_j] += alpha_val * conj_val(row_B[jj * ldb_j], conj_B);
                     }
-
-                    int64_t idx_C
-                        = (order_C == rocsparse_order_column) ? col + j * ldc : col * ldc + j;
-
-                    dense_C[idx_C] += alpha * val * conj_val(dense_B[idx_B], conj_B);
                 }
             }
         }
@@ -2749,31 +3446,12 @@ void host_csrmm_batched(J                    M,
         return;
     }
 
-    if(Ci_A_Bi)
-    {
-        for(J i = 0; i < batch_count_C; i++)
-        {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A,
-                       csr_col_ind_A,
-                       csr_val_A,
-                       dense_B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       dense_C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
-        }
-    }
-    else if(Ci_Ai_B)
+    // A batch stride of zero selects the shared operand
+    const int64_t offsets_stride_A = Ci_A_Bi ? 0 : offsets_batch_stride_A;
+    const int64_t values_stride_A  = Ci_A_Bi ? 0 : columns_values_batch_stride_A;
+    const int64_t stride_B         = (Ci_Ai_B && !Ci_A_Bi) ? 0 : batch_stride_B;
+
+    if(transA != rocsparse_operation_none)
     {
         for(J i = 0; i < batch_count_C; i++)
         {
@@ -2783,10 +3461,10 @@ void host_csrmm_batched(J                    M,
                        transA,
                        transB,
                        alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       dense_B,
+                       csr_row_ptr_A + offsets_stride_A * i,
+                       csr_col_ind_A + values_stride_A * i,
+                       csr_val_A + values_stride_A * i,
+                       dense_B + stride_B * i,
                        ldb,
                        order_B,
                        beta,
@@ -2796,29 +3474,56 @@ void host_csrmm_batched(J                    M,
                        base,
                        force_conj_A);
         }
+
+        return;
     }
-    else if(Ci_Ai_Bi)
+
+    bool conj_A = (transA == rocsparse_operation_conjugate_transpose || force_conj_A);
+    bool conj_B = (transB == rocsparse_operation_conjugate_transpose);
+
+    const bool B_col_major
+        = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
+          || (transB != rocsparse_operation_none && order_B == rocsparse_order_row);
+
+    const int64_t ldb_k = B_col_major ? 1 : ldb;
+    const int64_t ldb_j = B_col_major ? ldb : 1;
+    const int64_t ldc_i = (order_C == rocsparse_order_column) ? 1 : ldc;
+    const int64_t ldc_j = (order_C == rocsparse_order_column) ? ldc : 1;
+
+    // The batch loop is innermost, such that the shared operand, either the sparse row of A
+    // or the panel of B, is reused from cache across the batches
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    for(int64_t j = 0; j < N; j += host_spmm_panel_width)
     {
-        for(J i = 0; i < batch_count_C; i++)
+        int64_t nb = std::min(host_spmm_panel_width, N - j);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 256) nowait
+#endif
+        for(J i = 0; i < M; i++)
         {
-            host_csrmm(M,
-                       N,
-                       K,
-                       transA,
-                       transB,
-                       alpha,
-                       csr_row_ptr_A + offsets_batch_stride_A * i,
-                       csr_col_ind_A + columns_values_batch_stride_A * i,
-                       csr_val_A + columns_values_batch_stride_A * i,
-                       dense_B + batch_stride_B * i,
-                       ldb,
-                       order_B,
-                       beta,
-                       dense_C + batch_stride_C * i,
-                       ldc,
-                       order_C,
-                       base,
-                       force_conj_A);
+            for(J b = 0; b < batch_count_C; b++)
+            {
+                const I* row_ptr_A = csr_row_ptr_A + offsets_stride_A * b;
+
+                host_csrmm_row_panel(row_ptr_A[i] - base,
+                                     row_ptr_A[i + 1] - base,
+                                     csr_col_ind_A + values_stride_A * b,
+                                     csr_val_A + values_stride_A * b,
+                                     conj_A,
+                                     dense_B + stride_B * b + j * ldb_j,
+                                     ldb_k,
+                                     ldb_j,
+                                     conj_B,
+                                     alpha,
+                                     beta,
+                                     dense_C + batch_stride_C * b + i * ldc_i + j * ldc_j,
+                                     ldc_j,
+                                     nb,
+                                     base);
+            }
         }
     }
 }
@@ -2846,87 +3551,54 @@ void host_coomm(I                    M,
     bool conj_A = (transA == rocsparse_operation_conjugate_transpose);
     bool conj_B = (transB == rocsparse_operation_conjugate_transpose);
 
-    if(transA == rocsparse_operation_none)
-    {
-        for(I j = 0; j < N; j++)
-        {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-            for(I i = 0; i < M; ++i)
-            {
-                int64_t idx_C = (order_C == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
-                dense_C[idx_C] *= beta;
-            }
-        }
+    // For op(A) = A^T the roles of the row and column indices are swapped
+    const bool trans_A = (transA != rocsparse_operation_none);
+    const I    rows_C  = trans_A ? K : M;
+    const I*   ind_C   = trans_A ? coo_col_ind_A : coo_row_ind_A;
+    const I*   ind_B   = trans_A ? coo_row_ind_A : coo_col_ind_A;
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I j = 0; j < N; j++)
-        {
-            for(int64_t i = 0; i < nnz; ++i)
-            {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = alpha * coo_val_A[i];
+    const bool B_col_major
+        = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
+          || (transB != rocsparse_operation_none && order_B != rocsparse_order_column);
 
-                int64_t idx_C = (order_C == rocsparse_order_column) ? row + j * ldc : row * ldc + j;
+    const int64_t ldb_k = B_col_major ? 1 : ldb;
+    const int64_t ldb_j = B_col_major ? ldb : 1;
+    const int64_t ldc_i = (order_C == rocsparse_order_column) ? 1 : ldc;
+    const int64_t ldc_j = (order_C == rocsparse_order_column) ? ldc : 1;
 
-                int64_t idx_B = 0;
-                if((transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                   || (transB != rocsparse_operation_none && order_B != rocsparse_order_column))
-                {
-                    idx_B = (col + j * ldb);
-                }
-                else
-                {
-                    idx_B = (j + col * ldb);
-                }
+    // Each thread owns a set of column panels of C, the entries of A are streamed once
+    // per panel
+    int64_t panel = host_spmm_parallel_panel_width(N);
 
-                dense_C[idx_C] = std::fma(val, conj_val(dense_B[idx_B], conj_B), dense_C[idx_C]);
-            }
-        }
-    }
-    else
-    {
-        for(I j = 0; j < N; j++)
-        {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(dynamic, 1)
 #endif
-            for(I i = 0; i < K; ++i)
+    for(int64_t j = 0; j < N; j += panel)
+    {
+        int64_t nb = std::min(panel, N - j);
+
+        for(I i = 0; i < rows_C; ++i)
+        {
+            for(int64_t jj = 0; jj < nb; ++jj)
             {
-                int64_t idx_C = (order_C == rocsparse_order_column) ? i + j * ldc : i * ldc + j;
-                dense_C[idx_C] *= beta;
+                dense_C[i * ldc_i + (j + jj) * ldc_j] *= beta;
             }
         }
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(I j = 0; j < N; j++)
+        for(int64_t i = 0; i < nnz; ++i)
         {
-            for(int64_t i = 0; i < nnz; ++i)
-            {
-                I row = coo_row_ind_A[i] - base;
-                I col = coo_col_ind_A[i] - base;
-                T val = alpha * conj_val(coo_val_A[i], conj_A);
+            T val = alpha * conj_val(coo_val_A[i], conj_A);
 
-                int64_t idx_C = (order_C == rocsparse_order_column) ? col + j * ldc : col * ldc + j;
-
-                int64_t idx_B = 0;
-                if((transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                   || (transB != rocsparse_operation_none && order_B != rocsparse_order_column))
-                {
-                    idx_B = (row + j * ldb);
-                }
-                else
-                {
-                    idx_B = (j + row * ldb);
-                }
+            const B* row_B = dense_B + (ind_B[i] - base) * ldb_k + j * ldb_j;
+            C*       row_C = dense_C + (ind_C[i] - base) * ldc_i + j * ldc_j;
 
-                dense_C[idx_C] = std::fma(val, conj_val(dense_B[idx_B], conj_B), dense_C[idx_C]);
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(int64_t jj = 0; jj < nb; ++jj)
+            {
+                row_C[jj * ldc_j]
+                    = std::fma(val, conj_val(row_B[jj * ldb_j], conj_B), row_C[jj * ldc_j]);
             }
         }
     }
@@ -3244,229 +3916,269 @@ void host_cscmm_batched(J                    M,
 }
 
 template <typename I, typename J, typename T>
-static inline void host_lssolve(J                    M,
-                                J                    nrhs,
-                                rocsparse_operation  transB,
-                                T                    alpha,
-                                const I*             csr_row_ptr,
-                                const J*             csr_col_ind,
-                                const T*             csr_val,
-                                T*                   B,
-                                int64_t              ldb,
-                                rocsparse_order      order_B,
-                                rocsparse_diag_type  diag_type,
-                                rocsparse_index_base base,
-                                J*                   struct_pivot,
-                                J*                   numeric_pivot)
+static inline void host_lssolve(J                       M,
+                                J                       nrhs,
+                                rocsparse_operation     transB,
+                                T                       alpha,
+                                const I*                csr_row_ptr,
+                                const J*                csr_col_ind,
+                                const T*                csr_val,
+                                T*                      B,
+                                int64_t                 ldb,
+                                rocsparse_order         order_B,
+                                rocsparse_diag_type     diag_type,
+                                rocsparse_index_base    base,
+                                J*                      struct_pivot,
+                                J*                      numeric_pivot,
+                                const host_trm_info<J>& info)
 {
+    const bool B_col_major
+        = (transB == rocsparse_operation_none && order_B == rocsparse_order_column);
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-    for(J i = 0; i < nrhs; ++i)
     {
-        // Process lower triangular part
-        for(J row = 0; row < M; ++row)
-        {
-            int64_t idx_B
-                = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                      ? i * ldb + row
-                      : row * ldb + i;
+        J local_struct_pivot  = M + 1;
+        J local_numeric_pivot = M + 1;
 
-            T sum = static_cast<T>(0);
-            if(transB == rocsparse_operation_conjugate_transpose)
-            {
-                sum = alpha * rocsparse_conj(B[idx_B]);
-            }
-            else
+        // Process lower triangular part level by level, rows of a level are independent
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for(J k = info.level_ptr[level - 1]; k < info.level_ptr[level]; ++k)
             {
-                sum = alpha * B[idx_B];
-            }
+                J row = info.level_ind[k];
 
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = static_cast<T>(0);
+                for(J i = 0; i < nrhs; ++i)
+                {
+                    int64_t idx_B = B_col_major ? i * ldb + row : row * ldb + i;
 
-            for(I j = row_begin; j < row_end; ++j)
-            {
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+                    T sum = static_cast<T>(0);
+                    if(transB == rocsparse_operation_conjugate_transpose)
+                    {
+                        sum = alpha * rocsparse_conj(B[idx_B]);
+                    }
+                    else
+                    {
+                        sum = alpha * B[idx_B];
+                    }
 
-                if(local_val == static_cast<T>(0) && local_col == row
-                   && diag_type == rocsparse_diag_type_non_unit)
-                {
-                    // Numerical zero pivot found, avoid division by 0 and store
-                    // index for later use
-                    *numeric_pivot = std::min(*numeric_pivot, row + base);
-                    local_val      = static_cast<T>(1);
-                }
+                    I diag      = -1;
+                    I row_begin = csr_row_ptr[row] - base;
+                    I row_end   = csr_row_ptr[row + 1] - base;
 
-                // Ignore all entries that are above the diagonal
-                if(local_col > row)
-                {
-                    break;
-                }
+                    T diag_val = static_cast<T>(0);
 
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    // If diagonal type is non unit, do division by diagonal entry
-                    // This is not required for unit diagonal for obvious reasons
-                    if(diag_type == rocsparse_diag_type_non_unit)
+                    for(I j = row_begin; j < row_end; ++j)
                     {
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
-                    }
+                        J local_col = csr_col_ind[j] - base;
+                        T local_val = csr_val[j];
 
-                    break;
-                }
+                        if(local_val == static_cast<T>(0) && local_col == row
+                           && diag_type == rocsparse_diag_type_non_unit)
+                        {
+                            // Numerical zero pivot found, avoid division by 0 and store
+                            // index for later use
+                            local_numeric_pivot = std::min(local_numeric_pivot, row + base);
+                            local_val           = static_cast<T>(1);
+                        }
 
-                // Lower triangular part
-                int64_t idx
-                    = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                          ? i * ldb + local_col
-                          : local_col * ldb + i;
+                        // Ignore all entries that are above the diagonal
+                        if(local_col > row)
+                        {
+                            break;
+                        }
 
-                sum = std::fma(-local_val, B[idx], sum);
-            }
+                        // Diagonal entry
+                        if(local_col == row)
+                        {
+                            // If diagonal type is non unit, do division by diagonal entry
+                            // This is not required for unit diagonal for obvious reasons
+                            if(diag_type == rocsparse_diag_type_non_unit)
+                            {
+                                diag     = j;
+                                diag_val = static_cast<T>(1) / local_val;
+                            }
 
-            if(diag_type == rocsparse_diag_type_non_unit)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
+                            break;
+                        }
 
-                B[idx_B] = sum * diag_val;
-            }
-            else
-            {
-                B[idx_B] = sum;
+                        // Lower triangular part
+                        int64_t idx = B_col_major ? i * ldb + local_col : local_col * ldb + i;
+
+                        sum = std::fma(-local_val, B[idx], sum);
+                    }
+
+                    if(diag_type == rocsparse_diag_type_non_unit)
+                    {
+                        if(diag == -1)
+                        {
+                            local_struct_pivot = std::min(local_struct_pivot, row + base);
+                        }
+
+                        B[idx_B] = sum * diag_val;
+                    }
+                    else
+                    {
+                        B[idx_B] = sum;
+                    }
+                }
             }
         }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
+        }
     }
 }
 
 template <typename I, typename J, typename T>
-static inline void host_ussolve(J                    M,
-                                J                    nrhs,
-                                rocsparse_operation  transB,
-                                T                    alpha,
-                                const I*             csr_row_ptr,
-                                const J*             csr_col_ind,
-                                const T*             csr_val,
-                                T*                   B,
-                                int64_t              ldb,
-                                rocsparse_order      order_B,
-                                rocsparse_diag_type  diag_type,
-                                rocsparse_index_base base,
-                                J*                   struct_pivot,
-                                J*                   numeric_pivot)
+static inline void host_ussolve(J                       M,
+                                J                       nrhs,
+                                rocsparse_operation     transB,
+                                T                       alpha,
+                                const I*                csr_row_ptr,
+                                const J*                csr_col_ind,
+                                const T*                csr_val,
+                                T*                      B,
+                                int64_t                 ldb,
+                                rocsparse_order         order_B,
+                                rocsparse_diag_type     diag_type,
+                                rocsparse_index_base    base,
+                                J*                      struct_pivot,
+                                J*                      numeric_pivot,
+                                const host_trm_info<J>& info)
 {
+    const bool B_col_major
+        = (transB == rocsparse_operation_none && order_B == rocsparse_order_column);
+
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-    for(J i = 0; i < nrhs; ++i)
     {
-        // Process upper triangular part
-        for(J row = M - 1; row >= 0; --row)
-        {
-            int64_t idx_B
-                = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                      ? i * ldb + row
-                      : row * ldb + i;
-
-            T sum = static_cast<T>(0);
-            if(transB == rocsparse_operation_conjugate_transpose)
-            {
-                sum = alpha * rocsparse_conj(B[idx_B]);
-            }
-            else
-            {
-                sum = alpha * B[idx_B];
-            }
-
-            I diag      = -1;
-            I row_begin = csr_row_ptr[row] - base;
-            I row_end   = csr_row_ptr[row + 1] - base;
-
-            T diag_val = static_cast<T>(0);
+        J local_struct_pivot  = M + 1;
+        J local_numeric_pivot = M + 1;
 
-            for(I j = row_end - 1; j >= row_begin; --j)
+        // Process upper triangular part level by level, rows of a level are independent
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for(J k = info.level_ptr[level - 1]; k < info.level_ptr[level]; ++k)
             {
-                J local_col = csr_col_ind[j] - base;
-                T local_val = csr_val[j];
+                J row = info.level_ind[k];
 
-                // Ignore all entries that are below the diagonal
-                if(local_col < row)
+                for(J i = 0; i < nrhs; ++i)
                 {
-                    continue;
-                }
+                    int64_t idx_B = B_col_major ? i * ldb + row : row * ldb + i;
 
-                // Diagonal entry
-                if(local_col == row)
-                {
-                    if(diag_type == rocsparse_diag_type_non_unit)
+                    T sum = static_cast<T>(0);
+                    if(transB == rocsparse_operation_conjugate_transpose)
                     {
-                        // Check for numerical zero
-                        if(local_val == static_cast<T>(0))
-                        {
-                            *numeric_pivot = std::min(*numeric_pivot, row + base);
-                            local_val      = static_cast<T>(1);
-                        }
-
-                        diag     = j;
-                        diag_val = static_cast<T>(1) / local_val;
+                        sum = alpha * rocsparse_conj(B[idx_B]);
+                    }
+                    else
+                    {
+                        sum = alpha * B[idx_B];
                     }
 
-                    continue;
-                }
-
-                // Upper triangular part
-                int64_t idx
-                    = (transB == rocsparse_operation_none && order_B == rocsparse_order_column)
-                          ? i * ldb + local_col
-                          : local_col * ldb + i;
+                    I diag      = -1;
+                    I row_begin = csr_row_ptr[row] - base;
+                    I row_end   = csr_row_ptr[row + 1] - base;
 
-                sum = std::fma(-local_val, B[idx], sum);
-            }
+                    T diag_val = static_cast<T>(0);
 
-            if(diag_type == rocsparse_diag_type_non_unit)
-            {
-                if(diag == -1)
-                {
-                    *struct_pivot = std::min(*struct_pivot, row + base);
-                }
+                    for(I j = row_end - 1; j >= row_begin; --j)
+                    {
+                        J local_col = csr_col_ind[j] - base;
+                        T local_val = csr_val[j];
 
-                B[idx_B] = sum * diag_val;
-            }
-            else
-            {
-                B[idx_B] = sum;
+                        // Ignore all entries that are below the diagonal
+                        if(local_col < row)
+                        {
+                            continue;
+                        }
+
+                        // Diagonal entry
+                        if(local_col == row)
+                        {
+                            if(diag_type == rocsparse_diag_type_non_unit)
+                            {
+                                // Check for numerical zero
+                                if(local_val == static_cast<T>(0))
+                                {
+                                    local_numeric_pivot = std::min(local_numeric_pivot, row + base);
+                                    local_val           = static_cast<T>(1);
+                                }
+
+                                diag     = j;
+                                diag_val = static_cast<T>(1) / local_val;
+                            }
+
+                            continue;
+                        }
+
+                        // Upper triangular part
+                        int64_t idx = B_col_major ? i * ldb + local_col : local_col * ldb + i;
+
+                        sum = std::fma(-local_val, B[idx], sum);
+                    }
+
+                    if(diag_type == rocsparse_diag_type_non_unit)
+                    {
+                        if(diag == -1)
+                        {
+                            local_struct_pivot = std::min(local_struct_pivot, row + base);
+                        }
+
+                        B[idx_B] = sum * diag_val;
+                    }
+                    else
+                    {
+                        B[idx_B] = sum;
+                    }
+                }
             }
         }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
+        }
     }
 }
 
 template <typename I, typename J, typename T>
-void host_csrsm(J                    M,
-                J                    nrhs,
-                I                    nnz,
-                rocsparse_operation  transA,
-                rocsparse_operation  transB,
-                T                    alpha,
-                const I*             csr_row_ptr,
-                const J*             csr_col_ind,
-                const T*             csr_val,
-                T*                   B,
-                int64_t              ldb,
-                rocsparse_order      order_B,
-                rocsparse_diag_type  diag_type,
-                rocsparse_fill_mode  fill_mode,
-                rocsparse_index_base base,
-                J*                   struct_pivot,
-                J*                   numeric_pivot)
+void host_csrsm(J                       M,
+                J                       nrhs,
+                I                       nnz,
+                rocsparse_operation     transA,
+                rocsparse_operation     transB,
+                T                       alpha,
+                const I*                csr_row_ptr,
+                const J*                csr_col_ind,
+                const T*                csr_val,
+                T*                      B,
+                int64_t                 ldb,
+                rocsparse_order         order_B,
+                rocsparse_diag_type     diag_type,
+                rocsparse_fill_mode     fill_mode,
+                rocsparse_index_base    base,
+                J*                      struct_pivot,
+                J*                      numeric_pivot,
+                const host_trm_info<J>& info,
+                uint32_t                warp_size)
 {
     if(nrhs == 0)
     {
@@ -3513,7 +4225,9 @@ void host_csrsm(J                    M,
                    fill_mode,
                    base,
                    struct_pivot,
-                   numeric_pivot);
+                   numeric_pivot,
+                   info,
+                   warp_size);
 
         if((transB == rocsparse_operation_none && order_B == rocsparse_order_column))
         {
@@ -3553,7 +4267,8 @@ void host_csrsm(J                    M,
                              diag_type,
                              base,
                              struct_pivot,
-                             numeric_pivot);
+                             numeric_pivot,
+                             info);
             }
             else
             {
@@ -3570,7 +4285,8 @@ void host_csrsm(J                    M,
                              diag_type,
                              base,
                              struct_pivot,
-                             numeric_pivot);
+                             numeric_pivot,
+                             info);
             }
         }
         else if(transA == rocsparse_operation_transpose
@@ -3616,7 +4332,8 @@ void host_csrsm(J                    M,
                              diag_type,
                              base,
                              struct_pivot,
-                             numeric_pivot);
+                             numeric_pivot,
+                             info);
             }
             else
             {
@@ -3633,7 +4350,8 @@ void host_csrsm(J                    M,
                              diag_type,
                              base,
                              struct_pivot,
-                             numeric_pivot);
+                             numeric_pivot,
+                             info);
             }
         }
 
@@ -3644,6 +4362,52 @@ void host_csrsm(J                    M,
     }
 }
 
+template <typename I, typename J, typename T>
+void host_csrsm(J                    M,
+                J                    nrhs,
+                I                    nnz,
+                rocsparse_operation  transA,
+                rocsparse_operation  transB,
+                T                    alpha,
+                const I*             csr_row_ptr,
+                const J*             csr_col_ind,
+                const T*             csr_val,
+                T*                   B,
+                int64_t              ldb,
+                rocsparse_order      order_B,
+                rocsparse_diag_type  diag_type,
+                rocsparse_fill_mode  fill_mode,
+                rocsparse_index_base base,
+                J*                   struct_pivot,
+                J*                   numeric_pivot,
+                uint32_t             warp_size)
+{
+    // The level schedule only depends on the sparsity pattern and is shared by all
+    // right-hand sides
+    host_trm_info<J> info;
+    host_csrsv_analysis(transA, M, csr_row_ptr, csr_col_ind, fill_mode, base, &info);
+
+    host_csrsm(M,
+               nrhs,
+               nnz,
+               transA,
+               transB,
+               alpha,
+               csr_row_ptr,
+               csr_col_ind,
+               csr_val,
+               B,
+               ldb,
+               order_B,
+               diag_type,
+               fill_mode,
+               base,
+               struct_pivot,
+               numeric_pivot,
+               info,
+               warp_size);
+}
+
 template <typename I, typename T>
 void host_coosm(I                    M,
                 I                    nrhs,
@@ -3661,7 +4425,8 @@ void host_coosm(I                    M,
                 rocsparse_fill_mode  fill_mode,
                 rocsparse_index_base base,
                 I*                   struct_pivot,
-                I*                   numeric_pivot)
+                I*                   numeric_pivot,
+                uint32_t             warp_size)
 {
     if(std::is_same<I, int32_t>() && nnz < std::numeric_limits<int32_t>::max())
     {
@@ -3685,7 +4450,8 @@ void host_coosm(I                    M,
                                fill_mode,
                                base,
                                struct_pivot,
-                               numeric_pivot);
+                               numeric_pivot,
+                               warp_size);
     }
     else
     {
@@ -3709,7 +4475,8 @@ void host_coosm(I                    M,
                    fill_mode,
                    base,
                    struct_pivot,
-                   numeric_pivot);
+                   numeric_pivot,
+                   warp_size);
     }
 }
 
@@ -4716,208 +5483,597 @@ void host_csrgeam(rocsparse_int        M,
     }
 }
 
-template <typename T, typename I, typename J>
-void host_csrgemm_nnz(J                    M,
-                      J                    N,
-                      J                    K,
-                      const T*             alpha,
-                      const I*             csr_row_ptr_A,
-                      const J*             csr_col_ind_A,
-                      const I*             csr_row_ptr_B,
-                      const J*             csr_col_ind_B,
-                      const T*             beta,
-                      const I*             csr_row_ptr_D,
-                      const J*             csr_col_ind_D,
-                      I*                   csr_row_ptr_C,
-                      I*                   nnz_C,
-                      rocsparse_index_base base_A,
-                      rocsparse_index_base base_B,
-                      rocsparse_index_base base_C,
-                      rocsparse_index_base base_D)
+// Accumulator merging the intermediate products of a row of C = alpha * A * B + beta * D.
+// Entries are collected in col / val in order of appearance. Depending on the number of
+// intermediate products of the row, the column lookup either uses a sorted list (short
+// rows), an open-addressing hash table (medium rows) or a dense array spanning all
+// columns of C (long rows). The dense array is only allocated by threads encountering
+// such a row.
+template <typename J, typename T>
+class host_csrgemm_accumulator
 {
-    if(M == 0 || N == 0)
+public:
+    explicit host_csrgemm_accumulator(J N)
+        : mode(mode_list)
+        , N(N)
     {
-        *nnz_C = 0;
-        if(M > 0)
+    }
+
+    void begin_row(int64_t products)
+    {
+        // Reset the dense array touched by the previous row
+        if(mode == mode_dense)
         {
-            for(J i = 0; i <= M; ++i)
+            for(size_t j = 0; j < col.size(); ++j)
             {
-                csr_row_ptr_C[i] = base_C;
+                dense_pos[col[j]] = -1;
             }
         }
-        return;
-    }
-    else if(alpha && !beta && (K == 0))
-    {
-        *nnz_C = 0;
-        if(M > 0)
+
+        col.clear();
+        val.clear();
+
+        if(products <= list_size)
         {
-            for(J i = 0; i <= M; ++i)
+            mode = mode_list;
+        }
+        else if(2 * products >= N)
+        {
+            mode = mode_dense;
+
+            if(dense_pos.empty())
             {
-                csr_row_ptr_C[i] = base_C;
+                dense_pos.assign(N, -1);
             }
         }
-        return;
+        else
+        {
+            mode = mode_hash;
+
+            size_t size = 1;
+            hash_shift  = 64;
+            while(size < static_cast<size_t>(2 * products))
+            {
+                size <<= 1;
+                --hash_shift;
+            }
+
+            hash_key.assign(size, -1);
+            hash_pos.resize(size);
+        }
     }
-    else if(!alpha && !beta)
+
+    template <bool NUMERIC>
+    void add(J c, T v)
     {
-        *nnz_C = 0;
-        if(M > 0)
+        int64_t pos = lookup(c);
+
+        if(pos < 0)
         {
-            for(J i = 0; i <= M; ++i)
+            if(mode == mode_list)
             {
-                csr_row_ptr_C[i] = base_C;
+                // Keep the list sorted
+                pos = -pos - 1;
+                col.insert(col.begin() + pos, c);
+                if(NUMERIC)
+                {
+                    val.insert(val.begin() + pos, v);
+                }
+                return;
+            }
+
+            pos = col.size();
+            col.push_back(c);
+            if(NUMERIC)
+            {
+                val.push_back(v);
+            }
+
+            if(mode == mode_dense)
+            {
+                dense_pos[c] = pos;
+            }
+            else
+            {
+                hash_pos[hash_slot] = pos;
             }
         }
-        return;
+        else if(NUMERIC)
+        {
+            val[pos] += v;
+        }
     }
 
-#ifdef _OPENMP
-#pragma omp parallel
-#endif
+    size_t size() const
     {
-        std::vector<J> nnz(N, -1);
-
-        int nthreads = 1;
-        int tid      = 0;
+        return col.size();
+    }
 
-#ifdef _OPENMP
-        nthreads = omp_get_num_threads();
-        tid      = omp_get_thread_num();
-#endif
+    // Write the entries sorted by column
+    template <bool NUMERIC>
+    void extract(J* out_col, T* out_val, rocsparse_index_base base)
+    {
+        if(mode == mode_list)
+        {
+            for(size_t j = 0; j < col.size(); ++j)
+            {
+                out_col[j] = col[j] + base;
+                if(NUMERIC)
+                {
+                    out_val[j] = val[j];
+                }
+            }
+            return;
+        }
 
-        J rows_per_thread = (M + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+        perm.resize(col.size());
+        for(size_t j = 0; j < perm.size(); ++j)
+        {
+            perm[j] = j;
+        }
 
-        // Index base
-        csr_row_ptr_C[0] = base_C;
+        std::sort(perm.begin(), perm.end(), [&](const size_t& a, const size_t& b) {
+            return col[a] < col[b];
+        });
 
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
+        for(size_t j = 0; j < perm.size(); ++j)
         {
-            // Initialize csr row pointer with previous row offset
-            csr_row_ptr_C[i + 1] = 0;
+            out_col[j] = col[perm[j]] + base;
+            if(NUMERIC)
+            {
+                out_val[j] = val[perm[j]];
+            }
+        }
+    }
 
-            if(alpha)
+private:
+    // Returns the position of column c, or a negative value if c is not present yet. In
+    // list mode, -(insertion point + 1) is returned. In hash mode, the free slot for c is
+    // stored in hash_slot.
+    int64_t lookup(J c)
+    {
+        if(mode == mode_list)
+        {
+            auto it = std::lower_bound(col.begin(), col.end(), c);
+            if(it != col.end() && *it == c)
             {
-                I row_begin_A = csr_row_ptr_A[i] - base_A;
-                I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+                return it - col.begin();
+            }
 
-                // Loop over columns of A
-                for(I j = row_begin_A; j < row_end_A; ++j)
-                {
-                    // Current column of A
-                    J col_A = csr_col_ind_A[j] - base_A;
+            return -(it - col.begin()) - 1;
+        }
 
-                    I row_begin_B = csr_row_ptr_B[col_A] - base_B;
-                    I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+        if(mode == mode_dense)
+        {
+            return dense_pos[c];
+        }
 
-                    // Loop over columns of B in row col_A
-                    for(I k = row_begin_B; k < row_end_B; ++k)
-                    {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[k] - base_B;
+        // Fibonacci hashing, taking the high bits of the product such that columns with
+        // power of two strides, as in expanded block or stencil matrices, do not cluster
+        size_t mask = hash_key.size() - 1;
+        size_t slot = static_cast<size_t>((static_cast<uint64_t>(c) * hash_scale) >> hash_shift);
 
-                        // Check if a new nnz is generated
-                        if(nnz[col_B] != i)
-                        {
-                            nnz[col_B] = i;
-                            ++csr_row_ptr_C[i + 1];
-                        }
-                    }
-                }
+        while(true)
+        {
+            if(hash_key[slot] == c)
+            {
+                return hash_pos[slot];
             }
 
-            // Add nnz of D if beta != 0
-            if(beta)
+            if(hash_key[slot] == -1)
             {
-                I row_begin_D = csr_row_ptr_D[i] - base_D;
-                I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+                hash_key[slot] = c;
+                hash_slot      = slot;
+                return -1;
+            }
 
-                // Loop over columns of D
-                for(I j = row_begin_D; j < row_end_D; ++j)
-                {
-                    J col_D = csr_col_ind_D[j] - base_D;
+            slot = (slot + 1) & mask;
+        }
+    }
 
-                    // Check if a new nnz is generated
-                    if(nnz[col_D] != i)
-                    {
-                        nnz[col_D] = i;
-                        ++csr_row_ptr_C[i + 1];
-                    }
-                }
+    static constexpr int64_t  list_size  = 32;
+    static constexpr uint64_t hash_scale = 0x9e3779b97f4a7c15ULL;
+
+    enum
+    {
+        mode_list,
+        mode_hash,
+        mode_dense
+    } mode;
+
+    J N;
+
+    std::vector<J>       col;
+    std::vector<T>       val;
+    std::vector<size_t>  perm;
+    std::vector<int64_t> dense_pos;
+    std::vector<J>       hash_key;
+    std::vector<int64_t> hash_pos;
+    size_t               hash_slot;
+    int                  hash_shift;
+};
+
+// Number of intermediate products of each row of C, as exclusive scan. Only the base of A
+// is needed, the row lengths of B and D do not depend on their base.
+template <typename T, typename I, typename J>
+static void host_csrgemm_row_work(J                     M,
+                                  const T*              alpha,
+                                  const I*              csr_row_ptr_A,
+                                  const J*              csr_col_ind_A,
+                                  const I*              csr_row_ptr_B,
+                                  const T*              beta,
+                                  const I*              csr_row_ptr_D,
+                                  rocsparse_index_base  base_A,
+                                  std::vector<int64_t>& row_work)
+{
+    row_work.resize(M + 1);
+    row_work[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        int64_t products = 0;
+
+        if(alpha)
+        {
+            I row_begin_A = csr_row_ptr_A[i] - base_A;
+            I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+
+            for(I j = row_begin_A; j < row_end_A; ++j)
+            {
+                J col_A = csr_col_ind_A[j] - base_A;
+
+                products += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
             }
         }
+
+        if(beta)
+        {
+            products += csr_row_ptr_D[i + 1] - csr_row_ptr_D[i];
+        }
+
+        row_work[i + 1] = products;
     }
 
-    // Scan to obtain row offsets
     for(J i = 0; i < M; ++i)
     {
-        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+        row_work[i + 1] += row_work[i];
     }
+}
 
-    *nnz_C = csr_row_ptr_C[M] - base_C;
+// Split the rows of C into nparts chunks of about the same number of intermediate products
+template <typename J>
+static void host_csrgemm_partition(J                           M,
+                                   const std::vector<int64_t>& row_work,
+                                   int                         nparts,
+                                   std::vector<J>&             part)
+{
+    part.resize(nparts + 1);
+
+    int64_t total = row_work[M];
+
+    part[0]      = 0;
+    part[nparts] = M;
+
+    for(int p = 1; p < nparts; ++p)
+    {
+        int64_t target = total / nparts * p + total % nparts * p / nparts;
+
+        part[p] = std::lower_bound(row_work.begin(), row_work.begin() + M, target)
+                  - row_work.begin();
+        part[p] = std::max(part[p], part[p - 1]);
+    }
 }
 
-template <typename T, typename I, typename J>
-void host_csrgemm(J                    M,
-                  J                    N,
-                  J                    L,
-                  const T*             alpha,
-                  const I*             csr_row_ptr_A,
-                  const J*             csr_col_ind_A,
-                  const T*             csr_val_A,
-                  const I*             csr_row_ptr_B,
-                  const J*             csr_col_ind_B,
-                  const T*             csr_val_B,
-                  const T*             beta,
-                  const I*             csr_row_ptr_D,
-                  const J*             csr_col_ind_D,
-                  const T*             csr_val_D,
-                  const I*             csr_row_ptr_C,
-                  J*                   csr_col_ind_C,
-                  T*                   csr_val_C,
-                  rocsparse_index_base base_A,
-                  rocsparse_index_base base_B,
-                  rocsparse_index_base base_C,
-                  rocsparse_index_base base_D)
+static int host_csrgemm_num_parts()
 {
-    if(M == 0 || N == 0)
+#ifdef _OPENMP
+    // Some oversubscription to balance rows whose cost is not proportional to their products
+    return 4 * omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// Accumulate the intermediate products of row i of C
+template <bool NUMERIC, typename T, typename I, typename J>
+static void host_csrgemm_accumulate_row(J                               i,
+                                        const T*                        alpha,
+                                        const I*                        csr_row_ptr_A,
+                                        const J*                        csr_col_ind_A,
+                                        const T*                        csr_val_A,
+                                        const I*                        csr_row_ptr_B,
+                                        const J*                        csr_col_ind_B,
+                                        const T*                        csr_val_B,
+                                        const T*                        beta,
+                                        const I*                        csr_row_ptr_D,
+                                        const J*                        csr_col_ind_D,
+                                        const T*                        csr_val_D,
+                                        rocsparse_index_base            base_A,
+                                        rocsparse_index_base            base_B,
+                                        rocsparse_index_base            base_D,
+                                        host_csrgemm_accumulator<J, T>& acc)
+{
+    if(alpha)
     {
-        return;
+        I row_begin_A = csr_row_ptr_A[i] - base_A;
+        I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+
+        // Loop over columns of A
+        for(I j = row_begin_A; j < row_end_A; ++j)
+        {
+            // Current column of A
+            J col_A = csr_col_ind_A[j] - base_A;
+            // Current value of A
+            T val_A = NUMERIC ? *alpha * csr_val_A[j] : static_cast<T>(0);
+
+            I row_begin_B = csr_row_ptr_B[col_A] - base_B;
+            I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+
+            // Loop over columns of B in row col_A
+            for(I k = row_begin_B; k < row_end_B; ++k)
+            {
+                acc.template add<NUMERIC>(csr_col_ind_B[k] - base_B,
+                                          NUMERIC ? val_A * csr_val_B[k] : static_cast<T>(0));
+            }
+        }
     }
-    else if(alpha && !beta && (L == 0))
+
+    // Add nnz of D if beta != 0
+    if(beta)
     {
-        return;
+        I row_begin_D = csr_row_ptr_D[i] - base_D;
+        I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+
+        // Loop over columns of D
+        for(I j = row_begin_D; j < row_end_D; ++j)
+        {
+            acc.template add<NUMERIC>(csr_col_ind_D[j] - base_D,
+                                      NUMERIC ? *beta * csr_val_D[j] : static_cast<T>(0));
+        }
     }
-    else if(!alpha && !beta)
+}
+
+template <typename T, typename I, typename J>
+void host_csrgemm_nnz(J                        M,
+                      J                        N,
+                      J                        K,
+                      const T*                 alpha,
+                      const I*                 csr_row_ptr_A,
+                      const J*                 csr_col_ind_A,
+                      const I*                 csr_row_ptr_B,
+                      const J*                 csr_col_ind_B,
+                      const T*                 beta,
+                      const I*                 csr_row_ptr_D,
+                      const J*                 csr_col_ind_D,
+                      I*                       csr_row_ptr_C,
+                      I*                       nnz_C,
+                      rocsparse_index_base     base_A,
+                      rocsparse_index_base     base_B,
+                      rocsparse_index_base     base_C,
+                      rocsparse_index_base     base_D,
+                      host_csrgemm_info<I, J>* info)
+{
+    if(M == 0 || N == 0 || (alpha && !beta && (K == 0)) || (!alpha && !beta))
     {
+        *nnz_C = 0;
+        if(M > 0)
+        {
+            for(J i = 0; i <= M; ++i)
+            {
+                csr_row_ptr_C[i] = base_C;
+            }
+        }
+
+        if(info != nullptr)
+        {
+            info->row_work.assign(M + 1, 0);
+            info->csr_col_ind.clear();
+        }
         return;
     }
+
+    std::vector<int64_t> local_row_work;
+    std::vector<int64_t>& row_work = (info != nullptr) ? info->row_work : local_row_work;
+
+    host_csrgemm_row_work(M,
+                          alpha,
+                          csr_row_ptr_A,
+                          csr_col_ind_A,
+                          csr_row_ptr_B,
+                          beta,
+                          csr_row_ptr_D,
+                          base_A,
+                          row_work);
+
+    std::vector<J> part;
+    host_csrgemm_partition(M, row_work, host_csrgemm_num_parts(), part);
+
+    int nparts = part.size() - 1;
+
+    // Column indices of each part, only kept if the symbolic result is requested
+    std::vector<std::vector<J>> part_col_ind((info != nullptr) ? nparts : 0);
+
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
-        std::vector<I> nnz(N, -1);
+        host_csrgemm_accumulator<J, T> acc(N);
 
-        int nthreads = 1;
-        int tid      = 0;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            for(J i = part[p]; i < part[p + 1]; ++i)
+            {
+                acc.begin_row(row_work[i + 1] - row_work[i]);
+
+                host_csrgemm_accumulate_row<false>(i,
+                                                   alpha,
+                                                   csr_row_ptr_A,
+                                                   csr_col_ind_A,
+                                                   (const T*)nullptr,
+                                                   csr_row_ptr_B,
+                                                   csr_col_ind_B,
+                                                   (const T*)nullptr,
+                                                   beta,
+                                                   csr_row_ptr_D,
+                                                   csr_col_ind_D,
+                                                   (const T*)nullptr,
+                                                   base_A,
+                                                   base_B,
+                                                   base_D,
+                                                   acc);
+
+                csr_row_ptr_C[i + 1] = acc.size();
+
+                if(info != nullptr)
+                {
+                    std::vector<J>& col_ind = part_col_ind[p];
+
+                    size_t offset = col_ind.size();
+                    col_ind.resize(offset + acc.size());
+                    acc.template extract<false>(
+                        col_ind.data() + offset, (T*)nullptr, rocsparse_index_base_zero);
+                }
+            }
+        }
+    }
+
+    // Index base
+    csr_row_ptr_C[0] = base_C;
+
+    // Scan to obtain row offsets
+    for(J i = 0; i < M; ++i)
+    {
+        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+    }
+
+    *nnz_C = csr_row_ptr_C[M] - base_C;
+
+    if(info != nullptr)
+    {
+        info->csr_col_ind.resize(*nnz_C);
 
 #ifdef _OPENMP
-        nthreads = omp_get_num_threads();
-        tid      = omp_get_thread_num();
+#pragma omp parallel for schedule(dynamic, 1)
 #endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            std::copy(part_col_ind[p].begin(),
+                      part_col_ind[p].end(),
+                      info->csr_col_ind.begin() + (csr_row_ptr_C[part[p]] - base_C));
+        }
+    }
+}
 
-        J rows_per_thread = (M + nthreads - 1) / nthreads;
-        J chunk_begin     = rows_per_thread * tid;
-        J chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+template <typename T, typename I, typename J>
+void host_csrgemm_nnz(J                    M,
+                      J                    N,
+                      J                    K,
+                      const T*             alpha,
+                      const I*             csr_row_ptr_A,
+                      const J*             csr_col_ind_A,
+                      const I*             csr_row_ptr_B,
+                      const J*             csr_col_ind_B,
+                      const T*             beta,
+                      const I*             csr_row_ptr_D,
+                      const J*             csr_col_ind_D,
+                      I*                   csr_row_ptr_C,
+                      I*                   nnz_C,
+                      rocsparse_index_base base_A,
+                      rocsparse_index_base base_B,
+                      rocsparse_index_base base_C,
+                      rocsparse_index_base base_D)
+{
+    host_csrgemm_nnz(M,
+                     N,
+                     K,
+                     alpha,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_B,
+                     csr_col_ind_B,
+                     beta,
+                     csr_row_ptr_D,
+                     csr_col_ind_D,
+                     csr_row_ptr_C,
+                     nnz_C,
+                     base_A,
+                     base_B,
+                     base_C,
+                     base_D,
+                     (host_csrgemm_info<I, J>*)nullptr);
+}
 
-        // Loop over rows of A
-        for(J i = chunk_begin; i < chunk_end; ++i)
+template <typename T, typename I, typename J>
+void host_csrgemm(J                              M,
+                  J                              N,
+                  J                              L,
+                  const T*                       alpha,
+                  const I*                       csr_row_ptr_A,
+                  const J*                       csr_col_ind_A,
+                  const T*                       csr_val_A,
+                  const I*                       csr_row_ptr_B,
+                  const J*                       csr_col_ind_B,
+                  const T*                       csr_val_B,
+                  const T*                       beta,
+                  const I*                       csr_row_ptr_D,
+                  const J*                       csr_col_ind_D,
+                  const T*                       csr_val_D,
+                  const I*                       csr_row_ptr_C,
+                  J*                             csr_col_ind_C,
+                  T*                             csr_val_C,
+                  rocsparse_index_base           base_A,
+                  rocsparse_index_base           base_B,
+                  rocsparse_index_base           base_C,
+                  rocsparse_index_base           base_D,
+                  const host_csrgemm_info<I, J>& info)
+{
+    if(M == 0 || N == 0)
+    {
+        return;
+    }
+    else if(alpha && !beta && (L == 0))
+    {
+        return;
+    }
+    else if(!alpha && !beta)
+    {
+        return;
+    }
+
+    std::vector<J> part;
+    host_csrgemm_partition(M, info.row_work, host_csrgemm_num_parts(), part);
+
+    int nparts = part.size() - 1;
+
+    // The sparsity pattern of C is known, products are accumulated at the position of
+    // their column within the sorted row
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for(int p = 0; p < nparts; ++p)
+    {
+        for(J i = part[p]; i < part[p + 1]; ++i)
         {
             I row_begin_C = csr_row_ptr_C[i] - base_C;
-            I row_end_C   = row_begin_C;
+            I row_end_C   = csr_row_ptr_C[i + 1] - base_C;
+
+            const J* col_C = info.csr_col_ind.data();
+
+            for(I j = row_begin_C; j < row_end_C; ++j)
+            {
+                csr_col_ind_C[j] = col_C[j] + base_C;
+                csr_val_C[j]     = static_cast<T>(0);
+            }
+
+            auto position = [&](J col) {
+                return std::lower_bound(col_C + row_begin_C, col_C + row_end_C, col) - col_C;
+            };
 
             if(alpha)
             {
@@ -4938,23 +6094,7 @@ void host_csrgemm(J                    M,
                     // Loop over columns of B in row col_A
                     for(I k = row_begin_B; k < row_end_B; ++k)
                     {
-                        // Current column of B
-                        J col_B = csr_col_ind_B[k] - base_B;
-                        // Current value of B
-                        T val_B = csr_val_B[k];
-
-                        // Check if a new nnz is generated or if the product is appended
-                        if(nnz[col_B] < row_begin_C)
-                        {
-                            nnz[col_B]               = row_end_C;
-                            csr_col_ind_C[row_end_C] = col_B + base_C;
-                            csr_val_C[row_end_C]     = val_A * val_B;
-                            ++row_end_C;
-                        }
-                        else
-                        {
-                            csr_val_C[nnz[col_B]] += val_A * val_B;
-                        }
+                        csr_val_C[position(csr_col_ind_B[k] - base_B)] += val_A * csr_val_B[k];
                     }
                 }
             }
@@ -4968,63 +6108,102 @@ void host_csrgemm(J                    M,
                 // Loop over columns of D
                 for(I j = row_begin_D; j < row_end_D; ++j)
                 {
-                    // Current column of D
-                    J col_D = csr_col_ind_D[j] - base_D;
-                    // Current value of D
-                    T val_D = *beta * csr_val_D[j];
-
-                    // Check if a new nnz is generated or if the value is added
-                    if(nnz[col_D] < row_begin_C)
-                    {
-                        nnz[col_D] = row_end_C;
-
-                        csr_col_ind_C[row_end_C] = col_D + base_C;
-                        csr_val_C[row_end_C]     = val_D;
-                        ++row_end_C;
-                    }
-                    else
-                    {
-                        csr_val_C[nnz[col_D]] += val_D;
-                    }
+                    csr_val_C[position(csr_col_ind_D[j] - base_D)] += *beta * csr_val_D[j];
                 }
             }
         }
     }
+}
+
+template <typename T, typename I, typename J>
+void host_csrgemm(J                    M,
+                  J                    N,
+                  J                    L,
+                  const T*             alpha,
+                  const I*             csr_row_ptr_A,
+                  const J*             csr_col_ind_A,
+                  const T*             csr_val_A,
+                  const I*             csr_row_ptr_B,
+                  const J*             csr_col_ind_B,
+                  const T*             csr_val_B,
+                  const T*             beta,
+                  const I*             csr_row_ptr_D,
+                  const J*             csr_col_ind_D,
+                  const T*             csr_val_D,
+                  const I*             csr_row_ptr_C,
+                  J*                   csr_col_ind_C,
+                  T*                   csr_val_C,
+                  rocsparse_index_base base_A,
+                  rocsparse_index_base base_B,
+                  rocsparse_index_base base_C,
+                  rocsparse_index_base base_D)
+{
+    if(M == 0 || N == 0)
+    {
+        return;
+    }
+    else if(alpha && !beta && (L == 0))
+    {
+        return;
+    }
+    else if(!alpha && !beta)
+    {
+        return;
+    }
 
-    I nnz = csr_row_ptr_C[M] - base_C;
+    std::vector<int64_t> row_work;
+    host_csrgemm_row_work(M,
+                          alpha,
+                          csr_row_ptr_A,
+                          csr_col_ind_A,
+                          csr_row_ptr_B,
+                          beta,
+                          csr_row_ptr_D,
+                          base_A,
+                          row_work);
 
-    std::vector<J> col(nnz);
-    std::vector<T> val(nnz);
+    std::vector<J> part;
+    host_csrgemm_partition(M, row_work, host_csrgemm_num_parts(), part);
 
-    memcpy(col.data(), csr_col_ind_C, sizeof(J) * nnz);
-    memcpy(val.data(), csr_val_C, sizeof(T) * nnz);
+    int nparts = part.size() - 1;
 
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel
 #endif
-    for(J i = 0; i < M; ++i)
     {
-        I row_begin = csr_row_ptr_C[i] - base_C;
-        I row_end   = csr_row_ptr_C[i + 1] - base_C;
-        J row_nnz   = row_end - row_begin;
+        host_csrgemm_accumulator<J, T> acc(N);
 
-        std::vector<J> perm(row_nnz);
-        for(J j = 0; j < row_nnz; ++j)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
         {
-            perm[j] = j;
-        }
+            for(J i = part[p]; i < part[p + 1]; ++i)
+            {
+                acc.begin_row(row_work[i + 1] - row_work[i]);
 
-        J* col_entry = col.data() + row_begin;
-        T* val_entry = val.data() + row_begin;
+                host_csrgemm_accumulate_row<true>(i,
+                                                  alpha,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  csr_val_B,
+                                                  beta,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  csr_val_D,
+                                                  base_A,
+                                                  base_B,
+                                                  base_D,
+                                                  acc);
 
-        std::sort(perm.begin(), perm.end(), [&](const J& a, const J& b) {
-            return col_entry[a] < col_entry[b];
-        });
+                I row_begin_C = csr_row_ptr_C[i] - base_C;
 
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
-            csr_val_C[row_begin + j]     = val_entry[perm[j]];
+                acc.template extract<true>(
+                    csr_col_ind_C + row_begin_C, csr_val_C + row_begin_C, base_C);
+            }
         }
     }
 }
@@ -5335,13 +6514,12 @@ void host_bsric0(rocsparse_direction               direction,
     rocsparse_int M = Mb * block_dim;
 
     // Initialize pivot
-    *struct_pivot  = -1;
-    *numeric_pivot = -1;
+    *struct_pivot  = Mb + 1;
+    *numeric_pivot = Mb + 1;
 
     // pointer of upper part of each row
     std::vector<rocsparse_int> diag_block_offset(Mb);
     std::vector<rocsparse_int> diag_offset(M, -1);
-    std::vector<rocsparse_int> nnz_entries(M, -1);
 
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -5361,193 +6539,218 @@ void host_bsric0(rocsparse_direction               direction,
         }
     }
 
-    for(rocsparse_int i = 0; i < M; i++)
-    {
-        rocsparse_int local_row = i % block_dim;
-
-        rocsparse_int row_begin = bsr_row_ptr[i / block_dim] - base;
-        rocsparse_int row_end   = bsr_row_ptr[i / block_dim + 1] - base;
-
-        for(rocsparse_int j = row_begin; j < row_end; j++)
-        {
-            rocsparse_int block_col_j = bsr_col_ind[j] - base;
-
-            for(rocsparse_int k = 0; k < block_dim; k++)
-            {
-                if(direction == rocsparse_direction_row)
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * local_row + k;
-                }
-                else
-                {
-                    nnz_entries[block_dim * block_col_j + k]
-                        = block_dim * block_dim * j + block_dim * k + local_row;
-                }
-            }
-        }
+    // Block rows only depend on the block rows of their lower part, block rows of the same
+    // level are factorized concurrently
+    host_trm_info<rocsparse_int> info;
+    host_csrsv_analysis(rocsparse_operation_none,
+                        Mb,
+                        bsr_row_ptr.data(),
+                        bsr_col_ind.data(),
+                        rocsparse_fill_mode_lower,
+                        base,
+                        &info);
 
-        T             sum            = static_cast<T>(0);
-        rocsparse_int diag_val_index = -1;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Position of each BSR block of the current block row
+        std::vector<rocsparse_int> nnz_entries(Mb, -1);
 
-        bool has_diag         = false;
-        bool break_outer_loop = false;
+        rocsparse_int local_struct_pivot  = Mb + 1;
+        rocsparse_int local_numeric_pivot = Mb + 1;
 
-        for(rocsparse_int j = row_begin; j < row_end; j++)
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
         {
-            rocsparse_int block_col_j = bsr_col_ind[j] - base;
-
-            for(rocsparse_int k = 0; k < block_dim; k++)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for(rocsparse_int n = info.level_ptr[level - 1]; n < info.level_ptr[level]; ++n)
             {
-                rocsparse_int col_j = block_dim * block_col_j + k;
+                rocsparse_int bi = info.level_ind[n];
 
-                // Mark diagonal and skip row
-                if(col_j == i)
-                {
-                    diag_val_index = block_dim * block_dim * j + block_dim * k + k;
-
-                    has_diag         = true;
-                    break_outer_loop = true;
-                    break;
-                }
+                rocsparse_int row_begin = bsr_row_ptr[bi] - base;
+                rocsparse_int row_end   = bsr_row_ptr[bi + 1] - base;
 
-                // Skip upper triangular
-                if(col_j > i)
+                for(rocsparse_int j = row_begin; j < row_end; j++)
                 {
-                    break_outer_loop = true;
-                    break;
+                    nnz_entries[bsr_col_ind[j] - base] = j;
                 }
 
-                T val_j = static_cast<T>(0);
-                if(direction == rocsparse_direction_row)
-                {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row + k];
-                }
-                else
+                // Rows within a block row depend on each other
+                for(rocsparse_int i = block_dim * bi; i < block_dim * (bi + 1); i++)
                 {
-                    val_j = bsr_val[block_dim * block_dim * j + block_dim * k + local_row];
-                }
-
-                rocsparse_int local_row_j = col_j % block_dim;
+                    rocsparse_int local_row = i % block_dim;
 
-                rocsparse_int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
-                rocsparse_int row_end_j   = diag_block_offset[col_j / block_dim];
-                rocsparse_int row_diag_j  = diag_offset[col_j];
+                    T             sum            = static_cast<T>(0);
+                    rocsparse_int diag_val_index = -1;
 
-                T local_sum = static_cast<T>(0);
-                T inv_diag  = row_diag_j != -1 ? bsr_val[row_diag_j] : static_cast<T>(0);
+                    bool has_diag         = false;
+                    bool break_outer_loop = false;
 
-                // Check for numeric zero
-                if(inv_diag == static_cast<T>(0))
-                {
-                    // Numerical non-invertible block diagonal
-                    if(*numeric_pivot == -1)
+                    for(rocsparse_int j = row_begin; j < row_end; j++)
                     {
-                        *numeric_pivot = block_col_j + base;
-                    }
+                        rocsparse_int block_col_j = bsr_col_ind[j] - base;
 
-                    *numeric_pivot = std::min(*numeric_pivot, block_col_j + base);
+                        for(rocsparse_int k = 0; k < block_dim; k++)
+                        {
+                            rocsparse_int col_j = block_dim * block_col_j + k;
 
-                    inv_diag = static_cast<T>(1);
-                }
+                            // Mark diagonal and skip row
+                            if(col_j == i)
+                            {
+                                diag_val_index = block_dim * block_dim * j + block_dim * k + k;
 
-                inv_diag = static_cast<T>(1) / inv_diag;
+                                has_diag         = true;
+                                break_outer_loop = true;
+                                break;
+                            }
 
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(rocsparse_int l = row_begin_j; l < row_end_j + 1; l++)
-                {
-                    rocsparse_int block_col_l = bsr_col_ind[l] - base;
-
-                    for(rocsparse_int m = 0; m < block_dim; m++)
-                    {
-                        rocsparse_int idx = nnz_entries[block_dim * block_col_l + m];
+                            // Skip upper triangular
+                            if(col_j > i)
+                            {
+                                break_outer_loop = true;
+                                break;
+                            }
 
-                        if(idx != -1 && block_dim * block_col_l + m < col_j)
-                        {
+                            T val_j = static_cast<T>(0);
                             if(direction == rocsparse_direction_row)
                             {
-                                local_sum = std::fma(bsr_val[block_dim * block_dim * l
-                                                             + block_dim * local_row_j + m],
-                                                     rocsparse_conj(bsr_val[idx]),
-                                                     local_sum);
+                                val_j = bsr_val[block_dim * block_dim * j + block_dim * local_row
+                                                + k];
                             }
                             else
                             {
-                                local_sum = std::fma(bsr_val[block_dim * block_dim * l
-                                                             + block_dim * m + local_row_j],
-                                                     rocsparse_conj(bsr_val[idx]),
-                                                     local_sum);
+                                val_j = bsr_val[block_dim * block_dim * j + block_dim * k
+                                                + local_row];
                             }
-                        }
-                    }
-                }
 
-                val_j = (val_j - local_sum) * inv_diag;
-                sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
+                            rocsparse_int local_row_j = col_j % block_dim;
 
-                if(direction == rocsparse_direction_row)
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * local_row + k] = val_j;
-                }
-                else
-                {
-                    bsr_val[block_dim * block_dim * j + block_dim * k + local_row] = val_j;
-                }
-            }
+                            rocsparse_int row_begin_j = bsr_row_ptr[col_j / block_dim] - base;
+                            rocsparse_int row_end_j   = diag_block_offset[col_j / block_dim];
+                            rocsparse_int row_diag_j  = diag_offset[col_j];
 
-            if(break_outer_loop)
-            {
-                break;
-            }
-        }
+                            T local_sum = static_cast<T>(0);
+                            T inv_diag
+                                = row_diag_j != -1 ? bsr_val[row_diag_j] : static_cast<T>(0);
 
-        if(!has_diag)
-        {
-            // Structural missing block diagonal
-            if(*struct_pivot == -1)
-            {
-                *struct_pivot = i / block_dim + base;
-            }
-        }
+                            // Check for numeric zero
+                            if(inv_diag == static_cast<T>(0))
+                            {
+                                // Numerical non-invertible block diagonal
+                                local_numeric_pivot
+                                    = std::min(local_numeric_pivot, block_col_j + base);
 
-        // Process diagonal entry
-        if(has_diag)
-        {
-            T diag_entry            = std::sqrt(std::abs(bsr_val[diag_val_index] - sum));
-            bsr_val[diag_val_index] = diag_entry;
+                                inv_diag = static_cast<T>(1);
+                            }
 
-            if(diag_entry == static_cast<T>(0))
-            {
-                // Numerical non-invertible block diagonal
-                if(*numeric_pivot == -1)
-                {
-                    *numeric_pivot = i / block_dim + base;
-                }
+                            inv_diag = static_cast<T>(1) / inv_diag;
 
-                *numeric_pivot = std::min(*numeric_pivot, i / block_dim + base);
-            }
+                            // loop over upper offset pointer and do linear combination for nnz
+                            // entry
+                            for(rocsparse_int l = row_begin_j; l < row_end_j + 1; l++)
+                            {
+                                rocsparse_int block_col_l = bsr_col_ind[l] - base;
+                                rocsparse_int block_idx   = nnz_entries[block_col_l];
 
-            // Store diagonal offset
-            diag_offset[i] = diag_val_index;
-        }
+                                if(block_idx == -1)
+                                {
+                                    continue;
+                                }
 
-        for(rocsparse_int j = row_begin; j < row_end; j++)
-        {
-            rocsparse_int block_col_j = bsr_col_ind[j] - base;
+                                for(rocsparse_int m = 0; m < block_dim; m++)
+                                {
+                                    if(block_dim * block_col_l + m < col_j)
+                                    {
+                                        if(direction == rocsparse_direction_row)
+                                        {
+                                            rocsparse_int idx = block_dim * block_dim * block_idx
+                                                                + block_dim * local_row + m;
+
+                                            local_sum = std::fma(
+                                                bsr_val[block_dim * block_dim * l
+                                                        + block_dim * local_row_j + m],
+                                                rocsparse_conj(bsr_val[idx]),
+                                                local_sum);
+                                        }
+                                        else
+                                        {
+                                            rocsparse_int idx = block_dim * block_dim * block_idx
+                                                                + block_dim * m + local_row;
+
+                                            local_sum = std::fma(
+                                                bsr_val[block_dim * block_dim * l
+                                                        + block_dim * m + local_row_j],
+                                                rocsparse_conj(bsr_val[idx]),
+                                                local_sum);
+                                        }
+                                    }
+                                }
+                            }
 
-            for(rocsparse_int k = 0; k < block_dim; k++)
-            {
-                if(direction == rocsparse_direction_row)
-                {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                            val_j = (val_j - local_sum) * inv_diag;
+                            sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
+
+                            if(direction == rocsparse_direction_row)
+                            {
+                                bsr_val[block_dim * block_dim * j + block_dim * local_row + k]
+                                    = val_j;
+                            }
+                            else
+                            {
+                                bsr_val[block_dim * block_dim * j + block_dim * k + local_row]
+                                    = val_j;
+                            }
+                        }
+
+                        if(break_outer_loop)
+                        {
+                            break;
+                        }
+                    }
+
+                    if(!has_diag)
+                    {
+                        // Structural missing block diagonal
+                        local_struct_pivot = std::min(local_struct_pivot, bi + base);
+                    }
+
+                    // Process diagonal entry
+                    if(has_diag)
+                    {
+                        T diag_entry = std::sqrt(std::abs(bsr_val[diag_val_index] - sum));
+                        bsr_val[diag_val_index] = diag_entry;
+
+                        if(diag_entry == static_cast<T>(0))
+                        {
+                            // Numerical non-invertible block diagonal
+                            local_numeric_pivot = std::min(local_numeric_pivot, bi + base);
+                        }
+
+                        // Store diagonal offset
+                        diag_offset[i] = diag_val_index;
+                    }
                 }
-                else
+
+                for(rocsparse_int j = row_begin; j < row_end; j++)
                 {
-                    nnz_entries[block_dim * block_col_j + k] = -1;
+                    nnz_entries[bsr_col_ind[j] - base] = -1;
                 }
             }
         }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
+        }
     }
+
+    *struct_pivot  = (*struct_pivot == Mb + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == Mb + 1) ? -1 : *numeric_pivot;
 }
 
 template <typename T, typename U>
@@ -5571,195 +6774,250 @@ void host_bsrilu0(rocsparse_direction               dir,
 
     // Temporary vector to hold diagonal offset to access diagonal BSR block
     std::vector<rocsparse_int> diag_offset(mb);
-    std::vector<rocsparse_int> nnz_entries(mb, -1);
 
-    if(mb > 0)
-    {
-        // First diagonal block is index 0
-        diag_offset[0] = 0;
-    }
+    // The factorization stops at the first BSR row without diagonal block, after
+    // processing its lower part
+    rocsparse_int mb_factor = mb;
 
-    // Loop over all BSR rows
+#ifdef _OPENMP
+#pragma omp parallel for reduction(min : mb_factor)
+#endif
     for(rocsparse_int i = 0; i < mb; ++i)
     {
-        // Flag whether we have a diagonal block or not
         bool has_diag = false;
 
-        // BSR column entry and exit point
-        rocsparse_int row_begin = bsr_row_ptr[i] - base;
-        rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
-
-        rocsparse_int j;
-
-        // Set up entry points for linear combination
-        for(j = row_begin; j < row_end; ++j)
-        {
-            rocsparse_int col_j = bsr_col_ind[j] - base;
-            nnz_entries[col_j]  = j;
-        }
-
-        // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
-        for(j = row_begin; j < row_end; ++j)
+        for(rocsparse_int j = bsr_row_ptr[i] - base; j < bsr_row_ptr[i + 1] - base; ++j)
         {
-            // Column index of current BSR block
             rocsparse_int bsr_col = bsr_col_ind[j] - base;
 
-            // If this is a diagonal block, set diagonal flag to true and skip
-            // all upcoming blocks as we exceed the lower matrix part
-            if(bsr_col == i)
+            if(bsr_col >= i)
             {
-                has_diag = true;
+                has_diag = (bsr_col == i);
                 break;
             }
+        }
 
-            // Skip all upper matrix blocks
-            if(bsr_col > i)
-            {
-                break;
-            }
+        if(!has_diag)
+        {
+            mb_factor = std::min(mb_factor, i + 1);
+        }
+    }
+
+    // BSR rows only depend on the BSR rows of their lower part, BSR rows of the same
+    // level are factorized concurrently
+    host_trm_info<rocsparse_int> info;
+    host_csrsv_analysis(rocsparse_operation_none,
+                        mb_factor,
+                        bsr_row_ptr.data(),
+                        bsr_col_ind.data(),
+                        rocsparse_fill_mode_lower,
+                        base,
+                        &info);
 
-            // Process all lower matrix BSR blocks
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<rocsparse_int> nnz_entries(mb, -1);
 
-            // Obtain corresponding row entry and exit point that corresponds with the
-            // current BSR column. Actually, we skip all lower matrix column indices,
-            // therefore starting with the diagonal entry.
-            rocsparse_int diag_j    = diag_offset[bsr_col];
-            rocsparse_int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
+        rocsparse_int local_struct_pivot  = mb + 1;
+        rocsparse_int local_numeric_pivot = mb + 1;
 
-            // Loop through all rows within the BSR block
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for(rocsparse_int n = info.level_ptr[level - 1]; n < info.level_ptr[level]; ++n)
             {
-                T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+                rocsparse_int i = info.level_ind[n];
+
+                // Flag whether we have a diagonal block or not
+                bool has_diag = false;
+
+                // BSR column entry and exit point
+                rocsparse_int row_begin = bsr_row_ptr[i] - base;
+                rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
 
-                // Process all rows within the BSR block
-                for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                rocsparse_int j;
+
+                // Set up entry points for linear combination
+                for(j = row_begin; j < row_end; ++j)
                 {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+                    rocsparse_int col_j = bsr_col_ind[j] - base;
+                    nnz_entries[col_j]  = j;
+                }
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
+                // Process lower diagonal BSR blocks (diagonal BSR block is excluded)
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    // Column index of current BSR block
+                    rocsparse_int bsr_col = bsr_col_ind[j] - base;
 
-                    // Loop through columns of bk-th row and do linear combination
-                    for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
+                    // If this is a diagonal block, set diagonal flag to true and skip
+                    // all upcoming blocks as we exceed the lower matrix part
+                    if(bsr_col == i)
                     {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = std::fma(-val,
-                                       bsr_val[BSR_IND(diag_j, bi, bj, dir)],
-                                       bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        has_diag = true;
+                        break;
                     }
-                }
-            }
 
-            // Loop over upper offset pointer and do linear combination for nnz entry
-            for(rocsparse_int k = diag_j + 1; k < row_end_j; ++k)
-            {
-                rocsparse_int bsr_col_k = bsr_col_ind[k] - base;
+                    // Skip all upper matrix blocks
+                    if(bsr_col > i)
+                    {
+                        break;
+                    }
 
-                if(nnz_entries[bsr_col_k] != -1)
-                {
-                    rocsparse_int m = nnz_entries[bsr_col_k];
+                    // Process all lower matrix BSR blocks
+
+                    // Obtain corresponding row entry and exit point that corresponds with the
+                    // current BSR column. Actually, we skip all lower matrix column indices,
+                    // therefore starting with the diagonal entry.
+                    rocsparse_int diag_j    = diag_offset[bsr_col];
+                    rocsparse_int row_end_j = bsr_row_ptr[bsr_col + 1] - base;
 
                     // Loop through all rows within the BSR block
                     for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
                     {
-                        // Loop through columns of bi-th row and do linear combination
-                        for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                        T diag = bsr_val[BSR_IND(diag_j, bi, bi, dir)];
+
+                        // Process all rows within the BSR block
+                        for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
                         {
-                            T sum = static_cast<T>(0);
+                            T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+
+                            // Multiplication factor
+                            bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
 
-                            for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                            // Loop through columns of bk-th row and do linear combination
+                            for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
                             {
-                                sum = std::fma(bsr_val[BSR_IND(j, bi, bk, dir)],
-                                               bsr_val[BSR_IND(k, bk, bj, dir)],
-                                               sum);
+                                bsr_val[BSR_IND(j, bk, bj, dir)]
+                                    = std::fma(-val,
+                                               bsr_val[BSR_IND(diag_j, bi, bj, dir)],
+                                               bsr_val[BSR_IND(j, bk, bj, dir)]);
                             }
-
-                            bsr_val[BSR_IND(m, bi, bj, dir)] -= sum;
                         }
                     }
-                }
-            }
-        }
 
-        // Check for structural pivot
-        if(!has_diag)
-        {
-            *struct_pivot = std::min(*struct_pivot, i + base);
-            break;
-        }
+                    // Loop over upper offset pointer and do linear combination for nnz entry
+                    for(rocsparse_int k = diag_j + 1; k < row_end_j; ++k)
+                    {
+                        rocsparse_int bsr_col_k = bsr_col_ind[k] - base;
 
-        // Process diagonal
-        if(bsr_col_ind[j] - base == i)
-        {
-            // Loop through all rows within the BSR block
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
-            {
-                T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
+                        if(nnz_entries[bsr_col_k] != -1)
+                        {
+                            rocsparse_int m = nnz_entries[bsr_col_k];
+
+                            // Loop through all rows within the BSR block
+                            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                            {
+                                // Loop through columns of bi-th row and do linear combination
+                                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                                {
+                                    T sum = static_cast<T>(0);
+
+                                    for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                                    {
+                                        sum = std::fma(bsr_val[BSR_IND(j, bi, bk, dir)],
+                                                       bsr_val[BSR_IND(k, bk, bj, dir)],
+                                                       sum);
+                                    }
+
+                                    bsr_val[BSR_IND(m, bi, bj, dir)] -= sum;
+                                }
+                            }
+                        }
+                    }
+                }
 
-                if(boost)
+                // Check for structural pivot
+                if(!has_diag)
                 {
-                    diag = (boost_tol >= std::abs(diag)) ? boost_val : diag;
-                    bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                    local_struct_pivot = std::min(local_struct_pivot, i + base);
                 }
                 else
                 {
-                    // Check for numeric pivot
-                    if(diag == static_cast<T>(0))
+                    // Process diagonal
+                    for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
                     {
-                        *numeric_pivot = std::min(*numeric_pivot, bsr_col_ind[j]);
-                        continue;
-                    }
-                }
+                        T diag = bsr_val[BSR_IND(j, bi, bi, dir)];
 
-                // Process all rows within the BSR block after bi-th row
-                for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    T val = bsr_val[BSR_IND(j, bk, bi, dir)];
+                        if(boost)
+                        {
+                            diag = (boost_tol >= std::abs(diag)) ? boost_val : diag;
+                            bsr_val[BSR_IND(j, bi, bi, dir)] = diag;
+                        }
+                        else
+                        {
+                            // Check for numeric pivot
+                            if(diag == static_cast<T>(0))
+                            {
+                                local_numeric_pivot
+                                    = std::min(local_numeric_pivot, bsr_col_ind[j]);
+                                continue;
+                            }
+                        }
 
-                    // Multiplication factor
-                    bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
+                        // Process all rows within the BSR block after bi-th row
+                        for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
+                        {
+                            T val = bsr_val[BSR_IND(j, bk, bi, dir)];
 
-                    // Loop through remaining columns of bk-th row and do linear combination
-                    for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
-                    {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = std::fma(-val,
-                                       bsr_val[BSR_IND(j, bi, bj, dir)],
-                                       bsr_val[BSR_IND(j, bk, bj, dir)]);
+                            // Multiplication factor
+                            bsr_val[BSR_IND(j, bk, bi, dir)] = val /= diag;
+
+                            // Loop through remaining columns of bk-th row and do linear combination
+                            for(rocsparse_int bj = bi + 1; bj < bsr_dim; ++bj)
+                            {
+                                bsr_val[BSR_IND(j, bk, bj, dir)]
+                                    = std::fma(-val,
+                                               bsr_val[BSR_IND(j, bi, bj, dir)],
+                                               bsr_val[BSR_IND(j, bk, bj, dir)]);
+                            }
+                        }
                     }
-                }
-            }
-        }
 
-        // Store diagonal BSR block entry point
-        rocsparse_int row_diag = diag_offset[i] = j;
+                    // Store diagonal BSR block entry point
+                    rocsparse_int row_diag = diag_offset[i] = j;
 
-        // Process upper diagonal BSR blocks
-        for(j = row_diag + 1; j < row_end; ++j)
-        {
-            // Loop through all rows within the BSR block
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
-            {
-                // Process all rows within the BSR block after bi-th row
-                for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
-                {
-                    // Loop through columns of bk-th row and do linear combination
-                    for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                    // Process upper diagonal BSR blocks
+                    for(j = row_diag + 1; j < row_end; ++j)
                     {
-                        bsr_val[BSR_IND(j, bk, bj, dir)]
-                            = std::fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
-                                       bsr_val[BSR_IND(j, bi, bj, dir)],
-                                       bsr_val[BSR_IND(j, bk, bj, dir)]);
+                        // Loop through all rows within the BSR block
+                        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                        {
+                            // Process all rows within the BSR block after bi-th row
+                            for(rocsparse_int bk = bi + 1; bk < bsr_dim; ++bk)
+                            {
+                                // Loop through columns of bk-th row and do linear combination
+                                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                                {
+                                    bsr_val[BSR_IND(j, bk, bj, dir)]
+                                        = std::fma(-bsr_val[BSR_IND(row_diag, bk, bi, dir)],
+                                                   bsr_val[BSR_IND(j, bi, bj, dir)],
+                                                   bsr_val[BSR_IND(j, bk, bj, dir)]);
+                                }
+                            }
+                        }
                     }
                 }
+
+                // Reset entry points
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    rocsparse_int col_j = bsr_col_ind[j] - base;
+                    nnz_entries[col_j]  = -1;
+                }
             }
         }
 
-        // Reset entry points
-        for(j = row_begin; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp critical
+#endif
         {
-            rocsparse_int col_j = bsr_col_ind[j] - base;
-            nnz_entries[col_j]  = -1;
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
         }
     }
 
@@ -5779,329 +7037,737 @@ void host_csric0(rocsparse_int                     M,
                  double                            tol)
 {
     // Initialize pivot
-    *struct_pivot   = -1;
-    *numeric_pivot  = -1;
-    *singular_pivot = -1;
+    *struct_pivot   = M + 1;
+    *numeric_pivot  = M + 1;
+    *singular_pivot = M + 1;
 
     // pointer of upper part of each row
     std::vector<rocsparse_int> diag_offset(M);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
 
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < M; ++ai)
-    {
-        // ai-th row entries
-        rocsparse_int row_begin = csr_row_ptr[ai] - base;
-        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
-        rocsparse_int j;
+    // Rows only depend on the rows of their lower part, rows of the same level are
+    // factorized concurrently
+    host_trm_info<rocsparse_int> info;
+    host_csrsv_analysis(rocsparse_operation_none,
+                        M,
+                        csr_row_ptr.data(),
+                        csr_col_ind.data(),
+                        rocsparse_fill_mode_lower,
+                        base,
+                        &info);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        rocsparse_int local_struct_pivot   = M + 1;
+        rocsparse_int local_numeric_pivot  = M + 1;
+        rocsparse_int local_singular_pivot = M + 1;
+
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(rocsparse_int n = info.level_ptr[level - 1]; n < info.level_ptr[level]; ++n)
+            {
+                rocsparse_int ai = info.level_ind[n];
+
+                // ai-th row entries
+                rocsparse_int row_begin = csr_row_ptr[ai] - base;
+                rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+                rocsparse_int j;
+
+                T sum = static_cast<T>(0);
+
+                bool has_diag = false;
+
+                // loop over ai-th row nnz entries
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    rocsparse_int col_j = csr_col_ind[j] - base;
+                    T             val_j = csr_val[j];
+
+                    // Mark diagonal and skip row
+                    if(col_j == ai)
+                    {
+                        has_diag = true;
+                        break;
+                    }
+
+                    // Skip upper triangular
+                    if(col_j > ai)
+                    {
+                        break;
+                    }
+
+                    rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
+                    rocsparse_int row_diag_j  = diag_offset[col_j];
+
+                    T local_sum = static_cast<T>(0);
+                    T diag_val  = csr_val[row_diag_j];
+                    T inv_diag  = static_cast<T>(0);
+
+                    // Check for numeric negative
+                    if((std::real(diag_val) <= tol) && (std::imag(diag_val) == 0))
+                    {
+                        // Numerical negative diagonal
+                        local_singular_pivot = std::min(local_singular_pivot, col_j + base);
+                    }
+
+                    // Check for numeric zero
+                    if(diag_val == static_cast<T>(0))
+                    {
+                        // Numerical zero diagonal
+                        local_numeric_pivot = std::min(local_numeric_pivot, col_j + base);
+                    }
+                    else
+                    {
+
+                        inv_diag = static_cast<T>(1) / diag_val;
+                    }
+
+                    // loop over upper offset pointer and do linear combination for nnz entry,
+                    // the matching entries of the ai-th row are found by merging both sorted rows
+                    rocsparse_int idx = row_begin;
+                    for(rocsparse_int k = row_begin_j; k < row_diag_j; ++k)
+                    {
+                        rocsparse_int col_k = csr_col_ind[k] - base;
+
+                        while(idx < j && csr_col_ind[idx] - base < col_k)
+                        {
+                            ++idx;
+                        }
+
+                        // if nnz at this position do linear combination
+                        if(idx < j && csr_col_ind[idx] - base == col_k)
+                        {
+                            local_sum
+                                = std::fma(csr_val[k], rocsparse_conj(csr_val[idx]), local_sum);
+                        }
+                    }
+
+                    val_j = (val_j - local_sum) * inv_diag;
+                    sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
+
+                    csr_val[j] = val_j;
+                }
+
+                if(!has_diag)
+                {
+                    // Structural (and numerical) zero diagonal
+                    local_struct_pivot  = std::min(local_struct_pivot, ai + base);
+                    local_numeric_pivot = std::min(local_numeric_pivot, ai + base);
+                }
+                else
+                {
+                    // Store diagonal offset
+                    diag_offset[ai] = j;
+
+                    // Process diagonal entry
+                    T diag_entry = csr_val[j] - sum;
+                    csr_val[j]   = std::sqrt(std::abs(diag_entry));
+
+                    auto tolXtol = tol * tol;
+                    if((std::real(diag_entry) <= tolXtol) && (std::imag(diag_entry) == 0))
+                    {
+                        local_singular_pivot = std::min(local_singular_pivot, ai + base);
+                    }
+
+                    // check for zero diagonal
+                    if(diag_entry == static_cast<T>(0))
+                    {
+                        local_numeric_pivot = std::min(local_numeric_pivot, ai + base);
+                    }
+                }
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot   = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot  = std::min(*numeric_pivot, local_numeric_pivot);
+            *singular_pivot = std::min(*singular_pivot, local_singular_pivot);
+        }
+    }
+
+    *numeric_pivot  = std::min(*numeric_pivot, *struct_pivot);
+    *singular_pivot = std::min(*singular_pivot, *numeric_pivot);
+
+    *struct_pivot   = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot  = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+    *singular_pivot = (*singular_pivot == M + 1) ? -1 : *singular_pivot;
+}
+
+template <typename T, typename U>
+void host_csrilu0(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  std::vector<T>&                   csr_val,
+                  rocsparse_index_base              base,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot,
+                  rocsparse_int*                    singular_pivot,
+                  double                            tol,
+                  bool                              boost,
+                  U                                 boost_tol,
+                  T                                 boost_val)
+{
+    if((struct_pivot == nullptr) || (numeric_pivot == nullptr) || (singular_pivot == nullptr))
+    {
+        std::cerr << "host_csrilu0: invalid parameters, failed condition: ((struct_pivot != "
+                     "nullptr) && (numeric_pivot != nullptr) && (singular_pivot != nullptr))."
+                  << std::endl;
+        throw(1);
+    }
+
+    // Initialize pivot
+    *struct_pivot   = M + 1;
+    *numeric_pivot  = M + 1;
+    *singular_pivot = M + 1;
+
+    // pointer of upper part of each row
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    // Rows only depend on the rows of their lower part, rows of the same level are
+    // factorized concurrently
+    host_trm_info<rocsparse_int> info;
+    host_csrsv_analysis(rocsparse_operation_none,
+                        M,
+                        csr_row_ptr.data(),
+                        csr_col_ind.data(),
+                        rocsparse_fill_mode_lower,
+                        base,
+                        &info);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        rocsparse_int local_struct_pivot   = M + 1;
+        rocsparse_int local_numeric_pivot  = M + 1;
+        rocsparse_int local_singular_pivot = M + 1;
+
+        for(size_t level = 1; level < info.level_ptr.size(); ++level)
+        {
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+            for(rocsparse_int n = info.level_ptr[level - 1]; n < info.level_ptr[level]; ++n)
+            {
+                rocsparse_int ai = info.level_ind[n];
+
+                // ai-th row entries
+                rocsparse_int row_begin = csr_row_ptr[ai] - base;
+                rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+                rocsparse_int j;
+
+                bool          has_diag = false;
+                rocsparse_int diag_pos = -1;
+
+                // loop over ai-th row nnz entries
+                for(j = row_begin; j < row_end; ++j)
+                {
+                    // if nnz entry is in lower matrix
+                    if(csr_col_ind[j] - base < ai)
+                    {
+
+                        rocsparse_int col_j  = csr_col_ind[j] - base;
+                        rocsparse_int diag_j = diag_offset[col_j];
+                        if(diag_j < 0)
+                            continue;
+
+                        T diag_val = csr_val[diag_j];
+
+                        if(boost)
+                        {
+                            // The diagonal of row col_j has already been boosted when
+                            // processing row col_j
+                            diag_val = (boost_tol >= std::abs(diag_val)) ? boost_val : diag_val;
+                        }
+                        else
+                        {
+
+                            // Check for numeric singular pivot
+                            if(std::abs(diag_val) <= tol)
+                            {
+                                local_singular_pivot
+                                    = std::min(local_singular_pivot, col_j + base);
+                            }
+
+                            // Check for numeric zero pivot
+                            if(diag_val == static_cast<T>(0))
+                            {
+                                local_numeric_pivot = std::min(local_numeric_pivot, col_j + base);
+                                continue;
+                            }
+                        }
+
+                        {
+                            // multiplication factor
+
+                            csr_val[j] = csr_val[j] / diag_val;
+
+                            // loop over upper offset pointer and do linear combination for nnz
+                            // entry, the matching entries of the ai-th row are found by merging
+                            // both sorted rows
+                            rocsparse_int idx = j + 1;
+                            for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base;
+                                ++k)
+                            {
+                                rocsparse_int col_k = csr_col_ind[k] - base;
+
+                                while(idx < row_end && csr_col_ind[idx] - base < col_k)
+                                {
+                                    ++idx;
+                                }
+
+                                // if nnz at this position do linear combination
+                                if(idx < row_end && csr_col_ind[idx] - base == col_k)
+                                {
+                                    csr_val[idx] = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
+                                }
+                            }
+                        }
+                    }
+                    else if(csr_col_ind[j] - base == ai)
+                    {
+                        has_diag = true;
+                        diag_pos = j;
+                        break;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                if(!has_diag)
+                {
+                    // Structural (and numerical) zero diagonal. The factor values are not
+                    // meaningful once a structural zero pivot exists and may differ from a
+                    // row by row factorization, callers discard them in that case
+                    local_struct_pivot  = std::min(local_struct_pivot, ai + base);
+                    local_numeric_pivot = std::min(local_numeric_pivot, ai + base);
+                }
+                else
+                {
+                    // set diagonal pointer to diagonal element
+                    diag_offset[ai] = diag_pos;
+                    if(boost)
+                    {
+                        if(std::abs(csr_val[diag_pos]) <= boost_tol)
+                        {
+                            csr_val[diag_pos] = boost_val;
+                        }
+                    }
+                    else
+                    {
+                        const bool is_singular_diag = (std::abs(csr_val[diag_pos]) <= tol);
+                        const bool is_zero_diag     = (csr_val[diag_pos] == static_cast<T>(0));
+
+                        // check for singular diagonal
+                        if(is_singular_diag)
+                        {
+                            local_singular_pivot = std::min(local_singular_pivot, ai + base);
+                        }
+
+                        // check for zero diagonal
+                        if(is_zero_diag)
+                        {
+                            local_numeric_pivot = std::min(local_numeric_pivot, ai + base);
+                        }
+                    }
+                }
+            }
+        }
 
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp critical
+#endif
         {
-            nnz_entries[csr_col_ind[j] - base] = j;
+            *struct_pivot   = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot  = std::min(*numeric_pivot, local_numeric_pivot);
+            *singular_pivot = std::min(*singular_pivot, local_singular_pivot);
         }
+    }
 
-        T sum = static_cast<T>(0);
-
-        bool has_diag = false;
+    *numeric_pivot  = std::min(*numeric_pivot, *struct_pivot);
+    *singular_pivot = std::min(*singular_pivot, *numeric_pivot);
 
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            rocsparse_int col_j = csr_col_ind[j] - base;
-            T             val_j = csr_val[j];
+    *struct_pivot   = (*struct_pivot == M + 1) ? -1 : *struct_pivot;
+    *numeric_pivot  = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
+    *singular_pivot = (*singular_pivot == M + 1) ? -1 : *singular_pivot;
+}
 
-            // Mark diagonal and skip row
-            if(col_j == ai)
-            {
-                has_diag = true;
-                break;
-            }
+// Rows updated in place by one thread during an asynchronous host itilu0 sweep. Entries of
+// other row blocks are read from the snapshot taken at the start of the sweep, which keeps
+// the asynchronous reference deterministic and independent of the number of threads.
+static constexpr int64_t host_csritilu0_async_block_rows = 1024;
+
+// One sweep of the fixed-point iteration of Chow and Patel over the in-place ILU0 storage x.
+// Rows in [own_begin, own_end) of the current row block are read from x, all other rows
+// from x0. Synchronous sweeps have no own rows and only read x0. Returns the max norm of
+// the residual A - LU evaluated during the sweep, non-finite entries being skipped.
+template <bool RESIDUAL, typename T, typename I, typename J>
+static floating_data_t<T> host_csritilu0_sweep(bool                 async,
+                                               bool                 guard_diag,
+                                               J                    M,
+                                               const I*             csr_row_ptr,
+                                               const J*             csr_col_ind,
+                                               const T*             csr_val,
+                                               rocsparse_index_base base,
+                                               const I*             diag,
+                                               const I*             ucol_ptr,
+                                               const J*             urow_ind,
+                                               const I*             uperm,
+                                               const T*             x0,
+                                               T*                   x)
+{
+    const J block_rows = async ? static_cast<J>(std::min(static_cast<int64_t>(M),
+                                                         host_csritilu0_async_block_rows))
+                               : 1;
+    const J nblocks    = (M - 1) / block_rows + 1;
+    const J chunk      = async ? 1 : 64;
 
-            // Skip upper triangular
-            if(col_j > ai)
-            {
-                break;
-            }
+    floating_data_t<T> nrm = static_cast<floating_data_t<T>>(0);
 
-            rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
-            rocsparse_int row_diag_j  = diag_offset[col_j];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, chunk) reduction(max : nrm)
+#endif
+    for(J b = 0; b < nblocks; ++b)
+    {
+        const J row_begin = b * block_rows;
+        const J row_end   = std::min(M, row_begin + block_rows);
+        const J own_begin = async ? row_begin : 0;
+        const J own_end   = async ? row_end : 0;
 
-            T local_sum = static_cast<T>(0);
-            T diag_val  = csr_val[row_diag_j];
-            T inv_diag  = static_cast<T>(0);
+        for(J i = row_begin; i < row_end; ++i)
+        {
+            const T* xi     = (i >= own_begin && i < own_end) ? x : x0;
+            const I  lbegin = csr_row_ptr[i] - base;
+            const I  lend   = diag[i];
+            const I  end    = csr_row_ptr[i + 1] - base;
 
-            // Check for numeric negative
-            if((std::real(diag_val) <= tol) && (std::imag(diag_val) == 0))
+            for(I k = lbegin; k < end; ++k)
             {
-                // Numerical negative diagonal
-                *singular_pivot = (*singular_pivot == -1) ? (col_j + base)
-                                                          : std::min(*singular_pivot, col_j + base);
-            }
+                const J  j  = csr_col_ind[k] - base;
+                const T* xj = (j >= own_begin && j < own_end) ? x : x0;
+                const T  d  = xj[diag[j]];
 
-            // Check for numeric zero
-            if(diag_val == static_cast<T>(0))
-            {
-                // Numerical zero diagonal
-                *numeric_pivot = (*numeric_pivot == -1) ? (col_j + base)
-                                                        : std::min(*numeric_pivot, col_j + base);
-            }
-            else
-            {
+                // Merge row i of L with column j of U
+                T       sum  = static_cast<T>(0);
+                I       kx   = lbegin;
+                I       ky   = ucol_ptr[j];
+                const I uend = ucol_ptr[j + 1];
+                while(kx < lend && ky < uend)
+                {
+                    const J jx = csr_col_ind[kx] - base;
+                    const J jy = urow_ind[ky];
+                    if(jx == jy)
+                    {
+                        const T* xu = (jy >= own_begin && jy < own_end) ? x : x0;
+                        sum         = std::fma(xi[kx], xu[uperm[ky]], sum);
+                    }
+                    kx = (jx <= jy) ? (kx + 1) : kx;
+                    ky = (jx >= jy) ? (ky + 1) : ky;
+                }
 
-                inv_diag = static_cast<T>(1) / diag_val;
-            }
+                T s = csr_val[k] - sum;
+                if(i > j)
+                {
+                    if(guard_diag && std::abs(d) == static_cast<floating_data_t<T>>(0))
+                    {
+                        s = static_cast<T>(0);
+                    }
+                    else
+                    {
+                        s /= d;
+                    }
+                }
 
-            // loop over upper offset pointer and do linear combination for nnz entry
-            for(rocsparse_int k = row_begin_j; k < row_diag_j; ++k)
-            {
-                rocsparse_int col_k = csr_col_ind[k] - base;
+                if(RESIDUAL)
+                {
+                    // Complete (LU)_ij with the unit diagonal of L and the diagonal of U
+                    T lu = sum;
+                    if(i < j)
+                    {
+                        lu += xi[k];
+                    }
+                    else if(i > j)
+                    {
+                        lu = std::fma(xi[k], d, lu);
+                    }
+                    else
+                    {
+                        lu += d;
+                    }
+
+                    const floating_data_t<T> r = std::abs(csr_val[k] - lu);
+                    if(!std::isinf(r) && !std::isnan(r))
+                    {
+                        nrm = std::max(nrm, r);
+                    }
+                }
 
-                // if nnz at this position do linear combination
-                if(nnz_entries[col_k] != 0)
+                const floating_data_t<T> abs_s = std::abs(s);
+                if(!std::isinf(abs_s) && !std::isnan(abs_s))
                 {
-                    rocsparse_int idx = nnz_entries[col_k];
-                    local_sum = std::fma(csr_val[k], rocsparse_conj(csr_val[idx]), local_sum);
+                    x[k] = s;
                 }
             }
+        }
+    }
 
-            val_j = (val_j - local_sum) * inv_diag;
-            sum   = std::fma(val_j, rocsparse_conj(val_j), sum);
+    return nrm;
+}
 
-            csr_val[j] = val_j;
-        }
+template <typename T, typename I, typename J>
+rocsparse_status host_csritilu0(rocsparse_itilu0_alg alg,
+                                J                    options,
+                                J*                   nmaxiter,
+                                floating_data_t<T>   tol,
+                                J                    M,
+                                I                    nnz,
+                                const I*             csr_row_ptr,
+                                const J*             csr_col_ind,
+                                const T*             csr_val,
+                                T*                   ilu0,
+                                rocsparse_index_base base,
+                                floating_data_t<T>*  history)
+{
+    using real_t = floating_data_t<T>;
 
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            *struct_pivot
-                = (*struct_pivot == -1) ? (ai + base) : std::min(*struct_pivot, ai + base);
-            *numeric_pivot
-                = (*numeric_pivot == -1) ? (ai + base) : std::min(*numeric_pivot, ai + base);
-        }
-        else
-        {
-            // Store diagonal offset
-            diag_offset[ai] = j;
+    if(M == 0)
+    {
+        *nmaxiter = 0;
+        return rocsparse_status_success;
+    }
 
-            // Process diagonal entry
-            T diag_entry = csr_val[j] - sum;
-            csr_val[j]   = std::sqrt(std::abs(diag_entry));
+    if(nnz == 0)
+    {
+        return rocsparse_status_zero_pivot;
+    }
 
-            auto tolXtol = tol * tol;
-            if((std::real(diag_entry) <= tolXtol) && (std::imag(diag_entry) == 0))
+    // Diagonal positions, and the strictly upper part stored by columns with uperm pointing
+    // back to the CSR entries
+    std::vector<I> diag(M, -1);
+    std::vector<I> ucol_ptr(M + 1, 0);
+    for(J i = 0; i < M; ++i)
+    {
+        for(I k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            const J j = csr_col_ind[k] - base;
+            if(j == i)
             {
-                *singular_pivot
-                    = (*singular_pivot == -1) ? (ai + base) : std::min(*singular_pivot, ai + base);
+                diag[i] = k;
             }
-
-            // check for zero diagonal
-            if(diag_entry == static_cast<T>(0))
+            else if(j > i)
             {
-                *numeric_pivot
-                    = (*numeric_pivot == -1) ? (ai + base) : std::min(*numeric_pivot, ai + base);
+                ++ucol_ptr[j + 1];
             }
         }
 
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
+        if(diag[i] == -1)
         {
-            nnz_entries[csr_col_ind[j] - base] = 0;
+            return rocsparse_status_zero_pivot;
         }
     }
 
-    if(*struct_pivot != -1)
+    for(J j = 0; j < M; ++j)
     {
-        *numeric_pivot
-            = (*numeric_pivot == -1) ? (*struct_pivot) : std::min(*numeric_pivot, *struct_pivot);
+        ucol_ptr[j + 1] += ucol_ptr[j];
     }
 
-    if(*numeric_pivot != -1)
+    std::vector<J> urow_ind(ucol_ptr[M]);
+    std::vector<I> uperm(ucol_ptr[M]);
     {
-        *singular_pivot = (*singular_pivot == -1) ? (*numeric_pivot)
-                                                  : std::min(*singular_pivot, *numeric_pivot);
+        std::vector<I> next(ucol_ptr.begin(), ucol_ptr.end() - 1);
+        for(J i = 0; i < M; ++i)
+        {
+            for(I k = diag[i] + 1; k < csr_row_ptr[i + 1] - base; ++k)
+            {
+                const I p   = next[csr_col_ind[k] - base]++;
+                urow_ind[p] = i;
+                uperm[p]    = k;
+            }
+        }
     }
-}
 
-template <typename T, typename U>
-void host_csrilu0(rocsparse_int                     M,
-                  const std::vector<rocsparse_int>& csr_row_ptr,
-                  const std::vector<rocsparse_int>& csr_col_ind,
-                  std::vector<T>&                   csr_val,
-                  rocsparse_index_base              base,
-                  rocsparse_int*                    struct_pivot,
-                  rocsparse_int*                    numeric_pivot,
-                  rocsparse_int*                    singular_pivot,
-                  double                            tol,
-                  bool                              boost,
-                  U                                 boost_tol,
-                  T                                 boost_val)
-{
-    if((struct_pivot == nullptr) || (numeric_pivot == nullptr) || (singular_pivot == nullptr))
+    const bool verbose             = (options & rocsparse_itilu0_option_verbose) > 0;
+    const bool stopping_criteria   = (options & rocsparse_itilu0_option_stopping_criteria) > 0;
+    const bool convergence_history = (options & rocsparse_itilu0_option_convergence_history) > 0;
+
+    const bool inplace = (alg == rocsparse_itilu0_alg_default
+                          || alg == rocsparse_itilu0_alg_async_inplace);
+    const bool async   = inplace || (alg == rocsparse_itilu0_alg_async_split);
+    const bool fusion  = (alg == rocsparse_itilu0_alg_sync_split_fusion);
+
+    // The asynchronous algorithms do not compute the norm of the correction
+    const bool compute_nrm_residual = (options & rocsparse_itilu0_option_compute_nrm_residual) > 0;
+    const bool compute_nrm_corr
+        = !async && (options & rocsparse_itilu0_option_compute_nrm_correction) > 0;
+
+    // Without residual, the in-place algorithm runs all iterations
+    const bool stopping = stopping_criteria && (compute_nrm_residual || !inplace);
+
+    real_t nrm_matrix = static_cast<real_t>(0);
+    if(compute_nrm_residual || compute_nrm_corr)
     {
-        std::cerr << "host_csrilu0: invalid parameters, failed condition: ((struct_pivot != "
-                     "nullptr) && (numeric_pivot != nullptr) && (singular_pivot != nullptr))."
-                  << std::endl;
-        throw(1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : nrm_matrix)
+#endif
+        for(I k = 0; k < nnz; ++k)
+        {
+            nrm_matrix = std::max(nrm_matrix, static_cast<real_t>(std::abs(csr_val[k])));
+        }
     }
 
-    // Initialize pivot
-    *struct_pivot   = -1;
-    *numeric_pivot  = -1;
-    *singular_pivot = -1;
+    const J             maxiter = *nmaxiter;
+    std::vector<T>      x0(nnz);
+    std::vector<real_t> log_corr(compute_nrm_corr ? maxiter : 0);
+    std::vector<real_t> log_residual(compute_nrm_residual ? maxiter : 0);
 
-    // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(M, -1);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
+    static constexpr real_t tol_increment = (sizeof(real_t) == sizeof(float)) ? 1.0e-5 : 1.0e-15;
 
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < M; ++ai)
+    rocsparse_status status             = rocsparse_status_success;
+    J                niter              = maxiter;
+    real_t           nrm_indicator_prev = static_cast<real_t>(0);
+    for(J iter = 0; iter < maxiter; ++iter)
     {
-        // ai-th row entries
-        rocsparse_int row_begin = csr_row_ptr[ai] - base;
-        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
-        rocsparse_int j;
-
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(I k = 0; k < nnz; ++k)
+        {
+            x0[k] = ilu0[k];
+        }
+
+        real_t nrm_residual = static_cast<real_t>(0);
+        real_t nrm_corr     = static_cast<real_t>(0);
+        if(compute_nrm_residual)
+        {
+            nrm_residual = host_csritilu0_sweep<true>(async,
+                                                      fusion,
+                                                      M,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      csr_val,
+                                                      base,
+                                                      diag.data(),
+                                                      ucol_ptr.data(),
+                                                      urow_ind.data(),
+                                                      uperm.data(),
+                                                      x0.data(),
+                                                      ilu0)
+                           / nrm_matrix;
+            log_residual[iter] = nrm_residual;
+        }
+        else
         {
-            nnz_entries[csr_col_ind[j] - base] = j;
+            host_csritilu0_sweep<false>(async,
+                                        fusion,
+                                        M,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        csr_val,
+                                        base,
+                                        diag.data(),
+                                        ucol_ptr.data(),
+                                        urow_ind.data(),
+                                        uperm.data(),
+                                        x0.data(),
+                                        ilu0);
         }
 
-        bool          has_diag = false;
-        rocsparse_int diag_pos = -1;
-
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
+        if(compute_nrm_corr)
         {
-            // if nnz entry is in lower matrix
-            if(csr_col_ind[j] - base < ai)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : nrm_corr)
+#endif
+            for(I k = 0; k < nnz; ++k)
             {
+                nrm_corr = std::max(nrm_corr, static_cast<real_t>(std::abs(ilu0[k] - x0[k])));
+            }
 
-                rocsparse_int col_j  = csr_col_ind[j] - base;
-                rocsparse_int diag_j = diag_offset[col_j];
-                if(diag_j < 0)
-                    continue;
-
-                T diag_val = csr_val[diag_j];
-
-                if(boost)
-                {
-                    diag_val        = (boost_tol >= std::abs(diag_val)) ? boost_val : diag_val;
-                    csr_val[diag_j] = diag_val;
-                }
-                else
-                {
-
-                    // Check for numeric singular pivot
-                    if(std::abs(diag_val) <= tol)
-                    {
-                        *singular_pivot = (*singular_pivot == -1)
-                                              ? (col_j + base)
-                                              : std::min(*singular_pivot, col_j + base);
-                    }
-
-                    // Check for numeric zero pivot
-                    if(diag_val == static_cast<T>(0))
-                    {
-                        *numeric_pivot = (*numeric_pivot == -1)
-                                             ? (col_j + base)
-                                             : std::min(*numeric_pivot, col_j + base);
-                        continue;
-                    }
-                }
+            nrm_corr /= nrm_matrix;
+            log_corr[iter] = nrm_corr;
+        }
 
-                {
-                    // multiplication factor
+        const real_t nrm_indicator
+            = (compute_nrm_residual && compute_nrm_corr)
+                  ? std::max(nrm_residual, nrm_corr)
+                  : (compute_nrm_corr ? nrm_corr : nrm_residual);
 
-                    csr_val[j] = csr_val[j] / diag_val;
+        if(verbose)
+        {
+            std::cout << "host_csritilu0 iter " << iter << " residual " << nrm_residual
+                      << " corr " << nrm_corr << std::endl;
+        }
 
-                    // loop over upper offset pointer and do linear combination for nnz entry
-                    for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base; ++k)
-                    {
-                        // if nnz at this position do linear combination
-                        if(nnz_entries[csr_col_ind[k] - base] != 0)
-                        {
-                            rocsparse_int idx = nnz_entries[csr_col_ind[k] - base];
-                            csr_val[idx]      = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
-                        }
-                    }
-                }
-            }
-            else if(csr_col_ind[j] - base == ai)
+        if(stopping)
+        {
+            if(std::isinf(nrm_indicator) || (!async && std::isnan(nrm_indicator)))
             {
-                has_diag = true;
-                diag_pos = j;
+                niter  = iter + 1;
+                status = rocsparse_status_zero_pivot;
                 break;
             }
-            else
+
+            if(nrm_indicator <= tol && !(fusion && iter == 0))
             {
+                niter = iter + 1;
                 break;
             }
-        }
 
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            *struct_pivot
-                = (*struct_pivot == -1) ? (ai + base) : std::min(*struct_pivot, ai + base);
-            *numeric_pivot
-                = (*numeric_pivot == -1) ? (ai + base) : std::min(*numeric_pivot, ai + base);
-        }
-        else
-        {
-            // set diagonal pointer to diagonal element
-            diag_offset[ai] = diag_pos;
-            if(boost)
+            // Stagnation, the in-place algorithm uses its own thresholds
+            const real_t increment = std::abs(nrm_indicator - nrm_indicator_prev);
+            if(inplace)
             {
-                if(std::abs(csr_val[diag_pos]) <= boost_tol)
+                if(iter > 3 && increment < tol_increment * nrm_indicator
+                   && nrm_indicator < 1.0e-5)
                 {
-                    csr_val[diag_pos] = boost_val;
+                    niter = iter + 1;
+                    break;
                 }
             }
-            else
+            else if(compute_nrm_residual || compute_nrm_corr)
             {
-                const rocsparse_int diag_pos = diag_offset[ai];
-                const bool is_diag = (diag_pos >= 0) && (csr_col_ind[diag_pos] == (ai + base));
-
-                const bool is_singular_diag = is_diag && (std::abs(csr_val[diag_pos]) <= tol);
-                const bool is_zero_diag     = is_diag && (csr_val[diag_pos] == static_cast<T>(0));
-
-                // check for singular diagonal
-                if(is_singular_diag)
-                {
-                    *singular_pivot = (*singular_pivot == -1)
-                                          ? (ai + base)
-                                          : std::min(*singular_pivot, (ai + base));
-                }
-
-                // check for zero diagonal
-                if(is_zero_diag)
+                if(iter > 3 && increment <= tol_increment * nrm_indicator
+                   && nrm_indicator <= tol * 10)
                 {
-                    *numeric_pivot = (*numeric_pivot == -1) ? (ai + base)
-                                                            : std::min(*numeric_pivot, (ai + base));
+                    niter = iter + 1;
+                    break;
                 }
             }
-
-            // clear nnz entries
-            for(j = row_begin; j < row_end; ++j)
-            {
-                nnz_entries[csr_col_ind[j] - base] = 0;
-            }
         }
+
+        nrm_indicator_prev = nrm_indicator;
     }
 
-    if(*struct_pivot != -1)
+    if(stopping)
     {
-        *numeric_pivot
-            = (*numeric_pivot == -1) ? (*struct_pivot) : std::min(*numeric_pivot, *struct_pivot);
+        *nmaxiter = niter;
     }
 
-    if(*numeric_pivot != -1)
+    // Same layout as rocsparse_csritilu0_history
+    if(convergence_history && history != nullptr)
     {
-        *singular_pivot = (*singular_pivot == -1) ? (*numeric_pivot)
-                                                  : std::min(*singular_pivot, *numeric_pivot);
+        for(J iter = 0; iter < niter; ++iter)
+        {
+            if(compute_nrm_corr)
+            {
+                history[iter] = log_corr[iter];
+            }
+            if(compute_nrm_residual)
+            {
+                history[niter + iter] = log_residual[iter];
+            }
+        }
     }
+
+    return status;
 }
 
 // Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
@@ -6324,308 +7990,377 @@ void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
     }
 }
 
+// Number of interleaved systems solved together by the host batched solvers. The entries
+// of a lane group fill a cache line and the sweeps over a lane group are vectorized.
+template <typename T>
+static constexpr rocsparse_int host_interleaved_batch_lanes()
+{
+    return 64 / sizeof(T);
+}
+
 template <typename T>
-void host_gtsv_interleaved_batch_thomas(rocsparse_int m,
-                                        const T*      dl,
-                                        const T*      d,
-                                        const T*      du,
-                                        T*            x,
-                                        rocsparse_int batch_count,
-                                        rocsparse_int batch_stride)
+static void host_gtsv_interleaved_batch_thomas(rocsparse_int m,
+                                               const T*      dl,
+                                               const T*      d,
+                                               const T*      du,
+                                               T*            x,
+                                               rocsparse_int batch_count,
+                                               rocsparse_int batch_stride,
+                                               T*            c1,
+                                               T*            x1)
 {
-    std::vector<T> c1(m * batch_count, 0);
-    std::vector<T> x1(m * batch_count, 0);
+    static constexpr rocsparse_int lanes = host_interleaved_batch_lanes<T>();
+
+    const int64_t bc = batch_count;
+    const int64_t bs = batch_stride;
 
-    // Forward elimination
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(static)
 #endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int j_begin = 0; j_begin < batch_count; j_begin += lanes)
     {
-        c1[j] = du[j] / d[j];
-        x1[j] = x[j] / d[j];
-    }
+        rocsparse_int j_end = std::min(j_begin + lanes, batch_count);
 
-    for(rocsparse_int i = 1; i < m; i++)
-    {
+        // Forward elimination
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            c1[j] = du[j] / d[j];
+            x1[j] = x[j] / d[j];
+        }
+
+        for(rocsparse_int i = 1; i < m; i++)
         {
-            rocsparse_int index = batch_count * i + j;
-            rocsparse_int minus = batch_count * (i - 1) + j;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                int64_t index = bc * i + j;
+                int64_t minus = bc * (i - 1) + j;
 
-            T tdu = du[batch_stride * i + j];
-            T td  = d[batch_stride * i + j];
-            T tdl = dl[batch_stride * i + j];
-            T tx  = x[batch_stride * i + j];
+                T tdu = du[bs * i + j];
+                T td  = d[bs * i + j];
+                T tdl = dl[bs * i + j];
+                T tx  = x[bs * i + j];
 
-            c1[index] = tdu / (td - c1[minus] * tdl);
-            x1[index] = (tx - x1[minus] * tdl) / (td - c1[minus] * tdl);
+                c1[index] = tdu / (td - c1[minus] * tdl);
+                x1[index] = (tx - x1[minus] * tdl) / (td - c1[minus] * tdl);
+            }
         }
-    }
 
-    // backward substitution
+        // backward substitution
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
-    {
-        x[batch_stride * (m - 1) + j] = x1[batch_count * (m - 1) + j];
-    }
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            x[bs * (m - 1) + j] = x1[bc * (m - 1) + j];
+        }
 
-    for(rocsparse_int i = m - 2; i >= 0; i--)
-    {
+        for(rocsparse_int i = m - 2; i >= 0; i--)
+        {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            rocsparse_int index = batch_count * i + j;
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                int64_t index = bc * i + j;
 
-            x[batch_stride * i + j] = x1[index] - c1[index] * x[batch_stride * (i + 1) + j];
+                x[bs * i + j] = x1[index] - c1[index] * x[bs * (i + 1) + j];
+            }
         }
     }
 }
 
 template <typename T>
-void host_gtsv_interleaved_batch_lu(rocsparse_int m,
-                                    const T*      dl,
-                                    const T*      d,
-                                    const T*      du,
-                                    T*            x,
-                                    rocsparse_int batch_count,
-                                    rocsparse_int batch_stride)
+static void host_gtsv_interleaved_batch_lu(rocsparse_int  m,
+                                           const T*       dl,
+                                           const T*       d,
+                                           const T*       du,
+                                           T*             x,
+                                           rocsparse_int  batch_count,
+                                           rocsparse_int  batch_stride,
+                                           T*             l,
+                                           T*             u0,
+                                           T*             u1,
+                                           T*             u2,
+                                           rocsparse_int* p,
+                                           rocsparse_int* start)
 {
-    std::vector<T>             l(m * batch_count, 0);
-    std::vector<T>             u0(m * batch_count, 0);
-    std::vector<T>             u1(m * batch_count, 0);
-    std::vector<T>             u2(m * batch_count, 0);
-    std::vector<rocsparse_int> p(m * batch_count, 0);
+    static constexpr rocsparse_int lanes = host_interleaved_batch_lanes<T>();
+
+    const int64_t bc = batch_count;
+    const int64_t bs = batch_stride;
 
-    for(rocsparse_int i = 0; i < m; i++)
-    {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(static)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int j_begin = 0; j_begin < batch_count; j_begin += lanes)
+    {
+        rocsparse_int j_end = std::min(j_begin + lanes, batch_count);
+
+        for(rocsparse_int i = 0; i < m; i++)
         {
-            l[batch_count * i + j]  = dl[batch_stride * i + j];
-            u0[batch_count * i + j] = d[batch_stride * i + j];
-            u1[batch_count * i + j] = du[batch_stride * i + j];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                l[bc * i + j]  = dl[bs * i + j];
+                u0[bc * i + j] = d[bs * i + j];
+                u1[bc * i + j] = du[bs * i + j];
+                u2[bc * i + j] = static_cast<T>(0);
+                p[bc * i + j]  = 0;
+            }
         }
-    }
 
-    // LU decomposition
-    for(rocsparse_int i = 0; i < m - 1; i++)
-    {
+        // LU decomposition
+        for(rocsparse_int i = 0; i < m - 1; i++)
+        {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            T ak_1 = l[batch_count * (i + 1) + j];
-            T bk   = u0[batch_count * i + j];
-
-            if(std::abs(bk) < std::abs(ak_1))
+            for(rocsparse_int j = j_begin; j < j_end; j++)
             {
-                T bk_1 = u0[batch_count * (i + 1) + j];
-                T ck   = u1[batch_count * i + j];
-                T ck_1 = u1[batch_count * (i + 1) + j];
-                T dk   = u2[batch_count * i + j];
+                T ak_1 = l[bc * (i + 1) + j];
+                T bk   = u0[bc * i + j];
+
+                if(std::abs(bk) < std::abs(ak_1))
+                {
+                    T bk_1 = u0[bc * (i + 1) + j];
+                    T ck   = u1[bc * i + j];
+                    T ck_1 = u1[bc * (i + 1) + j];
+                    T dk   = u2[bc * i + j];
 
-                u0[batch_count * i + j] = ak_1;
-                u1[batch_count * i + j] = bk_1;
-                u2[batch_count * i + j] = ck_1;
+                    u0[bc * i + j] = ak_1;
+                    u1[bc * i + j] = bk_1;
+                    u2[bc * i + j] = ck_1;
 
-                u0[batch_count * (i + 1) + j] = ck;
-                u1[batch_count * (i + 1) + j] = dk;
+                    u0[bc * (i + 1) + j] = ck;
+                    u1[bc * (i + 1) + j] = dk;
 
-                rocsparse_int pk             = p[batch_count * i + j];
-                p[batch_count * i + j]       = i + 1;
-                p[batch_count * (i + 1) + j] = pk;
+                    rocsparse_int pk    = p[bc * i + j];
+                    p[bc * i + j]       = i + 1;
+                    p[bc * (i + 1) + j] = pk;
 
-                T xk                          = x[batch_stride * i + j];
-                x[batch_stride * i + j]       = x[batch_stride * (i + 1) + j];
-                x[batch_stride * (i + 1) + j] = xk;
+                    T xk                = x[bs * i + j];
+                    x[bs * i + j]       = x[bs * (i + 1) + j];
+                    x[bs * (i + 1) + j] = xk;
 
-                T lk_1                       = bk / ak_1;
-                l[batch_count * (i + 1) + j] = lk_1;
+                    T lk_1              = bk / ak_1;
+                    l[bc * (i + 1) + j] = lk_1;
 
-                u0[batch_count * (i + 1) + j]
-                    = u0[batch_count * (i + 1) + j] - lk_1 * u1[batch_count * i + j];
-                u1[batch_count * (i + 1) + j]
-                    = u1[batch_count * (i + 1) + j] - lk_1 * u2[batch_count * i + j];
+                    u0[bc * (i + 1) + j] = u0[bc * (i + 1) + j] - lk_1 * u1[bc * i + j];
+                    u1[bc * (i + 1) + j] = u1[bc * (i + 1) + j] - lk_1 * u2[bc * i + j];
+                }
+                else
+                {
+                    p[bc * (i + 1) + j] = i + 1;
+
+                    T lk_1              = ak_1 / bk;
+                    l[bc * (i + 1) + j] = lk_1;
+
+                    u0[bc * (i + 1) + j] = u0[bc * (i + 1) + j] - lk_1 * u1[bc * i + j];
+                    u1[bc * (i + 1) + j] = u1[bc * (i + 1) + j] - lk_1 * u2[bc * i + j];
+                }
             }
-            else
+        }
+
+        // Forward elimination (L * x_new = x_old)
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            start[j] = 0;
+        }
+
+        for(rocsparse_int i = 1; i < m; i++)
+        {
+            for(rocsparse_int j = j_begin; j < j_end; j++)
             {
-                p[batch_count * (i + 1) + j] = i + 1;
+                if(p[bc * i + j] <= i) // no pivoting occured, sum up result
+                {
+                    T temp = static_cast<T>(0);
+                    for(rocsparse_int s = start[j]; s < i; s++)
+                    {
+                        temp = temp - l[bc * (s + 1) + j] * x[bs * s + j];
+                    }
+                    x[bs * i + j] = x[bs * i + j] + temp;
+                    start[j] += i - start[j];
+                }
+            }
+        }
 
-                T lk_1                       = ak_1 / bk;
-                l[batch_count * (i + 1) + j] = lk_1;
+        // backward substitution (U * x_newest = x_new)
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            x[bs * (m - 1) + j] = x[bs * (m - 1) + j] / u0[bc * (m - 1) + j];
+            x[bs * (m - 2) + j]
+                = (x[bs * (m - 2) + j] - u1[bc * (m - 2) + j] * x[bs * (m - 1) + j])
+                  / u0[bc * (m - 2) + j];
+        }
 
-                u0[batch_count * (i + 1) + j]
-                    = u0[batch_count * (i + 1) + j] - lk_1 * u1[batch_count * i + j];
-                u1[batch_count * (i + 1) + j]
-                    = u1[batch_count * (i + 1) + j] - lk_1 * u2[batch_count * i + j];
+        for(rocsparse_int i = m - 3; i >= 0; i--)
+        {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                x[bs * i + j] = (x[bs * i + j] - u1[bc * i + j] * x[bs * (i + 1) + j]
+                                 - u2[bc * i + j] * x[bs * (i + 2) + j])
+                                / u0[bc * i + j];
             }
         }
     }
+}
+
+template <typename T>
+static void host_gtsv_interleaved_batch_qr(rocsparse_int m,
+                                           const T*      dl,
+                                           const T*      d,
+                                           const T*      du,
+                                           T*            x,
+                                           rocsparse_int batch_count,
+                                           rocsparse_int batch_stride,
+                                           T*            r0,
+                                           T*            r1,
+                                           T*            r2)
+{
+    static constexpr rocsparse_int lanes = host_interleaved_batch_lanes<T>();
+
+    const int64_t bc = batch_count;
+    const int64_t bs = batch_stride;
 
-    // Forward elimination (L * x_new = x_old)
-    std::vector<rocsparse_int> start(batch_count, 0);
-    for(rocsparse_int i = 1; i < m; i++)
-    {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp parallel for schedule(static)
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+    for(rocsparse_int j_begin = 0; j_begin < batch_count; j_begin += lanes)
+    {
+        rocsparse_int j_end = std::min(j_begin + lanes, batch_count);
+
+        for(rocsparse_int i = 0; i < m; i++)
         {
-            if(p[batch_count * i + j] <= i) // no pivoting occured, sum up result
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
             {
-                T temp = static_cast<T>(0);
-                for(rocsparse_int s = start[j]; s < i; s++)
-                {
-                    temp = temp - l[batch_count * (s + 1) + j] * x[batch_stride * s + j];
-                }
-                x[batch_stride * i + j] = x[batch_stride * i + j] + temp;
-                start[j] += i - start[j];
+                r0[bc * i + j] = d[bs * i + j];
+                r1[bc * i + j] = du[bs * i + j];
+                r2[bc * i + j] = static_cast<T>(0);
             }
         }
-    }
 
-    // backward substitution (U * x_newest = x_new)
+        // Reduce A = Q*R where Q is orthonormal and R is upper triangular
+        // This means when solving A * x          = b
+        //                      => Q * R * x      = b
+        //                      => Q' * Q * R * x = Q' * b
+        //                      => R * x          = Q' * b
+        // Because A is tri-diagonal, we use Givens rotations
+        // Note on notation used here. I consider the A matrix to have form:
+        // A = b0 c0 0  0  0
+        //     a1 b1 c1 0  0
+        //     0  a2 b2 c2 0
+        //     0  0  a3 b3 c3
+        //     0  0  0  a4 b4
+        for(rocsparse_int i = 0; i < m - 1; i++)
+        {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
-    {
-        x[batch_stride * (m - 1) + j]
-            = x[batch_stride * (m - 1) + j] / u0[batch_count * (m - 1) + j];
-        x[batch_stride * (m - 2) + j]
-            = (x[batch_stride * (m - 2) + j]
-               - u1[batch_count * (m - 2) + j] * x[batch_stride * (m - 1) + j])
-              / u0[batch_count * (m - 2) + j];
-    }
-
-    for(rocsparse_int i = m - 3; i >= 0; i--)
-    {
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                T ak_1 = dl[bs * (i + 1) + j];
+                T bk   = r0[bc * i + j];
+                T bk_1 = r0[bc * (i + 1) + j];
+                T ck   = r1[bc * i + j];
+                T ck_1 = r1[bc * (i + 1) + j];
+
+                T radius
+                    = std::sqrt(std::abs(bk * rocsparse_conj(bk) + ak_1 * rocsparse_conj(ak_1)));
+
+                // Apply Givens rotation
+                // | cos  sin | |bk    ck   0   |
+                // |-sin  cos | |ak_1  bk_1 ck_1|
+                T cos_theta = rocsparse_conj(bk) / radius;
+                T sin_theta = rocsparse_conj(ak_1) / radius;
+
+                r0[bc * i + j] = std::fma(bk, cos_theta, ak_1 * sin_theta);
+                r0[bc * (i + 1) + j]
+                    = std::fma(-ck, rocsparse_conj(sin_theta), bk_1 * rocsparse_conj(cos_theta));
+                r1[bc * i + j]       = std::fma(ck, cos_theta, bk_1 * sin_theta);
+                r1[bc * (i + 1) + j] = ck_1 * rocsparse_conj(cos_theta);
+                r2[bc * i + j]       = ck_1 * sin_theta;
+
+                // Apply Givens rotation to rhs vector
+                // | cos  sin | |xk  |
+                // |-sin  cos | |xk_1|
+                T xk          = x[bs * i + j];
+                T xk_1        = x[bs * (i + 1) + j];
+                x[bs * i + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
+                x[bs * (i + 1) + j]
+                    = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
+            }
+        }
+
+        // Backward substitution on upper triangular R * x = x
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            x[bs * (m - 1) + j] = x[bs * (m - 1) + j] / r0[bc * (m - 1) + j];
+            x[bs * (m - 2) + j]
+                = (x[bs * (m - 2) + j] - r1[bc * (m - 2) + j] * x[bs * (m - 1) + j])
+                  / r0[bc * (m - 2) + j];
+        }
+
+        for(rocsparse_int i = m - 3; i >= 0; i--)
         {
-            x[batch_stride * i + j]
-                = (x[batch_stride * i + j] - u1[batch_count * i + j] * x[batch_stride * (i + 1) + j]
-                   - u2[batch_count * i + j] * x[batch_stride * (i + 2) + j])
-                  / u0[batch_count * i + j];
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                x[bs * i + j] = (x[bs * i + j] - r1[bc * i + j] * x[bs * (i + 1) + j]
+                                 - r2[bc * i + j] * x[bs * (i + 2) + j])
+                                / r0[bc * i + j];
+            }
         }
     }
 }
 
 template <typename T>
-void host_gtsv_interleaved_batch_qr(rocsparse_int m,
-                                    const T*      dl,
-                                    const T*      d,
-                                    const T*      du,
-                                    T*            x,
-                                    rocsparse_int batch_count,
-                                    rocsparse_int batch_stride)
+void host_gtsv_interleaved_batch_buffer_size(rocsparse_gtsv_interleaved_alg algo,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  batch_count,
+                                             size_t*                        buffer_size)
 {
-    std::vector<T> r0(m * batch_count, 0);
-    std::vector<T> r1(m * batch_count, 0);
-    std::vector<T> r2(m * batch_count, 0);
+    size_t size = size_t(m) * batch_count;
 
-    for(rocsparse_int i = 0; i < m; i++)
+    switch(algo)
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            r0[batch_count * i + j] = d[batch_stride * i + j];
-            r1[batch_count * i + j] = du[batch_stride * i + j];
-        }
-    }
-
-    // Reduce A = Q*R where Q is orthonormal and R is upper triangular
-    // This means when solving A * x          = b
-    //                      => Q * R * x      = b
-    //                      => Q' * Q * R * x = Q' * b
-    //                      => R * x          = Q' * b
-    // Because A is tri-diagonal, we use Givens rotations
-    // Note on notation used here. I consider the A matrix to have form:
-    // A = b0 c0 0  0  0
-    //     a1 b1 c1 0  0
-    //     0  a2 b2 c2 0
-    //     0  0  a3 b3 c3
-    //     0  0  0  a4 b4
-    for(rocsparse_int i = 0; i < m - 1; i++)
+    case rocsparse_gtsv_interleaved_alg_thomas:
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            T ak_1 = dl[batch_stride * (i + 1) + j];
-            T bk   = r0[batch_count * i + j];
-            T bk_1 = r0[batch_count * (i + 1) + j];
-            T ck   = r1[batch_count * i + j];
-            T ck_1 = r1[batch_count * (i + 1) + j];
-
-            T radius = std::sqrt(std::abs(bk * rocsparse_conj(bk) + ak_1 * rocsparse_conj(ak_1)));
-
-            // Apply Givens rotation
-            // | cos  sin | |bk    ck   0   |
-            // |-sin  cos | |ak_1  bk_1 ck_1|
-            T cos_theta = rocsparse_conj(bk) / radius;
-            T sin_theta = rocsparse_conj(ak_1) / radius;
-
-            r0[batch_count * i + j] = std::fma(bk, cos_theta, ak_1 * sin_theta);
-            r0[batch_count * (i + 1) + j]
-                = std::fma(-ck, rocsparse_conj(sin_theta), bk_1 * rocsparse_conj(cos_theta));
-            r1[batch_count * i + j]       = std::fma(ck, cos_theta, bk_1 * sin_theta);
-            r1[batch_count * (i + 1) + j] = ck_1 * rocsparse_conj(cos_theta);
-            r2[batch_count * i + j]       = ck_1 * sin_theta;
-
-            // Apply Givens rotation to rhs vector
-            // | cos  sin | |xk  |
-            // |-sin  cos | |xk_1|
-            T xk                    = x[batch_stride * i + j];
-            T xk_1                  = x[batch_stride * (i + 1) + j];
-            x[batch_stride * i + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
-            x[batch_stride * (i + 1) + j]
-                = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
-        }
+        *buffer_size = sizeof(T) * 2 * size;
+        break;
     }
-
-    // Backward substitution on upper triangular R * x = x
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
+    case rocsparse_gtsv_interleaved_alg_lu:
     {
-        x[batch_stride * (m - 1) + j]
-            = x[batch_stride * (m - 1) + j] / r0[batch_count * (m - 1) + j];
-        x[batch_stride * (m - 2) + j]
-            = (x[batch_stride * (m - 2) + j]
-               - r1[batch_count * (m - 2) + j] * x[batch_stride * (m - 1) + j])
-              / r0[batch_count * (m - 2) + j];
+        *buffer_size = sizeof(T) * 4 * size + sizeof(rocsparse_int) * (size + batch_count);
+        break;
     }
-
-    for(rocsparse_int i = m - 3; i >= 0; i--)
+    case rocsparse_gtsv_interleaved_alg_default:
+    case rocsparse_gtsv_interleaved_alg_qr:
     {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            x[batch_stride * i + j]
-                = (x[batch_stride * i + j] - r1[batch_count * i + j] * x[batch_stride * (i + 1) + j]
-                   - r2[batch_count * i + j] * x[batch_stride * (i + 2) + j])
-                  / r0[batch_count * i + j];
-        }
+        *buffer_size = sizeof(T) * 3 * size;
+        break;
+    }
     }
 }
 
@@ -6637,245 +8372,320 @@ void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg algo,
                                  const T*                       du,
                                  T*                             x,
                                  rocsparse_int                  batch_count,
-                                 rocsparse_int                  batch_stride)
+                                 rocsparse_int                  batch_stride,
+                                 void*                          temp_buffer)
 {
+    size_t size = size_t(m) * batch_count;
+
+    T* ptr = static_cast<T*>(temp_buffer);
+
     switch(algo)
     {
     case rocsparse_gtsv_interleaved_alg_thomas:
     {
-        host_gtsv_interleaved_batch_thomas(m, dl, d, du, x, batch_count, batch_stride);
+        host_gtsv_interleaved_batch_thomas(
+            m, dl, d, du, x, batch_count, batch_stride, ptr, ptr + size);
         break;
     }
     case rocsparse_gtsv_interleaved_alg_lu:
     {
-        host_gtsv_interleaved_batch_lu(m, dl, d, du, x, batch_count, batch_stride);
+        rocsparse_int* p = reinterpret_cast<rocsparse_int*>(ptr + 4 * size);
+
+        host_gtsv_interleaved_batch_lu(m,
+                                       dl,
+                                       d,
+                                       du,
+                                       x,
+                                       batch_count,
+                                       batch_stride,
+                                       ptr,
+                                       ptr + size,
+                                       ptr + 2 * size,
+                                       ptr + 3 * size,
+                                       p,
+                                       p + size);
         break;
     }
     case rocsparse_gtsv_interleaved_alg_default:
     case rocsparse_gtsv_interleaved_alg_qr:
     {
-        host_gtsv_interleaved_batch_qr(m, dl, d, du, x, batch_count, batch_stride);
+        host_gtsv_interleaved_batch_qr(
+            m, dl, d, du, x, batch_count, batch_stride, ptr, ptr + size, ptr + 2 * size);
         break;
     }
     }
 }
 
 template <typename T>
-void host_gpsv_interleaved_batch_qr(rocsparse_int m,
-                                    T*            ds,
-                                    T*            dl,
-                                    T*            d,
-                                    T*            du,
-                                    T*            dw,
-                                    T*            x,
-                                    rocsparse_int batch_count,
-                                    rocsparse_int batch_stride)
+void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg algo,
+                                 rocsparse_int                  m,
+                                 const T*                       dl,
+                                 const T*                       d,
+                                 const T*                       du,
+                                 T*                             x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride)
+{
+    size_t buffer_size = 0;
+    host_gtsv_interleaved_batch_buffer_size<T>(algo, m, batch_count, &buffer_size);
+
+    std::vector<T> temp_buffer((buffer_size + sizeof(T) - 1) / sizeof(T));
+
+    host_gtsv_interleaved_batch(
+        algo, m, dl, d, du, x, batch_count, batch_stride, temp_buffer.data());
+}
+
+template <typename T>
+static void host_gpsv_interleaved_batch_qr(rocsparse_int m,
+                                           T*            ds,
+                                           T*            dl,
+                                           T*            d,
+                                           T*            du,
+                                           T*            dw,
+                                           T*            x,
+                                           rocsparse_int batch_count,
+                                           rocsparse_int batch_stride,
+                                           T*            r3,
+                                           T*            r4)
 {
-    std::vector<T> r3(m * batch_count, 0);
-    std::vector<T> r4(m * batch_count, 0);
-
-    // Reduce A = Q*R where Q is orthonormal and R is upper triangular
-    // This means when solving A * x          = b
-    //                      => Q * R * x      = b
-    //                      => Q' * Q * R * x = Q' * b
-    //                      => R * x          = Q' * b
-    // Because A is penta-diagonal, we use Givens rotations
-    // Note on notation used here. I consider the A matrix to have form:
-    // A = d0 u0 w0  0  0
-    //     l1 d1 u1 w1  0
-    //     s2  l2 d2 u2 w2
-    //     0  s3  l3 d3 u3
-    //     0  0  s4  l4 d4
-    for(rocsparse_int i = 0; i < m - 2; i++)
+    static constexpr rocsparse_int lanes = host_interleaved_batch_lanes<T>();
+
+    const int64_t bc = batch_count;
+    const int64_t bs = batch_stride;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(rocsparse_int j_begin = 0; j_begin < batch_count; j_begin += lanes)
     {
+        rocsparse_int j_end = std::min(j_begin + lanes, batch_count);
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                r3[bc * i + j] = static_cast<T>(0);
+                r4[bc * i + j] = static_cast<T>(0);
+            }
+        }
+
+        // Reduce A = Q*R where Q is orthonormal and R is upper triangular
+        // This means when solving A * x          = b
+        //                      => Q * R * x      = b
+        //                      => Q' * Q * R * x = Q' * b
+        //                      => R * x          = Q' * b
+        // Because A is penta-diagonal, we use Givens rotations
+        // Note on notation used here. I consider the A matrix to have form:
+        // A = d0 u0 w0  0  0
+        //     l1 d1 u1 w1  0
+        //     s2  l2 d2 u2 w2
+        //     0  s3  l3 d3 u3
+        //     0  0  s4  l4 d4
+        for(rocsparse_int i = 0; i < m - 2; i++)
+        {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                // For penta diagonal matrices, need to apply two givens rotations to remove
+                // lower and lower - 1 entries
+                T radius    = static_cast<T>(0);
+                T cos_theta = static_cast<T>(0);
+                T sin_theta = static_cast<T>(0);
+
+                // Apply first Givens rotation
+                // | cos  sin | |lk_1 dk_1 uk_1 wk_1 0   |
+                // |-sin  cos | |sk_2 lk_2 dk_2 uk_2 wk_2|
+                T sk_2 = ds[bs * (i + 2) + j];
+                T lk_1 = dl[bs * (i + 1) + j];
+                T lk_2 = dl[bs * (i + 2) + j];
+                T dk_1 = d[bs * (i + 1) + j];
+                T dk_2 = d[bs * (i + 2) + j];
+                T uk_1 = du[bs * (i + 1) + j];
+                T uk_2 = du[bs * (i + 2) + j];
+                T wk_1 = dw[bs * (i + 1) + j];
+                T wk_2 = dw[bs * (i + 2) + j];
+
+                radius = std::sqrt(
+                    std::abs(std::fma(lk_1, rocsparse_conj(lk_1), sk_2 * rocsparse_conj(sk_2))));
+                cos_theta = rocsparse_conj(lk_1) / radius;
+                sin_theta = rocsparse_conj(sk_2) / radius;
+
+                T dlk_1_new = std::fma(lk_1, cos_theta, sk_2 * sin_theta);
+                T dk_1_new  = std::fma(dk_1, cos_theta, lk_2 * sin_theta);
+                T duk_1_new = std::fma(uk_1, cos_theta, dk_2 * sin_theta);
+                T dwk_1_new = std::fma(wk_1, cos_theta, uk_2 * sin_theta);
+
+                dl[bs * (i + 1) + j] = dlk_1_new;
+                dl[bs * (i + 2) + j]
+                    = std::fma(-dk_1, rocsparse_conj(sin_theta), lk_2 * rocsparse_conj(cos_theta));
+                d[bs * (i + 1) + j] = dk_1_new;
+                d[bs * (i + 2) + j]
+                    = std::fma(-uk_1, rocsparse_conj(sin_theta), dk_2 * rocsparse_conj(cos_theta));
+                du[bs * (i + 1) + j] = duk_1_new;
+                du[bs * (i + 2) + j]
+                    = std::fma(-wk_1, rocsparse_conj(sin_theta), uk_2 * rocsparse_conj(cos_theta));
+                dw[bs * (i + 1) + j] = dwk_1_new;
+                dw[bs * (i + 2) + j] = wk_2 * rocsparse_conj(cos_theta);
+                r3[bc * (i + 1) + j] = wk_2 * sin_theta;
+
+                // Apply first Givens rotation to rhs vector
+                // | cos  sin | |xk_1|
+                // |-sin  cos | |xk_2|
+                T xk_1              = x[bs * (i + 1) + j];
+                T xk_2              = x[bs * (i + 2) + j];
+                x[bs * (i + 1) + j] = std::fma(xk_1, cos_theta, xk_2 * sin_theta);
+                x[bs * (i + 2) + j]
+                    = std::fma(-xk_1, rocsparse_conj(sin_theta), xk_2 * rocsparse_conj(cos_theta));
+
+                // Apply second Givens rotation
+                // | cos  sin | |dk   uk   wk   rk   0   |
+                // |-sin  cos | |lk_1 dk_1 uk_1 wk_1 rk_1|
+                lk_1   = dlk_1_new;
+                T dk   = d[bs * i + j];
+                dk_1   = dk_1_new;
+                T uk   = du[bs * i + j];
+                uk_1   = duk_1_new;
+                T wk   = dw[bs * i + j];
+                wk_1   = dwk_1_new;
+                T rk   = r3[bc * i + j];
+                T rk_1 = r3[bc * (i + 1) + j];
+
+                radius = std::sqrt(
+                    std::abs(std::fma(dk, rocsparse_conj(dk), lk_1 * rocsparse_conj(lk_1))));
+                cos_theta = rocsparse_conj(dk) / radius;
+                sin_theta = rocsparse_conj(lk_1) / radius;
+
+                d[bs * i + j] = std::fma(dk, cos_theta, lk_1 * sin_theta);
+                d[bs * (i + 1) + j]
+                    = std::fma(-uk, rocsparse_conj(sin_theta), dk_1 * rocsparse_conj(cos_theta));
+                du[bs * i + j] = std::fma(uk, cos_theta, dk_1 * sin_theta);
+                du[bs * (i + 1) + j]
+                    = std::fma(-wk, rocsparse_conj(sin_theta), uk_1 * rocsparse_conj(cos_theta));
+                dw[bs * i + j] = std::fma(wk, cos_theta, uk_1 * sin_theta);
+                dw[bs * (i + 1) + j]
+                    = std::fma(-rk, rocsparse_conj(sin_theta), wk_1 * rocsparse_conj(cos_theta));
+                r3[bc * i + j]       = std::fma(rk, cos_theta, wk_1 * sin_theta);
+                r3[bc * (i + 1) + j] = rk_1 * rocsparse_conj(cos_theta);
+                r4[bc * i + j]       = rk_1 * sin_theta;
+
+                // Apply second Givens rotation to rhs vector
+                // | cos  sin | |xk  |
+                // |-sin  cos | |xk_1|
+                T xk          = x[bs * i + j];
+                xk_1          = x[bs * (i + 1) + j];
+                x[bs * i + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
+                x[bs * (i + 1) + j]
+                    = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
+            }
+        }
+
+        // Apply last givens rotation
+#ifdef _OPENMP
+#pragma omp simd
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            // For penta diagonal matrices, need to apply two givens rotations to remove lower and lower - 1 entries
-            T radius    = static_cast<T>(0);
-            T cos_theta = static_cast<T>(0);
-            T sin_theta = static_cast<T>(0);
-
-            // Apply first Givens rotation
-            // | cos  sin | |lk_1 dk_1 uk_1 wk_1 0   |
-            // |-sin  cos | |sk_2 lk_2 dk_2 uk_2 wk_2|
-            T sk_2 = ds[batch_stride * (i + 2) + j];
-            T lk_1 = dl[batch_stride * (i + 1) + j];
-            T lk_2 = dl[batch_stride * (i + 2) + j];
-            T dk_1 = d[batch_stride * (i + 1) + j];
-            T dk_2 = d[batch_stride * (i + 2) + j];
-            T uk_1 = du[batch_stride * (i + 1) + j];
-            T uk_2 = du[batch_stride * (i + 2) + j];
-            T wk_1 = dw[batch_stride * (i + 1) + j];
-            T wk_2 = dw[batch_stride * (i + 2) + j];
-
-            radius = std::sqrt(
-                std::abs(std::fma(lk_1, rocsparse_conj(lk_1), sk_2 * rocsparse_conj(sk_2))));
-            cos_theta = rocsparse_conj(lk_1) / radius;
-            sin_theta = rocsparse_conj(sk_2) / radius;
-
-            T dlk_1_new = std::fma(lk_1, cos_theta, sk_2 * sin_theta);
-            T dk_1_new  = std::fma(dk_1, cos_theta, lk_2 * sin_theta);
-            T duk_1_new = std::fma(uk_1, cos_theta, dk_2 * sin_theta);
-            T dwk_1_new = std::fma(wk_1, cos_theta, uk_2 * sin_theta);
-
-            dl[batch_stride * (i + 1) + j] = dlk_1_new;
-            dl[batch_stride * (i + 2) + j]
-                = std::fma(-dk_1, rocsparse_conj(sin_theta), lk_2 * rocsparse_conj(cos_theta));
-            d[batch_stride * (i + 1) + j] = dk_1_new;
-            d[batch_stride * (i + 2) + j]
-                = std::fma(-uk_1, rocsparse_conj(sin_theta), dk_2 * rocsparse_conj(cos_theta));
-            du[batch_stride * (i + 1) + j] = duk_1_new;
-            du[batch_stride * (i + 2) + j]
-                = std::fma(-wk_1, rocsparse_conj(sin_theta), uk_2 * rocsparse_conj(cos_theta));
-            dw[batch_stride * (i + 1) + j] = dwk_1_new;
-            dw[batch_stride * (i + 2) + j] = wk_2 * rocsparse_conj(cos_theta);
-            r3[batch_count * (i + 1) + j]  = wk_2 * sin_theta;
-
-            // Apply first Givens rotation to rhs vector
-            // | cos  sin | |xk_1|
-            // |-sin  cos | |xk_2|
-            T xk_1                        = x[batch_stride * (i + 1) + j];
-            T xk_2                        = x[batch_stride * (i + 2) + j];
-            x[batch_stride * (i + 1) + j] = std::fma(xk_1, cos_theta, xk_2 * sin_theta);
-            x[batch_stride * (i + 2) + j]
-                = std::fma(-xk_1, rocsparse_conj(sin_theta), xk_2 * rocsparse_conj(cos_theta));
-
-            // Apply second Givens rotation
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            // Apply last Givens rotation
             // | cos  sin | |dk   uk   wk   rk   0   |
             // |-sin  cos | |lk_1 dk_1 uk_1 wk_1 rk_1|
-            lk_1   = dlk_1_new;
-            T dk   = d[batch_stride * i + j];
-            dk_1   = dk_1_new;
-            T uk   = du[batch_stride * i + j];
-            uk_1   = duk_1_new;
-            T wk   = dw[batch_stride * i + j];
-            wk_1   = dwk_1_new;
-            T rk   = r3[batch_count * i + j];
-            T rk_1 = r3[batch_count * (i + 1) + j];
-
-            radius = std::sqrt(
+            T lk_1 = dl[bs * (m - 1) + j];
+            T dk   = d[bs * (m - 2) + j];
+            T dk_1 = d[bs * (m - 1) + j];
+            T uk   = du[bs * (m - 2) + j];
+            T uk_1 = du[bs * (m - 1) + j];
+            T wk   = dw[bs * (m - 2) + j];
+            T wk_1 = dw[bs * (m - 1) + j];
+            T rk   = r3[bc * (m - 2) + j];
+            T rk_1 = r3[bc * (m - 1) + j];
+
+            T radius = std::sqrt(
                 std::abs(std::fma(dk, rocsparse_conj(dk), lk_1 * rocsparse_conj(lk_1))));
-            cos_theta = rocsparse_conj(dk) / radius;
-            sin_theta = rocsparse_conj(lk_1) / radius;
+            T cos_theta = rocsparse_conj(dk) / radius;
+            T sin_theta = rocsparse_conj(lk_1) / radius;
 
-            d[batch_stride * i + j] = std::fma(dk, cos_theta, lk_1 * sin_theta);
-            d[batch_stride * (i + 1) + j]
+            d[bs * (m - 2) + j] = std::fma(dk, cos_theta, lk_1 * sin_theta);
+            d[bs * (m - 1) + j]
                 = std::fma(-uk, rocsparse_conj(sin_theta), dk_1 * rocsparse_conj(cos_theta));
-            du[batch_stride * i + j] = std::fma(uk, cos_theta, dk_1 * sin_theta);
-            du[batch_stride * (i + 1) + j]
+            du[bs * (m - 2) + j] = std::fma(uk, cos_theta, dk_1 * sin_theta);
+            du[bs * (m - 1) + j]
                 = std::fma(-wk, rocsparse_conj(sin_theta), uk_1 * rocsparse_conj(cos_theta));
-            dw[batch_stride * i + j] = std::fma(wk, cos_theta, uk_1 * sin_theta);
-            dw[batch_stride * (i + 1) + j]
+            dw[bs * (m - 2) + j] = std::fma(wk, cos_theta, uk_1 * sin_theta);
+            dw[bs * (m - 1) + j]
                 = std::fma(-rk, rocsparse_conj(sin_theta), wk_1 * rocsparse_conj(cos_theta));
-            r3[batch_count * i + j]       = std::fma(rk, cos_theta, wk_1 * sin_theta);
-            r3[batch_count * (i + 1) + j] = rk_1 * rocsparse_conj(cos_theta);
-            r4[batch_count * i + j]       = rk_1 * sin_theta;
+            r3[bc * (m - 2) + j] = std::fma(rk, cos_theta, wk_1 * sin_theta);
+            r3[bc * (m - 1) + j] = rk_1 * rocsparse_conj(cos_theta);
+            r4[bc * (m - 2) + j] = rk_1 * sin_theta;
 
-            // Apply second Givens rotation to rhs vector
+            // Apply last Givens rotation to rhs vector
             // | cos  sin | |xk  |
             // |-sin  cos | |xk_1|
-            T xk                    = x[batch_stride * i + j];
-            xk_1                    = x[batch_stride * (i + 1) + j];
-            x[batch_stride * i + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
-            x[batch_stride * (i + 1) + j]
+            T xk                = x[bs * (m - 2) + j];
+            T xk_1              = x[bs * (m - 1) + j];
+            x[bs * (m - 2) + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
+            x[bs * (m - 1) + j]
                 = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
         }
-    }
 
-    // Apply last givens rotation
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
-    {
-        // Apply last Givens rotation
-        // | cos  sin | |dk   uk   wk   rk   0   |
-        // |-sin  cos | |lk_1 dk_1 uk_1 wk_1 rk_1|
-        T lk_1 = dl[batch_stride * (m - 1) + j];
-        T dk   = d[batch_stride * (m - 2) + j];
-        T dk_1 = d[batch_stride * (m - 1) + j];
-        T uk   = du[batch_stride * (m - 2) + j];
-        T uk_1 = du[batch_stride * (m - 1) + j];
-        T wk   = dw[batch_stride * (m - 2) + j];
-        T wk_1 = dw[batch_stride * (m - 1) + j];
-        T rk   = r3[batch_count * (m - 2) + j];
-        T rk_1 = r3[batch_count * (m - 1) + j];
-
-        T radius
-            = std::sqrt(std::abs(std::fma(dk, rocsparse_conj(dk), lk_1 * rocsparse_conj(lk_1))));
-        T cos_theta = rocsparse_conj(dk) / radius;
-        T sin_theta = rocsparse_conj(lk_1) / radius;
-
-        d[batch_stride * (m - 2) + j] = std::fma(dk, cos_theta, lk_1 * sin_theta);
-        d[batch_stride * (m - 1) + j]
-            = std::fma(-uk, rocsparse_conj(sin_theta), dk_1 * rocsparse_conj(cos_theta));
-        du[batch_stride * (m - 2) + j] = std::fma(uk, cos_theta, dk_1 * sin_theta);
-        du[batch_stride * (m - 1) + j]
-            = std::fma(-wk, rocsparse_conj(sin_theta), uk_1 * rocsparse_conj(cos_theta));
-        dw[batch_stride * (m - 2) + j] = std::fma(wk, cos_theta, uk_1 * sin_theta);
-        dw[batch_stride * (m - 1) + j]
-            = std::fma(-rk, rocsparse_conj(sin_theta), wk_1 * rocsparse_conj(cos_theta));
-        r3[batch_count * (m - 2) + j] = std::fma(rk, cos_theta, wk_1 * sin_theta);
-        r3[batch_count * (m - 1) + j] = rk_1 * rocsparse_conj(cos_theta);
-        r4[batch_count * (m - 2) + j] = rk_1 * sin_theta;
-
-        // Apply last Givens rotation to rhs vector
-        // | cos  sin | |xk  |
-        // |-sin  cos | |xk_1|
-        T xk                          = x[batch_stride * (m - 2) + j];
-        T xk_1                        = x[batch_stride * (m - 1) + j];
-        x[batch_stride * (m - 2) + j] = std::fma(xk, cos_theta, xk_1 * sin_theta);
-        x[batch_stride * (m - 1) + j]
-            = std::fma(-xk, rocsparse_conj(sin_theta), xk_1 * rocsparse_conj(cos_theta));
-    }
-
-    // Backward substitution on upper triangular R * x = x
+        // Backward substitution on upper triangular R * x = x
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-    for(rocsparse_int j = 0; j < batch_count; j++)
-    {
-        x[batch_stride * (m - 1) + j]
-            = x[batch_stride * (m - 1) + j] / d[batch_stride * (m - 1) + j];
-        x[batch_stride * (m - 2) + j]
-            = (x[batch_stride * (m - 2) + j]
-               - du[batch_stride * (m - 2) + j] * x[batch_stride * (m - 1) + j])
-              / d[batch_stride * (m - 2) + j];
+        for(rocsparse_int j = j_begin; j < j_end; j++)
+        {
+            x[bs * (m - 1) + j] = x[bs * (m - 1) + j] / d[bs * (m - 1) + j];
+            x[bs * (m - 2) + j]
+                = (x[bs * (m - 2) + j] - du[bs * (m - 2) + j] * x[bs * (m - 1) + j])
+                  / d[bs * (m - 2) + j];
 
-        x[batch_stride * (m - 3) + j]
-            = (x[batch_stride * (m - 3) + j]
-               - du[batch_stride * (m - 3) + j] * x[batch_stride * (m - 2) + j]
-               - dw[batch_stride * (m - 3) + j] * x[batch_stride * (m - 1) + j])
-              / d[batch_stride * (m - 3) + j];
+            x[bs * (m - 3) + j] = (x[bs * (m - 3) + j] - du[bs * (m - 3) + j] * x[bs * (m - 2) + j]
+                                   - dw[bs * (m - 3) + j] * x[bs * (m - 1) + j])
+                                  / d[bs * (m - 3) + j];
 
-        x[batch_stride * (m - 4) + j]
-            = (x[batch_stride * (m - 4) + j]
-               - du[batch_stride * (m - 4) + j] * x[batch_stride * (m - 3) + j]
-               - dw[batch_stride * (m - 4) + j] * x[batch_stride * (m - 2) + j]
-               - r3[batch_count * (m - 4) + j] * x[batch_stride * (m - 1) + j])
-              / d[batch_stride * (m - 4) + j];
-    }
+            x[bs * (m - 4) + j] = (x[bs * (m - 4) + j] - du[bs * (m - 4) + j] * x[bs * (m - 3) + j]
+                                   - dw[bs * (m - 4) + j] * x[bs * (m - 2) + j]
+                                   - r3[bc * (m - 4) + j] * x[bs * (m - 1) + j])
+                                  / d[bs * (m - 4) + j];
+        }
 
-    for(rocsparse_int i = m - 5; i >= 0; i--)
-    {
+        for(rocsparse_int i = m - 5; i >= 0; i--)
+        {
 #ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
+#pragma omp simd
 #endif
-        for(rocsparse_int j = 0; j < batch_count; j++)
-        {
-            x[batch_stride * i + j] = (x[batch_stride * i + j]
-                                       - du[batch_stride * i + j] * x[batch_stride * (i + 1) + j]
-                                       - dw[batch_stride * i + j] * x[batch_stride * (i + 2) + j]
-                                       - r3[batch_count * i + j] * x[batch_stride * (i + 3) + j]
-                                       - r4[batch_count * i + j] * x[batch_stride * (i + 4) + j])
-                                      / d[batch_stride * i + j];
+            for(rocsparse_int j = j_begin; j < j_end; j++)
+            {
+                x[bs * i + j] = (x[bs * i + j] - du[bs * i + j] * x[bs * (i + 1) + j]
+                                 - dw[bs * i + j] * x[bs * (i + 2) + j]
+                                 - r3[bc * i + j] * x[bs * (i + 3) + j]
+                                 - r4[bc * i + j] * x[bs * (i + 4) + j])
+                                / d[bs * i + j];
+            }
         }
     }
 }
 
+template <typename T>
+void host_gpsv_interleaved_batch_buffer_size(rocsparse_gpsv_interleaved_alg algo,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  batch_count,
+                                             size_t*                        buffer_size)
+{
+    switch(algo)
+    {
+    case rocsparse_gpsv_interleaved_alg_default:
+    case rocsparse_gpsv_interleaved_alg_qr:
+    {
+        *buffer_size = sizeof(T) * 2 * size_t(m) * batch_count;
+        break;
+    }
+    }
+}
+
 template <typename T>
 void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg algo,
                                  rocsparse_int                  m,
@@ -6886,24 +8696,72 @@ void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg algo,
                                  T*                             dw,
                                  T*                             x,
                                  rocsparse_int                  batch_count,
-                                 rocsparse_int                  batch_stride)
+                                 rocsparse_int                  batch_stride,
+                                 void*                          temp_buffer)
 {
+    size_t size = size_t(m) * batch_count;
+
+    T* ptr = static_cast<T*>(temp_buffer);
+
     switch(algo)
     {
     case rocsparse_gpsv_interleaved_alg_default:
     case rocsparse_gpsv_interleaved_alg_qr:
     {
-        host_gpsv_interleaved_batch_qr(m, ds, dl, d, du, dw, x, batch_count, batch_stride);
+        host_gpsv_interleaved_batch_qr(
+            m, ds, dl, d, du, dw, x, batch_count, batch_stride, ptr, ptr + size);
         break;
     }
     }
 }
 
+template <typename T>
+void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg algo,
+                                 rocsparse_int                  m,
+                                 T*                             ds,
+                                 T*                             dl,
+                                 T*                             d,
+                                 T*                             du,
+                                 T*                             dw,
+                                 T*                             x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride)
+{
+    size_t buffer_size = 0;
+    host_gpsv_interleaved_batch_buffer_size<T>(algo, m, batch_count, &buffer_size);
+
+    std::vector<T> temp_buffer((buffer_size + sizeof(T) - 1) / sizeof(T));
+
+    host_gpsv_interleaved_batch(
+        algo, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer.data());
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
  * ===========================================================================
  */
+template <typename I, typename J>
+void host_coo_to_csr(J M, I nnz, const J* coo_row_ind, I* csr_row_ptr, rocsparse_index_base base)
+{
+    // Resize and initialize csr_row_ptr with zeros
+    for(size_t i = 0; i < M + 1; ++i)
+    {
+        csr_row_ptr[i] = 0;
+    }
+
+    for(size_t i = 0; i < nnz; ++i)
+    {
+        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
+    }
+
+    csr_row_ptr[0] = base;
+    for(J i = 0; i < M; ++i)
+    {
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
+    }
+}
+
 template <typename T>
 rocsparse_status host_nnz(rocsparse_direction dirA,
                           rocsparse_int       m,
@@ -7322,45 +9180,152 @@ void host_csr_to_csc(J                    M,
                      rocsparse_action     action,
                      rocsparse_index_base base)
 {
-    // Determine nnz per column
-    for(I i = 0; i < nnz; ++i)
+    // The rows are split into nparts contiguous blocks of about nnz / nparts entries. Each
+    // block gets its own column histogram, which is turned into the block's first position
+    // in each column of the output. Blocks then scatter their entries independently, in
+    // increasing row order, such that the output is identical to a serial transpose. The
+    // number of blocks is limited such that the histograms do not exceed O(nnz + N) memory.
+    if(nnz == 0)
     {
-        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
+        for(size_t i = 0; i < csc_col_ptr.size(); ++i)
+        {
+            csc_col_ptr[i] = base;
+        }
+        return;
     }
 
-    // Scan
-    for(J i = 0; i < N; ++i)
+    int nparts = 1;
+
+#ifdef _OPENMP
+    if(nnz >= 65536)
     {
-        csc_col_ptr[i + 1] += csc_col_ptr[i];
+        nparts = static_cast<int>(std::min(static_cast<int64_t>(omp_get_max_threads()),
+                                           1 + static_cast<int64_t>(nnz) / std::max(N, J(1))));
     }
+#endif
 
-    // Fill row indices and values
-    for(J i = 0; i < M; ++i)
+    std::vector<J>              row_part(nparts + 1);
+    std::vector<std::vector<I>> hist(nparts);
+    std::vector<I>              block_sum(nparts + 1, 0);
+
+    row_part[0]      = 0;
+    row_part[nparts] = M;
+
+    for(int p = 1; p < nparts; ++p)
     {
-        I row_begin = csr_row_ptr[i] - base;
-        I row_end   = csr_row_ptr[i + 1] - base;
+        I target = base + static_cast<I>(static_cast<int64_t>(nnz) * p / nparts);
 
-        for(I j = row_begin; j < row_end; ++j)
+        row_part[p] = std::lower_bound(csr_row_ptr, csr_row_ptr + M, target) - csr_row_ptr;
+        row_part[p] = std::max(row_part[p], row_part[p - 1]);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nparts)
+#endif
+    {
+        // Determine nnz per column of each row block
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
         {
-            J col = csr_col_ind[j] - base;
-            I idx = csc_col_ptr[col];
+            hist[p].assign(N, 0);
 
-            csc_row_ind[idx] = i + base;
-            csc_val[idx]     = csr_val[j];
+            I* count = hist[p].data();
 
-            ++csc_col_ptr[col];
+            I row_begin = csr_row_ptr[row_part[p]] - base;
+            I row_end   = csr_row_ptr[row_part[p + 1]] - base;
+
+            for(I j = row_begin; j < row_end; ++j)
+            {
+                ++count[csr_col_ind[j] - base];
+            }
         }
-    }
 
-    // Shift column pointer array
-    for(J i = N; i > 0; --i)
-    {
-        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+        // Blocked scan over the columns, first the nnz of each column block
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            J col_begin = static_cast<J>(static_cast<int64_t>(N) * p / nparts);
+            J col_end   = static_cast<J>(static_cast<int64_t>(N) * (p + 1) / nparts);
+
+            I sum = 0;
+            for(int q = 0; q < nparts; ++q)
+            {
+                const I* count = hist[q].data();
+
+                for(J i = col_begin; i < col_end; ++i)
+                {
+                    sum += count[i];
+                }
+            }
+
+            block_sum[p + 1] = sum;
+        }
+
+#ifdef _OPENMP
+#pragma omp single
+#endif
+        {
+            for(int p = 0; p < nparts; ++p)
+            {
+                block_sum[p + 1] += block_sum[p];
+            }
+        }
+
+        // Column offsets, and the first position of each row block within each column
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            J col_begin = static_cast<J>(static_cast<int64_t>(N) * p / nparts);
+            J col_end   = static_cast<J>(static_cast<int64_t>(N) * (p + 1) / nparts);
+
+            I offset = block_sum[p];
+
+            for(J i = col_begin; i < col_end; ++i)
+            {
+                csc_col_ptr[i] = offset + base;
+
+                for(int q = 0; q < nparts; ++q)
+                {
+                    I count    = hist[q][i];
+                    hist[q][i] = offset;
+                    offset += count;
+                }
+            }
+        }
+
+        // Fill row indices and values
+#ifdef _OPENMP
+#pragma omp for schedule(static, 1)
+#endif
+        for(int p = 0; p < nparts; ++p)
+        {
+            I* next = hist[p].data();
+
+            for(J i = row_part[p]; i < row_part[p + 1]; ++i)
+            {
+                I row_begin = csr_row_ptr[i] - base;
+                I row_end   = csr_row_ptr[i + 1] - base;
+
+                for(I j = row_begin; j < row_end; ++j)
+                {
+                    I idx = next[csr_col_ind[j] - base]++;
+
+                    csc_row_ind[idx] = i + base;
+                    csc_val[idx]     = csr_val[j];
+                }
+            }
+        }
     }
 
     if(csc_col_ptr.size() > 0)
     {
-        csc_col_ptr[0] = base;
+        csc_col_ptr[N] = block_sum[nparts] + base;
     }
 }
 
@@ -8424,45 +10389,43 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                           const rocsparse_int* bsr_row_ptr,                       \
                                           const rocsparse_int* bsr_col_ind,                       \
                                           rocsparse_index_base bsr_base);                         \
-    template void             host_bsrmm<TYPE>(rocsparse_handle          handle,                              \
-                                   rocsparse_direction       dir,                                 \
-                                   rocsparse_operation       transA,                              \
-                                   rocsparse_operation       transB,                              \
-                                   rocsparse_int             Mb,                                  \
-                                   rocsparse_int             N,                                   \
-                                   rocsparse_int             Kb,                                  \
-                                   rocsparse_int             nnzb,                                \
-                                   const TYPE*               alpha,                               \
-                                   const rocsparse_mat_descr descr,                               \
-                                   const TYPE*               bsr_val_A,                           \
-                                   const rocsparse_int*      bsr_row_ptr_A,                       \
-                                   const rocsparse_int*      bsr_col_ind_A,                       \
-                                   rocsparse_int             block_dim,                           \
-                                   const TYPE*               B,                                   \
-                                   int64_t                   ldb,                                 \
-                                   const TYPE*               beta,                                \
-                                   TYPE*                     C,                                   \
-                                   int64_t                   ldc);                                                  \
-    template void             host_gebsrmm<TYPE>(rocsparse_handle          handle,                            \
-                                     rocsparse_direction       dir,                               \
-                                     rocsparse_operation       trans_A,                           \
-                                     rocsparse_operation       trans_B,                           \
-                                     rocsparse_int             mb,                                \
-                                     rocsparse_int             n,                                 \
-                                     rocsparse_int             kb,                                \
-                                     rocsparse_int             nnzb,                              \
-                                     const TYPE*               alpha,                             \
-                                     const rocsparse_mat_descr descr,                             \
-                                     const TYPE*               bsr_val,                           \
-                                     const rocsparse_int*      bsr_row_ptr,                       \
-                                     const rocsparse_int*      bsr_col_ind,                       \
-                                     rocsparse_int             row_block_dim,                     \
-                                     rocsparse_int             col_block_dim,                     \
-                                     const TYPE*               B,                                 \
-                                     int64_t                   ldb,                               \
-                                     const TYPE*               beta,                              \
-                                     TYPE*                     C,                                 \
-                                     int64_t                   ldc);                                                \
+    template void             host_bsrmm<TYPE>(rocsparse_direction  dir,                                       \
+                                   rocsparse_operation  transA,                                   \
+                                   rocsparse_operation  transB,                                   \
+                                   rocsparse_int        Mb,                                       \
+                                   rocsparse_int        N,                                        \
+                                   rocsparse_int        Kb,                                       \
+                                   rocsparse_int        nnzb,                                     \
+                                   const TYPE*          alpha,                                    \
+                                   rocsparse_index_base base,                                     \
+                                   const TYPE*          bsr_val_A,                                \
+                                   const rocsparse_int* bsr_row_ptr_A,                            \
+                                   const rocsparse_int* bsr_col_ind_A,                            \
+                                   rocsparse_int        block_dim,                                \
+                                   const TYPE*          B,                                        \
+                                   int64_t              ldb,                                      \
+                                   const TYPE*          beta,                                     \
+                                   TYPE*                C,                                        \
+                                   int64_t              ldc);                                     \
+    template void             host_gebsrmm<TYPE>(rocsparse_direction  dir,                                     \
+                                     rocsparse_operation  trans_A,                                \
+                                     rocsparse_operation  trans_B,                                \
+                                     rocsparse_int        mb,                                     \
+                                     rocsparse_int        n,                                      \
+                                     rocsparse_int        kb,                                     \
+                                     rocsparse_int        nnzb,                                   \
+                                     const TYPE*          alpha,                                  \
+                                     rocsparse_index_base base,                                   \
+                                     const TYPE*          bsr_val,                                \
+                                     const rocsparse_int* bsr_row_ptr,                            \
+                                     const rocsparse_int* bsr_col_ind,                            \
+                                     rocsparse_int        row_block_dim,                          \
+                                     rocsparse_int        col_block_dim,                          \
+                                     const TYPE*          B,                                      \
+                                     int64_t              ldb,                                    \
+                                     const TYPE*          beta,                                   \
+                                     TYPE*                C,                                      \
+                                     int64_t              ldc);                                   \
     template void             host_bsrsm<TYPE>(rocsparse_int        mb,                                       \
                                    rocsparse_int        nrhs,                                     \
                                    rocsparse_int        nnzb,                                     \
@@ -8622,7 +10585,21 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                     const TYPE*                    du,            \
                                                     TYPE*                          x,             \
                                                     rocsparse_int                  batch_count,   \
-                                                    rocsparse_int                  batch_stride);                  \
+                                                    rocsparse_int                  batch_stride); \
+    template void             host_gtsv_interleaved_batch<TYPE>(rocsparse_gtsv_interleaved_alg algo,          \
+                                                    rocsparse_int                  m,             \
+                                                    const TYPE*                    dl,            \
+                                                    const TYPE*                    d,             \
+                                                    const TYPE*                    du,            \
+                                                    TYPE*                          x,             \
+                                                    rocsparse_int                  batch_count,   \
+                                                    rocsparse_int                  batch_stride,  \
+                                                    void*                          temp_buffer);  \
+    template void             host_gtsv_interleaved_batch_buffer_size<TYPE>(                      \
+        rocsparse_gtsv_interleaved_alg algo,                                                      \
+        rocsparse_int                  m,                                                         \
+        rocsparse_int                  batch_count,                                               \
+        size_t*                        buffer_size);                                              \
     template void             host_gpsv_interleaved_batch<TYPE>(rocsparse_gpsv_interleaved_alg algo,          \
                                                     rocsparse_int                  m,             \
                                                     TYPE * ds,                                    \
@@ -8633,6 +10610,22 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                     TYPE * x,                                     \
                                                     rocsparse_int batch_count,                    \
                                                     rocsparse_int batch_stride);                  \
+    template void             host_gpsv_interleaved_batch<TYPE>(rocsparse_gpsv_interleaved_alg algo,          \
+                                                    rocsparse_int                  m,             \
+                                                    TYPE*                          ds,            \
+                                                    TYPE*                          dl,            \
+                                                    TYPE*                          d,             \
+                                                    TYPE*                          du,            \
+                                                    TYPE*                          dw,            \
+                                                    TYPE*                          x,             \
+                                                    rocsparse_int                  batch_count,   \
+                                                    rocsparse_int                  batch_stride,  \
+                                                    void*                          temp_buffer);  \
+    template void             host_gpsv_interleaved_batch_buffer_size<TYPE>(                      \
+        rocsparse_gpsv_interleaved_alg algo,                                                      \
+        rocsparse_int                  m,                                                         \
+        rocsparse_int                  batch_count,                                               \
+        size_t*                        buffer_size);                                              \
     template rocsparse_status host_nnz<TYPE>(rocsparse_direction dirA,                                        \
                                              rocsparse_int       m,                                           \
                                              rocsparse_int       n,                                           \
@@ -8829,6 +10822,20 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
         std::vector<rocsparse_int>& csr_row_ptr,                                               \
         std::vector<rocsparse_int>& csr_col_ind);
 
+#define INSTANTIATE_IJ(ITYPE, JTYPE)                                                   \
+    template void host_coo_to_csr<ITYPE, JTYPE>(JTYPE                M,                \
+                                                ITYPE                NNZ,              \
+                                                const JTYPE*         coo_row_ind,      \
+                                                ITYPE*               csr_row_ptr,      \
+                                                rocsparse_index_base base);            \
+    template void host_csrsv_analysis<ITYPE, JTYPE>(rocsparse_operation   trans,       \
+                                                    JTYPE                 M,           \
+                                                    const ITYPE*          csr_row_ptr, \
+                                                    const JTYPE*          csr_col_ind, \
+                                                    rocsparse_fill_mode   fill_mode,   \
+                                                    rocsparse_index_base  base,        \
+                                                    host_trm_info<JTYPE>* info);
+
 #define INSTANTIATE_IT(ITYPE, TTYPE)                                                     \
     template void host_gemvi<ITYPE, TTYPE>(ITYPE                M,                       \
                                            ITYPE                N,                       \
@@ -8874,7 +10881,8 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                            rocsparse_fill_mode  fill_mode,               \
                                            rocsparse_index_base base,                    \
                                            ITYPE*               struct_pivot,            \
-                                           ITYPE*               numeric_pivot);                        \
+                                           ITYPE*               numeric_pivot,           \
+                                           uint32_t             warp_size);                            \
     template void host_coosm<ITYPE, TTYPE>(ITYPE                M,                       \
                                            ITYPE                nrhs,                    \
                                            int64_t              nnz,                     \
@@ -8891,7 +10899,8 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                            rocsparse_fill_mode  fill_mode,               \
                                            rocsparse_index_base base,                    \
                                            ITYPE*               struct_pivot,            \
-                                           ITYPE*               numeric_pivot);                        \
+                                           ITYPE*               numeric_pivot,           \
+                                           uint32_t             warp_size);                            \
     template void host_axpby<ITYPE, TTYPE>(ITYPE                size,                    \
                                            ITYPE                nnz,                     \
                                            TTYPE                alpha,                   \
@@ -8934,7 +10943,25 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                   rocsparse_fill_mode  fill_mode,            \
                                                   rocsparse_index_base base,                 \
                                                   JTYPE*               struct_pivot,         \
-                                                  JTYPE*               numeric_pivot);                     \
+                                                  JTYPE*               numeric_pivot,        \
+                                                  uint32_t             warp_size);                         \
+    template void host_csrsv<ITYPE, JTYPE, TTYPE>(rocsparse_operation         trans,         \
+                                                  JTYPE                       M,             \
+                                                  ITYPE                       nnz,           \
+                                                  TTYPE                       alpha,         \
+                                                  const ITYPE*                csr_row_ptr,   \
+                                                  const JTYPE*                csr_col_ind,   \
+                                                  const TTYPE*                csr_val,       \
+                                                  const TTYPE*                x,             \
+                                                  int64_t                     x_inc,         \
+                                                  TTYPE*                      y,             \
+                                                  rocsparse_diag_type         diag_type,     \
+                                                  rocsparse_fill_mode         fill_mode,     \
+                                                  rocsparse_index_base        base,          \
+                                                  JTYPE*                      struct_pivot,  \
+                                                  JTYPE*                      numeric_pivot, \
+                                                  const host_trm_info<JTYPE>& info,          \
+                                                  uint32_t                    warp_size);    \
     template void host_csrsm<ITYPE, JTYPE, TTYPE>(JTYPE                M,                    \
                                                   JTYPE                nrhs,                 \
                                                   ITYPE                nnz,                  \
@@ -8951,7 +10978,27 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                   rocsparse_fill_mode  fill_mode,            \
                                                   rocsparse_index_base base,                 \
                                                   JTYPE*               struct_pivot,         \
-                                                  JTYPE*               numeric_pivot);                     \
+                                                  JTYPE*               numeric_pivot,        \
+                                                  uint32_t             warp_size);                         \
+    template void host_csrsm<ITYPE, JTYPE, TTYPE>(JTYPE                       M,             \
+                                                  JTYPE                       nrhs,          \
+                                                  ITYPE                       nnz,           \
+                                                  rocsparse_operation         transA,        \
+                                                  rocsparse_operation         transB,        \
+                                                  TTYPE                       alpha,         \
+                                                  const ITYPE*                csr_row_ptr,   \
+                                                  const JTYPE*                csr_col_ind,   \
+                                                  const TTYPE*                csr_val,       \
+                                                  TTYPE*                      B,             \
+                                                  int64_t                     ldb,           \
+                                                  rocsparse_order             order_B,       \
+                                                  rocsparse_diag_type         diag_type,     \
+                                                  rocsparse_fill_mode         fill_mode,     \
+                                                  rocsparse_index_base        base,          \
+                                                  JTYPE*                      struct_pivot,  \
+                                                  JTYPE*                      numeric_pivot, \
+                                                  const host_trm_info<JTYPE>& info,          \
+                                                  uint32_t                    warp_size);    \
     template void host_bsrgemm_nnzb<TTYPE, ITYPE, JTYPE>(JTYPE                Mb,            \
                                                          JTYPE                Nb,            \
                                                          JTYPE                Kb,            \
@@ -9030,7 +11077,60 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                                                     rocsparse_index_base base_A,             \
                                                     rocsparse_index_base base_B,             \
                                                     rocsparse_index_base base_C,             \
-                                                    rocsparse_index_base base_D);
+                                                    rocsparse_index_base base_D);            \
+    template void host_csrgemm_nnz<TTYPE, ITYPE, JTYPE>(JTYPE                            M,  \
+                                                        JTYPE                            N,  \
+                                                        JTYPE                            K,  \
+                                                        const TTYPE*                     alpha,\
+                                                        const ITYPE*                     csr_row_ptr_A,\
+                                                        const JTYPE*                     csr_col_ind_A,\
+                                                        const ITYPE*                     csr_row_ptr_B,\
+                                                        const JTYPE*                     csr_col_ind_B,\
+                                                        const TTYPE*                     beta,\
+                                                        const ITYPE*                     csr_row_ptr_D,\
+                                                        const JTYPE*                     csr_col_ind_D,\
+                                                        ITYPE*                           csr_row_ptr_C,\
+                                                        ITYPE*                           nnz_C,\
+                                                        rocsparse_index_base             base_A,\
+                                                        rocsparse_index_base             base_B,\
+                                                        rocsparse_index_base             base_C,\
+                                                        rocsparse_index_base             base_D,\
+                                                        host_csrgemm_info<ITYPE, JTYPE>* info);\
+    template void host_csrgemm<TTYPE, ITYPE, JTYPE>(JTYPE                                  M,\
+                                                    JTYPE                                  N,\
+                                                    JTYPE                                  L,\
+                                                    const TTYPE*                           alpha,\
+                                                    const ITYPE*                           csr_row_ptr_A,\
+                                                    const JTYPE*                           csr_col_ind_A,\
+                                                    const TTYPE*                           csr_val_A,\
+                                                    const ITYPE*                           csr_row_ptr_B,\
+                                                    const JTYPE*                           csr_col_ind_B,\
+                                                    const TTYPE*                           csr_val_B,\
+                                                    const TTYPE*                           beta,\
+                                                    const ITYPE*                           csr_row_ptr_D,\
+                                                    const JTYPE*                           csr_col_ind_D,\
+                                                    const TTYPE*                           csr_val_D,\
+                                                    const ITYPE*                           csr_row_ptr_C,\
+                                                    JTYPE*                                 csr_col_ind_C,\
+                                                    TTYPE*                                 csr_val_C,\
+                                                    rocsparse_index_base                   base_A,\
+                                                    rocsparse_index_base                   base_B,\
+                                                    rocsparse_index_base                   base_C,\
+                                                    rocsparse_index_base                   base_D,\
+                                                    const host_csrgemm_info<ITYPE, JTYPE>& info);\
+    template rocsparse_status host_csritilu0<TTYPE, ITYPE, JTYPE>( \
+        rocsparse_itilu0_alg         alg,                          \
+        JTYPE                        options,                      \
+        JTYPE*                       nmaxiter,                     \
+        floating_data_t<TTYPE>       tol,                          \
+        JTYPE                        M,                            \
+        ITYPE                        nnz,                          \
+        const ITYPE*                 csr_row_ptr,                  \
+        const JTYPE*                 csr_col_ind,                  \
+        const TTYPE*                 csr_val,                      \
+        TTYPE*                       ilu0,                         \
+        rocsparse_index_base         base,                         \
+        floating_data_t<TTYPE>*      history);
 
 #define INSTANTIATE_IXYT(ITYPE, XTYPE, YTYPE, TTYPE)                                  \
     template void host_doti<ITYPE, XTYPE, YTYPE, TTYPE>(ITYPE                nnz,     \
@@ -9110,7 +11210,8 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                              YTYPE*                y,                \
                              rocsparse_index_base  base,             \
                              rocsparse_matrix_type matrix_type,      \
-                             rocsparse_spmv_alg    algo);               \
+                             rocsparse_spmv_alg    algo,             \
+                             uint32_t              warp_size);          \
     template void host_csrmv(rocsparse_operation   trans,            \
                              JTYPE                 M,                \
                              JTYPE                 N,                \
@@ -9125,7 +11226,8 @@ template struct rocsparse_host<rocsparse_double_complex, int64_t, int64_t>;
                              rocsparse_index_base  base,             \
                              rocsparse_matrix_type matrix_type,      \
                              rocsparse_spmv_alg    algo,             \
-                             bool                  force_conj)
+                             bool                  force_conj,       \
+                             uint32_t              warp_size)
 
 #define INSTANTIATE_IABCT(ITYPE, ATYPE, BTYPE, CTYPE, TTYPE)              \
     template void host_coomm(ITYPE                M,                      \
@@ -9312,6 +11414,10 @@ INSTANTIATE_T(rocsparse_double_complex);
 INSTANTIATE_T_REAL_ONLY(float);
 INSTANTIATE_T_REAL_ONLY(double);
 
+INSTANTIATE_IJ(int32_t, int32_t);
+INSTANTIATE_IJ(int64_t, int32_t);
+INSTANTIATE_IJ(int64_t, int64_t);
+
 INSTANTIATE_IT(int32_t, float);
 INSTANTIATE_IT(int32_t, double);
 INSTANTIATE_IT(int32_t, rocsparse_float_complex);
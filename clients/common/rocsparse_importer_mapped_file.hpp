@@ -0,0 +1,180 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_IMPORTER_MAPPED_FILE_HPP
+#define ROCSPARSE_IMPORTER_MAPPED_FILE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//
+// Read-only view of a whole file, memory mapped when the platform allows it and read into
+// memory otherwise.
+//
+class rocsparse_importer_mapped_file
+{
+private:
+    const char*       m_data{};
+    size_t            m_size{};
+    void*             m_map{};
+    std::vector<char> m_copy{};
+
+public:
+    rocsparse_importer_mapped_file() = default;
+    rocsparse_importer_mapped_file(const rocsparse_importer_mapped_file&) = delete;
+    rocsparse_importer_mapped_file& operator=(const rocsparse_importer_mapped_file&) = delete;
+
+    ~rocsparse_importer_mapped_file()
+    {
+        this->close();
+    }
+
+    const char* begin() const
+    {
+        return this->m_data;
+    }
+
+    const char* end() const
+    {
+        return this->m_data + this->m_size;
+    }
+
+    size_t size() const
+    {
+        return this->m_size;
+    }
+
+    bool open(const char* filename)
+    {
+        this->close();
+#ifndef WIN32
+        const int fd = ::open(filename, O_RDONLY);
+        if(fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st;
+        if(fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        this->m_size = static_cast<size_t>(st.st_size);
+        if(this->m_size > 0)
+        {
+            void* map = mmap(nullptr, this->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(map == MAP_FAILED)
+            {
+                ::close(fd);
+                this->m_size = 0;
+                return false;
+            }
+            madvise(map, this->m_size, MADV_SEQUENTIAL);
+            this->m_map  = map;
+            this->m_data = static_cast<const char*>(map);
+        }
+
+        ::close(fd);
+        return true;
+#else
+        FILE* f = fopen(filename, "rb");
+        if(f == nullptr)
+        {
+            return false;
+        }
+
+        fseek(f, 0, SEEK_END);
+        const long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        this->m_copy.resize(size > 0 ? size : 0);
+        const size_t nread = fread(this->m_copy.data(), 1, this->m_copy.size(), f);
+        fclose(f);
+        if(nread != this->m_copy.size())
+        {
+            this->m_copy.clear();
+            return false;
+        }
+
+        this->m_size = this->m_copy.size();
+        this->m_data = this->m_copy.data();
+        return true;
+#endif
+    }
+
+    void close()
+    {
+#ifndef WIN32
+        if(this->m_map != nullptr)
+        {
+            munmap(this->m_map, this->m_size);
+            this->m_map = nullptr;
+        }
+#endif
+        this->m_copy.clear();
+        this->m_copy.shrink_to_fit();
+        this->m_data = nullptr;
+        this->m_size = 0;
+    }
+
+    //
+    // Split [begin_, end_) into at most nchunks_ ranges of whole lines. Every range but the
+    // last one ends right after a newline.
+    //
+    static std::vector<std::pair<const char*, const char*>>
+        split_lines(const char* begin_, const char* end_, size_t nchunks_)
+    {
+        std::vector<std::pair<const char*, const char*>> chunks;
+        const size_t size  = end_ - begin_;
+        const size_t chunk = (nchunks_ > 0) ? (size - 1) / nchunks_ + 1 : size;
+        const char*  p     = begin_;
+        while(p < end_)
+        {
+            const char* q = (static_cast<size_t>(end_ - p) > chunk) ? (p + chunk) : end_;
+            if(q < end_)
+            {
+                const char* eol = static_cast<const char*>(memchr(q, '\n', end_ - q));
+                q               = (eol != nullptr) ? (eol + 1) : end_;
+            }
+            chunks.push_back(std::make_pair(p, q));
+            p = q;
+        }
+        return chunks;
+    }
+};
+
+#endif
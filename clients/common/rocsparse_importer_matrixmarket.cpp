@@ -22,105 +22,287 @@
  *
  * ************************************************************************ */
 #include "rocsparse_importer_matrixmarket.hpp"
+#include <limits>
 #include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 rocsparse_importer_matrixmarket::rocsparse_importer_matrixmarket(const std::string& filename_)
     : m_filename(filename_)
 {
 }
 
+//
+// Size of the ranges of lines the body of the file is split into, each range being parsed by
+// a single thread.
+//
+static constexpr size_t s_mtx_chunk_size = size_t(4) << 20;
+
+static inline int get_mtx_num_threads()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
 /* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, int8_t& val)
+/*! \brief  Copy the line starting at p into line and return the beginning of the next line */
+static inline const char* get_mtx_line(const char* p, const char* end, char* line, size_t size)
+{
+    const char*  eol = static_cast<const char*>(memchr(p, '\n', end - p));
+    const char*  q   = (eol != nullptr) ? eol : end;
+    const size_t len = std::min(static_cast<size_t>(q - p), size - 1);
+    memcpy(line, p, len);
+    line[len] = '\0';
+    return (eol != nullptr) ? (eol + 1) : end;
+}
+
+static inline const char* skip_mtx_blanks(const char* p, const char* end)
+{
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+    return p;
+}
+
+/*! \brief  Parse a decimal integer, return the position after it or nullptr */
+static inline const char* read_mtx_index(const char* p, const char* end, int64_t& v)
+{
+    p = skip_mtx_blanks(p, end);
+    bool neg = false;
+    if(p < end && (*p == '-' || *p == '+'))
+    {
+        neg = (*p == '-');
+        ++p;
+    }
+
+    if(p == end || *p < '0' || *p > '9')
+    {
+        return nullptr;
+    }
+
+    int64_t x = 0;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        x = x * 10 + (*p - '0');
+        ++p;
+    }
+
+    v = neg ? -x : x;
+    return p;
+}
+
+//
+// Floating point values are parsed with strtof / strtod, which stop at the newline ending the
+// line. The last line of the body is always newline terminated, see import_sparse_coo.
+//
+static inline const char* read_mtx_real(const char* p, const char* end, float& v)
+{
+    p = skip_mtx_blanks(p, end);
+    if(p == end || *p == '\n')
+    {
+        return nullptr;
+    }
+    char* q = nullptr;
+    v       = strtof(p, &q);
+    return (q != p) ? q : nullptr;
+}
+
+static inline const char* read_mtx_real(const char* p, const char* end, double& v)
 {
-    is >> row >> col >> val;
+    p = skip_mtx_blanks(p, end);
+    if(p == end || *p == '\n')
+    {
+        return nullptr;
+    }
+    char* q = nullptr;
+    v       = strtod(p, &q);
+    return (q != p) ? q : nullptr;
+}
+
+/*! \brief  Read the value of an entry */
+static inline const char* read_mtx_value(const char* p, const char* end, int8_t& val)
+{
+    double x{};
+    p   = read_mtx_real(p, end, x);
+    val = static_cast<int8_t>(x);
+    return p;
 }
 
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, float& val)
+static inline const char* read_mtx_value(const char* p, const char* end, float& val)
 {
-    is >> row >> col >> val;
+    return read_mtx_real(p, end, val);
 }
 
-static inline void read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, double& val)
+static inline const char* read_mtx_value(const char* p, const char* end, double& val)
 {
-    is >> row >> col >> val;
+    return read_mtx_real(p, end, val);
 }
 
-static inline void
-    read_mtx_value(std::istringstream& is, int64_t& row, int64_t& col, rocsparse_float_complex& val)
+static inline const char*
+    read_mtx_value(const char* p, const char* end, rocsparse_float_complex& val)
 {
     float real{};
     float imag{};
 
-    is >> row >> col >> real >> imag;
+    // Real and integer files have no imaginary part
+    p             = read_mtx_real(p, end, real);
+    const char* q = (p != nullptr) ? read_mtx_real(p, end, imag) : nullptr;
 
     val = {real, imag};
+    return (q != nullptr) ? q : p;
 }
 
-static inline void read_mtx_value(std::istringstream&       is,
-                                  int64_t&                  row,
-                                  int64_t&                  col,
-                                  rocsparse_double_complex& val)
+static inline const char*
+    read_mtx_value(const char* p, const char* end, rocsparse_double_complex& val)
 {
     double real{};
     double imag{};
 
-    is >> row >> col >> real >> imag;
+    // Real and integer files have no imaginary part
+    p             = read_mtx_real(p, end, real);
+    const char* q = (p != nullptr) ? read_mtx_real(p, end, imag) : nullptr;
 
     val = {real, imag};
+    return (q != nullptr) ? q : p;
 }
 
-template <typename I, typename J>
-rocsparse_status
-
-    rocsparse_importer_matrixmarket::import_sparse_csx(
-        rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
+/* ============================================================================================ */
+/*! \brief  Stable parallel LSD radix sort of keys of nbits bits, perm is permuted along */
+template <typename I>
+static void radix_sort_mtx_keys(size_t n, int nbits, uint64_t* keys, I* perm)
 {
-    return rocsparse_status_not_implemented;
-}
+    static constexpr int    radix_bits = 8;
+    static constexpr size_t radix      = size_t(1) << radix_bits;
 
-template <typename T, typename I, typename J>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I* ptr, J* ind, T* val)
-{
-    return rocsparse_status_not_implemented;
-}
+    const size_t nblocks = std::max(std::min(static_cast<size_t>(get_mtx_num_threads()), n),
+                                    static_cast<size_t>(1));
+    const size_t block   = (n - 1) / nblocks + 1;
 
-template <typename I, typename J>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(rocsparse_direction* dir,
-                                                                      rocsparse_direction* dirb,
-                                                                      J*                   mb,
-                                                                      J*                   nb,
-                                                                      I*                   nnzb,
-                                                                      J* block_dim_row,
-                                                                      J* block_dim_column,
-                                                                      rocsparse_index_base* base)
-{
-    return rocsparse_status_not_implemented;
+    std::vector<uint64_t> keys_tmp(n);
+    std::vector<I>        perm_tmp(n);
+    std::vector<size_t>   hist(nblocks * radix);
+
+    uint64_t* src_keys = keys;
+    I*        src_perm = perm;
+    uint64_t* dst_keys = keys_tmp.data();
+    I*        dst_perm = perm_tmp.data();
+
+    for(int shift = 0; shift < nbits; shift += radix_bits)
+    {
+        std::fill(hist.begin(), hist.end(), 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(size_t b = 0; b < nblocks; ++b)
+        {
+            size_t*      h     = hist.data() + b * radix;
+            const size_t begin = b * block;
+            const size_t end   = std::min(n, begin + block);
+            for(size_t i = begin; i < end; ++i)
+            {
+                ++h[(src_keys[i] >> shift) & (radix - 1)];
+            }
+        }
+
+        // Skip the pass if all keys share the same digit
+        bool skip = false;
+        for(size_t d = 0; d < radix; ++d)
+        {
+            size_t count = 0;
+            for(size_t b = 0; b < nblocks; ++b)
+            {
+                count += hist[b * radix + d];
+            }
+            if(count == n)
+            {
+                skip = true;
+            }
+            if(count > 0)
+            {
+                break;
+            }
+        }
+
+        if(skip)
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+        for(size_t d = 0; d < radix; ++d)
+        {
+            for(size_t b = 0; b < nblocks; ++b)
+            {
+                const size_t count  = hist[b * radix + d];
+                hist[b * radix + d] = offset;
+
+                offset += count;
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(size_t b = 0; b < nblocks; ++b)
+        {
+            size_t*      h     = hist.data() + b * radix;
+            const size_t begin = b * block;
+            const size_t end   = std::min(n, begin + block);
+            for(size_t i = begin; i < end; ++i)
+            {
+                const size_t k = h[(src_keys[i] >> shift) & (radix - 1)]++;
+                dst_keys[k]    = src_keys[i];
+                dst_perm[k]    = src_perm[i];
+            }
+        }
+
+        std::swap(src_keys, dst_keys);
+        std::swap(src_perm, dst_perm);
+    }
+
+    if(src_perm != perm)
+    {
+        std::copy(src_perm, src_perm + n, perm);
+    }
 }
 
-template <typename T, typename I, typename J>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(I* ptr, J* ind, T* val)
+static inline int count_mtx_bits(uint64_t x)
 {
-    return rocsparse_status_not_implemented;
+    int nbits = 0;
+    while(x > 0)
+    {
+        ++nbits;
+        x >>= 1;
+    }
+    return nbits;
 }
 
-template <typename I>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*                    m,
-                                                                    I*                    n,
-                                                                    int64_t*              nnz,
-                                                                    rocsparse_index_base* base)
+rocsparse_status rocsparse_importer_matrixmarket::import_header()
 {
     char line[1024];
-    f = fopen(this->m_filename.c_str(), "r");
-    if(!f)
+    if(!this->m_file.open(this->m_filename.c_str()))
     {
         missing_file_error_message(this->m_filename.c_str());
         return rocsparse_status_internal_error;
     }
+
+    const char* p   = this->m_file.begin();
+    const char* end = this->m_file.end();
+
     // Check for banner
-    if(!fgets(line, 1024, f))
+    if(p == end)
     {
         throw rocsparse_status_internal_error;
     }
+    p = get_mtx_line(p, end, line, 1024);
 
     char banner[16];
     char array[16];
@@ -178,183 +360,421 @@ rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*
     this->m_symm = !strcmp(type, "symmetric");
 
     // Skip comments
-    while(fgets(line, 1024, f))
+    while(p < end)
     {
+        p = get_mtx_line(p, end, line, 1024);
         if(line[0] != '%')
         {
             break;
         }
     }
 
-    // Read dimensions
-    I snnz;
-
-    int inrow;
-    int incol;
-    int innz;
-
-    sscanf(line, "%d %d %d", &inrow, &incol, &innz);
-
-    rocsparse_status status;
-    status = rocsparse_type_conversion(inrow, m[0]);
-    if(status != rocsparse_status_success)
-        return status;
-
-    status = rocsparse_type_conversion(incol, n[0]);
-    if(status != rocsparse_status_success)
-        return status;
-
-    status = rocsparse_type_conversion(innz, snnz);
-    if(status != rocsparse_status_success)
-        return status;
-
-    if(this->m_symm)
+    // Read dimensions, the number of entries of the file may not fit in 32 bits
+    int64_t     inrow{};
+    int64_t     incol{};
+    int64_t     innz{};
+    const char* dims     = line;
+    const char* dims_end = line + strlen(line);
+
+    dims = read_mtx_index(dims, dims_end, inrow);
+    dims = (dims != nullptr) ? read_mtx_index(dims, dims_end, incol) : nullptr;
+    dims = (dims != nullptr) ? read_mtx_index(dims, dims_end, innz) : nullptr;
+    if(dims == nullptr || inrow < 0 || incol < 0 || innz < 0)
     {
-        //
-        //
-        // We need to count how many diagonal elements are in the file.
-        //
-        //
+        throw rocsparse_status_internal_error;
+    }
 
-        //
-        // Record position.
-        //
-        fpos_t pos;
-        if(0 != fgetpos(this->f, &pos))
+    //
+    // The body is parsed by ranges of whole lines. A last line without newline is copied,
+    // so that every line of every range is newline terminated.
+    //
+    const char* body_end = end;
+    this->m_tail.clear();
+    if(p < end && end[-1] != '\n')
+    {
+        const char* last = end;
+        while(last > p && last[-1] != '\n')
         {
-            throw rocsparse_status_internal_error;
+            --last;
         }
+        this->m_tail.assign(last, end);
+        this->m_tail.push_back('\n');
+        body_end = last;
+    }
+
+    const size_t nchunks
+        = (body_end - p) / s_mtx_chunk_size + static_cast<size_t>(get_mtx_num_threads());
+    this->m_chunks = rocsparse_importer_mapped_file::split_lines(p, body_end, nchunks);
+    if(!this->m_tail.empty())
+    {
+        this->m_chunks.push_back(std::make_pair(this->m_tail.data(),
+                                                this->m_tail.data() + this->m_tail.size()));
+    }
 
-        //
-        // Count diagonal coefficients.
-        //
-        I num_diagonal_coefficients = 0;
-        while(fgets(line, 1024, f))
+    //
+    // Count the entries of each range, the diagonal of symmetric matrices is counted in the
+    // same pass.
+    //
+    const size_t        nranges = this->m_chunks.size();
+    const bool          symm    = this->m_symm;
+    std::vector<size_t> range_nlines(nranges, 0);
+    this->m_chunk_nnz.assign(nranges + 1, 0);
+
+    bool failed = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(|| : failed)
+#endif
+    for(size_t c = 0; c < nranges; ++c)
+    {
+        const char* q       = this->m_chunks[c].first;
+        const char* q_end   = this->m_chunks[c].second;
+        size_t      nlines  = 0;
+        size_t      nexpand = 0;
+        while(q < q_end)
         {
-            int32_t irow{};
-            int32_t icol{};
-            sscanf(line, "%d %d", &irow, &icol);
-            if(irow == icol)
+            const char* eol = static_cast<const char*>(memchr(q, '\n', q_end - q));
+            eol             = (eol != nullptr) ? eol : q_end;
+            const char* r   = skip_mtx_blanks(q, eol);
+            if(r < eol && *r != '%')
             {
-                ++num_diagonal_coefficients;
+                int64_t irow{};
+                int64_t icol{};
+                r = read_mtx_index(r, eol, irow);
+                r = (r != nullptr) ? read_mtx_index(r, eol, icol) : nullptr;
+                if(r == nullptr || irow < 1 || irow > inrow || icol < 1 || icol > incol)
+                {
+                    failed = true;
+                    break;
+                }
+
+                ++nlines;
+                nexpand += (symm && irow != icol) ? 2 : 1;
             }
+            q = eol + 1;
         }
+        range_nlines[c]            = nlines;
+        this->m_chunk_nnz[c + 1] = nexpand;
+    }
 
-        //
-        // Set position.
-        //
-        if(0 != fsetpos(this->f, &pos))
-        {
-            throw rocsparse_status_internal_error;
-        }
+    size_t nlines = 0;
+    for(size_t c = 0; c < nranges; ++c)
+    {
+        nlines += range_nlines[c];
+        this->m_chunk_nnz[c + 1] += this->m_chunk_nnz[c];
+    }
 
-        //
-        // Now calculate the right number of coefficients.
-        //
-        snnz = (snnz - num_diagonal_coefficients) * 2 + num_diagonal_coefficients;
+    if(failed || nlines != static_cast<size_t>(innz))
+    {
+        throw rocsparse_status_internal_error;
     }
 
-    status = rocsparse_type_conversion(snnz, nnz[0]);
+    this->m_m   = inrow;
+    this->m_n   = incol;
+    this->m_nnz = this->m_chunk_nnz[nranges];
+    return rocsparse_status_success;
+}
+
+template <typename I>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I*                    m,
+                                                                    I*                    n,
+                                                                    int64_t*              nnz,
+                                                                    rocsparse_index_base* base)
+{
+    rocsparse_status status = this->import_header();
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_m, m[0]);
     if(status != rocsparse_status_success)
         return status;
 
-    base[0]     = rocsparse_index_base_one;
-    this->m_nnz = snnz;
+    status = rocsparse_type_conversion(this->m_n, n[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_nnz, nnz[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    base[0] = rocsparse_index_base_one;
     return rocsparse_status_success;
 }
 
-template <typename T, typename I>
-rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind, I* col_ind, T* val)
+/* ============================================================================================ */
+/*! \brief  Sort the entries by row and column index and gather them into the outputs.
+ *  \details
+ *  P is the type of the permutation, large enough to hold nnz. The rows are written to row_ind
+ *  or compressed into the one-based row offsets ptr, whichever is not null.
+ */
+template <typename P, typename T, typename I, typename J>
+static void sort_mtx_entries(size_t   nnz,
+                             int64_t  m,
+                             int64_t  n,
+                             const J* unsorted_row,
+                             const J* unsorted_col,
+                             const T* unsorted_val,
+                             I*       ptr,
+                             J*       row_ind,
+                             J*       col_ind,
+                             T*       val)
 {
-    char           line[1024];
-    const size_t   nnz = this->m_nnz;
-    std::vector<I> unsorted_row(nnz);
-    std::vector<I> unsorted_col(nnz);
-    std::vector<T> unsorted_val(nnz);
+    std::vector<P> perm(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(size_t i = 0; i < nnz; ++i)
+    {
+        perm[i] = static_cast<P>(i);
+    }
 
-    // Read entries
-    I idx = 0;
-    while(fgets(line, 1024, f))
+    const int col_bits = count_mtx_bits(std::max(n, static_cast<int64_t>(1)));
+    const int row_bits = count_mtx_bits(std::max(m, static_cast<int64_t>(1)));
+    if(row_bits + col_bits <= 64)
     {
-        if(idx >= nnz)
+        // Indices are one-based, a key of (row, col) fits in 64 bits
+        std::vector<uint64_t> keys(nnz);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(size_t i = 0; i < nnz; ++i)
         {
-            throw rocsparse_status_internal_error;
+            keys[i] = (static_cast<uint64_t>(unsorted_row[i]) << col_bits)
+                      | static_cast<uint64_t>(unsorted_col[i]);
         }
 
-        int64_t irow{};
-        int64_t icol{};
-        T       ival;
+        radix_sort_mtx_keys(nnz, row_bits + col_bits, keys.data(), perm.data());
+    }
+    else
+    {
+        std::stable_sort(perm.begin(), perm.end(), [&](const P& a, const P& b) {
+            if(unsorted_row[a] < unsorted_row[b])
+            {
+                return true;
+            }
+            else if(unsorted_row[a] == unsorted_row[b])
+            {
+                return (unsorted_col[a] < unsorted_col[b]);
+            }
+            else
+            {
+                return false;
+            }
+        });
+    }
 
-        std::istringstream ss(line);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for(size_t i = 0; i < nnz; ++i)
+    {
+        col_ind[i] = unsorted_col[perm[i]];
+        val[i]     = unsorted_val[perm[i]];
+    }
 
-        if(!strcmp(this->m_data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = static_cast<T>(1);
-        }
-        else
+    if(row_ind != nullptr)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(size_t i = 0; i < nnz; ++i)
         {
-            read_mtx_value(ss, irow, icol, ival);
+            row_ind[i] = unsorted_row[perm[i]];
         }
+    }
 
-        unsorted_row[idx] = (I)irow;
-        unsorted_col[idx] = (I)icol;
-        unsorted_val[idx] = ival;
-
-        ++idx;
-        if(this->m_symm && irow != icol)
+    if(ptr != nullptr)
+    {
+        // Each entry starting a row sets the offsets of the rows since the previous entry
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(size_t i = 0; i < nnz; ++i)
         {
-            if(idx >= nnz)
+            const int64_t row  = static_cast<int64_t>(unsorted_row[perm[i]]) - 1;
+            const int64_t prev = (i > 0) ? static_cast<int64_t>(unsorted_row[perm[i - 1]]) - 1 : -1;
+            for(int64_t r = prev + 1; r <= row; ++r)
             {
-                throw rocsparse_status_internal_error;
+                ptr[r] = static_cast<I>(i + 1);
             }
+        }
 
-            unsorted_row[idx] = (I)icol;
-            unsorted_col[idx] = (I)irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+        const int64_t last = (nnz > 0) ? static_cast<int64_t>(unsorted_row[perm[nnz - 1]]) - 1 : -1;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(int64_t r = last + 1; r <= m; ++r)
+        {
+            ptr[r] = static_cast<I>(nnz + 1);
         }
     }
-    fclose(f);
+}
 
-    // Sort by row and column index
-    std::vector<I> perm(nnz);
-    for(I i = 0; i < nnz; ++i)
-    {
-        perm[i] = i;
-    }
+template <typename T, typename I, typename J>
+rocsparse_status
+    rocsparse_importer_matrixmarket::import_sorted_entries(I* ptr, J* row_ind, J* col_ind, T* val)
+{
+    const size_t   nnz = this->m_nnz;
+    std::vector<J> unsorted_row(nnz);
+    std::vector<J> unsorted_col(nnz);
+    std::vector<T> unsorted_val(nnz);
 
-    std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
+    // Read entries, each range of lines is written at its own offset
+    const size_t nranges = this->m_chunks.size();
+    const bool   symm    = this->m_symm;
+    const bool   pattern = !strcmp(this->m_data, "pattern");
+    bool         failed  = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(|| : failed)
+#endif
+    for(size_t c = 0; c < nranges; ++c)
+    {
+        const char* q     = this->m_chunks[c].first;
+        const char* q_end = this->m_chunks[c].second;
+        size_t      idx   = this->m_chunk_nnz[c];
+        while(q < q_end)
         {
-            return false;
+            const char* eol = static_cast<const char*>(memchr(q, '\n', q_end - q));
+            eol             = (eol != nullptr) ? eol : q_end;
+            const char* r   = skip_mtx_blanks(q, eol);
+            if(r < eol && *r != '%')
+            {
+                int64_t irow{};
+                int64_t icol{};
+                T       ival = static_cast<T>(1);
+
+                r = read_mtx_index(r, eol, irow);
+                r = (r != nullptr) ? read_mtx_index(r, eol, icol) : nullptr;
+                if(r != nullptr && !pattern)
+                {
+                    r = read_mtx_value(r, eol, ival);
+                }
+
+                if(r == nullptr || idx >= this->m_chunk_nnz[c + 1])
+                {
+                    failed = true;
+                    break;
+                }
+
+                unsorted_row[idx] = (J)irow;
+                unsorted_col[idx] = (J)icol;
+                unsorted_val[idx] = ival;
+                ++idx;
+
+                if(symm && irow != icol)
+                {
+                    unsorted_row[idx] = (J)icol;
+                    unsorted_col[idx] = (J)irow;
+                    unsorted_val[idx] = ival;
+                    ++idx;
+                }
+            }
+            q = eol + 1;
         }
-    });
+    }
+
+    this->m_chunks.clear();
+    this->m_chunk_nnz.clear();
+    this->m_tail.clear();
+    this->m_file.close();
 
-    for(I i = 0; i < nnz; ++i)
+    if(failed)
     {
-        row_ind[i] = unsorted_row[perm[i]];
+        throw rocsparse_status_internal_error;
     }
-    for(I i = 0; i < nnz; ++i)
+
+    // A 32 bits permutation is enough unless the matrix has more than 2^31 - 1 entries
+    if(nnz <= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
     {
-        col_ind[i] = unsorted_col[perm[i]];
+        sort_mtx_entries<int32_t>(nnz,
+                                  this->m_m,
+                                  this->m_n,
+                                  unsorted_row.data(),
+                                  unsorted_col.data(),
+                                  unsorted_val.data(),
+                                  ptr,
+                                  row_ind,
+                                  col_ind,
+                                  val);
     }
-    for(I i = 0; i < nnz; ++i)
+    else
     {
-        val[i] = unsorted_val[perm[i]];
+        sort_mtx_entries<int64_t>(nnz,
+                                  this->m_m,
+                                  this->m_n,
+                                  unsorted_row.data(),
+                                  unsorted_col.data(),
+                                  unsorted_val.data(),
+                                  ptr,
+                                  row_ind,
+                                  col_ind,
+                                  val);
     }
 
     return rocsparse_status_success;
 }
 
+template <typename T, typename I>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_coo(I* row_ind, I* col_ind, T* val)
+{
+    return this->import_sorted_entries<T, I, I>(nullptr, row_ind, col_ind, val);
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(
+    rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
+{
+    rocsparse_status status = this->import_header();
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_m, m[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_n, n[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    status = rocsparse_type_conversion(this->m_nnz, nnz[0]);
+    if(status != rocsparse_status_success)
+        return status;
+
+    // The row offsets are one-based and go up to nnz + 1
+    I nnz_end;
+    status = rocsparse_type_conversion(this->m_nnz + 1, nnz_end);
+    if(status != rocsparse_status_success)
+        return status;
+
+    dir[0]  = rocsparse_direction_row;
+    base[0] = rocsparse_index_base_one;
+    return rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I* ptr, J* ind, T* val)
+{
+    return this->import_sorted_entries<T, I, J>(ptr, nullptr, ind, val);
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(rocsparse_direction* dir,
+                                                                      rocsparse_direction* dirb,
+                                                                      J*                   mb,
+                                                                      J*                   nb,
+                                                                      I*                   nnzb,
+                                                                      J* block_dim_row,
+                                                                      J* block_dim_column,
+                                                                      rocsparse_index_base* base)
+{
+    return rocsparse_status_not_implemented;
+}
+
+template <typename T, typename I, typename J>
+rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(I* ptr, J* ind, T* val)
+{
+    return rocsparse_status_not_implemented;
+}
+
 #define INSTANTIATE_TIJ(T, I, J)                                                              \
     template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_csx(I*, J*, T*); \
     template rocsparse_status rocsparse_importer_matrixmarket::import_sparse_gebsx(I*, J*, T*)
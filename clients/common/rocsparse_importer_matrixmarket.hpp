@@ -26,6 +26,7 @@
 #ifndef ROCSPARSE_IMPORTER_MATRIXMARKET_HPP
 #define ROCSPARSE_IMPORTER_MATRIXMARKET_HPP
 #include "rocsparse_importer.hpp"
+#include "rocsparse_importer_mapped_file.hpp"
 
 class rocsparse_importer_matrixmarket : public rocsparse_importer<rocsparse_importer_matrixmarket>
 {
@@ -36,10 +37,30 @@ public:
     rocsparse_importer_matrixmarket(const std::string& filename_);
 
 private:
-    FILE*  f;
-    size_t m_nnz;
-    char   m_data[16];
-    int    m_symm;
+    //
+    // The body of the file is parsed in parallel, by ranges of whole lines. m_chunk_nnz holds
+    // the offset of the first entry of each range once symmetric entries are expanded.
+    //
+    rocsparse_importer_mapped_file                   m_file;
+    std::vector<std::pair<const char*, const char*>> m_chunks;
+    std::vector<size_t>                              m_chunk_nnz;
+    std::string                                      m_tail;
+    int64_t                                          m_m;
+    int64_t                                          m_n;
+    size_t                                           m_nnz;
+    char                                             m_data[16];
+    int                                              m_symm;
+
+    //
+    // Parse the header and count the entries of the file.
+    //
+    rocsparse_status import_header();
+
+    //
+    // Parse and sort the entries, rows are either written to row_ind or compressed into ptr.
+    //
+    template <typename T, typename I, typename J>
+    rocsparse_status import_sorted_entries(I* ptr, J* row_ind, J* col_ind, T* val);
 
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
@@ -0,0 +1,555 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_IMPORTER_ML_STRUCTURE_HPP
+#define ROCSPARSE_IMPORTER_ML_STRUCTURE_HPP
+
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparse_importer.hpp"
+#include "rocsparse_importer_mapped_file.hpp"
+#include "rocsparseio.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <vector>
+
+#ifdef WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+// Sparsity structure of the machine learning formats .smtx and .bsmtx: one line of dimensions,
+// a second line of block dimensions for .bsmtx files, followed by the offsets and the indices
+// as whitespace separated integers. Lines starting with '%' before the dimensions are skipped.
+//
+// The integers are tokenized in parallel from a memory mapped view of the file. The structure
+// is then stored in the binary sidecar <file>.sidecar, in the rocsparseio format, which later
+// imports read instead of the text as long as the size and the modification time of the file
+// are unchanged. Sidecars are enabled with ROCSPARSE_CLIENTS_MATRICES_SIDECAR=1.
+//
+class rocsparse_importer_ml_structure
+{
+public:
+    size_t nrow{};
+    size_t ncol{};
+    size_t nnz{};
+    size_t block_dim_row{1};
+    size_t block_dim_col{1};
+
+    rocsparse_importer_ml_structure() = default;
+    rocsparse_importer_ml_structure(const rocsparse_importer_ml_structure&) = delete;
+    rocsparse_importer_ml_structure& operator=(const rocsparse_importer_ml_structure&) = delete;
+
+    ~rocsparse_importer_ml_structure()
+    {
+        this->close_sidecar();
+    }
+
+    //
+    // \brief Read the dimensions, from the sidecar if it is up to date.
+    //
+    rocsparse_status open(const std::string& filename, const char* kind, bool blocked)
+    {
+        this->m_filename = filename;
+        this->m_kind     = kind;
+        this->m_blocked  = blocked;
+        if(this->open_sidecar())
+        {
+            return rocsparse_status_success;
+        }
+        return this->open_text();
+    }
+
+    //
+    // \brief Read the nptr offsets into ptr and the nind indices into ind.
+    //
+    template <typename I, typename J>
+    rocsparse_status read(size_t nptr, I* ptr, size_t nind, J* ind)
+    {
+        if(this->m_sidecar != nullptr)
+        {
+            const bool hit = read_sidecar_array(this->m_sidecar, nptr, ptr)
+                             && read_sidecar_array(this->m_sidecar, nind, ind);
+            this->close_sidecar();
+            if(hit)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Fall back to the text file
+            const size_t dims[5] = {this->nrow,
+                                    this->ncol,
+                                    this->nnz,
+                                    this->block_dim_row,
+                                    this->block_dim_col};
+            rocsparse_status status = this->open_text();
+            if(status != rocsparse_status_success)
+            {
+                return status;
+            }
+            if(dims[0] != this->nrow || dims[1] != this->ncol || dims[2] != this->nnz
+               || dims[3] != this->block_dim_row || dims[4] != this->block_dim_col)
+            {
+                return rocsparse_status_internal_error;
+            }
+        }
+
+        rocsparse_status status = this->tokenize(nptr, ptr, nind, ind);
+        this->m_file.close();
+        if(status == rocsparse_status_success)
+        {
+            this->store_sidecar(nptr, ptr, nind, ind);
+        }
+        return status;
+    }
+
+private:
+    std::string                    m_filename{};
+    const char*                    m_kind{};
+    bool                           m_blocked{};
+    rocsparse_importer_mapped_file m_file{};
+    const char*                    m_body{};
+    rocsparseio_handle             m_sidecar{};
+
+    //
+    // Size of the ranges of the body tokenized by a single thread.
+    //
+    static constexpr size_t s_chunk_size = size_t(1) << 20;
+
+    static int get_num_threads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    static bool is_blank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static rocsparseio_type get_sidecar_type(const int32_t*)
+    {
+        return rocsparseio_type_int32;
+    }
+
+    static rocsparseio_type get_sidecar_type(const int64_t*)
+    {
+        return rocsparseio_type_int64;
+    }
+
+    //
+    // rocsparseio formats its file names, '%' must be escaped.
+    //
+    static std::string escape_sidecar_format(const std::string& s)
+    {
+        std::string r;
+        for(char c : s)
+        {
+            r += c;
+            if(c == '%')
+            {
+                r += c;
+            }
+        }
+        return r;
+    }
+
+    std::string get_sidecar_filename() const
+    {
+        return this->m_filename + ".sidecar";
+    }
+
+    //
+    // The key identifies the version of the file the sidecar was built from.
+    //
+    bool get_sidecar_key(std::string& key) const
+    {
+        if(!rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_SIDECAR))
+        {
+            return false;
+        }
+
+        struct stat st;
+        if(stat(this->m_filename.c_str(), &st) != 0)
+        {
+            return false;
+        }
+
+        char buffer[128];
+        snprintf(buffer,
+                 sizeof(buffer),
+                 " %" PRId64 " %" PRId64,
+                 static_cast<int64_t>(st.st_size),
+                 static_cast<int64_t>(st.st_mtime));
+        key = std::string(this->m_kind) + buffer;
+        return true;
+    }
+
+    bool open_sidecar()
+    {
+        std::string key;
+        if(!this->get_sidecar_key(key))
+        {
+            return false;
+        }
+
+        const std::string filename = this->get_sidecar_filename();
+        struct stat       st;
+        if(stat(filename.c_str(), &st) != 0)
+        {
+            return false;
+        }
+
+        const std::string format = escape_sidecar_format(filename);
+        if(rocsparseio_open(&this->m_sidecar, rocsparseio_rwmode_read, format.c_str())
+           != rocsparseio_status_success)
+        {
+            this->m_sidecar = nullptr;
+            return false;
+        }
+
+        rocsparseio_string name;
+        size_t             dims[5];
+        const bool         hit
+            = rocsparseio_read_name(this->m_sidecar, name) == rocsparseio_status_success
+              && key.compare(0, key.size(), name, key.size()) == 0 && name[key.size()] == ' '
+              && sscanf(name + key.size(),
+                        " %zu %zu %zu %zu %zu",
+                        &dims[0],
+                        &dims[1],
+                        &dims[2],
+                        &dims[3],
+                        &dims[4])
+                     == 5;
+        if(!hit)
+        {
+            this->close_sidecar();
+            return false;
+        }
+
+        this->nrow          = dims[0];
+        this->ncol          = dims[1];
+        this->nnz           = dims[2];
+        this->block_dim_row = dims[3];
+        this->block_dim_col = dims[4];
+        return true;
+    }
+
+    void close_sidecar()
+    {
+        if(this->m_sidecar != nullptr)
+        {
+            rocsparseio_close(this->m_sidecar);
+            this->m_sidecar = nullptr;
+        }
+    }
+
+    template <typename I>
+    static bool read_sidecar_array(rocsparseio_handle handle, size_t size, I* data)
+    {
+        rocsparseio_type type;
+        uint64_t         nmemb;
+        if(rocsparseiox_read_metadata_dense_vector(handle, &type, &nmemb)
+               != rocsparseio_status_success
+           || nmemb != size)
+        {
+            return false;
+        }
+
+        if(type == get_sidecar_type(data))
+        {
+            return rocsparseiox_read_dense_vector(handle, data, 1) == rocsparseio_status_success;
+        }
+
+        if(type == rocsparseio_type_int32)
+        {
+            std::vector<int32_t> tmp(size);
+            if(rocsparseiox_read_dense_vector(handle, tmp.data(), 1) != rocsparseio_status_success)
+            {
+                return false;
+            }
+            rocsparse_importer_copy_mixed_arrays(size, data, tmp.data());
+            return true;
+        }
+
+        if(type == rocsparseio_type_int64)
+        {
+            std::vector<int64_t> tmp(size);
+            if(rocsparseiox_read_dense_vector(handle, tmp.data(), 1) != rocsparseio_status_success)
+            {
+                return false;
+            }
+
+            // The indices stored in 64 bits may not fit in I
+            for(size_t i = 0; i < size; ++i)
+            {
+                if(tmp[i] > static_cast<int64_t>(std::numeric_limits<I>::max()))
+                {
+                    return false;
+                }
+            }
+            rocsparse_importer_copy_mixed_arrays(size, data, tmp.data());
+            return true;
+        }
+        return false;
+    }
+
+    //
+    // Write the sidecar to a temporary file first, concurrent processes may store it at the
+    // same time. Failures are ignored.
+    //
+    template <typename I, typename J>
+    void store_sidecar(size_t nptr, const I* ptr, size_t nind, const J* ind) const
+    {
+        std::string key;
+        if(!this->get_sidecar_key(key))
+        {
+            return;
+        }
+
+        char dims[128];
+        snprintf(dims,
+                 sizeof(dims),
+                 " %zu %zu %zu %zu %zu",
+                 this->nrow,
+                 this->ncol,
+                 this->nnz,
+                 this->block_dim_row,
+                 this->block_dim_col);
+        const std::string name     = key + dims;
+        const std::string filename = this->get_sidecar_filename();
+        const std::string tmp      = filename + ".tmp" + std::to_string(getpid());
+        const std::string format   = escape_sidecar_format(tmp);
+
+        // rocsparseio rejects null arrays, even empty ones
+        const J empty{};
+        if(nind == 0)
+        {
+            ind = &empty;
+        }
+
+        rocsparseio_handle handle{};
+        bool ok = rocsparseio_open(&handle, rocsparseio_rwmode_write, format.c_str())
+                  == rocsparseio_status_success;
+        ok = ok
+             && rocsparseio_write_dense_vector(
+                    handle, get_sidecar_type(ptr), nptr, ptr, 1, name.c_str())
+                    == rocsparseio_status_success
+             && rocsparseio_write_dense_vector(handle, get_sidecar_type(ind), nind, ind, 1, "ind")
+                    == rocsparseio_status_success;
+        if(handle != nullptr)
+        {
+            ok = (rocsparseio_close(handle) == rocsparseio_status_success) && ok;
+        }
+
+        if(!ok || rename(tmp.c_str(), filename.c_str()) != 0)
+        {
+            remove(tmp.c_str());
+        }
+    }
+
+    //
+    // Map the text file and parse its dimensions, comment lines start with '%'.
+    //
+    rocsparse_status open_text()
+    {
+        if(!this->m_file.open(this->m_filename.c_str()))
+        {
+            missing_file_error_message(this->m_filename.c_str());
+            return rocsparse_status_internal_error;
+        }
+
+        const char* p   = this->m_file.begin();
+        const char* end = this->m_file.end();
+        char        line[1024];
+        int         nlines = 0;
+        while(p < end && nlines < (this->m_blocked ? 2 : 1))
+        {
+            const char*  eol = static_cast<const char*>(memchr(p, '\n', end - p));
+            const char*  q   = (eol != nullptr) ? eol : end;
+            const size_t len = std::min(static_cast<size_t>(q - p), sizeof(line) - 1);
+            memcpy(line, p, len);
+            line[len] = '\0';
+            p         = (eol != nullptr) ? (eol + 1) : end;
+
+            // Dimensions may be separated by commas
+            std::replace(line, line + len, ',', ' ');
+
+            const char* l = &line[0];
+            while(l[0] != '\0' && (l[0] == ' ' || l[0] == '\t'))
+            {
+                ++l;
+            }
+
+            if(nlines == 0)
+            {
+                if(l[0] == '\0' || l[0] == '%')
+                {
+                    continue;
+                }
+                if(3 != sscanf(l, "%zu %zu %zu", &this->nrow, &this->ncol, &this->nnz))
+                {
+                    return rocsparse_status_internal_error;
+                }
+            }
+            else if(2 != sscanf(l, "%zu %zu", &this->block_dim_row, &this->block_dim_col))
+            {
+                return rocsparse_status_internal_error;
+            }
+            ++nlines;
+        }
+
+        if(nlines < (this->m_blocked ? 2 : 1))
+        {
+            return rocsparse_status_internal_error;
+        }
+
+        this->m_body = p;
+        return rocsparse_status_success;
+    }
+
+    template <typename I>
+    static bool store_token(uint64_t x, I& y)
+    {
+        if(x > static_cast<uint64_t>(std::numeric_limits<I>::max()))
+        {
+            return false;
+        }
+        y = static_cast<I>(x);
+        return true;
+    }
+
+    //
+    // Tokenize the body in two parallel passes, the first one counts the integers of each range
+    // and the second one parses them at their position.
+    //
+    template <typename I, typename J>
+    rocsparse_status tokenize(size_t nptr, I* ptr, size_t nind, J* ind) const
+    {
+        const char*  begin = this->m_body;
+        const char*  end   = this->m_file.end();
+        const size_t size  = end - begin;
+        const size_t nchunks
+            = std::max(std::min(size / s_chunk_size, static_cast<size_t>(get_num_threads()) * 8),
+                       static_cast<size_t>(1));
+
+        // Ranges end on a blank, such that no integer is split
+        std::vector<const char*> bounds(nchunks + 1);
+        bounds[0]       = begin;
+        bounds[nchunks] = end;
+        for(size_t c = 1; c < nchunks; ++c)
+        {
+            const char* p = begin + (size * c) / nchunks;
+            while(p < end && !is_blank(*p))
+            {
+                ++p;
+            }
+            bounds[c] = std::max(p, bounds[c - 1]);
+        }
+
+        std::vector<size_t> offsets(nchunks + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(size_t c = 0; c < nchunks; ++c)
+        {
+            size_t count = 0;
+            bool   blank = true;
+            for(const char* p = bounds[c]; p < bounds[c + 1]; ++p)
+            {
+                const bool b = is_blank(*p);
+                count += (blank && !b);
+                blank = b;
+            }
+            offsets[c + 1] = count;
+        }
+
+        for(size_t c = 0; c < nchunks; ++c)
+        {
+            offsets[c + 1] += offsets[c];
+        }
+
+        if(offsets[nchunks] < nptr + nind)
+        {
+            return rocsparse_status_internal_error;
+        }
+
+        bool ok = true;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) reduction(&& : ok)
+#endif
+        for(size_t c = 0; c < nchunks; ++c)
+        {
+            size_t      t = offsets[c];
+            const char* p = bounds[c];
+            const char* q = bounds[c + 1];
+            while(ok && t < nptr + nind)
+            {
+                while(p < q && is_blank(*p))
+                {
+                    ++p;
+                }
+                if(p == q)
+                {
+                    break;
+                }
+
+                uint64_t x = 0;
+                for(; p < q && !is_blank(*p); ++p)
+                {
+                    const unsigned d = static_cast<unsigned char>(*p) - '0';
+                    if(d > 9 || x > (std::numeric_limits<uint64_t>::max() - d) / 10)
+                    {
+                        ok = false;
+                        break;
+                    }
+                    x = x * 10 + d;
+                }
+
+                ok = ok && ((t < nptr) ? store_token(x, ptr[t]) : store_token(x, ind[t - nptr]));
+                ++t;
+            }
+        }
+
+        return ok ? rocsparse_status_success : rocsparse_status_internal_error;
+    }
+};
+
+#endif // ROCSPARSE_IMPORTER_ML_STRUCTURE_HPP
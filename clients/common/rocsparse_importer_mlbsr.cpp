@@ -23,14 +23,6 @@
  * ************************************************************************ */
 #include "rocsparse_importer_mlbsr.hpp"
 #include <stdio.h>
-rocsparse_importer_mlbsr::~rocsparse_importer_mlbsr()
-{
-    if(this->m_f != nullptr)
-    {
-        fclose(this->m_f);
-    }
-}
-
 rocsparse_importer_mlbsr::rocsparse_importer_mlbsr(const std::string& filename_)
     : m_filename(filename_)
 {
@@ -61,49 +53,18 @@ rocsparse_status rocsparse_importer_mlbsr::import_sparse_gebsx(rocsparse_directi
                                                                J* block_dim_column,
                                                                rocsparse_index_base* base)
 {
-    char line[1024];
-    this->m_f = fopen(this->m_filename.c_str(), "r");
-    if(!this->m_f)
-    {
-        missing_file_error_message(this->m_filename.c_str());
-        return rocsparse_status_internal_error;
-    }
-
-    //
-    // Skip header.
-    //
-    while(0 != fgets(line, 1024, this->m_f))
-    {
-        const char* l = &line[0];
-        while(l[0] != '\0' && (l[0] == ' ' || l[0] == '\t'))
-        {
-            ++l;
-        }
-        if(l[0] != '\0' && l[0] != '%')
-        {
-            break;
-        }
-    }
-
-    //
-    // Read dimension.
-    //
-    size_t inrow;
-    size_t incol;
-    size_t innz;
-    if(EOF == sscanf(line, "%zd %zd %zd", &inrow, &incol, &innz))
-    {
-        return rocsparse_status_internal_error;
-    }
-
-    if(0 == fgets(line, 1024, this->m_f))
+    rocsparse_status status = this->m_structure.open(this->m_filename, "mlbsr", true);
+    if(status != rocsparse_status_success)
     {
-        return rocsparse_status_internal_error;
+        return status;
     }
 
-    size_t ibdim_row;
-    size_t ibdim_col;
-    if(EOF == sscanf(line, "%zd %zd", &ibdim_row, &ibdim_col))
+    const size_t inrow     = this->m_structure.nrow;
+    const size_t incol     = this->m_structure.ncol;
+    const size_t innz      = this->m_structure.nnz;
+    const size_t ibdim_row = this->m_structure.block_dim_row;
+    const size_t ibdim_col = this->m_structure.block_dim_col;
+    if(ibdim_row == 0 || ibdim_col == 0)
     {
         return rocsparse_status_internal_error;
     }
@@ -111,9 +72,8 @@ rocsparse_status rocsparse_importer_mlbsr::import_sparse_gebsx(rocsparse_directi
     //
     // Convert.
     //
-    rocsparse_status status;
-    const size_t     imb = inrow / ibdim_row;
-    status               = rocsparse_type_conversion(imb, mb[0]);
+    const size_t imb = inrow / ibdim_row;
+    status           = rocsparse_type_conversion(imb, mb[0]);
     if(status != rocsparse_status_success)
         return status;
 
@@ -139,42 +99,17 @@ rocsparse_status rocsparse_importer_mlbsr::import_sparse_gebsx(rocsparse_directi
     dirb[0] = rocsparse_direction_column;
     base[0] = rocsparse_index_base_zero;
 
-    this->m_mb   = imb;
-    this->m_nnzb = innzb;
-
     return rocsparse_status_success;
 }
 
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_importer_mlbsr::import_sparse_gebsx(I* ptr, J* ind, T* val)
 {
-    size_t           k;
-    rocsparse_status status;
-    for(size_t i = 0; i <= this->m_mb; ++i)
-    {
-        if(EOF == fscanf(this->m_f, "%zd", &k))
-        {
-            return rocsparse_status_internal_error;
-        }
-        status = rocsparse_type_conversion(k, ptr[i]);
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-    }
-    for(size_t i = 0; i < this->m_nnzb; ++i)
-    {
-        if(EOF == fscanf(this->m_f, "%zd", &k))
-        {
-            return rocsparse_status_internal_error;
-        }
-        status = rocsparse_type_conversion(k, ind[i]);
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-    }
-    return rocsparse_status_success;
+    rocsparse_importer_ml_structure& s = this->m_structure;
+
+    const size_t mb   = s.nrow / s.block_dim_row;
+    const size_t nnzb = s.nnz / (s.block_dim_row * s.block_dim_col);
+    return s.read(mb + 1, ptr, nnzb, ind);
 }
 
 template <typename I>
@@ -26,6 +26,7 @@
 #ifndef ROCSPARSE_IMPORTER_MLBSR_HPP
 #define ROCSPARSE_IMPORTER_MLBSR_HPP
 #include "rocsparse_importer.hpp"
+#include "rocsparse_importer_ml_structure.hpp"
 
 class rocsparse_importer_mlbsr : public rocsparse_importer<rocsparse_importer_mlbsr>
 {
@@ -34,12 +35,9 @@ protected:
 
 public:
     rocsparse_importer_mlbsr(const std::string& filename_);
-    ~rocsparse_importer_mlbsr();
 
 private:
-    FILE*  m_f{};
-    size_t m_nnzb{};
-    size_t m_mb{};
+    rocsparse_importer_ml_structure m_structure{};
 
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
@@ -24,14 +24,6 @@
 #include "rocsparse_importer_mlcsr.hpp"
 #include <stdio.h>
 
-rocsparse_importer_mlcsr::~rocsparse_importer_mlcsr()
-{
-    if(this->m_f != nullptr)
-    {
-        fclose(this->m_f);
-    }
-}
-
 rocsparse_importer_mlcsr::rocsparse_importer_mlcsr(const std::string& filename_)
     : m_filename(filename_)
 {
@@ -41,45 +33,19 @@ template <typename I, typename J>
 rocsparse_status rocsparse_importer_mlcsr::import_sparse_csx(
     rocsparse_direction* dir, J* m, J* n, I* nnz, rocsparse_index_base* base)
 {
-    char line[1024];
-    this->m_f = fopen(this->m_filename.c_str(), "r");
-    if(!this->m_f)
-    {
-        missing_file_error_message(this->m_filename.c_str());
-        return rocsparse_status_internal_error;
-    }
-
-    //
-    // Skip header.
-    //
-    while(0 != fgets(line, 1024, this->m_f))
+    rocsparse_status status = this->m_structure.open(this->m_filename, "mlcsr", false);
+    if(status != rocsparse_status_success)
     {
-        const char* l = &line[0];
-        while(l[0] != '\0' && (l[0] == ' ' || l[0] == '\t'))
-        {
-            ++l;
-        }
-        if(l[0] != '\0' && l[0] != '%')
-        {
-            break;
-        }
+        return status;
     }
 
-    //
-    // Read dimension.
-    //
-    size_t inrow;
-    size_t incol;
-    size_t innz;
-    if(EOF == sscanf(line, "%zd %zd %zd", &inrow, &incol, &innz))
-    {
-        return rocsparse_status_internal_error;
-    }
+    const size_t inrow = this->m_structure.nrow;
+    const size_t incol = this->m_structure.ncol;
+    const size_t innz  = this->m_structure.nnz;
 
     //
     // Convert.
     //
-    rocsparse_status status;
     status = rocsparse_type_conversion(inrow, m[0]);
     if(status != rocsparse_status_success)
         return status;
@@ -95,43 +61,13 @@ rocsparse_status rocsparse_importer_mlcsr::import_sparse_csx(
     dir[0]  = rocsparse_direction_row;
     base[0] = rocsparse_index_base_zero;
 
-    this->m_m   = inrow;
-    this->m_k   = incol;
-    this->m_nnz = innz;
-
     return rocsparse_status_success;
 }
 
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_importer_mlcsr::import_sparse_csx(I* ptr, J* ind, T* val)
 {
-    size_t           k;
-    rocsparse_status status;
-    for(size_t i = 0; i <= this->m_m; ++i)
-    {
-        if(EOF == fscanf(this->m_f, "%zd", &k))
-        {
-            return rocsparse_status_internal_error;
-        }
-        status = rocsparse_type_conversion(k, ptr[i]);
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-    }
-    for(size_t i = 0; i < this->m_nnz; ++i)
-    {
-        if(EOF == fscanf(this->m_f, "%zd", &k))
-        {
-            return rocsparse_status_internal_error;
-        }
-        status = rocsparse_type_conversion(k, ind[i]);
-        if(status != rocsparse_status_success)
-        {
-            return status;
-        }
-    }
-    return rocsparse_status_success;
+    return this->m_structure.read(this->m_structure.nrow + 1, ptr, this->m_structure.nnz, ind);
 }
 
 template <typename I, typename J>
@@ -26,6 +26,7 @@
 #ifndef ROCSPARSE_IMPORTER_MLCSR_HPP
 #define ROCSPARSE_IMPORTER_MLCSR_HPP
 #include "rocsparse_importer.hpp"
+#include "rocsparse_importer_ml_structure.hpp"
 
 class rocsparse_importer_mlcsr : public rocsparse_importer<rocsparse_importer_mlcsr>
 {
@@ -34,13 +35,9 @@ protected:
 
 public:
     rocsparse_importer_mlcsr(const std::string& filename_);
-    ~rocsparse_importer_mlcsr();
 
 private:
-    FILE*  m_f{};
-    size_t m_m{};
-    size_t m_k{};
-    size_t m_nnz{};
+    rocsparse_importer_ml_structure m_structure{};
 
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
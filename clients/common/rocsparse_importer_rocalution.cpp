@@ -24,74 +24,74 @@
 
 #include "rocsparse_importer_rocalution.hpp"
 
-static inline void read_csr_values(std::ifstream& in, int64_t nnz, int8_t* csr_val)
+#include <chrono>
+
+//
+// Values are stored as double, or double complex, whatever the requested type is.
+//
+template <typename T>
+struct rocalution_value_traits
 {
-    // Temporary array to convert from double to float
-    std::vector<double> tmp(nnz);
+    using file_t = double;
+};
 
-    // Read in double values
-    in.read((char*)tmp.data(), sizeof(double) * nnz);
+template <>
+struct rocalution_value_traits<rocsparse_float_complex>
+{
+    using file_t = rocsparse_double_complex;
+};
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int64_t i = 0; i < nnz; ++i)
+template <>
+struct rocalution_value_traits<rocsparse_double_complex>
+{
+    using file_t = rocsparse_double_complex;
+};
+
+//
+// Number of elements read per block when the requested type differs from the stored type.
+//
+static constexpr size_t s_rocalution_block_size = size_t(1) << 20;
+
+//
+// Read size elements of type F into x, either directly into x if the types are identical,
+// or block by block through a bounded staging buffer and a parallel conversion.
+//
+template <typename F, typename T>
+static bool rocalution_read_array(FILE* f, size_t size, T* __restrict__ x)
+{
+    if(std::is_same<F, T>())
     {
-        csr_val[i] = static_cast<int8_t>(tmp[i]);
+        return fread(x, sizeof(T), size, f) == size;
     }
-}
 
-static inline void read_csr_values(std::ifstream& in, int64_t nnz, float* csr_val)
-{
-    // Temporary array to convert from double to float
-    std::vector<double> tmp(nnz);
-
-    // Read in double values
-    in.read((char*)tmp.data(), sizeof(double) * nnz);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int64_t i = 0; i < nnz; ++i)
+    const size_t   block_size = std::min(size, s_rocalution_block_size);
+    std::vector<F> buffer(block_size);
+    for(size_t offset = 0; offset < size; offset += block_size)
     {
-        csr_val[i] = static_cast<float>(tmp[i]);
+        const size_t n = std::min(block_size, size - offset);
+        if(fread(buffer.data(), sizeof(F), n, f) != n)
+        {
+            return false;
+        }
+        rocsparse_importer_copy_mixed_arrays(n, x + offset, (const F*)buffer.data());
     }
+    return true;
 }
 
-static inline void read_csr_values(std::ifstream& in, int64_t nnz, double* csr_val)
+rocsparse_importer_rocalution::rocsparse_importer_rocalution(const std::string& filename_)
+    : m_filename(filename_)
 {
-    in.read((char*)csr_val, sizeof(double) * nnz);
 }
 
-static inline void read_csr_values(std::ifstream& in, int64_t nnz, rocsparse_float_complex* csr_val)
+rocsparse_importer_rocalution::~rocsparse_importer_rocalution()
 {
-    // Temporary array to convert from double to float complex
-    std::vector<rocsparse_double_complex> tmp(nnz);
-
-    // Read in double complex values
-    in.read((char*)tmp.data(), sizeof(rocsparse_double_complex) * nnz);
-
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
-    for(int64_t i = 0; i < nnz; ++i)
+    if(this->m_info_csx.f != nullptr)
     {
-        csr_val[i] = rocsparse_float_complex(static_cast<float>(std::real(tmp[i])),
-                                             static_cast<float>(std::imag(tmp[i])));
+        fclose(this->m_info_csx.f);
+        this->m_info_csx.f = nullptr;
     }
 }
 
-static inline void
-    read_csr_values(std::ifstream& in, int64_t nnz, rocsparse_double_complex* csr_val)
-{
-    in.read((char*)csr_val, sizeof(rocsparse_double_complex) * nnz);
-}
-
-rocsparse_importer_rocalution::rocsparse_importer_rocalution(const std::string& filename_)
-    : m_filename(filename_)
-{
-}
-
 template <typename I, typename J>
 rocsparse_status rocsparse_importer_rocalution::import_sparse_gebsx(rocsparse_direction* dir,
                                                                     rocsparse_direction* dirb,
@@ -137,26 +137,37 @@ rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(
         std::cout << "Opening file '" << this->m_filename << "' ... " << std::endl;
     }
 
-    this->m_info_csx.in = new std::ifstream(this->m_filename, std::ios::in | std::ios::binary);
-    if(!this->m_info_csx.in->is_open())
+    if(this->m_info_csx.f != nullptr)
+    {
+        fclose(this->m_info_csx.f);
+    }
+    this->m_info_csx.f = fopen(this->m_filename.c_str(), "rb");
+    if(this->m_info_csx.f == nullptr)
     {
         missing_file_error_message(this->m_filename.c_str());
         return rocsparse_status_internal_error;
     }
-    std::string header;
-    std::getline(this->m_info_csx.in[0], header);
-    if(header != "#rocALUTION binary csr file")
+
+    char header[64];
+    if(fgets(header, sizeof(header), this->m_info_csx.f) == nullptr
+       || strcmp(header, "#rocALUTION binary csr file\n"))
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    int sizes[4];
+    if(fread(sizes, sizeof(int), 4, this->m_info_csx.f) != 4)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    const int iM   = sizes[1];
+    const int iN   = sizes[2];
+    const int innz = sizes[3];
+    if(iM < 0 || iN < 0 || innz < 0)
     {
         return rocsparse_status_internal_error;
     }
-    int version;
-    this->m_info_csx.in->read((char*)&version, sizeof(int));
-    int iM;
-    int iN;
-    int innz;
-    this->m_info_csx.in->read((char*)&iM, sizeof(int));
-    this->m_info_csx.in->read((char*)&iN, sizeof(int));
-    this->m_info_csx.in->read((char*)&innz, sizeof(int));
 
     rocsparse_status status;
     status = rocsparse_type_conversion(iM, m[0]);
@@ -182,99 +193,39 @@ rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_importer_rocalution::import_sparse_csx(I* ptr, J* ind, T* val)
 {
+    using F = typename rocalution_value_traits<T>::file_t;
+
     const size_t M   = this->m_info_csx.m;
     const size_t nnz = this->m_info_csx.nnz;
-
-    const bool same_ptr_type = std::is_same<I, int>();
-    const bool same_ind_type = std::is_same<J, int>();
-    const bool same_val_type
-        = std::is_same<T, double>() || std::is_same<T, rocsparse_double_complex>();
-    const bool is_consistent = same_ptr_type && same_ind_type && same_val_type;
-    if(is_consistent)
+    FILE*        f   = this->m_info_csx.f;
+    if(f == nullptr)
     {
-        this->m_info_csx.in->read((char*)ptr, sizeof(int) * (M + 1));
-        this->m_info_csx.in->read((char*)ind, sizeof(int) * nnz);
-        this->m_info_csx.in->read((char*)val, sizeof(T) * nnz);
-        this->m_info_csx.in->close();
-        delete this->m_info_csx.in;
-        this->m_info_csx.in = nullptr;
-        {
-            const char* env = getenv("GTEST_LISTENER");
-            if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
-            {
-                std::cout << "Import done." << std::endl;
-            }
-        }
+        return rocsparse_status_internal_error;
     }
-    else
-    {
-        void* tmp_ptr = (void*)ptr;
-        void* tmp_ind = (void*)ind;
-        void* tmp_val = (void*)val;
 
-        host_dense_vector<int> tmp_ptrv;
-        host_dense_vector<int> tmp_indv;
-        host_dense_vector<T>   tmp_valv;
+    const auto t0 = std::chrono::steady_clock::now();
 
-        if(!same_ptr_type)
-        {
-            tmp_ptrv.resize((M + 1));
-            tmp_ptr = tmp_ptrv;
-        }
-        else
-        {
-            tmp_ptr = ptr;
-        }
+    const bool ok = rocalution_read_array<int>(f, M + 1, ptr)
+                    && rocalution_read_array<int>(f, nnz, ind)
+                    && rocalution_read_array<F>(f, nnz, val);
 
-        if(!same_ind_type)
-        {
-            tmp_indv.resize(nnz);
-            tmp_ind = tmp_indv;
-        }
-        else
-        {
-            tmp_ind = ind;
-        }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
 
-        if(!same_val_type)
-        {
-            tmp_valv.resize(nnz);
-            tmp_val = tmp_valv;
-        }
-        else
-        {
-            tmp_val = val;
-        }
-        this->m_info_csx.in->read((char*)tmp_ptr, sizeof(int) * (M + 1));
-        this->m_info_csx.in->read((char*)tmp_ind, sizeof(int) * nnz);
-        read_csr_values(this->m_info_csx.in[0], (int64_t)nnz, (T*)tmp_val);
-        //  this->m_info_csx.in->read((char*)tmp_val, sizeof(double) * nnz);
-        this->m_info_csx.in->close();
-        delete this->m_info_csx.in;
-        this->m_info_csx.in = nullptr;
-        {
-            const char* env = getenv("GTEST_LISTENER");
-            if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
-            {
-                std::cout << "Import done." << std::endl;
-            }
-        }
-        //
-        // Copy back.
-        //
-        if(!same_ptr_type)
-        {
+    fclose(f);
+    this->m_info_csx.f = nullptr;
+    if(!ok)
+    {
+        std::cerr << "rocsparse_importer_rocalution: truncated file '" << this->m_filename << "'"
+                  << std::endl;
+        return rocsparse_status_internal_error;
+    }
 
-            rocsparse_importer_copy_mixed_arrays(M + 1, ptr, (int*)tmp_ptr);
-        }
-        if(!same_ind_type)
-        {
-            rocsparse_importer_copy_mixed_arrays(nnz, ind, (int*)tmp_ind);
-        }
-        if(!same_val_type)
-        {
-            rocsparse_importer_copy_mixed_arrays(nnz, val, (T*)tmp_val);
-        }
+    const char* env = getenv("GTEST_LISTENER");
+    if(!env || strcmp(env, "NO_PASS_LINE_IN_LOG"))
+    {
+        const double nbytes = sizeof(int) * (M + 1) + (sizeof(int) + sizeof(F)) * nnz;
+        std::cout << "Import done (" << nbytes / elapsed.count() / 1e6 << " MB/s, "
+                  << elapsed.count() << " s)." << std::endl;
     }
 
     return rocsparse_status_success;
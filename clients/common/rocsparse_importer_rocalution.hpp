@@ -36,6 +36,7 @@ protected:
 public:
     using IMPL = rocsparse_importer_rocalution;
     rocsparse_importer_rocalution(const std::string& filename_);
+    ~rocsparse_importer_rocalution();
 
 public:
     template <typename I = rocsparse_int, typename J = rocsparse_int>
@@ -63,9 +64,9 @@ public:
 private:
     struct info_csx
     {
-        size_t         m{};
-        size_t         nnz{};
-        std::ifstream* in{};
+        size_t m{};
+        size_t nnz{};
+        FILE*  f{};
     };
     info_csx m_info_csx{};
 
@@ -216,7 +216,13 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_coo(I* row_ind, I
 
     const uint64_t NNZ = this->m_nnz;
 
-    const bool same_ind_type = (this->m_ind_type == csr_ind_type);
+    // Row and column indices are expected to share the same type.
+    if(this->m_row_ind_type != this->m_col_ind_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    const bool same_ind_type = (this->m_row_ind_type == csr_ind_type);
     const bool same_val_type = (this->m_val_type == csr_val_type);
     const bool is_consistent = same_ind_type && same_val_type;
 
@@ -232,38 +238,29 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_coo(I* row_ind, I
     else
     {
 
-        void *tmp_row_ind = (void*)row_ind, *tmp_col_ind = (void*)col_ind, *tmp_val = (void*)val;
-
-        host_dense_vector<char> tmp_row_indv, tmp_col_indv, tmp_valv;
-
-        uint64_t sizeof_ind_type, sizeof_val_type;
-
-        istatus = rocsparseio_type_get_size(this->m_ind_type, &sizeof_ind_type);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-        istatus = rocsparseio_type_get_size(this->m_val_type, &sizeof_val_type);
+        //
+        // Map data and convert it from the mapped arrays.
+        //
+        rocsparseio_map map;
+        const void *    tmp_row_ind, *tmp_col_ind, *tmp_val;
+        istatus = rocsparseiox_map_sparse_coo(
+            this->m_handle, &map, &tmp_row_ind, &tmp_col_ind, &tmp_val);
         ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
 
-        if(!same_ind_type)
+        if(same_ind_type)
         {
-            tmp_row_indv.resize(NNZ * sizeof_ind_type);
-            tmp_row_ind = tmp_row_indv;
-
-            tmp_col_indv.resize(NNZ * sizeof_ind_type);
-            tmp_col_ind = tmp_col_indv;
+            memcpy(row_ind, tmp_row_ind, sizeof(I) * NNZ);
+            memcpy(col_ind, tmp_col_ind, sizeof(I) * NNZ);
         }
 
-        if(!same_val_type)
+        if(same_val_type)
         {
-            tmp_valv.resize(NNZ * sizeof_val_type);
-            tmp_val = tmp_valv;
+            memcpy(val, tmp_val, sizeof(T) * NNZ);
         }
 
-        istatus = rocsparseiox_read_sparse_coo(this->m_handle, tmp_row_ind, tmp_col_ind, tmp_val);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-
         if(!same_ind_type)
         {
-            switch(this->m_ind_type)
+            switch(this->m_row_ind_type)
             {
             case rocsparseio_type_int32:
             {
@@ -338,6 +335,9 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_coo(I* row_ind, I
             }
             }
         }
+
+        istatus = rocsparseiox_unmap(map);
+        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
     }
     return rocsparse_status_success;
 }
@@ -435,39 +435,29 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_gebsx(I* ptr, J*
     else
     {
 
-        void *tmp_ptr = (void*)ptr, *tmp_ind = (void*)ind, *tmp_val = (void*)val;
-
-        host_dense_vector<char> tmp_ptrv, tmp_indv, tmp_valv;
-
-        uint64_t sizeof_ptr_type, sizeof_ind_type, sizeof_val_type;
-
-        istatus = rocsparseio_type_get_size(this->m_ptr_type, &sizeof_ptr_type);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-        istatus = rocsparseio_type_get_size(this->m_ind_type, &sizeof_ind_type);
+        //
+        // Map data and convert it from the mapped arrays.
+        //
+        rocsparseio_map map;
+        const void *    tmp_ptr, *tmp_ind, *tmp_val;
+        istatus = rocsparseiox_map_sparse_gebsx(this->m_handle, &map, &tmp_ptr, &tmp_ind, &tmp_val);
         ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-        istatus = rocsparseio_type_get_size(this->m_val_type, &sizeof_val_type);
 
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-        if(!same_ptr_type)
+        if(same_ptr_type)
         {
-            tmp_ptrv.resize((MB + 1) * sizeof_ptr_type);
-            tmp_ptr = tmp_ptrv;
+            memcpy(ptr, tmp_ptr, sizeof(I) * (MB + 1));
         }
 
-        if(!same_ind_type)
+        if(same_ind_type)
         {
-            tmp_indv.resize(NNZB * sizeof_ind_type);
-            tmp_ind = tmp_indv;
+            memcpy(ind, tmp_ind, sizeof(J) * NNZB);
         }
 
-        if(!same_val_type)
+        if(same_val_type)
         {
-            tmp_valv.resize(NNZB * row_block_dim * col_block_dim * sizeof_val_type);
-            tmp_val = tmp_valv;
+            memcpy(val, tmp_val, sizeof(T) * NNZB * row_block_dim * col_block_dim);
         }
 
-        istatus = rocsparseiox_read_sparse_csx(this->m_handle, tmp_ptr, tmp_ind, tmp_val);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
         if(!same_ptr_type)
         {
             switch(this->m_ptr_type)
@@ -568,6 +558,9 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_gebsx(I* ptr, J*
             }
             }
         }
+
+        istatus = rocsparseiox_unmap(map);
+        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
     }
 
     return rocsparse_status_success;
@@ -644,39 +637,29 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(I* ptr, J* in
     else
     {
 
-        void *tmp_ptr = (void*)ptr, *tmp_ind = (void*)ind, *tmp_val = (void*)val;
-
-        host_dense_vector<char> tmp_ptrv, tmp_indv, tmp_valv;
-
-        uint64_t sizeof_ptr_type, sizeof_ind_type, sizeof_val_type;
-
-        istatus = rocsparseio_type_get_size(this->m_ptr_type, &sizeof_ptr_type);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-        istatus = rocsparseio_type_get_size(this->m_ind_type, &sizeof_ind_type);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
-        istatus = rocsparseio_type_get_size(this->m_val_type, &sizeof_val_type);
+        //
+        // Map data and convert it from the mapped arrays.
+        //
+        rocsparseio_map map;
+        const void *    tmp_ptr, *tmp_ind, *tmp_val;
+        istatus = rocsparseiox_map_sparse_csx(this->m_handle, &map, &tmp_ptr, &tmp_ind, &tmp_val);
         ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
 
-        if(!same_ptr_type)
+        if(same_ptr_type)
         {
-            tmp_ptrv.resize((M + 1) * sizeof_ptr_type);
-            tmp_ptr = tmp_ptrv;
+            memcpy(ptr, tmp_ptr, sizeof(I) * (M + 1));
         }
 
-        if(!same_ind_type)
+        if(same_ind_type)
         {
-            tmp_indv.resize(NNZ * sizeof_ind_type);
-            tmp_ind = tmp_indv;
+            memcpy(ind, tmp_ind, sizeof(J) * NNZ);
         }
 
-        if(!same_val_type)
+        if(same_val_type)
         {
-            tmp_valv.resize(NNZ * sizeof_val_type);
-            tmp_val = tmp_valv;
+            memcpy(val, tmp_val, sizeof(T) * NNZ);
         }
 
-        istatus = rocsparseiox_read_sparse_csx(this->m_handle, tmp_ptr, tmp_ind, tmp_val);
-        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
         if(!same_ptr_type)
         {
             switch(this->m_ptr_type)
@@ -772,6 +755,9 @@ rocsparse_status rocsparse_importer_rocsparseio::import_sparse_csx(I* ptr, J* in
             }
             }
         }
+
+        istatus = rocsparseiox_unmap(map);
+        ROCSPARSE_CHECK_ROCSPARSEIO(istatus);
     }
 
     return rocsparse_status_success;
@@ -26,27 +26,6 @@
 #include "rocsparse_importer_impls.hpp"
 #include "rocsparse_matrix.hpp"
 
-template <typename I, typename J>
-void host_coo_to_csr(J M, I nnz, const J* coo_row_ind, I* csr_row_ptr, rocsparse_index_base base)
-{
-    // Resize and initialize csr_row_ptr with zeros
-    for(size_t i = 0; i < M + 1; ++i)
-    {
-        csr_row_ptr[i] = 0;
-    }
-
-    for(size_t i = 0; i < nnz; ++i)
-    {
-        ++csr_row_ptr[coo_row_ind[i] + 1 - base];
-    }
-
-    csr_row_ptr[0] = base;
-    for(J i = 0; i < M; ++i)
-    {
-        csr_row_ptr[i + 1] += csr_row_ptr[i];
-    }
-}
-
 template <typename I, typename J>
 void host_csr_to_coo(J                     M,
                      I                     nnz,
@@ -803,30 +782,11 @@ void rocsparse_init_csr_mtx(const char*          filename,
                             I&                   nnz,
                             rocsparse_index_base base)
 {
-    I       coo_M, coo_N;
-    int64_t coo_nnz;
-
-    std::vector<I> coo_row_ind;
-    std::vector<I> coo_col_ind;
-
-    // Read COO matrix
-    rocsparse_init_coo_mtx(
-        filename, coo_row_ind, coo_col_ind, csr_val, coo_M, coo_N, coo_nnz, base);
-
-    // Convert to CSR
-    M   = (J)coo_M;
-    N   = (J)coo_N;
-    nnz = (I)coo_nnz;
-
-    csr_row_ptr.resize(M + 1);
-    csr_col_ind.resize(nnz);
-
-    host_coo_to_csr(coo_M, nnz, coo_row_ind.data(), csr_row_ptr.data(), base);
-
-    for(I i = 0; i < nnz; ++i)
-    {
-        csr_col_ind[i] = (J)coo_col_ind[i];
-    }
+    // Rows are compressed by the importer, no intermediate COO matrix is needed
+    rocsparse_importer_matrixmarket importer(filename);
+    rocsparse_status                status = rocsparse_import_sparse_csr(
+        importer, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
+    CHECK_ROCSPARSE_THROW_ERROR(status);
 }
 
 /* ============================================================================================ */
@@ -1745,11 +1705,6 @@ void rocsparse_init_gebsr_pentadiagonal(std::vector<I>&      row_ptr,
                                                 const std::vector<ITYPE>& csr_row_ptr,     \
                                                 std::vector<JTYPE>&       coo_row_ind,     \
                                                 rocsparse_index_base      base);                \
-    template void host_coo_to_csr<ITYPE, JTYPE>(JTYPE                M,                    \
-                                                ITYPE                NNZ,                  \
-                                                const JTYPE*         coo_row_ind,          \
-                                                ITYPE*               csr_row_ptr,          \
-                                                rocsparse_index_base base);                \
     template void host_csr_to_coo_aos<ITYPE, JTYPE>(JTYPE                     M,           \
                                                     ITYPE                     nnz,         \
                                                     const std::vector<ITYPE>& csr_row_ptr, \
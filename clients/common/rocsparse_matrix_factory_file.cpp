@@ -25,6 +25,7 @@
 #include "rocsparse_matrix_factory_file.hpp"
 #include "rocsparse_import.hpp"
 #include "rocsparse_importer_impls.hpp"
+#include "rocsparse_matrix_file_cache.hpp"
 #include "rocsparse_matrix_utils.hpp"
 
 template <typename T, template <typename...> class VECTOR>
@@ -124,6 +125,55 @@ struct rocsparse_init_file
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  Read a CSR matrix from the cache, or with init_csr and then store it in the cache */
+template <typename T, typename I, typename J, typename F>
+static void init_csr_cached(const std::string&   filename,
+                            std::vector<I>&      row_ptr,
+                            std::vector<J>&      col_ind,
+                            std::vector<T>&      val,
+                            J&                   M,
+                            J&                   N,
+                            I&                   nnz,
+                            rocsparse_index_base base,
+                            F                    init_csr)
+{
+    if(!rocsparse_matrix_file_cache::load(filename, row_ptr, col_ind, val, M, N, nnz, base))
+    {
+        init_csr(row_ptr, col_ind, val, M, N, nnz, base);
+        rocsparse_matrix_file_cache::store(filename, row_ptr, col_ind, val, M, N, nnz, base);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Read a COO matrix from the cache, COO matrices are cached in CSR format */
+template <typename T, typename I, typename F>
+static void init_coo_cached(const std::string&   filename,
+                            std::vector<I>&      row_ind,
+                            std::vector<I>&      col_ind,
+                            std::vector<T>&      val,
+                            I&                   M,
+                            I&                   N,
+                            int64_t&             nnz,
+                            rocsparse_index_base base,
+                            F                    init_coo)
+{
+    std::vector<int64_t> row_ptr;
+    if(rocsparse_matrix_file_cache::load(filename, row_ptr, col_ind, val, M, N, nnz, base))
+    {
+        host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
+    }
+    else
+    {
+        init_coo(row_ind, col_ind, val, M, N, nnz, base);
+
+        // Entries are sorted by row
+        row_ptr.resize(M + 1);
+        host_coo_to_csr(M, nnz, row_ind.data(), row_ptr.data(), base);
+        rocsparse_matrix_file_cache::store(filename, row_ptr, col_ind, val, M, N, nnz, base);
+    }
+}
+
 template <rocsparse_matrix_init MATRIX_INIT, typename T, typename I, typename J>
 rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::rocsparse_matrix_factory_file(
     const char* filename, bool toint)
@@ -375,8 +425,10 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_csr(
     {
     case rocsparse_matrix_file_rocalution:
     {
-        rocsparse_init_csr_rocalution(
-            this->m_filename.c_str(), row_ptr, col_ind, val, M, N, nnz, base);
+        init_csr_cached(
+            this->m_filename, row_ptr, col_ind, val, M, N, nnz, base, [this](auto&... args) {
+                rocsparse_init_csr_rocalution(this->m_filename.c_str(), args...);
+            });
         break;
     }
 
@@ -388,7 +440,10 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_csr(
     }
     case rocsparse_matrix_file_mtx:
     {
-        rocsparse_init_csr_mtx(this->m_filename.c_str(), row_ptr, col_ind, val, M, N, nnz, base);
+        init_csr_cached(
+            this->m_filename, row_ptr, col_ind, val, M, N, nnz, base, [this](auto&... args) {
+                rocsparse_init_csr_mtx(this->m_filename.c_str(), args...);
+            });
         break;
     }
     case rocsparse_matrix_file_smtx:
@@ -475,15 +530,20 @@ void rocsparse_matrix_factory_file<MATRIX_INIT, T, I, J>::init_coo(
     {
     case rocsparse_matrix_file_rocalution:
     {
-        rocsparse_init_coo_rocalution(
-            this->m_filename.c_str(), row_ind, col_ind, val, M, N, nnz, base);
+        init_coo_cached(
+            this->m_filename, row_ind, col_ind, val, M, N, nnz, base, [this](auto&... args) {
+                rocsparse_init_coo_rocalution(this->m_filename.c_str(), args...);
+            });
 
         break;
     }
 
     case rocsparse_matrix_file_mtx:
     {
-        rocsparse_init_coo_mtx(this->m_filename.c_str(), row_ind, col_ind, val, M, N, nnz, base);
+        init_coo_cached(
+            this->m_filename, row_ind, col_ind, val, M, N, nnz, base, [this](auto&... args) {
+                rocsparse_init_coo_mtx(this->m_filename.c_str(), args...);
+            });
 
         break;
     }
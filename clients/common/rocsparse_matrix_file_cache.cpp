@@ -0,0 +1,486 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_matrix_file_cache.hpp"
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparse_clients_matrices_dir.hpp"
+#include "rocsparse_importer.hpp"
+#include "rocsparseio.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef WIN32
+#include <direct.h>
+#include <io.h>
+#include <process.h>
+#include <sys/utime.h>
+#define getpid _getpid
+#define utime _utime
+#else
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+template <typename T>
+static rocsparseio_type get_cache_type();
+
+template <>
+rocsparseio_type get_cache_type<int8_t>()
+{
+    return rocsparseio_type_int8;
+}
+
+template <>
+rocsparseio_type get_cache_type<int32_t>()
+{
+    return rocsparseio_type_int32;
+}
+
+template <>
+rocsparseio_type get_cache_type<int64_t>()
+{
+    return rocsparseio_type_int64;
+}
+
+template <>
+rocsparseio_type get_cache_type<float>()
+{
+    return rocsparseio_type_float32;
+}
+
+template <>
+rocsparseio_type get_cache_type<double>()
+{
+    return rocsparseio_type_float64;
+}
+
+template <>
+rocsparseio_type get_cache_type<rocsparse_float_complex>()
+{
+    return rocsparseio_type_complex32;
+}
+
+template <>
+rocsparseio_type get_cache_type<rocsparse_double_complex>()
+{
+    return rocsparseio_type_complex64;
+}
+
+//
+// rocsparseio formats its file and object names, '%' must be escaped.
+//
+static std::string escape_cache_format(const std::string& s)
+{
+    std::string r;
+    for(char c : s)
+    {
+        r += c;
+        if(c == '%')
+        {
+            r += c;
+        }
+    }
+    return r;
+}
+
+static std::string get_cache_dir()
+{
+    return std::string(rocsparse_clients_matrices_dir_get(true)) + ".rocsparseio_cache";
+}
+
+//
+// Maximum size in bytes of the cached files.
+//
+static uint64_t get_cache_max_size()
+{
+    static constexpr uint64_t default_max_size_mb = 8192;
+
+    uint64_t    max_size_mb = default_max_size_mb;
+    const char* env
+        = rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_CACHE_SIZE);
+    if(env != nullptr && env[0] != '\0')
+    {
+        char*                    end = nullptr;
+        const unsigned long long v   = strtoull(env, &end, 10);
+        if(end != env)
+        {
+            max_size_mb = static_cast<uint64_t>(v);
+        }
+    }
+    return max_size_mb << 20;
+}
+
+struct cache_file
+{
+    std::string filename;
+    uint64_t    size;
+    int64_t     mtime;
+};
+
+static void list_cache_files(std::vector<cache_file>& files)
+{
+    const std::string dir = get_cache_dir();
+#ifdef WIN32
+    struct _finddata_t data;
+    const intptr_t     h = _findfirst((dir + "/*.csr").c_str(), &data);
+    if(h == -1)
+    {
+        return;
+    }
+    do
+    {
+        files.push_back({dir + "/" + data.name,
+                         static_cast<uint64_t>(data.size),
+                         static_cast<int64_t>(data.time_write)});
+    } while(_findnext(h, &data) == 0);
+    _findclose(h);
+#else
+    DIR* d = opendir(dir.c_str());
+    if(d == nullptr)
+    {
+        return;
+    }
+    for(struct dirent* e = readdir(d); e != nullptr; e = readdir(d))
+    {
+        // Skip the temporary files of the matrices being stored
+        const std::string name = e->d_name;
+        if(name.size() < 4 || name.compare(name.size() - 4, 4, ".csr") != 0)
+        {
+            continue;
+        }
+
+        const std::string filename = dir + "/" + name;
+        struct stat       st;
+        if(stat(filename.c_str(), &st) == 0)
+        {
+            files.push_back(
+                {filename, static_cast<uint64_t>(st.st_size), static_cast<int64_t>(st.st_mtime)});
+        }
+    }
+    closedir(d);
+#endif
+}
+
+/* ============================================================================================ */
+/*! \brief  Remove the least recently used cached files until they hold at most max_size bytes.
+ *  \details
+ *  The modification time of a cached file is updated on each hit, so that it orders the files
+ *  by last use.
+ */
+static void evict_cache_files(uint64_t max_size)
+{
+    std::vector<cache_file> files;
+    list_cache_files(files);
+
+    uint64_t size = 0;
+    for(const auto& f : files)
+    {
+        size += f.size;
+    }
+
+    if(size <= max_size)
+    {
+        return;
+    }
+
+    std::sort(files.begin(), files.end(), [](const cache_file& a, const cache_file& b) {
+        return a.mtime < b.mtime;
+    });
+
+    for(const auto& f : files)
+    {
+        if(size <= max_size)
+        {
+            break;
+        }
+
+        // Another process may have removed the file already
+        remove(f.filename.c_str());
+        size -= f.size;
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Build the key of a source file and the name of its cached file.
+ *  \details
+ *  The key is stored as the name of the cached matrix, so that a hash collision is detected
+ *  when loading. Return false if the file cannot be cached.
+ */
+template <typename T, typename I, typename J>
+static bool get_cache_entry(const std::string& source, std::string& key, std::string& filename)
+{
+    if(!rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_CACHE))
+    {
+        return false;
+    }
+
+    struct stat st;
+    if(stat(source.c_str(), &st) != 0)
+    {
+        return false;
+    }
+
+    char buffer[128];
+    snprintf(buffer,
+             sizeof(buffer),
+             " %" PRId64 " %" PRId64 " %d %d %d",
+             static_cast<int64_t>(st.st_size),
+             static_cast<int64_t>(st.st_mtime),
+             static_cast<int>(get_cache_type<T>()),
+             static_cast<int>(get_cache_type<I>()),
+             static_cast<int>(get_cache_type<J>()));
+    key = source + buffer;
+    if(key.size() >= sizeof(rocsparseio_string))
+    {
+        return false;
+    }
+
+    // 64 bits FNV-1a hash of the key
+    uint64_t hash = 14695981039346656037ULL;
+    for(char c : key)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    snprintf(buffer, sizeof(buffer), "/%016" PRIx64 ".csr", hash);
+    filename = get_cache_dir() + buffer;
+    return filename.size() < 512;
+}
+
+template <typename T, typename I, typename J>
+static bool read_cache_file(rocsparseio_handle    handle,
+                            const std::string&    key,
+                            std::vector<I>&       ptr,
+                            std::vector<J>&       ind,
+                            std::vector<T>&       val,
+                            J&                    M,
+                            J&                    N,
+                            I&                    nnz,
+                            rocsparse_index_base& base)
+{
+    rocsparseio_string name;
+    if(rocsparseio_read_name(handle, name) != rocsparseio_status_success || key != name)
+    {
+        return false;
+    }
+
+    rocsparseio_direction  dir;
+    uint64_t               m;
+    uint64_t               n;
+    uint64_t               nz;
+    rocsparseio_type       ptr_type;
+    rocsparseio_type       ind_type;
+    rocsparseio_type       val_type;
+    rocsparseio_index_base iobase;
+    if(rocsparseiox_read_metadata_sparse_csx(
+           handle, &dir, &m, &n, &nz, &ptr_type, &ind_type, &val_type, &iobase)
+           != rocsparseio_status_success
+       || dir != rocsparseio_direction_row || ptr_type != get_cache_type<I>()
+       || ind_type != get_cache_type<J>() || val_type != get_cache_type<T>())
+    {
+        return false;
+    }
+
+    // The arrays are copied straight from the mapped file
+    rocsparseio_map map{};
+    const void*     mapped_ptr{};
+    const void*     mapped_ind{};
+    const void*     mapped_val{};
+    if(rocsparseiox_map_sparse_csx(handle, &map, &mapped_ptr, &mapped_ind, &mapped_val)
+       != rocsparseio_status_success)
+    {
+        return false;
+    }
+
+    ptr.resize(m + 1);
+    ind.resize(nz);
+    val.resize(nz);
+    rocsparse_importer_copy_mixed_arrays(m + 1, ptr.data(), static_cast<const I*>(mapped_ptr));
+    rocsparse_importer_copy_mixed_arrays(nz, ind.data(), static_cast<const J*>(mapped_ind));
+    rocsparse_importer_copy_mixed_arrays(nz, val.data(), static_cast<const T*>(mapped_val));
+    rocsparseiox_unmap(map);
+
+    M    = static_cast<J>(m);
+    N    = static_cast<J>(n);
+    nnz  = static_cast<I>(nz);
+    base = (iobase == rocsparseio_index_base_one) ? rocsparse_index_base_one
+                                                  : rocsparse_index_base_zero;
+    return true;
+}
+
+template <typename T, typename I, typename J>
+bool rocsparse_matrix_file_cache::load(const std::string&   source,
+                                       std::vector<I>&      ptr,
+                                       std::vector<J>&      ind,
+                                       std::vector<T>&      val,
+                                       J&                   M,
+                                       J&                   N,
+                                       I&                   nnz,
+                                       rocsparse_index_base base)
+{
+    std::string key;
+    std::string filename;
+    if(!get_cache_entry<T, I, J>(source, key, filename))
+    {
+        return false;
+    }
+
+    struct stat st;
+    if(stat(filename.c_str(), &st) != 0)
+    {
+        return false;
+    }
+
+    rocsparseio_handle   handle{};
+    rocsparse_index_base cached_base{};
+    const std::string    format = escape_cache_format(filename);
+
+    bool hit = rocsparseio_open(&handle, rocsparseio_rwmode_read, format.c_str())
+               == rocsparseio_status_success;
+    hit = hit && read_cache_file(handle, key, ptr, ind, val, M, N, nnz, cached_base);
+    rocsparseio_close(handle);
+    if(!hit)
+    {
+        return false;
+    }
+
+    // Mark the cached file as the most recently used one
+    utime(filename.c_str(), nullptr);
+
+    if(rocsparse_importer_switch_base(M + 1, ptr, cached_base, base) != rocsparse_status_success)
+    {
+        return false;
+    }
+
+    return rocsparse_importer_switch_base(nnz, ind, cached_base, base) == rocsparse_status_success;
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_matrix_file_cache::store(const std::string&    source,
+                                        const std::vector<I>& ptr,
+                                        const std::vector<J>& ind,
+                                        const std::vector<T>& val,
+                                        J                     M,
+                                        J                     N,
+                                        I                     nnz,
+                                        rocsparse_index_base  base)
+{
+    std::string key;
+    std::string filename;
+    if(!get_cache_entry<T, I, J>(source, key, filename))
+    {
+        return;
+    }
+
+    // A matrix larger than the cache is not stored
+    const uint64_t max_size = get_cache_max_size();
+    const uint64_t nbytes   = (static_cast<uint64_t>(M) + 1) * sizeof(I)
+                            + static_cast<uint64_t>(nnz) * (sizeof(J) + sizeof(T));
+    if(nbytes > max_size)
+    {
+        return;
+    }
+
+#ifdef WIN32
+    _mkdir(get_cache_dir().c_str());
+#else
+    mkdir(get_cache_dir().c_str(), 0755);
+#endif
+
+    evict_cache_files(max_size - nbytes);
+
+    // Write to a temporary file first, concurrent processes may store the same matrix
+    const std::string tmp = filename + ".tmp" + std::to_string(getpid());
+
+    const rocsparseio_index_base iobase = (base == rocsparse_index_base_one)
+                                              ? rocsparseio_index_base_one
+                                              : rocsparseio_index_base_zero;
+    const std::string            format = escape_cache_format(tmp);
+    const std::string            name   = escape_cache_format(key);
+
+    rocsparseio_handle handle{};
+    bool ok = rocsparseio_open(&handle, rocsparseio_rwmode_write, format.c_str())
+              == rocsparseio_status_success;
+    ok = ok
+         && rocsparseio_write_sparse_csx(handle,
+                                         rocsparseio_direction_row,
+                                         M,
+                                         N,
+                                         nnz,
+                                         get_cache_type<I>(),
+                                         ptr.data(),
+                                         get_cache_type<J>(),
+                                         ind.data(),
+                                         get_cache_type<T>(),
+                                         val.data(),
+                                         iobase,
+                                         name.c_str())
+                == rocsparseio_status_success;
+    rocsparseio_close(handle);
+
+    if(!ok || rename(tmp.c_str(), filename.c_str()) != 0)
+    {
+        remove(tmp.c_str());
+    }
+}
+
+#define INSTANTIATE(T, I, J)                                                            \
+    template bool rocsparse_matrix_file_cache::load(const std::string&   source,        \
+                                                    std::vector<I>&      ptr,           \
+                                                    std::vector<J>&      ind,           \
+                                                    std::vector<T>&      val,           \
+                                                    J&                   M,             \
+                                                    J&                   N,             \
+                                                    I&                   nnz,           \
+                                                    rocsparse_index_base base);         \
+    template void rocsparse_matrix_file_cache::store(const std::string&    source,      \
+                                                     const std::vector<I>& ptr,         \
+                                                     const std::vector<J>& ind,         \
+                                                     const std::vector<T>& val,         \
+                                                     J                     M,           \
+                                                     J                     N,           \
+                                                     I                     nnz,         \
+                                                     rocsparse_index_base  base)
+
+INSTANTIATE(int8_t, int32_t, int32_t);
+INSTANTIATE(int8_t, int64_t, int32_t);
+INSTANTIATE(int8_t, int64_t, int64_t);
+INSTANTIATE(float, int32_t, int32_t);
+INSTANTIATE(float, int64_t, int32_t);
+INSTANTIATE(float, int64_t, int64_t);
+INSTANTIATE(double, int32_t, int32_t);
+INSTANTIATE(double, int64_t, int32_t);
+INSTANTIATE(double, int64_t, int64_t);
+INSTANTIATE(rocsparse_float_complex, int32_t, int32_t);
+INSTANTIATE(rocsparse_float_complex, int64_t, int32_t);
+INSTANTIATE(rocsparse_float_complex, int64_t, int64_t);
+INSTANTIATE(rocsparse_double_complex, int32_t, int32_t);
+INSTANTIATE(rocsparse_double_complex, int64_t, int32_t);
+INSTANTIATE(rocsparse_double_complex, int64_t, int64_t);
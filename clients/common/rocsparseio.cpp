@@ -50,6 +50,41 @@ extern "C" rocsparseio_status rocsparseio_close(rocsparseio_handle handle_)
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseio_set_codec(rocsparseio_handle handle_,
+                                                    rocsparseio_codec  index_codec_,
+                                                    rocsparseio_codec  value_codec_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::set_codec(handle_, index_codec_, value_codec_));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseio_set_parallel_io(rocsparseio_handle handle_,
+                                                          uint64_t           nthreads_,
+                                                          uint64_t           chunk_size_,
+                                                          int                direct_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK(
+        rocsparseio::set_parallel_io(handle_, nthreads_, chunk_size_, direct_ != 0));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseio_get_parallel_io(rocsparseio_handle handle_,
+                                                          uint64_t*          nthreads_,
+                                                          uint64_t*          chunk_size_,
+                                                          int*               direct_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!nthreads_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!chunk_size_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!direct_, rocsparseio_status_invalid_pointer);
+    nthreads_[0]   = handle_->parallel_io.nthreads;
+    chunk_size_[0] = handle_->parallel_io.chunk_size;
+    direct_[0]     = handle_->parallel_io.direct;
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_format(rocsparseio_handle  handle_,
                                                       rocsparseio_format* format_)
 {
@@ -68,6 +103,50 @@ extern "C" rocsparseio_status rocsparseio_read_name(rocsparseio_handle handle_,
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseio_get_num_objects(rocsparseio_handle handle_,
+                                                          uint64_t*          nobjects_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!nobjects_, rocsparseio_status_invalid_pointer);
+    nobjects_[0] = handle_->toc.size();
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseio_get_object(rocsparseio_handle  handle_,
+                                                     uint64_t            index_,
+                                                     rocsparseio_string  name_,
+                                                     rocsparseio_format* format_,
+                                                     uint64_t*           nbytes_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!name_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!format_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!nbytes_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(index_ >= handle_->toc.size(), rocsparseio_status_invalid_value);
+    const rocsparseio::toc_entry_t& entry = handle_->toc[index_];
+    memcpy(name_, entry.name, sizeof(rocsparseio_string));
+    format_[0] = (rocsparseio_format)entry.format;
+    nbytes_[0] = entry.nbytes;
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status
+    rocsparseio_find_object(rocsparseio_handle handle_, const char* name_, uint64_t* index_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!name_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!index_, rocsparseio_status_invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::find_object(handle_, name_, index_));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseio_seek_object(rocsparseio_handle handle_, uint64_t index_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio_status_invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::seek_object(handle_, index_));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_type_get_size(rocsparseio_type type_, uint64_t* p_size_)
 {
     ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(type_).is_invalid(),
@@ -334,6 +413,28 @@ extern "C" rocsparseio_status rocsparseiox_read_sparse_coo(rocsparseio_handle ha
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_map_sparse_coo(rocsparseio_handle handle_,
+                                                          rocsparseio_map*   p_map_,
+                                                          const void**       row_ind_,
+                                                          const void**       col_ind_,
+                                                          const void**       val_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!p_map_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!row_ind_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!col_ind_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!val_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::map_sparse_coo(handle_, p_map_, row_ind_, col_ind_, val_));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_unmap(rocsparseio_map map_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!map_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::unmap(map_));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_coo(rocsparseio_handle handle_,
                                                           uint64_t*          m_,
                                                           uint64_t*          n_,
@@ -453,6 +554,77 @@ extern "C" rocsparseio_status rocsparseio_write_sparse_csx(rocsparseio_handle
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status
+    rocsparseiox_write_sparse_csx_stream_begin(rocsparseio_handle     handle_,
+                                               rocsparseio_direction  dir_,
+                                               uint64_t               m_,
+                                               uint64_t               n_,
+                                               uint64_t               nnz_,
+                                               rocsparseio_type       ptr_type_,
+                                               const void*            ptr_,
+                                               rocsparseio_type       ind_type_,
+                                               rocsparseio_type       val_type_,
+                                               rocsparseio_index_base base_,
+                                               const char*            name_,
+                                               ...)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::direction_t(dir_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(ptr_type_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(ind_type_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::type_t(val_type_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(rocsparseio::index_base_t(base_).is_invalid(),
+                            rocsparseio::status_t::invalid_value);
+    ROCSPARSEIO_C_CHECK_ARG(!ptr_, rocsparseio::status_t::invalid_pointer);
+
+    rocsparseio_string name;
+    if(name_)
+    {
+        va_list args;
+        va_start(args, name_);
+        const int len = vsnprintf(name, sizeof(rocsparseio_string), name_, args);
+        va_end(args);
+        ROCSPARSEIO_C_CHECK_ARG(len < 0 || len >= int(sizeof(rocsparseio_string)),
+                                rocsparseio::status_t::invalid_value);
+    }
+
+    ROCSPARSEIO_C_CHECK(rocsparseio::write_sparse_csx_stream_begin(handle_,
+                                                                   dir_,
+                                                                   m_,
+                                                                   n_,
+                                                                   nnz_,
+                                                                   ptr_type_,
+                                                                   ptr_,
+                                                                   ind_type_,
+                                                                   val_type_,
+                                                                   base_,
+                                                                   name_ ? name : nullptr));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_write_sparse_csx_stream(rocsparseio_handle handle_,
+                                                                   uint64_t           count_,
+                                                                   const void*        ind_,
+                                                                   const void*        val_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG((count_ > 0 && !ind_), rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG((count_ > 0 && !val_), rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::write_sparse_csx_stream(handle_, count_, ind_, val_));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_write_sparse_csx_stream_end(rocsparseio_handle handle_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK(rocsparseio::write_sparse_csx_stream_end(handle_));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseiox_read_metadata_sparse_csx(rocsparseio_handle     handle_,
                                                                     rocsparseio_direction* dir_,
                                                                     uint64_t*              m_,
@@ -497,6 +669,49 @@ extern "C" rocsparseio_status
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_read_sparse_csx_slab_range(rocsparseio_handle handle_,
+                                                                      uint64_t           first_,
+                                                                      uint64_t           nnz_max_,
+                                                                      uint64_t*          last_,
+                                                                      uint64_t*          nnz_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!last_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!nnz_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(
+        rocsparseio::read_sparse_csx_slab_range(handle_, first_, nnz_max_, last_, nnz_));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_read_sparse_csx_slab(rocsparseio_handle handle_,
+                                                                uint64_t           first_,
+                                                                uint64_t           last_,
+                                                                void*              ptr_,
+                                                                void*              ind_,
+                                                                void*              val_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!ptr_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(
+        rocsparseio::read_sparse_csx_slab(handle_, first_, last_, ptr_, ind_, val_));
+    return rocsparseio_status_success;
+}
+
+extern "C" rocsparseio_status rocsparseiox_map_sparse_csx(rocsparseio_handle handle_,
+                                                          rocsparseio_map*   p_map_,
+                                                          const void**       ptr_,
+                                                          const void**       ind_,
+                                                          const void**       val_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!p_map_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!ptr_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!ind_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!val_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::map_sparse_csx(handle_, p_map_, ptr_, ind_, val_));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_csx(rocsparseio_handle     handle_,
                                                           rocsparseio_direction* dir_,
                                                           uint64_t*              m_,
@@ -701,6 +916,21 @@ extern "C" rocsparseio_status
     return rocsparseio_status_success;
 }
 
+extern "C" rocsparseio_status rocsparseiox_map_sparse_gebsx(rocsparseio_handle handle_,
+                                                            rocsparseio_map*   p_map_,
+                                                            const void**       ptr_,
+                                                            const void**       ind_,
+                                                            const void**       val_)
+{
+    ROCSPARSEIO_C_CHECK_ARG(!handle_, rocsparseio::status_t::invalid_handle);
+    ROCSPARSEIO_C_CHECK_ARG(!p_map_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!ptr_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!ind_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK_ARG(!val_, rocsparseio::status_t::invalid_pointer);
+    ROCSPARSEIO_C_CHECK(rocsparseio::map_sparse_gebsx(handle_, p_map_, ptr_, ind_, val_));
+    return rocsparseio_status_success;
+}
+
 extern "C" rocsparseio_status rocsparseio_read_sparse_gebsx(rocsparseio_handle handle_,
 
                                                             rocsparseio_direction* dir_,
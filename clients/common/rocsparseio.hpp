@@ -23,12 +23,28 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <limits>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 //
 //
@@ -522,8 +538,9 @@ namespace rocsparseio
     {
         typedef enum value_type_ : rocsparseio_rwmode_t
         {
-            read  = rocsparseio_rwmode_read,
-            write = rocsparseio_rwmode_write
+            read   = rocsparseio_rwmode_read,
+            write  = rocsparseio_rwmode_write,
+            append = rocsparseio_rwmode_append
         } value_type;
 
         value_type value;
@@ -544,6 +561,7 @@ namespace rocsparseio
             {
             case read:
             case write:
+            case append:
             {
                 return false;
             }
@@ -562,6 +580,77 @@ namespace rocsparseio
     }
                 CASE(read);
                 CASE(write);
+                CASE(append);
+#undef CASE
+            }
+            return "unknown";
+        }
+    };
+
+    //!
+    //! @brief c++11 struct for codec enum.
+    //!
+    struct codec_t
+    {
+        typedef enum value_type_ : rocsparseio_codec_t
+        {
+            none          = rocsparseio_codec_none,
+            delta_varbyte = rocsparseio_codec_delta_varbyte,
+            delta_bitpack = rocsparseio_codec_delta_bitpack,
+            byte_shuffle  = rocsparseio_codec_byte_shuffle
+        } value_type;
+
+        value_type value{};
+
+        inline constexpr operator value_type() const
+        {
+            return this->value;
+        };
+
+        inline explicit constexpr operator rocsparseio_codec() const
+        {
+            return (rocsparseio_codec)this->value;
+        };
+
+        constexpr codec_t(){};
+        inline constexpr codec_t(rocsparseio_codec_t ival_)
+            : value((value_type)ival_)
+        {
+        }
+
+        inline bool is_invalid() const
+        {
+            switch(this->value)
+            {
+            case none:
+            case delta_varbyte:
+            case delta_bitpack:
+            case byte_shuffle:
+            {
+                return false;
+            }
+            }
+            return true;
+        };
+
+        inline bool is_delta() const
+        {
+            return this->value == delta_varbyte || this->value == delta_bitpack;
+        };
+
+        inline const char* to_string() const
+        {
+            switch(this->value)
+            {
+#define CASE(case_name)    \
+    case case_name:        \
+    {                      \
+        return #case_name; \
+    }
+                CASE(none);
+                CASE(delta_varbyte);
+                CASE(delta_bitpack);
+                CASE(byte_shuffle);
 #undef CASE
             }
             return "unknown";
@@ -604,6 +693,63 @@ namespace rocsparseio
         return os_;
     }
 
+    //
+    // Entry of the table of contents.
+    //
+    struct toc_entry_t
+    {
+        rocsparseio_string name{};
+        format_t           format{};
+        uint64_t           offset{};
+        uint64_t           nbytes{};
+    };
+
+    //
+    // State of a streaming write of a csr/csc matrix.
+    //
+    struct csx_stream_t
+    {
+        bool        active{};
+        toc_entry_t entry{};
+        uint64_t    nnz{};
+        uint64_t    count{};
+        uint64_t    ind_size{};
+        uint64_t    ind_offset{};
+        uint64_t    val_size{};
+        uint64_t    val_offset{};
+    };
+
+    //
+    // Configuration of the parallel transfers of large arrays of a handle.
+    //
+    struct parallel_io_t
+    {
+        uint64_t nthreads{1};
+        uint64_t chunk_size{8 << 20};
+        bool     direct{};
+    };
+
+    static constexpr uint64_t parallel_io_alignment = 4096;
+
+    //
+    // Default configuration of a handle, read from the environment.
+    //
+    inline parallel_io_t default_parallel_io()
+    {
+        parallel_io_t config;
+#ifdef _OPENMP
+        config.nthreads = std::min(omp_get_max_threads(), 8);
+#endif
+        const char* env = getenv("ROCSPARSEIO_IO_THREADS");
+        if(env != nullptr && atoi(env) > 0)
+        {
+            config.nthreads = atoi(env);
+        }
+        env           = getenv("ROCSPARSEIO_IO_DIRECT");
+        config.direct = (env != nullptr && atoi(env) != 0);
+        return config;
+    }
+
 } // namespace rocsparseio
 
 struct _rocsparseio_handle
@@ -611,6 +757,16 @@ struct _rocsparseio_handle
     rocsparseio::rwmode_t mode;
     std::string           filename{};
     FILE*                 f{};
+    rocsparseio::codec_t  index_codec{};
+    rocsparseio::codec_t  value_codec{};
+    bool                  encoded{};
+
+    rocsparseio::parallel_io_t parallel_io{rocsparseio::default_parallel_io()};
+
+    std::vector<rocsparseio::toc_entry_t>     toc{};
+    std::unordered_map<std::string, uint64_t> toc_index{};
+    rocsparseio::csx_stream_t                 csx_stream{};
+
     _rocsparseio_handle(rocsparseio::rwmode_t mode_, const char* filename_)
         : mode(mode_)
         , filename(filename_)
@@ -618,12 +774,151 @@ struct _rocsparseio_handle
     }
 };
 
+struct _rocsparseio_map
+{
+    void*              addr{};
+    uint64_t           length{};
+    std::vector<void*> buffers{};
+};
+
 namespace rocsparseio
 {
     using handle_t = rocsparseio_handle;
 
-    inline status_t fread_data(FILE* in_, uint64_t size_, uint64_t nmemb_, void* data_)
+#ifndef WIN32
+    inline bool ptransfer_chunk(int fd_, bool write_, char* data_, uint64_t nbytes_, off_t offset_)
+    {
+        while(nbytes_ > 0)
+        {
+            const ssize_t n = write_ ? pwrite(fd_, data_, nbytes_, offset_)
+                                     : pread(fd_, data_, nbytes_, offset_);
+            if(n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if(n <= 0)
+            {
+                return false;
+            }
+            data_ += n;
+            nbytes_ -= n;
+            offset_ += n;
+        }
+        return true;
+    }
+
+    //
+    // Transfer nbytes_ at offset_ of a file descriptor with pread/pwrite, in chunks processed
+    // concurrently. Chunk boundaries are aligned in the file, so that every chunk but the
+    // first and the last ones can be transferred with O_DIRECT through an aligned buffer.
+    //
+    inline status_t ptransfer(const parallel_io_t& io_,
+                              int                  fd_,
+                              bool                 write_,
+                              uint64_t             offset_,
+                              uint64_t             nbytes_,
+                              void*                data_)
+    {
+        const uint64_t alignment  = parallel_io_alignment;
+        const uint64_t chunk_size = std::max(alignment, io_.chunk_size / alignment * alignment);
+
+        //
+        // The first chunk ends at the first boundary after offset_, and may be empty.
+        //
+        const uint64_t end   = offset_ + nbytes_;
+        const uint64_t first = std::min(end, (offset_ + chunk_size - 1) / chunk_size * chunk_size);
+        const uint64_t nchunks = 1 + (end - first + chunk_size - 1) / chunk_size;
+
+        int direct_fd = -1;
+#ifdef O_DIRECT
+        if(io_.direct)
+        {
+            char path[64];
+            snprintf(path, sizeof(path), "/proc/self/fd/%d", fd_);
+            direct_fd = open(path, (write_ ? O_WRONLY : O_RDONLY) | O_DIRECT);
+        }
+#endif
+
+        status_t status = status_t::success;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(io_.nthreads)
+#endif
+        {
+            void* buffer = nullptr;
+            if(direct_fd >= 0 && 0 != posix_memalign(&buffer, alignment, chunk_size))
+            {
+                buffer = nullptr;
+            }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int64_t c = 0; c < static_cast<int64_t>(nchunks); ++c)
+            {
+                const uint64_t start = (c == 0) ? offset_ : first + (c - 1) * chunk_size;
+                const uint64_t stop  = (c == 0) ? first : std::min(end, start + chunk_size);
+                const uint64_t count = stop - start;
+                char*          data  = static_cast<char*>(data_) + (start - offset_);
+
+                bool done = (count == 0);
+                if(!done && buffer != nullptr && start % alignment == 0 && count % alignment == 0)
+                {
+                    if(write_)
+                    {
+                        memcpy(buffer, data, count);
+                    }
+                    done = ptransfer_chunk(direct_fd, write_, (char*)buffer, count, start);
+                    if(done && !write_)
+                    {
+                        memcpy(data, buffer, count);
+                    }
+                }
+
+                if(!done && !ptransfer_chunk(fd_, write_, data, count, start))
+                {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                    status = status_t::invalid_file_operation;
+                }
+            }
+            free(buffer);
+        }
+
+        if(direct_fd >= 0)
+        {
+            ::close(direct_fd);
+        }
+        return status;
+    }
+
+    //
+    // Check if a transfer of nbytes_ is split into parallel chunks.
+    //
+    inline bool use_ptransfer(const parallel_io_t& io_, uint64_t nbytes_)
+    {
+        return (io_.nthreads > 1 || io_.direct) && nbytes_ >= 2 * io_.chunk_size;
+    }
+#endif
+
+    inline status_t fread_data(FILE*                in_,
+                               const parallel_io_t& io_,
+                               uint64_t             size_,
+                               uint64_t             nmemb_,
+                               void*                data_)
     {
+#ifndef WIN32
+        if(use_ptransfer(io_, size_ * nmemb_))
+        {
+            const long offset = ftell(in_);
+            ROCSPARSEIO_CHECK(ptransfer(io_, fileno(in_), false, offset, size_ * nmemb_, data_));
+            if(0 != fseek(in_, offset + size_ * nmemb_, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            return status_t::success;
+        }
+#endif
         if(nmemb_ != fread(data_, size_, nmemb_, in_))
         {
             return status_t::invalid_file_operation;
@@ -631,6 +926,36 @@ namespace rocsparseio
         return status_t::success;
     }
 
+    inline status_t fwrite_data(FILE*                out_,
+                                const parallel_io_t& io_,
+                                uint64_t             size_,
+                                uint64_t             nmemb_,
+                                const void*          data_)
+    {
+#ifndef WIN32
+        if(use_ptransfer(io_, size_ * nmemb_))
+        {
+            if(0 != fflush(out_))
+            {
+                return status_t::invalid_file_operation;
+            }
+            const long offset = ftell(out_);
+            ROCSPARSEIO_CHECK(ptransfer(
+                io_, fileno(out_), true, offset, size_ * nmemb_, const_cast<void*>(data_)));
+            if(0 != fseek(out_, offset + size_ * nmemb_, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            return status_t::success;
+        }
+#endif
+        if(nmemb_ != fwrite(data_, size_, nmemb_, out_))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
     template <typename source, typename target>
     inline status_t convert_scalar(const source& s_, target& t_)
     {
@@ -711,6 +1036,17 @@ namespace rocsparseio
         return status_t::success;
     }
 
+    template <typename source>
+    inline status_t convert_scalar(const source& s_, index_base_t& t_)
+    {
+        t_ = static_cast<index_base_t>(s_);
+        if(t_.is_invalid())
+        {
+            return status_t::invalid_value;
+        }
+        return status_t::success;
+    }
+
     template <typename T, typename J>
     inline status_t fwrite_scalar(J scalar_, FILE* out_)
     {
@@ -758,28 +1094,484 @@ namespace rocsparseio
         return status_t::success;
     };
 
-    inline status_t fwrite_array(FILE* out_, uint64_t size_, uint64_t nmemb_, const void* data_)
+    //
+    // Encoded arrays are split in blocks of codec_block_size elements, which are encoded
+    // independently. The codec is stored in the upper bits of the size of the elements.
+    //
+    static constexpr uint64_t codec_block_size = 65536;
+    static constexpr uint64_t codec_shift      = 32;
+    static constexpr uint64_t codec_size_mask  = (uint64_t(1) << codec_shift) - 1;
+
+    inline uint64_t zigzag_encode(int64_t x_)
     {
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(size_, out_));
+        return (static_cast<uint64_t>(x_) << 1) ^ static_cast<uint64_t>(x_ >> 63);
+    }
+
+    inline int64_t zigzag_decode(uint64_t x_)
+    {
+        return static_cast<int64_t>(x_ >> 1) ^ -static_cast<int64_t>(x_ & 1);
+    }
+
+    inline int64_t get_integer(const char* data_, uint64_t size_, uint64_t i_)
+    {
+        return (size_ == sizeof(int32_t)) ? reinterpret_cast<const int32_t*>(data_)[i_]
+                                          : reinterpret_cast<const int64_t*>(data_)[i_];
+    }
+
+    inline void set_integer(char* data_, uint64_t size_, uint64_t i_, int64_t value_)
+    {
+        if(size_ == sizeof(int32_t))
+        {
+            reinterpret_cast<int32_t*>(data_)[i_] = static_cast<int32_t>(value_);
+        }
+        else
+        {
+            reinterpret_cast<int64_t*>(data_)[i_] = value_;
+        }
+    }
+
+    //
+    // Runs of 3 to 130 identical bytes are encoded with a control byte in [128, 255], and
+    // sequences of 1 to 128 other bytes with a control byte in [0, 127].
+    //
+    inline void encode_runs(const unsigned char* in_, uint64_t n_, std::vector<char>& out_)
+    {
+        uint64_t i = 0;
+        while(i < n_)
+        {
+            uint64_t run = 1;
+            while(i + run < n_ && run < 130 && in_[i + run] == in_[i])
+            {
+                ++run;
+            }
+
+            if(run >= 3)
+            {
+                out_.push_back(static_cast<char>(125 + run));
+                out_.push_back(static_cast<char>(in_[i]));
+                i += run;
+            }
+            else
+            {
+                uint64_t j = i;
+                while(j < n_ && j - i < 128)
+                {
+                    if(j + 2 < n_ && in_[j] == in_[j + 1] && in_[j] == in_[j + 2])
+                    {
+                        break;
+                    }
+                    ++j;
+                }
+                out_.push_back(static_cast<char>(j - i - 1));
+                out_.insert(out_.end(), in_ + i, in_ + j);
+                i = j;
+            }
+        }
+    }
+
+    inline status_t
+        decode_runs(const unsigned char* in_, uint64_t nbytes_, unsigned char* out_, uint64_t n_)
+    {
+        uint64_t i = 0;
+        uint64_t k = 0;
+        while(k < n_)
+        {
+            ROCSPARSEIO_CHECK_ARG(i >= nbytes_, status_t::invalid_format);
+            const uint64_t control = in_[i++];
+            if(control >= 128)
+            {
+                const uint64_t run = control - 125;
+                ROCSPARSEIO_CHECK_ARG(i >= nbytes_ || k + run > n_, status_t::invalid_format);
+                memset(out_ + k, in_[i++], run);
+                k += run;
+            }
+            else
+            {
+                const uint64_t count = control + 1;
+                ROCSPARSEIO_CHECK_ARG(i + count > nbytes_ || k + count > n_,
+                                      status_t::invalid_format);
+                memcpy(out_ + k, in_ + i, count);
+                i += count;
+                k += count;
+            }
+        }
+        return status_t::success;
+    }
+
+    inline void encode_block(
+        codec_t codec_, uint64_t size_, uint64_t nmemb_, const char* data_, std::vector<char>& out_)
+    {
+        switch(codec_)
+        {
+        case codec_t::none:
+        {
+            out_.assign(data_, data_ + size_ * nmemb_);
+            break;
+        }
+
+        case codec_t::delta_varbyte:
+        {
+            int64_t previous = 0;
+            for(uint64_t i = 0; i < nmemb_; ++i)
+            {
+                const int64_t value = get_integer(data_, size_, i);
+                uint64_t      delta = zigzag_encode(value - previous);
+                previous            = value;
+                while(delta >= 128)
+                {
+                    out_.push_back(static_cast<char>((delta & 127) | 128));
+                    delta >>= 7;
+                }
+                out_.push_back(static_cast<char>(delta));
+            }
+            break;
+        }
+
+        case codec_t::delta_bitpack:
+        {
+            uint64_t all_bits = 0;
+            int64_t  previous = 0;
+            for(uint64_t i = 0; i < nmemb_; ++i)
+            {
+                const int64_t value = get_integer(data_, size_, i);
+                all_bits |= zigzag_encode(value - previous);
+                previous = value;
+            }
+
+            uint64_t nbits = 0;
+            while(nbits < 64 && (all_bits >> nbits) != 0)
+            {
+                ++nbits;
+            }
+            out_.push_back(static_cast<char>(nbits));
+
+            unsigned char current = 0;
+            uint64_t      nfilled = 0;
+            previous              = 0;
+            for(uint64_t i = 0; i < nmemb_; ++i)
+            {
+                const int64_t value    = get_integer(data_, size_, i);
+                const uint64_t delta   = zigzag_encode(value - previous);
+                previous               = value;
+                uint64_t       written = 0;
+                while(written < nbits)
+                {
+                    const uint64_t count = std::min(nbits - written, 8 - nfilled);
+                    current |= static_cast<unsigned char>(
+                        ((delta >> written) & ((uint64_t(1) << count) - 1)) << nfilled);
+                    nfilled += count;
+                    written += count;
+                    if(nfilled == 8)
+                    {
+                        out_.push_back(static_cast<char>(current));
+                        current = 0;
+                        nfilled = 0;
+                    }
+                }
+            }
+            if(nfilled > 0)
+            {
+                out_.push_back(static_cast<char>(current));
+            }
+            break;
+        }
+
+        case codec_t::byte_shuffle:
+        {
+            std::vector<unsigned char> shuffled(size_ * nmemb_);
+            for(uint64_t b = 0; b < size_; ++b)
+            {
+                for(uint64_t i = 0; i < nmemb_; ++i)
+                {
+                    shuffled[b * nmemb_ + i] = data_[i * size_ + b];
+                }
+            }
+            encode_runs(shuffled.data(), shuffled.size(), out_);
+            break;
+        }
+        }
+    }
+
+    inline status_t decode_block(codec_t     codec_,
+                                 uint64_t    size_,
+                                 uint64_t    nmemb_,
+                                 const char* in_,
+                                 uint64_t    nbytes_,
+                                 char*       data_)
+    {
+        const unsigned char* in = reinterpret_cast<const unsigned char*>(in_);
+        switch(codec_)
+        {
+        case codec_t::none:
+        {
+            ROCSPARSEIO_CHECK_ARG(nbytes_ != size_ * nmemb_, status_t::invalid_format);
+            memcpy(data_, in_, nbytes_);
+            return status_t::success;
+        }
+
+        case codec_t::delta_varbyte:
+        {
+            int64_t  previous = 0;
+            uint64_t k        = 0;
+            for(uint64_t i = 0; i < nmemb_; ++i)
+            {
+                uint64_t delta = 0;
+                uint64_t shift = 0;
+                while(true)
+                {
+                    ROCSPARSEIO_CHECK_ARG(k >= nbytes_ || shift > 63, status_t::invalid_format);
+                    const uint64_t byte = in[k++];
+                    delta |= (byte & 127) << shift;
+                    shift += 7;
+                    if(byte < 128)
+                    {
+                        break;
+                    }
+                }
+                previous += zigzag_decode(delta);
+                set_integer(data_, size_, i, previous);
+            }
+            return status_t::success;
+        }
+
+        case codec_t::delta_bitpack:
+        {
+            ROCSPARSEIO_CHECK_ARG(nbytes_ == 0, status_t::invalid_format);
+            const uint64_t nbits = in[0];
+            ROCSPARSEIO_CHECK_ARG(nbits > 64 || 1 + (nbits * nmemb_ + 7) / 8 != nbytes_,
+                                  status_t::invalid_format);
+            int64_t  previous = 0;
+            uint64_t bit      = 0;
+            for(uint64_t i = 0; i < nmemb_; ++i)
+            {
+                uint64_t delta = 0;
+                uint64_t read  = 0;
+                while(read < nbits)
+                {
+                    const uint64_t offset = bit % 8;
+                    const uint64_t count  = std::min(nbits - read, 8 - offset);
+                    delta |= ((uint64_t(in[1 + bit / 8]) >> offset) & ((uint64_t(1) << count) - 1))
+                             << read;
+                    read += count;
+                    bit += count;
+                }
+                previous += zigzag_decode(delta);
+                set_integer(data_, size_, i, previous);
+            }
+            return status_t::success;
+        }
+
+        case codec_t::byte_shuffle:
+        {
+            std::vector<unsigned char> shuffled(size_ * nmemb_);
+            ROCSPARSEIO_CHECK(decode_runs(in, nbytes_, shuffled.data(), shuffled.size()));
+            for(uint64_t b = 0; b < size_; ++b)
+            {
+                for(uint64_t i = 0; i < nmemb_; ++i)
+                {
+                    data_[i * size_ + b] = static_cast<char>(shuffled[b * nmemb_ + i]);
+                }
+            }
+            return status_t::success;
+        }
+        }
+        return status_t::invalid_format;
+    }
+
+    //
+    // Write an encoded array: the size of the elements and the codec, the number of elements,
+    // the number of bytes of the encoding, the block size, the offsets of the blocks and the
+    // encoded blocks.
+    //
+    inline status_t fwrite_encoded_array(
+        FILE* out_, codec_t codec_, uint64_t size_, uint64_t nmemb_, const void* data_)
+    {
+        ROCSPARSEIO_CHECK_ARG(codec_.is_delta() && size_ != sizeof(int32_t)
+                                  && size_ != sizeof(int64_t),
+                              status_t::invalid_value);
+
+        const uint64_t                 nblocks = (nmemb_ + codec_block_size - 1) / codec_block_size;
+        std::vector<std::vector<char>> blocks(nblocks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t b = 0; b < static_cast<int64_t>(nblocks); ++b)
+        {
+            const uint64_t first = b * codec_block_size;
+            const uint64_t count = std::min(codec_block_size, nmemb_ - first);
+            encode_block(codec_,
+                         size_,
+                         count,
+                         static_cast<const char*>(data_) + first * size_,
+                         blocks[b]);
+        }
+
+        std::vector<uint64_t> offsets(nblocks + 1, 0);
+        for(uint64_t b = 0; b < nblocks; ++b)
+        {
+            offsets[b + 1] = offsets[b] + blocks[b].size();
+        }
+
+        const uint64_t nbytes = sizeof(uint64_t) * (nblocks + 2) + offsets[nblocks];
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(size_ | (uint64_t(codec_) << codec_shift), out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nmemb_, out_));
-        if(nmemb_ != fwrite(data_, size_, nmemb_, out_))
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nbytes, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(codec_block_size, out_));
+        if(nblocks + 1 != fwrite(offsets.data(), sizeof(uint64_t), nblocks + 1, out_))
         {
             return status_t::invalid_file_operation;
         }
+
+        for(uint64_t b = 0; b < nblocks; ++b)
+        {
+            if(blocks[b].size() != fwrite(blocks[b].data(), 1, blocks[b].size(), out_))
+            {
+                return status_t::invalid_file_operation;
+            }
+        }
         return status_t::success;
     }
 
-    inline status_t fread_array(FILE* in_, void* data_)
+    //
+    // Read the elements [first_, first_ + count_) of an encoded array, offset_ being the
+    // position of the block size. Only the blocks overlapping the range are read.
+    //
+    inline status_t fread_encoded_range(FILE*                in_,
+                                        const parallel_io_t& io_,
+                                        uint64_t             offset_,
+                                        codec_t              codec_,
+                                        uint64_t             size_,
+                                        uint64_t             nmemb_,
+                                        uint64_t             first_,
+                                        uint64_t             count_,
+                                        void*                data_)
+    {
+        ROCSPARSEIO_CHECK_ARG(first_ + count_ > nmemb_, status_t::invalid_size);
+        if(count_ == 0)
+        {
+            return status_t::success;
+        }
+
+        if(0 != fseek(in_, offset_, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        uint64_t block_size;
+        ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(block_size, in_));
+        ROCSPARSEIO_CHECK_ARG(block_size == 0, status_t::invalid_format);
+
+        const uint64_t nblocks = (nmemb_ + block_size - 1) / block_size;
+        const uint64_t b0      = first_ / block_size;
+        const uint64_t b1      = (first_ + count_ - 1) / block_size + 1;
+
+        std::vector<uint64_t> offsets(b1 - b0 + 1);
+        if(0 != fseek(in_, offset_ + sizeof(uint64_t) * (1 + b0), SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fread_data(in_, io_, sizeof(uint64_t), offsets.size(), offsets.data()));
+        for(uint64_t b = b0; b < b1; ++b)
+        {
+            ROCSPARSEIO_CHECK_ARG(offsets[b - b0 + 1] < offsets[b - b0], status_t::invalid_format);
+        }
+
+        std::vector<char> encoded(offsets[b1 - b0] - offsets[0]);
+        if(0 != fseek(in_, offset_ + sizeof(uint64_t) * (nblocks + 2) + offsets[0], SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fread_data(in_, io_, 1, encoded.size(), encoded.data()));
+
+        status_t status = status_t::success;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for(int64_t b = b0; b < static_cast<int64_t>(b1); ++b)
+        {
+            const uint64_t block_first = b * block_size;
+            const uint64_t block_count = std::min(block_size, nmemb_ - block_first);
+            const char*    in          = encoded.data() + offsets[b - b0] - offsets[0];
+            const uint64_t nbytes      = offsets[b - b0 + 1] - offsets[b - b0];
+
+            // Blocks partially overlapping the range are decoded in a temporary buffer.
+            const uint64_t begin = std::max(block_first, first_);
+            const uint64_t end   = std::min(block_first + block_count, first_ + count_);
+            char*          out   = static_cast<char*>(data_) + (begin - first_) * size_;
+
+            status_t block_status;
+            if(begin == block_first && end == block_first + block_count)
+            {
+                block_status = decode_block(codec_, size_, block_count, in, nbytes, out);
+            }
+            else
+            {
+                std::vector<char> block(block_count * size_);
+                block_status = decode_block(codec_, size_, block_count, in, nbytes, block.data());
+                memcpy(out, block.data() + (begin - block_first) * size_, (end - begin) * size_);
+            }
+
+            if(block_status != status_t::success)
+            {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                status = block_status;
+            }
+        }
+        return status;
+    }
+
+    inline status_t fwrite_array(FILE*                out_,
+                                 const parallel_io_t& io_,
+                                 uint64_t             size_,
+                                 uint64_t             nmemb_,
+                                 const void*          data_)
+    {
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(size_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nmemb_, out_));
+        return fwrite_data(out_, io_, size_, nmemb_, data_);
+    }
+
+    inline status_t fwrite_array(FILE*                out_,
+                                 const parallel_io_t& io_,
+                                 uint64_t             size_,
+                                 uint64_t             nmemb_,
+                                 const void*          data_,
+                                 codec_t              codec_)
+    {
+        if(codec_ == codec_t::none)
+        {
+            return fwrite_array(out_, io_, size_, nmemb_, data_);
+        }
+        return fwrite_encoded_array(out_, codec_, size_, nmemb_, data_);
+    }
+
+    inline status_t fread_array(FILE* in_, const parallel_io_t& io_, void* data_)
     {
         uint64_t size;
         uint64_t nmemb;
         ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size, in_));
         ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
-        if(nmemb != fread(data_, size, nmemb, in_))
+
+        const codec_t codec = static_cast<rocsparseio_codec_t>(size >> codec_shift);
+        if(codec != codec_t::none)
         {
-            return status_t::invalid_file_operation;
+            ROCSPARSEIO_CHECK_ARG(codec.is_invalid(), status_t::invalid_format);
+            uint64_t nbytes;
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nbytes, in_));
+            const uint64_t offset = ftell(in_);
+            ROCSPARSEIO_CHECK(fread_encoded_range(
+                in_, io_, offset, codec, size & codec_size_mask, nmemb, 0, nmemb, data_));
+            if(0 != fseek(in_, offset + nbytes, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            return status_t::success;
         }
-        return status_t::success;
+
+        return fread_data(in_, io_, size, nmemb, data_);
     }
 
     inline status_t fread_array_metadata(FILE* in_, uint64_t* size_, uint64_t* nmemb_)
@@ -787,6 +1579,7 @@ namespace rocsparseio
         const long pos = ftell(in_);
         ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size_, in_));
         ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb_, in_));
+        size_[0] &= codec_size_mask;
         if(0 != fseek(in_, pos, SEEK_SET))
         {
             return status_t::invalid_file_operation;
@@ -794,6 +1587,196 @@ namespace rocsparseio
         return status_t::success;
     }
 
+    inline status_t funmap(rocsparseio_map map_)
+    {
+        ROCSPARSEIO_CHECK_ARG(map_ == nullptr, status_t::invalid_pointer);
+#ifndef WIN32
+        if(map_->addr != nullptr)
+        {
+            munmap(map_->addr, map_->length);
+        }
+#endif
+        for(void* buffer : map_->buffers)
+        {
+            free(buffer);
+        }
+        delete map_;
+        return status_t::success;
+    }
+
+    //
+    // Location of an array in the file, offset is the position of the elements or, for an
+    // encoded array, the position of the block size.
+    //
+    struct array_location_t
+    {
+        uint64_t offset{};
+        uint64_t size{};
+        uint64_t nmemb{};
+        codec_t  codec{};
+    };
+
+    //
+    // Locate the arrays of the object at the current position of the file, the object being
+    // made of its name, nscalars_ scalars and narrays_ arrays. The position is moved after the
+    // object.
+    //
+    static constexpr uint64_t max_narrays = 3;
+
+    inline status_t flocate_arrays(FILE*            in_,
+                                   uint64_t         nscalars_,
+                                   uint64_t         narrays_,
+                                   array_location_t arrays_[max_narrays])
+    {
+        ROCSPARSEIO_CHECK_ARG(in_ == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(narrays_ == 0 || narrays_ > max_narrays, status_t::invalid_size);
+
+        if(0 != fseek(in_, sizeof(uint64_t) * nscalars_ + sizeof(rocsparseio_string), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        for(uint64_t i = 0; i < narrays_; ++i)
+        {
+            uint64_t size;
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(size, in_));
+            ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(arrays_[i].nmemb, in_));
+            arrays_[i].size  = size & codec_size_mask;
+            arrays_[i].codec = static_cast<rocsparseio_codec_t>(size >> codec_shift);
+            ROCSPARSEIO_CHECK_ARG(arrays_[i].size == 0 || arrays_[i].codec.is_invalid(),
+                                  status_t::invalid_format);
+
+            uint64_t nbytes = arrays_[i].size * arrays_[i].nmemb;
+            if(arrays_[i].codec != codec_t::none)
+            {
+                ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nbytes, in_));
+            }
+
+            arrays_[i].offset = ftell(in_);
+            if(0 != fseek(in_, nbytes, SEEK_CUR))
+            {
+                return status_t::invalid_file_operation;
+            }
+        }
+        return status_t::success;
+    }
+
+    //
+    // Read the elements [first_, first_ + count_) of a located array.
+    //
+    inline status_t fread_range(FILE*                   in_,
+                                const parallel_io_t&    io_,
+                                const array_location_t& array_,
+                                uint64_t                first_,
+                                uint64_t                count_,
+                                void*                   data_)
+    {
+        ROCSPARSEIO_CHECK_ARG(first_ + count_ > array_.nmemb, status_t::invalid_size);
+        if(array_.codec != codec_t::none)
+        {
+            return fread_encoded_range(in_,
+                                       io_,
+                                       array_.offset,
+                                       array_.codec,
+                                       array_.size,
+                                       array_.nmemb,
+                                       first_,
+                                       count_,
+                                       data_);
+        }
+
+        if(0 != fseek(in_, array_.offset + first_ * array_.size, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return fread_data(in_, io_, array_.size, count_, data_);
+    }
+
+    //
+    // Map the arrays of the object at the current position of the file. The arrays are mapped
+    // from the file and an array is only copied if its data is not aligned with respect to its
+    // type, if it is encoded, or if the file cannot be mapped. The position is moved after the
+    // object.
+    //
+    inline status_t fmap_arrays(FILE*                in_,
+                                const parallel_io_t& io_,
+                                uint64_t             nscalars_,
+                                uint64_t             narrays_,
+                                const void**         arrays_,
+                                rocsparseio_map*     p_map_)
+    {
+        ROCSPARSEIO_CHECK_ARG(p_map_ == nullptr, status_t::invalid_pointer);
+
+        array_location_t arrays[max_narrays];
+        ROCSPARSEIO_CHECK(flocate_arrays(in_, nscalars_, narrays_, arrays));
+        const long end = ftell(in_);
+
+        rocsparseio_map map = new _rocsparseio_map();
+        uint64_t        first{};
+
+#ifndef WIN32
+        {
+            const uint64_t page_size = sysconf(_SC_PAGESIZE);
+            first                    = (arrays[0].offset / page_size) * page_size;
+            map->length              = end - first;
+            void* addr
+                = mmap(nullptr, map->length, PROT_READ, MAP_PRIVATE, fileno(in_), (off_t)first);
+            if(addr != MAP_FAILED)
+            {
+                map->addr = addr;
+                madvise(addr, map->length, MADV_SEQUENTIAL);
+            }
+        }
+#endif
+
+        for(uint64_t i = 0; i < narrays_; ++i)
+        {
+            const uint64_t nbytes = arrays[i].size * arrays[i].nmemb;
+            const char*    data   = nullptr;
+            if(map->addr != nullptr && arrays[i].codec == codec_t::none)
+            {
+                data = static_cast<const char*>(map->addr) + (arrays[i].offset - first);
+            }
+
+            if(data == nullptr || (reinterpret_cast<uintptr_t>(data) % arrays[i].size) != 0)
+            {
+                void* buffer = malloc((nbytes > 0) ? nbytes : 1);
+                if(buffer == nullptr)
+                {
+                    funmap(map);
+                    return status_t::invalid_memory;
+                }
+                map->buffers.push_back(buffer);
+
+                if(data != nullptr)
+                {
+                    memcpy(buffer, data, nbytes);
+                }
+                else
+                {
+                    const status_t status
+                        = fread_range(in_, io_, arrays[i], 0, arrays[i].nmemb, buffer);
+                    if(status != status_t::success)
+                    {
+                        funmap(map);
+                        return status;
+                    }
+                }
+                data = static_cast<const char*>(buffer);
+            }
+            arrays_[i] = data;
+        }
+
+        if(0 != fseek(in_, end, SEEK_SET))
+        {
+            funmap(map);
+            return status_t::invalid_file_operation;
+        }
+
+        p_map_[0] = map;
+        return status_t::success;
+    }
+
 } // namespace rocsparseio
 
 namespace rocsparseio
@@ -802,21 +1785,19 @@ namespace rocsparseio
     //
     // ////////////////////////////////////////////////
     //
-    inline status_t fwrite_dense_vector(FILE*       out_,
-                                        type_t      data_type_,
-                                        uint64_t    data_nmemb_,
-                                        const void* data_,
-                                        uint64_t    data_inc_,
-                                        const char* name_,
+    inline status_t fwrite_dense_vector(FILE*                out_,
+                                        const parallel_io_t& io_,
+                                        type_t               data_type_,
+                                        uint64_t             data_nmemb_,
+                                        const void*          data_,
+                                        uint64_t             data_inc_,
+                                        const char*          name_,
                                         ...)
     {
         ROCSPARSEIO_CHECK_ARG(out_ == nullptr, status_t::invalid_pointer);
         ROCSPARSEIO_CHECK_ARG(data_type_.is_invalid(), status_t::invalid_value);
         ROCSPARSEIO_CHECK_ARG(((data_nmemb_ > 0) && (data_ == nullptr)), status_t::invalid_pointer);
         ROCSPARSEIO_CHECK_ARG(((data_inc_ > 0) && (data_ == nullptr)), status_t::invalid_size);
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_vector, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
-        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb_, out_));
 
         rocsparseio_string name;
         if(name_)
@@ -842,13 +1823,14 @@ namespace rocsparseio
             return status_t::invalid_file_operation;
         }
 
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::dense_vector, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_nmemb_, out_));
+
         uint64_t data_size = data_type_.size();
         if(data_inc_ == 1)
         {
-            if(data_nmemb_ != fwrite(data_, data_size, data_nmemb_, out_))
-            {
-                return status_t::invalid_file_operation;
-            }
+            ROCSPARSEIO_CHECK(fwrite_data(out_, io_, data_size, data_nmemb_, data_));
         }
         else
         {
@@ -930,7 +1912,10 @@ namespace rocsparseio
         return status_t::success;
     };
 
-    inline status_t fread_dense_vector(FILE* in_, void* data_, uint64_t inc_)
+    inline status_t fread_dense_vector(FILE*                in_,
+                                       const parallel_io_t& io_,
+                                       void*                data_,
+                                       uint64_t             inc_)
     {
         if(0 != fseek(in_, sizeof(uint64_t) + sizeof(rocsparseio_string), SEEK_CUR))
         {
@@ -943,12 +1928,12 @@ namespace rocsparseio
         ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(nmemb, in_));
         if(inc_ == 1)
         {
-            return fread_data(in_, size, nmemb, data_);
+            return fread_data(in_, io_, size, nmemb, data_);
         }
         else
         {
             void* buff = malloc(size * nmemb);
-            ROCSPARSEIO_CHECK(fread_data(in_, size, nmemb, buff));
+            ROCSPARSEIO_CHECK(fread_data(in_, io_, size, nmemb, buff));
             uint64_t j = 0;
             for(uint64_t i = 0; i < nmemb; ++i)
             {
@@ -965,14 +1950,15 @@ namespace rocsparseio
 namespace rocsparseio
 {
 
-    inline status_t fwrite_dense_matrix(FILE*       out_,
-                                        order_t     order_,
-                                        uint64_t    m_,
-                                        uint64_t    n_,
-                                        type_t      data_type_,
-                                        const void* data_,
-                                        uint64_t    data_ld_,
-                                        const char* name_,
+    inline status_t fwrite_dense_matrix(FILE*                out_,
+                                        const parallel_io_t& io_,
+                                        order_t              order_,
+                                        uint64_t             m_,
+                                        uint64_t             n_,
+                                        type_t               data_type_,
+                                        const void*          data_,
+                                        uint64_t             data_ld_,
+                                        const char*          name_,
                                         ...)
     {
         ROCSPARSEIO_CHECK_ARG(out_ == nullptr, status_t::invalid_pointer);
@@ -1030,11 +2016,7 @@ namespace rocsparseio
         {
             if(data_ld_ == n_)
             {
-                const uint64_t data_nmemb = m_ * n_;
-                if(data_nmemb != fwrite(data_, data_size, data_nmemb, out_))
-                {
-                    return status_t::invalid_file_operation;
-                }
+                ROCSPARSEIO_CHECK(fwrite_data(out_, io_, data_size, m_ * n_, data_));
             }
             else
             {
@@ -1055,11 +2037,7 @@ namespace rocsparseio
         {
             if(data_ld_ == m_)
             {
-                const uint64_t data_nmemb = m_ * n_;
-                if(data_nmemb != fwrite(data_, data_size, data_nmemb, out_))
-                {
-                    return status_t::invalid_file_operation;
-                }
+                ROCSPARSEIO_CHECK(fwrite_data(out_, io_, data_size, m_ * n_, data_));
             }
             else
             {
@@ -1079,7 +2057,10 @@ namespace rocsparseio
         return status_t::success;
     };
 
-    inline status_t fread_dense_matrix(FILE* in_, void* data_, uint64_t ld_)
+    inline status_t fread_dense_matrix(FILE*                in_,
+                                       const parallel_io_t& io_,
+                                       void*                data_,
+                                       uint64_t             ld_)
     {
         if(0 != fseek(in_, sizeof(rocsparseio_string), SEEK_CUR))
         {
@@ -1115,14 +2096,14 @@ namespace rocsparseio
         {
             if(ld_ == n)
             {
-                ROCSPARSEIO_CHECK(fread_data(in_, s, m * n, data_));
+                ROCSPARSEIO_CHECK(fread_data(in_, io_, s, m * n, data_));
             }
             else
             {
                 char* p = static_cast<char*>(data_);
                 for(uint64_t i = 0; i < m; ++i)
                 {
-                    ROCSPARSEIO_CHECK(fread_data(in_, s, n, p));
+                    ROCSPARSEIO_CHECK(fread_data(in_, io_, s, n, p));
                     p += s * ld_;
                 }
             }
@@ -1132,7 +2113,7 @@ namespace rocsparseio
         {
             if(ld_ == m)
             {
-                ROCSPARSEIO_CHECK(fread_data(in_, s, m * n, data_));
+                ROCSPARSEIO_CHECK(fread_data(in_, io_, s, m * n, data_));
             }
             else
             {
@@ -1140,7 +2121,7 @@ namespace rocsparseio
                 const uint64_t s = type.size();
                 for(uint64_t j = 0; j < n; ++j)
                 {
-                    ROCSPARSEIO_CHECK(fread_data(in_, s, m, p));
+                    ROCSPARSEIO_CHECK(fread_data(in_, io_, s, m, p));
                     p += s * ld_;
                 }
             }
@@ -1187,12 +2168,15 @@ namespace rocsparseio
 //
 namespace rocsparseio
 {
-    inline status_t fwrite_sparse_csx(FILE*       out_,
-                                      direction_t dir_,
-                                      uint64_t    m_,
-                                      uint64_t    n_,
-                                      uint64_t    nnz_,
-                                      type_t      ptr_type_,
+    inline status_t fwrite_sparse_csx(FILE*                out_,
+                                      const parallel_io_t& io_,
+                                      codec_t              index_codec_,
+                                      codec_t              value_codec_,
+                                      direction_t          dir_,
+                                      uint64_t             m_,
+                                      uint64_t             n_,
+                                      uint64_t             nnz_,
+                                      type_t               ptr_type_,
                                       const void* __restrict__ ptr_,
                                       type_t ind_type_,
                                       const void* __restrict__ ind_,
@@ -1240,18 +2224,20 @@ namespace rocsparseio
         {
         case direction_t::row:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), m_ + 1, ptr_));
+            ROCSPARSEIO_CHECK(
+                fwrite_array(out_, io_, ptr_type_.size(), m_ + 1, ptr_, index_codec_));
             break;
         }
         case direction_t::column:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), n_ + 1, ptr_));
+            ROCSPARSEIO_CHECK(
+                fwrite_array(out_, io_, ptr_type_.size(), n_ + 1, ptr_, index_codec_));
             break;
         }
         }
 
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), nnz_, ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, data_type_.size(), nnz_, data_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ind_type_.size(), nnz_, ind_, index_codec_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, data_type_.size(), nnz_, data_, value_codec_));
 
         return status_t::success;
     };
@@ -1287,24 +2273,193 @@ namespace rocsparseio
         {
             return status_t::invalid_file_operation;
         }
-
+
+        return status_t::success;
+    }
+
+    inline status_t fread_sparse_csx(FILE*                in_,
+                                     const parallel_io_t& io_,
+                                     void* __restrict__ ptr_,
+                                     void* __restrict__ ind_,
+                                     void* __restrict__ data_)
+    {
+        if(0 != fseek(in_, sizeof(uint64_t) * 9 + sizeof(rocsparseio_string), SEEK_CUR))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ptr_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, data_));
+
+        return status_t::success;
+    }
+
+    //
+    // Decode the i_-th offset of an array of offsets.
+    //
+    inline status_t get_offset(type_t type_, const void* data_, uint64_t i_, uint64_t* value_)
+    {
+        switch(type_)
+        {
+        case type_t::int32:
+        {
+            return convert_scalar(static_cast<const int32_t*>(data_)[i_], value_[0]);
+        }
+        case type_t::int64:
+        {
+            return convert_scalar(static_cast<const int64_t*>(data_)[i_], value_[0]);
+        }
+        case type_t::float32:
+        case type_t::float64:
+        case type_t::complex32:
+        case type_t::complex64:
+        {
+            break;
+        }
+        }
+        return status_t::invalid_format;
+    }
+
+    inline status_t fread_offset(FILE*                   in_,
+                                 const parallel_io_t&    io_,
+                                 const array_location_t& array_,
+                                 uint64_t                i_,
+                                 uint64_t*               value_)
+    {
+        char data[sizeof(uint64_t)];
+        ROCSPARSEIO_CHECK_ARG(array_.size > sizeof(data), status_t::invalid_format);
+        ROCSPARSEIO_CHECK(fread_range(in_, io_, array_, i_, 1, data));
+        return get_offset(
+            (array_.size == sizeof(int32_t)) ? type_t::int32 : type_t::int64, data, 0, value_);
+    }
+
+    //
+    // Find the largest slab [first_, last_) of rows (or columns) with at most nnz_max_
+    // non-zeros, a slab contains at least one row. The position is not modified.
+    //
+    inline status_t fread_sparse_csx_slab_range(FILE*                in_,
+                                                const parallel_io_t& io_,
+                                                uint64_t             first_,
+                                                uint64_t             nnz_max_,
+                                                uint64_t*            last_,
+                                                uint64_t*            nnz_)
+    {
+        ROCSPARSEIO_CHECK_ARG(in_ == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(last_ == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(nnz_ == nullptr, status_t::invalid_pointer);
+
+        const long       pos = ftell(in_);
+        array_location_t arrays[max_narrays];
+        ROCSPARSEIO_CHECK(flocate_arrays(in_, 9, 3, arrays));
+
+        const uint64_t size = arrays[0].nmemb - 1;
+        ROCSPARSEIO_CHECK_ARG(first_ >= size, status_t::invalid_value);
+
+        //
+        // Binary search on the stored offsets.
+        //
+        uint64_t begin;
+        ROCSPARSEIO_CHECK(fread_offset(in_, io_, arrays[0], first_, &begin));
+
+        uint64_t last = first_ + 1;
+        uint64_t end;
+        ROCSPARSEIO_CHECK(fread_offset(in_, io_, arrays[0], last, &end));
+
+        uint64_t lower = last + 1;
+        uint64_t upper = size + 1;
+        while(lower < upper)
+        {
+            const uint64_t mid = lower + (upper - lower) / 2;
+            uint64_t       value;
+            ROCSPARSEIO_CHECK(fread_offset(in_, io_, arrays[0], mid, &value));
+            if(value - begin <= nnz_max_)
+            {
+                last  = mid;
+                end   = value;
+                lower = mid + 1;
+            }
+            else
+            {
+                upper = mid;
+            }
+        }
+
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        last_[0] = last;
+        nnz_[0]  = end - begin;
+        return status_t::success;
+    }
+
+    //
+    // Read the slab [first_, last_) of rows (or columns): the last_ - first_ + 1 stored offsets
+    // and the matching indices and values. The position is not modified.
+    //
+    inline status_t fread_sparse_csx_slab(FILE*                in_,
+                                          const parallel_io_t& io_,
+                                          uint64_t             first_,
+                                          uint64_t             last_,
+                                          void* __restrict__ ptr_,
+                                          void* __restrict__ ind_,
+                                          void* __restrict__ data_)
+    {
+        ROCSPARSEIO_CHECK_ARG(in_ == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(ptr_ == nullptr, status_t::invalid_pointer);
+
+        direction_t  dir;
+        uint64_t     m, n, nnz;
+        type_t       ptr_type, ind_type, data_type;
+        index_base_t base;
+        ROCSPARSEIO_CHECK(fread_metadata_sparse_csx(
+            in_, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &data_type, &base));
+
+        const long       pos = ftell(in_);
+        array_location_t arrays[max_narrays];
+        ROCSPARSEIO_CHECK(flocate_arrays(in_, 9, 3, arrays));
+        ROCSPARSEIO_CHECK_ARG(first_ > last_ || last_ >= arrays[0].nmemb, status_t::invalid_value);
+
+        const uint64_t slab_size = last_ - first_;
+        ROCSPARSEIO_CHECK(fread_range(in_, io_, arrays[0], first_, slab_size + 1, ptr_));
+
+        uint64_t begin, end;
+        ROCSPARSEIO_CHECK(get_offset(ptr_type, ptr_, 0, &begin));
+        ROCSPARSEIO_CHECK(get_offset(ptr_type, ptr_, slab_size, &end));
+        const uint64_t ubase = static_cast<uint64_t>(base.value);
+        ROCSPARSEIO_CHECK_ARG(begin < ubase || end < begin || end - ubase > arrays[1].nmemb,
+                              status_t::invalid_format);
+
+        const uint64_t slab_nnz = end - begin;
+        if(slab_nnz > 0)
+        {
+            ROCSPARSEIO_CHECK_ARG(ind_ == nullptr, status_t::invalid_pointer);
+            ROCSPARSEIO_CHECK_ARG(data_ == nullptr, status_t::invalid_pointer);
+            ROCSPARSEIO_CHECK(fread_range(in_, io_, arrays[1], begin - ubase, slab_nnz, ind_));
+            ROCSPARSEIO_CHECK(fread_range(in_, io_, arrays[2], begin - ubase, slab_nnz, data_));
+        }
+
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
         return status_t::success;
     }
 
-    inline status_t fread_sparse_csx(FILE* in_,
-                                     void* __restrict__ ptr_,
-                                     void* __restrict__ ind_,
-                                     void* __restrict__ data_)
+    inline status_t fmap_sparse_csx(FILE*                in_,
+                                    const parallel_io_t& io_,
+                                    rocsparseio_map*     p_map_,
+                                    const void**         ptr_,
+                                    const void**         ind_,
+                                    const void**         data_)
     {
-        if(0 != fseek(in_, sizeof(uint64_t) * 9 + sizeof(rocsparseio_string), SEEK_CUR))
-        {
-            return status_t::invalid_file_operation;
-        }
-
-        ROCSPARSEIO_CHECK(fread_array(in_, ptr_));
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
-
+        const void* arrays[3]{};
+        ROCSPARSEIO_CHECK(fmap_arrays(in_, io_, 9, 3, arrays, p_map_));
+        ptr_[0]  = arrays[0];
+        ind_[0]  = arrays[1];
+        data_[0] = arrays[2];
         return status_t::success;
     }
 
@@ -1312,11 +2467,14 @@ namespace rocsparseio
 
 namespace rocsparseio
 {
-    inline status_t fwrite_sparse_coo(FILE*    out_,
-                                      uint64_t m_,
-                                      uint64_t n_,
-                                      uint64_t nnz_,
-                                      type_t   row_ind_type_,
+    inline status_t fwrite_sparse_coo(FILE*                out_,
+                                      const parallel_io_t& io_,
+                                      codec_t              index_codec_,
+                                      codec_t              value_codec_,
+                                      uint64_t             m_,
+                                      uint64_t             n_,
+                                      uint64_t             nnz_,
+                                      type_t               row_ind_type_,
                                       const void* __restrict__ row_ind_,
                                       type_t col_ind_type_,
                                       const void* __restrict__ col_ind_,
@@ -1359,9 +2517,11 @@ namespace rocsparseio
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(col_ind_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, row_ind_type_.size(), nnz_, row_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, col_ind_type_.size(), nnz_, col_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, data_type_.size(), nnz_, data_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, io_, row_ind_type_.size(), nnz_, row_ind_, index_codec_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, io_, col_ind_type_.size(), nnz_, col_ind_, index_codec_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, data_type_.size(), nnz_, data_, value_codec_));
         return status_t::success;
     };
 
@@ -1397,7 +2557,8 @@ namespace rocsparseio
         return status_t::success;
     }
 
-    inline status_t fread_sparse_coo(FILE* in_,
+    inline status_t fread_sparse_coo(FILE*                in_,
+                                     const parallel_io_t& io_,
                                      void* __restrict__ row_ind_,
                                      void* __restrict__ col_ind_,
                                      void* __restrict__ data_)
@@ -1407,9 +2568,24 @@ namespace rocsparseio
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, row_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, col_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, row_ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, col_ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, data_));
+        return status_t::success;
+    }
+
+    inline status_t fmap_sparse_coo(FILE*                in_,
+                                    const parallel_io_t& io_,
+                                    rocsparseio_map*     p_map_,
+                                    const void**         row_ind_,
+                                    const void**         col_ind_,
+                                    const void**         data_)
+    {
+        const void* arrays[3]{};
+        ROCSPARSEIO_CHECK(fmap_arrays(in_, io_, 8, 3, arrays, p_map_));
+        row_ind_[0] = arrays[0];
+        col_ind_[0] = arrays[1];
+        data_[0]    = arrays[2];
         return status_t::success;
     }
 
@@ -1417,11 +2593,12 @@ namespace rocsparseio
 
 namespace rocsparseio
 {
-    inline status_t fwrite_sparse_ell(FILE*    out_,
-                                      uint64_t m_,
-                                      uint64_t n_,
-                                      uint64_t width_,
-                                      type_t   ind_type_,
+    inline status_t fwrite_sparse_ell(FILE*                out_,
+                                      const parallel_io_t& io_,
+                                      uint64_t             m_,
+                                      uint64_t             n_,
+                                      uint64_t             width_,
+                                      type_t               ind_type_,
                                       const void* __restrict__ ind_,
                                       type_t val_type_,
                                       const void* __restrict__ val_,
@@ -1460,8 +2637,8 @@ namespace rocsparseio
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(val_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), m_ * width_, ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, val_type_.size(), m_ * width_, val_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ind_type_.size(), m_ * width_, ind_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, val_type_.size(), m_ * width_, val_));
         return status_t::success;
     };
 
@@ -1495,15 +2672,18 @@ namespace rocsparseio
         return status_t::success;
     }
 
-    inline status_t fread_sparse_ell(FILE* in_, void* __restrict__ ind_, void* __restrict__ val_)
+    inline status_t fread_sparse_ell(FILE*                in_,
+                                     const parallel_io_t& io_,
+                                     void* __restrict__ ind_,
+                                     void* __restrict__ val_)
     {
         if(0 != fseek(in_, sizeof(uint64_t) * 7 + sizeof(rocsparseio_string), SEEK_CUR))
         {
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, val_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, val_));
 
         return status_t::success;
     }
@@ -1512,11 +2692,12 @@ namespace rocsparseio
 
 namespace rocsparseio
 {
-    inline status_t fwrite_sparse_dia(FILE*    out_,
-                                      uint64_t m_,
-                                      uint64_t n_,
-                                      uint64_t ndiag_,
-                                      type_t   ind_type_,
+    inline status_t fwrite_sparse_dia(FILE*                out_,
+                                      const parallel_io_t& io_,
+                                      uint64_t             m_,
+                                      uint64_t             n_,
+                                      uint64_t             ndiag_,
+                                      type_t               ind_type_,
                                       const void* __restrict__ ind_,
                                       type_t val_type_,
                                       const void* __restrict__ val_,
@@ -1555,8 +2736,9 @@ namespace rocsparseio
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(val_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), ndiag_, ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, val_type_.size(), std::min(m_, n_) * ndiag_, val_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ind_type_.size(), ndiag_, ind_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, io_, val_type_.size(), std::min(m_, n_) * ndiag_, val_));
         return status_t::success;
     };
 
@@ -1590,15 +2772,18 @@ namespace rocsparseio
         return status_t::success;
     }
 
-    inline status_t fread_sparse_dia(FILE* in_, void* __restrict__ ind_, void* __restrict__ val_)
+    inline status_t fread_sparse_dia(FILE*                in_,
+                                     const parallel_io_t& io_,
+                                     void* __restrict__ ind_,
+                                     void* __restrict__ val_)
     {
         if(0 != fseek(in_, sizeof(uint64_t) * 7 + sizeof(rocsparseio_string), SEEK_CUR))
         {
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, val_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, val_));
 
         return status_t::success;
     }
@@ -1608,9 +2793,10 @@ namespace rocsparseio
 namespace rocsparseio
 {
 
-    inline status_t fwrite_sparse_hyb(FILE*    out_,
-                                      uint64_t m_,
-                                      uint64_t n_,
+    inline status_t fwrite_sparse_hyb(FILE*                out_,
+                                      const parallel_io_t& io_,
+                                      uint64_t             m_,
+                                      uint64_t             n_,
 
                                       uint64_t coo_nnz_,
                                       type_t   coo_row_ind_type_,
@@ -1670,11 +2856,13 @@ namespace rocsparseio
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ell_val_type_, out_));
         ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ell_base_, out_));
 
-        ROCSPARSEIO_CHECK(fwrite_array(out_, coo_row_ind_type_.size(), coo_nnz_, coo_row_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, coo_col_ind_type_.size(), coo_nnz_, coo_col_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, coo_data_type_.size(), coo_nnz_, coo_data_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ell_ind_type_.size(), m_ * ell_width_, ell_ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ell_val_type_.size(), m_ * ell_width_, ell_val_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, io_, coo_row_ind_type_.size(), coo_nnz_, coo_row_ind_));
+        ROCSPARSEIO_CHECK(
+            fwrite_array(out_, io_, coo_col_ind_type_.size(), coo_nnz_, coo_col_ind_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, coo_data_type_.size(), coo_nnz_, coo_data_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ell_ind_type_.size(), m_ * ell_width_, ell_ind_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ell_val_type_.size(), m_ * ell_width_, ell_val_));
 
         return status_t::success;
     };
@@ -1721,7 +2909,8 @@ namespace rocsparseio
         return status_t::success;
     }
 
-    inline status_t fread_sparse_hyb(FILE* in_,
+    inline status_t fread_sparse_hyb(FILE*                in_,
+                                     const parallel_io_t& io_,
                                      void* __restrict__ coo_row_ind_,
                                      void* __restrict__ coo_col_ind_,
                                      void* __restrict__ coo_data_,
@@ -1733,12 +2922,12 @@ namespace rocsparseio
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, coo_row_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, coo_col_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, coo_data_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, coo_row_ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, coo_col_ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, coo_data_));
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ell_ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, ell_val_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ell_ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ell_val_));
         return status_t::success;
     }
 
@@ -1747,15 +2936,18 @@ namespace rocsparseio
 namespace rocsparseio
 {
 
-    inline status_t fwrite_sparse_gebsx(FILE*       out_,
-                                        direction_t dir_,
-                                        direction_t dirb_,
-                                        uint64_t    mb_,
-                                        uint64_t    nb_,
-                                        uint64_t    nnzb_,
-                                        uint64_t    row_block_dim_,
-                                        uint64_t    col_block_dim_,
-                                        type_t      ptr_type_,
+    inline status_t fwrite_sparse_gebsx(FILE*                out_,
+                                        const parallel_io_t& io_,
+                                        codec_t              index_codec_,
+                                        codec_t              value_codec_,
+                                        direction_t          dir_,
+                                        direction_t          dirb_,
+                                        uint64_t             mb_,
+                                        uint64_t             nb_,
+                                        uint64_t             nnzb_,
+                                        uint64_t             row_block_dim_,
+                                        uint64_t             col_block_dim_,
+                                        type_t               ptr_type_,
                                         const void* __restrict__ ptr_,
                                         type_t ind_type_,
                                         const void* __restrict__ ind_,
@@ -1807,19 +2999,25 @@ namespace rocsparseio
         {
         case direction_t::row:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), mb_ + 1, ptr_));
+            ROCSPARSEIO_CHECK(
+                fwrite_array(out_, io_, ptr_type_.size(), mb_ + 1, ptr_, index_codec_));
             break;
         }
         case direction_t::column:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), nb_ + 1, ptr_));
+            ROCSPARSEIO_CHECK(
+                fwrite_array(out_, io_, ptr_type_.size(), nb_ + 1, ptr_, index_codec_));
             break;
         }
         }
 
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), nnzb_, ind_));
-        ROCSPARSEIO_CHECK(
-            fwrite_array(out_, data_type_.size(), nnzb_ * row_block_dim_ * col_block_dim_, data_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ind_type_.size(), nnzb_, ind_, index_codec_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_,
+                                       io_,
+                                       data_type_.size(),
+                                       nnzb_ * row_block_dim_ * col_block_dim_,
+                                       data_,
+                                       value_codec_));
 
         return status_t::success;
     };
@@ -1864,7 +3062,8 @@ namespace rocsparseio
         return status_t::success;
     }
 
-    inline status_t fread_sparse_gebsx(FILE* in_,
+    inline status_t fread_sparse_gebsx(FILE*                in_,
+                                       const parallel_io_t& io_,
                                        void* __restrict__ ptr_,
                                        void* __restrict__ ind_,
                                        void* __restrict__ data_)
@@ -1874,10 +3073,25 @@ namespace rocsparseio
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ptr_));
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ptr_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, data_));
+
+        return status_t::success;
+    }
 
+    inline status_t fmap_sparse_gebsx(FILE*                in_,
+                                      const parallel_io_t& io_,
+                                      rocsparseio_map*     p_map_,
+                                      const void**         ptr_,
+                                      const void**         ind_,
+                                      const void**         data_)
+    {
+        const void* arrays[3]{};
+        ROCSPARSEIO_CHECK(fmap_arrays(in_, io_, 12, 3, arrays, p_map_));
+        ptr_[0]  = arrays[0];
+        ind_[0]  = arrays[1];
+        data_[0] = arrays[2];
         return status_t::success;
     }
 
@@ -1888,12 +3102,13 @@ namespace rocsparseio
 //
 namespace rocsparseio
 {
-    inline status_t fwrite_sparse_mcsx(FILE*       out_,
-                                       direction_t dir_,
-                                       uint64_t    m_,
-                                       uint64_t    n_,
-                                       uint64_t    nnz_,
-                                       type_t      ptr_type_,
+    inline status_t fwrite_sparse_mcsx(FILE*                out_,
+                                       const parallel_io_t& io_,
+                                       direction_t          dir_,
+                                       uint64_t             m_,
+                                       uint64_t             n_,
+                                       uint64_t             nnz_,
+                                       type_t               ptr_type_,
                                        const void* __restrict__ ptr_,
                                        type_t ind_type_,
                                        const void* __restrict__ ind_,
@@ -1941,18 +3156,18 @@ namespace rocsparseio
         {
         case direction_t::row:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), m_ + 1, ptr_));
+            ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ptr_type_.size(), m_ + 1, ptr_));
             break;
         }
         case direction_t::column:
         {
-            ROCSPARSEIO_CHECK(fwrite_array(out_, ptr_type_.size(), n_ + 1, ptr_));
+            ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ptr_type_.size(), n_ + 1, ptr_));
             break;
         }
         }
 
-        ROCSPARSEIO_CHECK(fwrite_array(out_, ind_type_.size(), nnz_, ind_));
-        ROCSPARSEIO_CHECK(fwrite_array(out_, data_type_.size(), nnz_, data_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, ind_type_.size(), nnz_, ind_));
+        ROCSPARSEIO_CHECK(fwrite_array(out_, io_, data_type_.size(), nnz_, data_));
 
         return status_t::success;
     };
@@ -1992,7 +3207,8 @@ namespace rocsparseio
         return status_t::success;
     }
 
-    inline status_t fread_sparse_mcsx(FILE* in_,
+    inline status_t fread_sparse_mcsx(FILE*                in_,
+                                      const parallel_io_t& io_,
                                       void* __restrict__ ptr_,
                                       void* __restrict__ ind_,
                                       void* __restrict__ data_)
@@ -2002,9 +3218,9 @@ namespace rocsparseio
             return status_t::invalid_file_operation;
         }
 
-        ROCSPARSEIO_CHECK(fread_array(in_, ptr_));
-        ROCSPARSEIO_CHECK(fread_array(in_, ind_));
-        ROCSPARSEIO_CHECK(fread_array(in_, data_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ptr_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, ind_));
+        ROCSPARSEIO_CHECK(fread_array(in_, io_, data_));
 
         return status_t::success;
     }
@@ -2049,6 +3265,252 @@ namespace rocsparseio
         return fread_name(handle_->f, ts_...);
     }
 
+    inline status_t fwrite_header(FILE* out_, int version_)
+    {
+        uint64_t value[2]{};
+        char*    p = (char*)&value;
+        sprintf(p, "ROCSPARSEIO.%d", version_);
+        if(2 != fwrite(&value[0], sizeof(uint64_t), 2, out_))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    //
+    // Flag the file as containing encoded arrays before writing the first of them.
+    //
+    inline status_t write_encoded_header(rocsparseio_handle handle_)
+    {
+        if(handle_->encoded
+           || (handle_->index_codec == codec_t::none && handle_->value_codec == codec_t::none))
+        {
+            return status_t::success;
+        }
+
+        const long pos = ftell(handle_->f);
+        if(0 != fseek(handle_->f, 0, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fwrite_header(handle_->f, ROCSPARSEIO_VERSION_MAJOR_ENCODED));
+        if(0 != fseek(handle_->f, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        handle_->encoded = true;
+        return status_t::success;
+    }
+
+    inline status_t
+        set_codec(rocsparseio_handle handle_, codec_t index_codec_, codec_t value_codec_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle_->mode == rwmode_t::read, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(index_codec_.is_invalid(), status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(value_codec_.is_invalid() || value_codec_.is_delta(),
+                              status_t::invalid_value);
+        handle_->index_codec = index_codec_;
+        handle_->value_codec = value_codec_;
+        return status_t::success;
+    }
+
+    inline status_t set_parallel_io(rocsparseio_handle handle_,
+                                    uint64_t           nthreads_,
+                                    uint64_t           chunk_size_,
+                                    bool               direct_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(nthreads_ == 0, status_t::invalid_value);
+        ROCSPARSEIO_CHECK_ARG(chunk_size_ < parallel_io_alignment, status_t::invalid_size);
+        handle_->parallel_io.nthreads   = nthreads_;
+        handle_->parallel_io.chunk_size = chunk_size_;
+        handle_->parallel_io.direct     = direct_;
+        return status_t::success;
+    }
+
+    //
+    // The table of contents follows the last object:
+    // [name, format, offset, nbytes] * nobjects, then the trailer [nobjects, offset, magic].
+    //
+    static constexpr uint64_t toc_magic        = 0x434f54534f495352; // "RSIOSTOC"
+    static constexpr uint64_t toc_entry_nbytes = sizeof(rocsparseio_string) + 3 * sizeof(uint64_t);
+    static constexpr uint64_t toc_trailer_nbytes = 3 * sizeof(uint64_t);
+
+    inline status_t fwrite_toc(FILE* out_, const std::vector<toc_entry_t>& toc_)
+    {
+        const long offset = ftell(out_);
+        for(const toc_entry_t& entry : toc_)
+        {
+            if(size_t(1) != fwrite(entry.name, sizeof(rocsparseio_string), 1, out_))
+            {
+                return status_t::invalid_file_operation;
+            }
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(entry.format, out_));
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(entry.offset, out_));
+            ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(entry.nbytes, out_));
+        }
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(toc_.size(), out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(offset, out_));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(toc_magic, out_));
+        return status_t::success;
+    }
+
+    //
+    // Read the table of contents if any, toc_offset_ is set to -1 otherwise.
+    // The position of the file is not modified.
+    //
+    inline status_t fread_toc(FILE* in_, std::vector<toc_entry_t>& toc_, long* toc_offset_)
+    {
+        const long pos = ftell(in_);
+        toc_.clear();
+        toc_offset_[0] = -1;
+
+        if(0 != fseek(in_, 0, SEEK_END))
+        {
+            return status_t::invalid_file_operation;
+        }
+        const uint64_t end = ftell(in_);
+        if(end >= 2 * sizeof(uint64_t) + toc_trailer_nbytes)
+        {
+            if(0 != fseek(in_, end - toc_trailer_nbytes, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
+            uint64_t trailer[3]{};
+            if(3 != fread(&trailer[0], sizeof(uint64_t), 3, in_))
+            {
+                return status_t::invalid_file_operation;
+            }
+
+            const uint64_t nobjects = trailer[0];
+            const uint64_t offset   = trailer[1];
+            if(trailer[2] == toc_magic && nobjects <= end / toc_entry_nbytes
+               && offset + nobjects * toc_entry_nbytes + toc_trailer_nbytes == end)
+            {
+                if(0 != fseek(in_, offset, SEEK_SET))
+                {
+                    return status_t::invalid_file_operation;
+                }
+                toc_.resize(nobjects);
+                for(toc_entry_t& entry : toc_)
+                {
+                    if(size_t(1) != fread(entry.name, sizeof(rocsparseio_string), 1, in_))
+                    {
+                        return status_t::invalid_file_operation;
+                    }
+                    entry.name[sizeof(rocsparseio_string) - 1] = '\0';
+                    ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(entry.format, in_));
+                    ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(entry.offset, in_));
+                    ROCSPARSEIO_CHECK(fread_scalar<uint64_t>(entry.nbytes, in_));
+                    ROCSPARSEIO_CHECK_ARG(entry.offset + entry.nbytes > offset,
+                                          status_t::invalid_format);
+                }
+                toc_offset_[0] = offset;
+            }
+        }
+
+        if(0 != fseek(in_, pos, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline void toc_insert(rocsparseio_handle handle_, const toc_entry_t& entry_)
+    {
+        handle_->toc_index[entry_.name] = handle_->toc.size();
+        handle_->toc.push_back(entry_);
+    }
+
+    //
+    // Write an object and record it in the table of contents.
+    //
+    template <typename F>
+    inline status_t write_object(rocsparseio_handle handle_, F&& write_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle_->mode == rwmode_t::read, status_t::invalid_mode);
+
+        const long start = ftell(handle_->f);
+        ROCSPARSEIO_CHECK(write_());
+        const long end = ftell(handle_->f);
+
+        //
+        // The name is only known once formatted, read it back.
+        //
+        toc_entry_t entry{};
+        if(0 != fseek(handle_->f, start, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fread_name(handle_->f, entry.name));
+        ROCSPARSEIO_CHECK(fread_format(handle_->f, &entry.format));
+        if(0 != fseek(handle_->f, end, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        entry.offset = start;
+        entry.nbytes = end - start;
+        toc_insert(handle_, entry);
+        return status_t::success;
+    }
+
+    inline status_t find_object(rocsparseio_handle handle_, const char* name_, uint64_t* index_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(name_ == nullptr, status_t::invalid_pointer);
+        ROCSPARSEIO_CHECK_ARG(index_ == nullptr, status_t::invalid_pointer);
+        const auto it = handle_->toc_index.find(name_);
+        if(it == handle_->toc_index.end())
+        {
+            return status_t::invalid_value;
+        }
+        index_[0] = it->second;
+        return status_t::success;
+    }
+
+    inline status_t seek_object(rocsparseio_handle handle_, uint64_t index_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle_->mode != rwmode_t::read, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(index_ >= handle_->toc.size(), status_t::invalid_value);
+        if(0 != fseek(handle_->f, handle_->toc[index_].offset, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        return status_t::success;
+    }
+
+    inline status_t fread_header(FILE* in_, int* version_)
+    {
+        uint64_t value[2]{};
+        if(2 != fread(&value[0], sizeof(uint64_t), 2, in_))
+        {
+            return status_t::invalid_file_operation;
+        }
+
+        for(int version : {ROCSPARSEIO_VERSION_MAJOR, ROCSPARSEIO_VERSION_MAJOR_ENCODED})
+        {
+            uint64_t ref_value[2]{};
+            char*    p = (char*)&ref_value[0];
+            sprintf(p, "ROCSPARSEIO.%d", version);
+            if(ref_value[0] == value[0] && ref_value[1] == value[1])
+            {
+                version_[0] = version;
+                return status_t::success;
+            }
+        }
+
+        uint64_t ref_value[2]{};
+        char*    p = (char*)&ref_value[0];
+        sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
+        std::cerr << "incompatible rocsparseio version: " << std::endl;
+        std::cerr << "   expected      : " << ref_value[0] << "." << ref_value[1] << std::endl;
+        std::cerr << "   from file     : " << value[0] << "." << value[1] << std::endl;
+        return status_t::invalid_file;
+    }
+
     inline status_t open(rocsparseio_handle* p_handle_, rwmode_t mode, const char* filename, ...)
     {
         char filename_[512];
@@ -2077,34 +3539,58 @@ namespace rocsparseio
                 return status_t::invalid_file;
             }
 
+            int version;
+            ROCSPARSEIO_CHECK(fread_header(h->f, &version));
+
+            //
+            // READ TABLE OF CONTENTS
+            //
+            long toc_offset;
+            ROCSPARSEIO_CHECK(fread_toc(h->f, h->toc, &toc_offset));
+            for(uint64_t i = 0; i < h->toc.size(); ++i)
             {
-                uint64_t ref_value[2]{};
-                char*    p = (char*)&ref_value[0];
-                sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
-                uint64_t value[2]{};
-                if(2 != fread(&value[0], sizeof(uint64_t), 2, h->f))
-                {
-                    return status_t::invalid_file_operation;
-                }
-                //	    std::cout << "read " << value[0] << " " << value[1] <<
-                //std::endl;
-                if(ref_value[0] != value[0] || ref_value[1] != value[1])
-                {
-                    std::cerr << "incompatible rocsparseio version: " << std::endl;
-                    std::cerr << "   expected      : " << ref_value[0] << "." << ref_value[1]
-                              << std::endl;
-                    std::cerr << "   from file     : " << value[0] << "." << value[1] << std::endl;
-                    return status_t::invalid_file;
-                }
+                h->toc_index[h->toc[i].name] = i;
+            }
+            break;
+        }
+
+        case rwmode_t::append:
+        {
+            h->f = fopen(filename_, "r+b");
+            if(h->f == nullptr)
+            {
+                return status_t::invalid_file;
             }
 
+            int version;
+            ROCSPARSEIO_CHECK(fread_header(h->f, &version));
+            h->encoded = (version == ROCSPARSEIO_VERSION_MAJOR_ENCODED);
+
+            //
+            // The new objects overwrite the table of contents, which is rewritten on close.
+            //
+            long toc_offset;
+            ROCSPARSEIO_CHECK(fread_toc(h->f, h->toc, &toc_offset));
+            if(toc_offset < 0)
+            {
+                std::cerr << "no table of contents in '" << filename_ << "'" << std::endl;
+                return status_t::invalid_format;
+            }
+            for(uint64_t i = 0; i < h->toc.size(); ++i)
+            {
+                h->toc_index[h->toc[i].name] = i;
+            }
+            if(0 != fseek(h->f, toc_offset, SEEK_SET))
+            {
+                return status_t::invalid_file_operation;
+            }
             break;
         }
 
         case rwmode_t::write:
         {
 
-            h->f = fopen(filename_, "wb");
+            h->f = fopen(filename_, "w+b");
             if(h->f == nullptr)
             {
                 return status_t::invalid_file;
@@ -2113,15 +3599,7 @@ namespace rocsparseio
             //
             // WRITE HEADER
             //
-            {
-                uint64_t value[2]{};
-                char*    p = (char*)&value;
-                sprintf(p, "ROCSPARSEIO.%d", ROCSPARSEIO_VERSION_MAJOR);
-                if(2 != fwrite(&value[0], sizeof(uint64_t), 2, h->f))
-                {
-                    return status_t::invalid_file_operation;
-                }
-            }
+            ROCSPARSEIO_CHECK(fwrite_header(h->f, ROCSPARSEIO_VERSION_MAJOR));
 
             break;
         }
@@ -2135,26 +3613,33 @@ namespace rocsparseio
     inline status_t close(rocsparseio_handle handle_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        status_t status = status_t::success;
         if(handle_->f != nullptr)
         {
+            if(handle_->mode != rwmode_t::read)
+            {
+                status = fwrite_toc(handle_->f, handle_->toc);
+            }
             fclose(handle_->f);
         }
         delete handle_;
-        return status_t::success;
+        return status;
     }
 
     template <typename... Ts>
     inline status_t write_dense_vector(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_dense_vector(handle_->f, ts_...);
+        return write_object(handle_, [&]() {
+            return fwrite_dense_vector(handle_->f, handle_->parallel_io, ts_...);
+        });
     }
 
     template <typename... Ts>
     inline status_t read_dense_vector(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_dense_vector(handle_->f, ts_...);
+        return fread_dense_vector(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename... Ts>
@@ -2168,7 +3653,9 @@ namespace rocsparseio
     inline status_t write_dense_matrix(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_dense_matrix(handle_->f, ts_...);
+        return write_object(handle_, [&]() {
+            return fwrite_dense_matrix(handle_->f, handle_->parallel_io, ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2182,7 +3669,7 @@ namespace rocsparseio
     inline status_t read_dense_matrix(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_dense_matrix(handle_->f, ts_...);
+        return fread_dense_matrix(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename T, typename J>
@@ -2190,8 +3677,9 @@ namespace rocsparseio
         rocsparseio_handle handle_, order_t order_, J m_, J n_, const T* data_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        ROCSPARSEIO_CHECK_ARG(handle_->mode != rwmode_t::write, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(handle_->mode == rwmode_t::read, status_t::invalid_mode);
         return fwrite_dense_matrix(handle_->f,
+                                   handle_->parallel_io,
                                    order_,
                                    static_cast<uint64_t>(m_),
                                    static_cast<uint64_t>(n_),
@@ -2205,7 +3693,127 @@ namespace rocsparseio
     inline status_t write_sparse_csx(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_csx(handle_->f, ts_...);
+        ROCSPARSEIO_CHECK(write_encoded_header(handle_));
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_csx(handle_->f,
+                                     handle_->parallel_io,
+                                     handle_->index_codec,
+                                     handle_->value_codec,
+                                     ts_...);
+        });
+    }
+
+    //
+    // The offsets are written first, the arrays of indices and values are laid out and then
+    // filled by batches.
+    //
+    inline status_t write_sparse_csx_stream_begin(rocsparseio_handle handle_,
+                                                  direction_t        dir_,
+                                                  uint64_t           m_,
+                                                  uint64_t           n_,
+                                                  uint64_t           nnz_,
+                                                  type_t             ptr_type_,
+                                                  const void*        ptr_,
+                                                  type_t             ind_type_,
+                                                  type_t             data_type_,
+                                                  index_base_t       base_,
+                                                  const char*        name_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        ROCSPARSEIO_CHECK_ARG(handle_->mode == rwmode_t::read, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(handle_->csx_stream.active, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(handle_->index_codec != codec_t::none
+                                  || handle_->value_codec != codec_t::none,
+                              status_t::invalid_mode);
+
+        FILE*         out    = handle_->f;
+        csx_stream_t& stream = handle_->csx_stream;
+        stream               = csx_stream_t{};
+        stream.entry.format  = format_t::sparse_csx;
+        stream.entry.offset  = ftell(out);
+        if(snprintf(stream.entry.name, sizeof(rocsparseio_string), "%s", name_ ? name_ : "unknown")
+           >= int(sizeof(rocsparseio_string)))
+        {
+            return status_t::invalid_value;
+        }
+
+        if(size_t(1) != fwrite(stream.entry.name, sizeof(rocsparseio_string), 1, out))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(format_t::sparse_csx, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(dir_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(m_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(n_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ptr_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(ind_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(data_type_, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(base_, out));
+        ROCSPARSEIO_CHECK(fwrite_array(out,
+                                       handle_->parallel_io,
+                                       ptr_type_.size(),
+                                       ((dir_ == direction_t::row) ? m_ : n_) + 1,
+                                       ptr_));
+
+        stream.nnz      = nnz_;
+        stream.ind_size = ind_type_.size();
+        stream.val_size = data_type_.size();
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(stream.ind_size, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out));
+        stream.ind_offset = ftell(out);
+        if(0 != fseek(out, stream.ind_offset + nnz_ * stream.ind_size, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(stream.val_size, out));
+        ROCSPARSEIO_CHECK(fwrite_scalar<uint64_t>(nnz_, out));
+        stream.val_offset = ftell(out);
+        stream.active     = true;
+        return status_t::success;
+    }
+
+    inline status_t write_sparse_csx_stream(rocsparseio_handle handle_,
+                                            uint64_t           count_,
+                                            const void*        ind_,
+                                            const void*        val_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        csx_stream_t& stream = handle_->csx_stream;
+        ROCSPARSEIO_CHECK_ARG(!stream.active, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(stream.count + count_ > stream.nnz, status_t::invalid_size);
+
+        FILE* out = handle_->f;
+        if(0 != fseek(out, stream.ind_offset + stream.count * stream.ind_size, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fwrite_data(out, handle_->parallel_io, stream.ind_size, count_, ind_));
+        if(0 != fseek(out, stream.val_offset + stream.count * stream.val_size, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        ROCSPARSEIO_CHECK(fwrite_data(out, handle_->parallel_io, stream.val_size, count_, val_));
+        stream.count += count_;
+        return status_t::success;
+    }
+
+    inline status_t write_sparse_csx_stream_end(rocsparseio_handle handle_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        csx_stream_t& stream = handle_->csx_stream;
+        ROCSPARSEIO_CHECK_ARG(!stream.active, status_t::invalid_mode);
+        ROCSPARSEIO_CHECK_ARG(stream.count != stream.nnz, status_t::invalid_size);
+
+        const uint64_t end = stream.val_offset + stream.nnz * stream.val_size;
+        if(0 != fseek(handle_->f, end, SEEK_SET))
+        {
+            return status_t::invalid_file_operation;
+        }
+        stream.entry.nbytes = end - stream.entry.offset;
+        toc_insert(handle_, stream.entry);
+        stream.active = false;
+        return status_t::success;
     }
 
     template <typename... Ts>
@@ -2219,14 +3827,42 @@ namespace rocsparseio
     inline status_t read_sparse_csx(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_csx(handle_->f, ts_...);
+        return fread_sparse_csx(handle_->f, handle_->parallel_io, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t read_sparse_csx_slab_range(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fread_sparse_csx_slab_range(handle_->f, handle_->parallel_io, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t read_sparse_csx_slab(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fread_sparse_csx_slab(handle_->f, handle_->parallel_io, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t map_sparse_csx(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fmap_sparse_csx(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_coo(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_coo(handle_->f, ts_...);
+        ROCSPARSEIO_CHECK(write_encoded_header(handle_));
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_coo(handle_->f,
+                                     handle_->parallel_io,
+                                     handle_->index_codec,
+                                     handle_->value_codec,
+                                     ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2240,14 +3876,23 @@ namespace rocsparseio
     inline status_t read_sparse_coo(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_coo(handle_->f, ts_...);
+        return fread_sparse_coo(handle_->f, handle_->parallel_io, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t map_sparse_coo(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fmap_sparse_coo(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_hyb(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_hyb(handle_->f, ts_...);
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_hyb(handle_->f, handle_->parallel_io, ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2261,14 +3906,21 @@ namespace rocsparseio
     inline status_t read_sparse_hyb(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_hyb(handle_->f, ts_...);
+        return fread_sparse_hyb(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_gebsx(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_gebsx(handle_->f, ts_...);
+        ROCSPARSEIO_CHECK(write_encoded_header(handle_));
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_gebsx(handle_->f,
+                                       handle_->parallel_io,
+                                       handle_->index_codec,
+                                       handle_->value_codec,
+                                       ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2282,14 +3934,28 @@ namespace rocsparseio
     inline status_t read_sparse_gebsx(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_gebsx(handle_->f, ts_...);
+        return fread_sparse_gebsx(handle_->f, handle_->parallel_io, ts_...);
+    }
+
+    template <typename... Ts>
+    inline status_t map_sparse_gebsx(rocsparseio_handle handle_, Ts&&... ts_)
+    {
+        ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
+        return fmap_sparse_gebsx(handle_->f, handle_->parallel_io, ts_...);
+    }
+
+    inline status_t unmap(rocsparseio_map map_)
+    {
+        return funmap(map_);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_ell(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_ell(handle_->f, ts_...);
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_ell(handle_->f, handle_->parallel_io, ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2303,14 +3969,16 @@ namespace rocsparseio
     inline status_t read_sparse_ell(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_ell(handle_->f, ts_...);
+        return fread_sparse_ell(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_dia(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_dia(handle_->f, ts_...);
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_dia(handle_->f, handle_->parallel_io, ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2324,14 +3992,16 @@ namespace rocsparseio
     inline status_t read_sparse_dia(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_dia(handle_->f, ts_...);
+        return fread_sparse_dia(handle_->f, handle_->parallel_io, ts_...);
     }
 
     template <typename... Ts>
     inline status_t write_sparse_mcsx(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fwrite_sparse_mcsx(handle_->f, ts_...);
+        return write_object(handle_, [&]() {
+            return fwrite_sparse_mcsx(handle_->f, handle_->parallel_io, ts_...);
+        });
     }
 
     template <typename... Ts>
@@ -2345,7 +4015,7 @@ namespace rocsparseio
     inline status_t read_sparse_mcsx(rocsparseio_handle handle_, Ts&&... ts_)
     {
         ROCSPARSEIO_CHECK_ARG(!handle_, status_t::invalid_handle);
-        return fread_sparse_mcsx(handle_->f, ts_...);
+        return fread_sparse_mcsx(handle_->f, handle_->parallel_io, ts_...);
     }
 
 } // namespace rocsparseio
@@ -0,0 +1,320 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparseio_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+rocsparseio_stream_statistics_csx::rocsparseio_stream_statistics_csx(rocsparseio_direction dir_,
+                                                                     uint64_t              M_,
+                                                                     uint64_t              N_)
+    : K((dir_ == rocsparseio_direction_row) ? M_ : N_)
+    , M(M_)
+    , N(N_)
+    , is_row(dir_ == rocsparseio_direction_row)
+{
+}
+
+uint64_t rocsparseio_stream_statistics_csx::hash(uint64_t a_, uint64_t b_)
+{
+    uint64_t h = a_ * 0x9e3779b97f4a7c15ULL ^ b_;
+    h          = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h          = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+}
+
+void rocsparseio_stream_statistics_csx::sample(uint64_t i_, uint64_t j_)
+{
+    const uint64_t mask = (uint64_t(1) << sample_level) - 1;
+    const uint64_t h    = hash(std::min(i_, j_), std::max(i_, j_));
+    if((h & mask) != 0)
+    {
+        return;
+    }
+
+    ((i_ < j_) ? upper_samples : lower_samples).insert(h);
+    if(upper_samples.size() + lower_samples.size() > max_samples)
+    {
+        ++sample_level;
+        const uint64_t new_mask = (uint64_t(1) << sample_level) - 1;
+        for(auto* samples : {&upper_samples, &lower_samples})
+        {
+            for(auto it = samples->begin(); it != samples->end();)
+            {
+                it = ((*it & new_mask) != 0) ? samples->erase(it) : std::next(it);
+            }
+        }
+    }
+}
+
+template <typename J>
+void rocsparseio_stream_statistics_csx::add(uint64_t               k_,
+                                            const J*               ind_,
+                                            uint64_t               n_,
+                                            rocsparseio_index_base base_)
+{
+    nnz += n_;
+    min_nnz = std::min(min_nnz, n_);
+    max_nnz = std::max(max_nnz, n_);
+    sum_nnz2 += double(n_) * double(n_);
+    ++histogram[(n_ == 0) ? 0 : 64 - __builtin_clzll(n_)];
+
+    uint64_t min_ind = k_;
+    for(uint64_t l = 0; l < n_; ++l)
+    {
+        const uint64_t j = ind_[l] - base_;
+        const uint64_t r = is_row ? k_ : j;
+        const uint64_t c = is_row ? j : k_;
+        min_ind          = std::min(min_ind, j);
+        if(r > c)
+        {
+            lower_bandwidth = std::max(lower_bandwidth, r - c);
+        }
+        else if(r < c)
+        {
+            upper_bandwidth = std::max(upper_bandwidth, c - r);
+        }
+
+        if(j == k_)
+        {
+            ++ndiag;
+        }
+        else if(M == N)
+        {
+            sample(r, c);
+        }
+
+        for(uint64_t b = min_block_dim; b <= max_block_dim; ++b)
+        {
+            block_ind[b].push_back(j / b);
+        }
+    }
+    profile += k_ - min_ind;
+
+    for(uint64_t b = min_block_dim; b <= max_block_dim; ++b)
+    {
+        if((k_ + 1) % b == 0 || k_ + 1 == K)
+        {
+            std::sort(block_ind[b].begin(), block_ind[b].end());
+            nnzb[b] += std::unique(block_ind[b].begin(), block_ind[b].end())
+                       - block_ind[b].begin();
+            block_ind[b].clear();
+        }
+    }
+}
+
+template void rocsparseio_stream_statistics_csx::add(uint64_t               k_,
+                                                     const int32_t*         ind_,
+                                                     uint64_t               n_,
+                                                     rocsparseio_index_base base_);
+template void rocsparseio_stream_statistics_csx::add(uint64_t               k_,
+                                                     const int64_t*         ind_,
+                                                     uint64_t               n_,
+                                                     rocsparseio_index_base base_);
+
+double rocsparseio_stream_statistics_csx::mean() const
+{
+    return (K > 0) ? double(nnz) / K : 0.0;
+}
+
+double rocsparseio_stream_statistics_csx::stddev() const
+{
+    const double m = this->mean();
+    return (K > 0) ? std::sqrt(std::max(0.0, sum_nnz2 / K - m * m)) : 0.0;
+}
+
+double rocsparseio_stream_statistics_csx::symmetry() const
+{
+    uint64_t matched = 0;
+    for(uint64_t h : upper_samples)
+    {
+        matched += lower_samples.count(h);
+    }
+    const uint64_t nsamples = upper_samples.size() + lower_samples.size();
+    return (nsamples > 0) ? 100.0 * 2 * matched / nsamples : 100.0;
+}
+
+double rocsparseio_stream_statistics_csx::fill(uint64_t b) const
+{
+    return (nnzb[b] > 0) ? double(nnz) / (double(nnzb[b]) * b * b) : 0.0;
+}
+
+void rocsparseio_stream_statistics_csx::print() const
+{
+    const char* seq = is_row ? "row" : "column";
+    std::cout << "nnz per " << seq << std::endl;
+    std::cout << "  min      : " << ((K > 0) ? min_nnz : 0) << std::endl;
+    std::cout << "  max      : " << max_nnz << std::endl;
+    std::cout << "  mean     : " << mean() << std::endl;
+    std::cout << "  stddev   : " << stddev() << std::endl;
+    std::cout << "histogram of nnz per " << seq << std::endl;
+    for(int i = 0; i < nbins; ++i)
+    {
+        if(histogram[i] > 0)
+        {
+            const uint64_t lo = (i == 0) ? 0 : uint64_t(1) << (i - 1);
+            const uint64_t hi = (i == 0) ? 0 : (lo << 1) - 1;
+            std::cout << "  [" << lo << ", " << hi << "] : " << histogram[i] << std::endl;
+        }
+    }
+    std::cout << "bandwidth  : lower " << lower_bandwidth << ", upper " << upper_bandwidth
+              << std::endl;
+    std::cout << "profile    : " << profile << std::endl;
+    std::cout << "diagonal   : " << ndiag << " / " << std::min(M, N)
+              << ((ndiag == std::min(M, N)) ? " (full)" : "") << std::endl;
+    if(M == N)
+    {
+        std::cout << "symmetry   : " << symmetry()
+                  << "% of the off-diagonal pattern (estimated on 1/"
+                  << (uint64_t(1) << sample_level) << " of the entries)" << std::endl;
+    }
+    std::cout << "block fill" << std::endl;
+    for(uint64_t b = min_block_dim; b <= max_block_dim; ++b)
+    {
+        std::cout << "  " << b << "x" << b << ((b < 10) ? "      " : "    ") << ": nnzb "
+                  << nnzb[b] << ", fill " << fill(b) << std::endl;
+    }
+}
+
+template <typename I, typename J>
+static rocsparseio_status
+    rocsparseio_csx_stream_statistics_template(rocsparseio_handle                 handle,
+                                               uint64_t                           val_type_size,
+                                               rocsparseio_index_base             base,
+                                               uint64_t                           slab_nnz,
+                                               rocsparseio_stream_statistics_csx& stats)
+{
+    std::vector<I>    ptr;
+    std::vector<J>    ind;
+    std::vector<char> val;
+    for(uint64_t first = 0; first < stats.K;)
+    {
+        //
+        // The number of sequences of a slab is bounded as well, for sparse enough matrices.
+        //
+        uint64_t           last, nnz;
+        rocsparseio_status status
+            = rocsparseiox_read_sparse_csx_slab_range(handle, first, slab_nnz, &last, &nnz);
+        if(status != rocsparseio_status_success)
+        {
+            return status;
+        }
+        last = std::min(last, first + std::max(slab_nnz, uint64_t(1)));
+
+        ptr.resize(last - first + 1);
+        ind.resize(nnz);
+        val.resize(nnz * val_type_size);
+        status = rocsparseiox_read_sparse_csx_slab(
+            handle, first, last, ptr.data(), ind.data(), val.data());
+        if(status != rocsparseio_status_success)
+        {
+            return status;
+        }
+
+        for(uint64_t k = first; k < last; ++k)
+        {
+            stats.add(k,
+                      ind.data() + (ptr[k - first] - ptr[0]),
+                      ptr[k + 1 - first] - ptr[k - first],
+                      base);
+        }
+        first = last;
+    }
+
+    return rocsparseio_status_success;
+}
+
+template <typename I, typename... P>
+static rocsparseio_status rocsparseio_csx_stream_statistics_ind_type(rocsparseio_type ind_type,
+                                                                     P&&... params)
+{
+    switch(ind_type)
+    {
+    case rocsparseio_type_int32:
+    {
+        return rocsparseio_csx_stream_statistics_template<I, int32_t>(params...);
+    }
+    case rocsparseio_type_int64:
+    {
+        return rocsparseio_csx_stream_statistics_template<I, int64_t>(params...);
+    }
+    case rocsparseio_type_int8:
+    case rocsparseio_type_float32:
+    case rocsparseio_type_float64:
+    case rocsparseio_type_complex32:
+    case rocsparseio_type_complex64:
+    {
+        return rocsparseio_status_invalid_value;
+    }
+    }
+    return rocsparseio_status_invalid_enum;
+}
+
+template <typename... P>
+static rocsparseio_status
+    rocsparseio_csx_stream_statistics_dynamic_dispatch(rocsparseio_type ptr_type,
+                                                       rocsparseio_type ind_type,
+                                                       P&&... params)
+{
+    switch(ptr_type)
+    {
+    case rocsparseio_type_int32:
+    {
+        return rocsparseio_csx_stream_statistics_ind_type<int32_t>(ind_type, params...);
+    }
+    case rocsparseio_type_int64:
+    {
+        return rocsparseio_csx_stream_statistics_ind_type<int64_t>(ind_type, params...);
+    }
+    case rocsparseio_type_int8:
+    case rocsparseio_type_float32:
+    case rocsparseio_type_float64:
+    case rocsparseio_type_complex32:
+    case rocsparseio_type_complex64:
+    {
+        return rocsparseio_status_invalid_value;
+    }
+    }
+    return rocsparseio_status_invalid_enum;
+}
+
+rocsparseio_status rocsparseio_csx_stream_statistics(rocsparseio_handle                 handle,
+                                                     rocsparseio_type                   ptr_type,
+                                                     rocsparseio_type                   ind_type,
+                                                     rocsparseio_type                   val_type,
+                                                     rocsparseio_index_base             base,
+                                                     uint64_t                           slab_nnz,
+                                                     rocsparseio_stream_statistics_csx& stats)
+{
+    uint64_t           val_type_size;
+    rocsparseio_status status = rocsparseio_type_get_size(val_type, &val_type_size);
+    if(status != rocsparseio_status_success)
+    {
+        return status;
+    }
+
+    return rocsparseio_csx_stream_statistics_dynamic_dispatch(
+        ptr_type, ind_type, handle, val_type_size, base, slab_nnz, stats);
+}
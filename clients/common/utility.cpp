@@ -156,3 +156,12 @@ double get_time_us_sync(hipStream_t stream)
         = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
     return (static_cast<double>(duration));
 };
+
+uint32_t rocsparse_get_warp_size()
+{
+    int             dev;
+    hipDeviceProp_t prop;
+    CHECK_HIP_THROW_ERROR(hipGetDevice(&dev));
+    CHECK_HIP_THROW_ERROR(hipGetDeviceProperties(&prop, dev));
+    return prop.warpSize;
+}
@@ -146,6 +146,7 @@ struct Arguments
 
     bool graph_test;
     bool skip_reproducibility;
+    bool host_timing;
 
     char filename[128];
     char function[64];
@@ -282,6 +283,7 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(tolm);
         ROCSPARSE_FORMAT_CHECK(graph_test);
         ROCSPARSE_FORMAT_CHECK(skip_reproducibility);
+        ROCSPARSE_FORMAT_CHECK(host_timing);
         ROCSPARSE_FORMAT_CHECK(filename);
         ROCSPARSE_FORMAT_CHECK(function);
         ROCSPARSE_FORMAT_CHECK(name);
@@ -493,6 +495,7 @@ private:
         print("tolm", arg.tolm);
         print("graph_test", arg.graph_test);
         print("skip_reproducibility", arg.skip_reproducibility);
+        print("host_timing", arg.host_timing);
         print("name", arg.name);
         print("category", arg.category);
         print("hardware", arg.hardware);
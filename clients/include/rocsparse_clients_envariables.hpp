@@ -43,10 +43,13 @@ struct rocsparse_clients_envariables
     typedef enum var_bool_ : int32_t
     {
         VERBOSE,
-        TEST_DEBUG_ARGUMENTS
+        TEST_DEBUG_ARGUMENTS,
+        MATRICES_CACHE,
+        MATRICES_SIDECAR
     } var_bool;
 
-    static constexpr var_bool s_var_bool_all[] = {VERBOSE, TEST_DEBUG_ARGUMENTS};
+    static constexpr var_bool s_var_bool_all[]
+        = {VERBOSE, TEST_DEBUG_ARGUMENTS, MATRICES_CACHE, MATRICES_SIDECAR};
 
     ///
     /// @brief Return value of a Boolean variable.
@@ -79,10 +82,12 @@ struct rocsparse_clients_envariables
     typedef enum var_string_ : int32_t
     {
         MATRICES_DIR,
-        TEST_DATA_DIR
+        TEST_DATA_DIR,
+        MATRICES_CACHE_SIZE
     } var_string;
 
-    static constexpr var_string s_var_string_all[2] = {MATRICES_DIR, TEST_DATA_DIR};
+    static constexpr var_string s_var_string_all[3]
+        = {MATRICES_DIR, TEST_DATA_DIR, MATRICES_CACHE_SIZE};
 
     ///
     /// @brief Return value of a string variable.
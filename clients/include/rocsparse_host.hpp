@@ -26,15 +26,45 @@
 #ifndef ROCSPARSE_HOST_HPP
 #define ROCSPARSE_HOST_HPP
 
-#include "rocsparse_test.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_traits.hpp"
 
-#include <hip/hip_runtime_api.h>
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+/*! \brief Level schedule of a sparse triangular matrix.
+ *  \details
+ *  Rows are grouped into levels such that all rows of a level only depend on rows of
+ *  previous levels. Rows of level \p l are stored in \p level_ind
+ *  [\p level_ptr[l], \p level_ptr[l + 1]). The schedule only depends on the sparsity
+ *  pattern and can be reused for multiple triangular solves.
+ */
+template <typename J>
+struct host_trm_info
+{
+    std::vector<J> level_ptr;
+    std::vector<J> level_ind;
+};
+
+/*! \brief Symbolic result of a host sparse matrix-matrix multiplication.
+ *  \details
+ *  Filled by host_csrgemm_nnz and consumed by host_csrgemm, such that the numeric phase
+ *  neither repeats the merge of the sparsity patterns nor the load balancing.
+ *  \p row_work holds the exclusive scan of the number of intermediate products per row
+ *  and \p csr_col_ind the zero-based, sorted column indices of C.
+ */
+template <typename I, typename J>
+struct host_csrgemm_info
+{
+    std::vector<int64_t> row_work;
+    std::vector<J>       csr_col_ind;
+};
+
 template <typename T, typename I, typename J>
 struct rocsparse_host
 {
@@ -276,6 +306,11 @@ void host_coomv_aos(rocsparse_operation  trans,
                     Y*                   y,
                     rocsparse_index_base base);
 
+/*! \details
+ *  host_csrmv, host_cscmv, host_csrsv, host_coosv, host_csrsm and host_coosm reproduce the
+ *  summation order of the device kernels, which depends on the wavefront size \p warp_size
+ *  of the device the computation is compared against.
+ */
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_csrmv(rocsparse_operation   trans,
                 J                     M,
@@ -291,7 +326,8 @@ void host_csrmv(rocsparse_operation   trans,
                 rocsparse_index_base  base,
                 rocsparse_matrix_type matrix_type,
                 rocsparse_spmv_alg    algo,
-                bool                  force_conj);
+                bool                  force_conj,
+                uint32_t              warp_size);
 
 template <typename T, typename I, typename J, typename A, typename X, typename Y>
 void host_cscmv(rocsparse_operation trans,
@@ -307,7 +343,17 @@ void host_cscmv(rocsparse_operation trans,
                 Y* __restrict y,
                 rocsparse_index_base  base,
                 rocsparse_matrix_type matrix_type,
-                rocsparse_spmv_alg    algo);
+                rocsparse_spmv_alg    algo,
+                uint32_t              warp_size);
+
+template <typename I, typename J>
+void host_csrsv_analysis(rocsparse_operation  trans,
+                         J                    M,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         rocsparse_fill_mode  fill_mode,
+                         rocsparse_index_base base,
+                         host_trm_info<J>*    info);
 
 template <typename I, typename J, typename T>
 void host_csrsv(rocsparse_operation  trans,
@@ -324,7 +370,27 @@ void host_csrsv(rocsparse_operation  trans,
                 rocsparse_fill_mode  fill_mode,
                 rocsparse_index_base base,
                 J*                   struct_pivot,
-                J*                   numeric_pivot);
+                J*                   numeric_pivot,
+                uint32_t             warp_size);
+
+template <typename I, typename J, typename T>
+void host_csrsv(rocsparse_operation     trans,
+                J                       M,
+                I                       nnz,
+                T                       alpha,
+                const I*                csr_row_ptr,
+                const J*                csr_col_ind,
+                const T*                csr_val,
+                const T*                x,
+                int64_t                 x_inc,
+                T*                      y,
+                rocsparse_diag_type     diag_type,
+                rocsparse_fill_mode     fill_mode,
+                rocsparse_index_base    base,
+                J*                      struct_pivot,
+                J*                      numeric_pivot,
+                const host_trm_info<J>& info,
+                uint32_t                warp_size);
 
 template <typename I, typename T>
 void host_coosv(rocsparse_operation  trans,
@@ -340,7 +406,8 @@ void host_coosv(rocsparse_operation  trans,
                 rocsparse_fill_mode  fill_mode,
                 rocsparse_index_base base,
                 I*                   struct_pivot,
-                I*                   numeric_pivot);
+                I*                   numeric_pivot,
+                uint32_t             warp_size);
 
 template <typename T, typename I, typename A, typename X, typename Y>
 void host_ellmv(rocsparse_operation  trans,
@@ -408,47 +475,131 @@ void host_gemvi(I                    M,
  * ===========================================================================
  */
 template <typename T>
-void host_bsrmm(rocsparse_handle          handle,
-                rocsparse_direction       dir,
-                rocsparse_operation       trans_A,
-                rocsparse_operation       trans_B,
-                rocsparse_int             mb,
-                rocsparse_int             n,
-                rocsparse_int             kb,
-                rocsparse_int             nnzb,
-                const T*                  alpha,
-                const rocsparse_mat_descr descr,
-                const T*                  bsr_val,
-                const rocsparse_int*      bsr_row_ptr,
-                const rocsparse_int*      bsr_col_ind,
-                rocsparse_int             block_dim,
-                const T*                  B,
-                int64_t                   ldb,
-                const T*                  beta,
-                T*                        C,
-                int64_t                   ldc);
+void host_bsrmm(rocsparse_direction  dir,
+                rocsparse_operation  trans_A,
+                rocsparse_operation  trans_B,
+                rocsparse_int        mb,
+                rocsparse_int        n,
+                rocsparse_int        kb,
+                rocsparse_int        nnzb,
+                const T*             alpha,
+                rocsparse_index_base base,
+                const T*             bsr_val,
+                const rocsparse_int* bsr_row_ptr,
+                const rocsparse_int* bsr_col_ind,
+                rocsparse_int        block_dim,
+                const T*             B,
+                int64_t              ldb,
+                const T*             beta,
+                T*                   C,
+                int64_t              ldc);
+
+template <typename T>
+void host_gebsrmm(rocsparse_direction  dir,
+                  rocsparse_operation  trans_A,
+                  rocsparse_operation  trans_B,
+                  rocsparse_int        mb,
+                  rocsparse_int        n,
+                  rocsparse_int        kb,
+                  rocsparse_int        nnzb,
+                  const T*             alpha,
+                  rocsparse_index_base base,
+                  const T*             bsr_val,
+                  const rocsparse_int* bsr_row_ptr,
+                  const rocsparse_int* bsr_col_ind,
+                  rocsparse_int        row_block_dim,
+                  rocsparse_int        col_block_dim,
+                  const T*             B,
+                  int64_t              ldb,
+                  const T*             beta,
+                  T*                   C,
+                  int64_t              ldc);
 
+// Convenience overloads taking the same arguments as rocsparse_(ge)bsrmm. They are
+// header-only, so that the host reference library does not depend on librocsparse.
 template <typename T>
-void host_gebsrmm(rocsparse_handle          handle,
-                  rocsparse_direction       dir,
-                  rocsparse_operation       trans_A,
-                  rocsparse_operation       trans_B,
-                  rocsparse_int             mb,
-                  rocsparse_int             n,
-                  rocsparse_int             kb,
-                  rocsparse_int             nnzb,
-                  const T*                  alpha,
-                  const rocsparse_mat_descr descr,
-                  const T*                  bsr_val,
-                  const rocsparse_int*      bsr_row_ptr,
-                  const rocsparse_int*      bsr_col_ind,
-                  rocsparse_int             row_block_dim,
-                  rocsparse_int             col_block_dim,
-                  const T*                  B,
-                  int64_t                   ldb,
-                  const T*                  beta,
-                  T*                        C,
-                  int64_t                   ldc);
+inline void host_bsrmm(rocsparse_handle          handle,
+                       rocsparse_direction       dir,
+                       rocsparse_operation       trans_A,
+                       rocsparse_operation       trans_B,
+                       rocsparse_int             mb,
+                       rocsparse_int             n,
+                       rocsparse_int             kb,
+                       rocsparse_int             nnzb,
+                       const T*                  alpha,
+                       const rocsparse_mat_descr descr,
+                       const T*                  bsr_val,
+                       const rocsparse_int*      bsr_row_ptr,
+                       const rocsparse_int*      bsr_col_ind,
+                       rocsparse_int             block_dim,
+                       const T*                  B,
+                       int64_t                   ldb,
+                       const T*                  beta,
+                       T*                        C,
+                       int64_t                   ldc)
+{
+    host_bsrmm(dir,
+               trans_A,
+               trans_B,
+               mb,
+               n,
+               kb,
+               nnzb,
+               alpha,
+               rocsparse_get_mat_index_base(descr),
+               bsr_val,
+               bsr_row_ptr,
+               bsr_col_ind,
+               block_dim,
+               B,
+               ldb,
+               beta,
+               C,
+               ldc);
+}
+
+template <typename T>
+inline void host_gebsrmm(rocsparse_handle          handle,
+                         rocsparse_direction       dir,
+                         rocsparse_operation       trans_A,
+                         rocsparse_operation       trans_B,
+                         rocsparse_int             mb,
+                         rocsparse_int             n,
+                         rocsparse_int             kb,
+                         rocsparse_int             nnzb,
+                         const T*                  alpha,
+                         const rocsparse_mat_descr descr,
+                         const T*                  bsr_val,
+                         const rocsparse_int*      bsr_row_ptr,
+                         const rocsparse_int*      bsr_col_ind,
+                         rocsparse_int             row_block_dim,
+                         rocsparse_int             col_block_dim,
+                         const T*                  B,
+                         int64_t                   ldb,
+                         const T*                  beta,
+                         T*                        C,
+                         int64_t                   ldc)
+{
+    host_gebsrmm(dir,
+                 trans_A,
+                 trans_B,
+                 mb,
+                 n,
+                 kb,
+                 nnzb,
+                 alpha,
+                 rocsparse_get_mat_index_base(descr),
+                 bsr_val,
+                 bsr_row_ptr,
+                 bsr_col_ind,
+                 row_block_dim,
+                 col_block_dim,
+                 B,
+                 ldb,
+                 beta,
+                 C,
+                 ldc);
+}
 
 template <typename T, typename I, typename J, typename A, typename B, typename C>
 void host_csrmm(J                    M,
@@ -605,7 +756,29 @@ void host_csrsm(J                    M,
                 rocsparse_fill_mode  fill_mode,
                 rocsparse_index_base base,
                 J*                   struct_pivot,
-                J*                   numeric_pivot);
+                J*                   numeric_pivot,
+                uint32_t             warp_size);
+
+template <typename I, typename J, typename T>
+void host_csrsm(J                       M,
+                J                       nrhs,
+                I                       nnz,
+                rocsparse_operation     transA,
+                rocsparse_operation     transB,
+                T                       alpha,
+                const I*                csr_row_ptr,
+                const J*                csr_col_ind,
+                const T*                csr_val,
+                T*                      B,
+                int64_t                 ldb,
+                rocsparse_order         order_B,
+                rocsparse_diag_type     diag_type,
+                rocsparse_fill_mode     fill_mode,
+                rocsparse_index_base    base,
+                J*                      struct_pivot,
+                J*                      numeric_pivot,
+                const host_trm_info<J>& info,
+                uint32_t                warp_size);
 
 template <typename I, typename T>
 void host_coosm(I                    M,
@@ -624,7 +797,8 @@ void host_coosm(I                    M,
                 rocsparse_fill_mode  fill_mode,
                 rocsparse_index_base base,
                 I*                   struct_pivot,
-                I*                   numeric_pivot);
+                I*                   numeric_pivot,
+                uint32_t             warp_size);
 
 template <typename T>
 void host_bsrsm(rocsparse_int       mb,
@@ -803,6 +977,26 @@ void host_csrgemm_nnz(J                    M,
                       rocsparse_index_base base_C,
                       rocsparse_index_base base_D);
 
+template <typename T, typename I, typename J>
+void host_csrgemm_nnz(J                        M,
+                      J                        N,
+                      J                        K,
+                      const T*                 alpha,
+                      const I*                 csr_row_ptr_A,
+                      const J*                 csr_col_ind_A,
+                      const I*                 csr_row_ptr_B,
+                      const J*                 csr_col_ind_B,
+                      const T*                 beta,
+                      const I*                 csr_row_ptr_D,
+                      const J*                 csr_col_ind_D,
+                      I*                       csr_row_ptr_C,
+                      I*                       nnz_C,
+                      rocsparse_index_base     base_A,
+                      rocsparse_index_base     base_B,
+                      rocsparse_index_base     base_C,
+                      rocsparse_index_base     base_D,
+                      host_csrgemm_info<I, J>* info);
+
 template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
 void host_csrgemm(J                    M,
                   J                    N,
@@ -826,6 +1020,30 @@ void host_csrgemm(J                    M,
                   rocsparse_index_base base_C,
                   rocsparse_index_base base_D);
 
+template <typename T, typename I, typename J>
+void host_csrgemm(J                              M,
+                  J                              N,
+                  J                              L,
+                  const T*                       alpha,
+                  const I*                       csr_row_ptr_A,
+                  const J*                       csr_col_ind_A,
+                  const T*                       csr_val_A,
+                  const I*                       csr_row_ptr_B,
+                  const J*                       csr_col_ind_B,
+                  const T*                       csr_val_B,
+                  const T*                       beta,
+                  const I*                       csr_row_ptr_D,
+                  const J*                       csr_col_ind_D,
+                  const T*                       csr_val_D,
+                  const I*                       csr_row_ptr_C,
+                  J*                             csr_col_ind_C,
+                  T*                             csr_val_C,
+                  rocsparse_index_base           base_A,
+                  rocsparse_index_base           base_B,
+                  rocsparse_index_base           base_C,
+                  rocsparse_index_base           base_D,
+                  const host_csrgemm_info<I, J>& info);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -881,6 +1099,20 @@ void host_csrilu0(rocsparse_int                     M,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T, typename I, typename J>
+rocsparse_status host_csritilu0(rocsparse_itilu0_alg alg,
+                                J                    options,
+                                J*                   nmaxiter,
+                                floating_data_t<T>   tol,
+                                J                    M,
+                                I                    nnz,
+                                const I*             csr_row_ptr,
+                                const J*             csr_col_ind,
+                                const T*             csr_val,
+                                T*                   ilu0,
+                                rocsparse_index_base base,
+                                floating_data_t<T>*  history = nullptr);
+
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
@@ -909,6 +1141,26 @@ void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg algo,
                                  rocsparse_int                  batch_count,
                                  rocsparse_int                  batch_stride);
 
+// Interleaved batched solvers working on a caller provided temporary buffer, such that
+// repeated solves do not allocate. The buffer must hold at least the number of bytes
+// returned by the corresponding buffer size query.
+template <typename T>
+void host_gtsv_interleaved_batch_buffer_size(rocsparse_gtsv_interleaved_alg algo,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  batch_count,
+                                             size_t*                        buffer_size);
+
+template <typename T>
+void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg algo,
+                                 rocsparse_int                  m,
+                                 const T*                       dl,
+                                 const T*                       d,
+                                 const T*                       du,
+                                 T*                             x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride,
+                                 void*                          temp_buffer);
+
 template <typename T>
 void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg algo,
                                  rocsparse_int                  m,
@@ -921,6 +1173,25 @@ void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg algo,
                                  rocsparse_int                  batch_count,
                                  rocsparse_int                  batch_stride);
 
+template <typename T>
+void host_gpsv_interleaved_batch_buffer_size(rocsparse_gpsv_interleaved_alg algo,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  batch_count,
+                                             size_t*                        buffer_size);
+
+template <typename T>
+void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg algo,
+                                 rocsparse_int                  m,
+                                 T*                             ds,
+                                 T*                             dl,
+                                 T*                             d,
+                                 T*                             du,
+                                 T*                             dw,
+                                 T*                             x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride,
+                                 void*                          temp_buffer);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
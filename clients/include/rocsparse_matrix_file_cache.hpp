@@ -0,0 +1,75 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_MATRIX_FILE_CACHE_HPP
+#define ROCSPARSE_MATRIX_FILE_CACHE_HPP
+
+#include <rocsparse.h>
+
+#include <string>
+#include <vector>
+
+//
+// On-disk cache of the matrices imported from files.
+//
+// The first import of a file is stored in the rocsparseio format in the directory
+// .rocsparseio_cache of the matrices directory. A cached matrix is identified by the path, size
+// and modification time of the file, and by the value and index types. Later imports map the
+// cached binary file instead of parsing the file again.
+//
+// The cache is enabled with ROCSPARSE_CLIENTS_MATRICES_CACHE=1. Its size is bounded by
+// ROCSPARSE_CLIENTS_MATRICES_CACHE_SIZE, in MB, the least recently used matrices being
+// removed first.
+//
+struct rocsparse_matrix_file_cache
+{
+    //
+    // \brief Load a CSR matrix imported from the file source, return false if it is not cached.
+    //
+    template <typename T, typename I, typename J>
+    static bool load(const std::string&   source,
+                     std::vector<I>&      ptr,
+                     std::vector<J>&      ind,
+                     std::vector<T>&      val,
+                     J&                   M,
+                     J&                   N,
+                     I&                   nnz,
+                     rocsparse_index_base base);
+
+    //
+    // \brief Store a CSR matrix imported from the file source, failures are ignored.
+    //
+    template <typename T, typename I, typename J>
+    static void store(const std::string&    source,
+                      const std::vector<I>& ptr,
+                      const std::vector<J>& ind,
+                      const std::vector<T>& val,
+                      J                     M,
+                      J                     N,
+                      I                     nnz,
+                      rocsparse_index_base  base);
+};
+
+#endif // ROCSPARSE_MATRIX_FILE_CACHE_HPP
@@ -29,6 +29,11 @@
 
 #define ROCSPARSEIO_VERSION_MAJOR 1
 
+//
+// Version of the files containing encoded arrays, so they are rejected by older readers.
+//
+#define ROCSPARSEIO_VERSION_MAJOR_ENCODED 2
+
 #include <stddef.h>
 #include <stdint.h>
 
@@ -75,6 +80,7 @@ typedef rocsparseio_enum_t rocsparseio_direction_t;
 typedef rocsparseio_enum_t rocsparseio_type_t;
 typedef rocsparseio_enum_t rocsparseio_format_t;
 typedef rocsparseio_enum_t rocsparseio_index_base_t;
+typedef rocsparseio_enum_t rocsparseio_codec_t;
 
 /*! \ingroup types_module
  *  \brief Enumerates status.
@@ -93,6 +99,7 @@ typedef rocsparseio_enum_t rocsparseio_index_base_t;
 
 #define ROCSPARSEIO_RWMODE_READ 0
 #define ROCSPARSEIO_RWMODE_WRITE 1
+#define ROCSPARSEIO_RWMODE_APPEND 2
 
 #define ROCSPARSEIO_ORDER_ROW 0
 #define ROCSPARSEIO_ORDER_COLUMN 1
@@ -121,6 +128,11 @@ typedef rocsparseio_enum_t rocsparseio_index_base_t;
 #define ROCSPARSEIO_FORMAT_SPARSE_HYB 7
 #define ROCSPARSEIO_FORMAT_SPARSE_MCSX 8
 
+#define ROCSPARSEIO_CODEC_NONE 0
+#define ROCSPARSEIO_CODEC_DELTA_VARBYTE 1
+#define ROCSPARSEIO_CODEC_DELTA_BITPACK 2
+#define ROCSPARSEIO_CODEC_BYTE_SHUFFLE 3
+
 typedef enum rocsparseio_index_base_
 {
     rocsparseio_index_base_zero = 0,
@@ -129,8 +141,9 @@ typedef enum rocsparseio_index_base_
 
 typedef enum rocsparseio_rwmode_
 {
-    rocsparseio_rwmode_read  = ROCSPARSEIO_RWMODE_READ,
-    rocsparseio_rwmode_write = ROCSPARSEIO_RWMODE_WRITE
+    rocsparseio_rwmode_read   = ROCSPARSEIO_RWMODE_READ,
+    rocsparseio_rwmode_write  = ROCSPARSEIO_RWMODE_WRITE,
+    rocsparseio_rwmode_append = ROCSPARSEIO_RWMODE_APPEND
 } rocsparseio_rwmode;
 
 typedef enum rocsparseio_type_
@@ -169,6 +182,24 @@ typedef enum rocsparseio_order_
     rocsparseio_order_column = 1
 } rocsparseio_order;
 
+/*! \ingroup types_module
+ *  \brief Enumerates array codecs.
+ *
+ *  \details
+ *  - \ref rocsparseio_codec_delta_varbyte and \ref rocsparseio_codec_delta_bitpack encode
+ *  the differences between consecutive integers, either with a variable number of bytes or
+ *  with a fixed number of bits per block of elements. They apply to integer arrays.
+ *  - \ref rocsparseio_codec_byte_shuffle groups the bytes of the elements by significance
+ *  and encodes runs of identical bytes. It applies to any array.
+ */
+typedef enum rocsparseio_codec_
+{
+    rocsparseio_codec_none          = ROCSPARSEIO_CODEC_NONE,
+    rocsparseio_codec_delta_varbyte = ROCSPARSEIO_CODEC_DELTA_VARBYTE,
+    rocsparseio_codec_delta_bitpack = ROCSPARSEIO_CODEC_DELTA_BITPACK,
+    rocsparseio_codec_byte_shuffle  = ROCSPARSEIO_CODEC_BYTE_SHUFFLE
+} rocsparseio_codec;
+
 /*! \ingroup types_module
  *  \brief Enumerates status.
  */
@@ -192,6 +223,11 @@ typedef enum rocsparseio_status_
 //
 typedef struct _rocsparseio_handle* rocsparseio_handle;
 
+//
+// Opaque structure.
+//
+typedef struct _rocsparseio_map* rocsparseio_map;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -204,6 +240,13 @@ extern "C" {
 //! @retval rocsparseio_status_invalid_handle \p p_handle is a null pointer.
 //! @retval rocsparseio_status_invalid_value \p mode is invalid
 //! @retval rocsparseio_status_invalid_pointer \p filename is a null pointer.
+//! @retval rocsparseio_status_invalid_format \p mode is \ref rocsparseio_rwmode_append and the
+//! file has no table of contents.
+//! @note
+//! - Files are written with a table of contents listing their objects, which allows random
+//! access with \ref rocsparseio_find_object and \ref rocsparseio_seek_object.
+//! - \ref rocsparseio_rwmode_append opens an existing file for writing additional objects,
+//! its table of contents is extended when the handle is closed.
 
 rocsparseio_status rocsparseio_open(rocsparseio_handle* p_handle,
                                     rocsparseio_rwmode  mode,
@@ -217,6 +260,58 @@ rocsparseio_status rocsparseio_open(rocsparseio_handle* p_handle,
 
 rocsparseio_status rocsparseio_close(rocsparseio_handle handle);
 
+//! @brief Set the codecs used to encode the arrays of the sparse objects to be written.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] index_codec codec of the arrays of offsets and indices.
+//! @param[in] value_codec codec of the arrays of values.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_mode \p handle is not opened for writing.
+//! @retval rocsparseio_status_invalid_value \p index_codec or \p value_codec is invalid, or
+//! \p value_codec is a delta codec.
+//! @note
+//! - The codecs apply to the csr/csc, gebsr/gebsc and coo objects, the other objects are
+//! written without encoding.
+//! - A file containing encoded arrays is flagged with \ref ROCSPARSEIO_VERSION_MAJOR_ENCODED
+//! and cannot be opened by readers which do not support encoded arrays.
+rocsparseio_status rocsparseio_set_codec(rocsparseio_handle handle,
+                                         rocsparseio_codec  index_codec,
+                                         rocsparseio_codec  value_codec);
+
+//! @brief Configure the parallel transfers of large arrays of the handle.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] nthreads number of threads transferring chunks of an array concurrently.
+//! @param[in] chunk_size size in bytes of the chunks, rounded down to a multiple of 4096.
+//! @param[in] direct if non zero, use O_DIRECT for the chunks aligned in the file.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_value \p nthreads is zero.
+//! @retval rocsparseio_status_invalid_size \p chunk_size is smaller than 4096.
+//! @note
+//! - The configuration applies to the transfers of the handle only.
+//! - Arrays of at least two chunks are transferred with pread/pwrite, the others through the
+//! buffered stream of the handle. O_DIRECT is ignored where it is not supported.
+//! - The defaults of a new handle are read from the environment variables
+//! ROCSPARSEIO_IO_THREADS and ROCSPARSEIO_IO_DIRECT.
+rocsparseio_status rocsparseio_set_parallel_io(rocsparseio_handle handle,
+                                               uint64_t           nthreads,
+                                               uint64_t           chunk_size,
+                                               int                direct);
+
+//! @brief Get the configuration of the parallel transfers of large arrays of the handle.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[out] nthreads number of threads transferring chunks of an array concurrently.
+//! @param[out] chunk_size size in bytes of the chunks.
+//! @param[out] direct non zero if O_DIRECT is used.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_pointer \p nthreads, \p chunk_size or \p direct is a
+//! null pointer.
+rocsparseio_status rocsparseio_get_parallel_io(rocsparseio_handle handle,
+                                               uint64_t*          nthreads,
+                                               uint64_t*          chunk_size,
+                                               int*               direct);
+
 //! @brief Get the description of a \ref rocsparseio_status.
 //! @param[in] handle pointer to the rocsparseio handle.
 //! @param[in] status status to get the description from.
@@ -245,6 +340,56 @@ rocsparseio_status rocsparseio_read_name(rocsparseio_handle handle, rocsparseio_
 
 rocsparseio_status rocsparseio_read_format(rocsparseio_handle handle, rocsparseio_format* format);
 
+//! @brief Get the number of objects listed in the table of contents.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[out] nobjects number of objects.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_pointer \p nobjects is a null pointer.
+//! @note
+//! - Files written without a table of contents report zero objects.
+rocsparseio_status rocsparseio_get_num_objects(rocsparseio_handle handle, uint64_t* nobjects);
+
+//! @brief Get the description of an object listed in the table of contents.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] index index of the object.
+//! @param[out] name name of the object.
+//! @param[out] format format of the object.
+//! @param[out] nbytes size in bytes of the object in the file.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_pointer \p name, \p format or \p nbytes is a null pointer.
+//! @retval rocsparseio_status_invalid_value \p index is out of range.
+rocsparseio_status rocsparseio_get_object(rocsparseio_handle  handle,
+                                          uint64_t            index,
+                                          rocsparseio_string  name,
+                                          rocsparseio_format* format,
+                                          uint64_t*           nbytes);
+
+//! @brief Find an object by name in the table of contents.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] name name of the object.
+//! @param[out] index index of the object.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_pointer \p name or \p index is a null pointer.
+//! @retval rocsparseio_status_invalid_value no object is named \p name.
+//! @note
+//! - If several objects have the same name, the last written one is found.
+rocsparseio_status
+    rocsparseio_find_object(rocsparseio_handle handle, const char* name, uint64_t* index);
+
+//! @brief Position the handle at the beginning of an object.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] index index of the object in the table of contents.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_handle \p handle is a null pointer.
+//! @retval rocsparseio_status_invalid_mode \p handle is not opened for reading.
+//! @retval rocsparseio_status_invalid_value \p index is out of range.
+//! @note
+//! - The next read operations apply to the object, e.g. \ref rocsparseio_read_format.
+rocsparseio_status rocsparseio_seek_object(rocsparseio_handle handle, uint64_t index);
+
 //! @brief Size in byte of a given \ref rocsparseio_type.
 //! @param[in] type
 //! @param[out] size
@@ -394,6 +539,57 @@ rocsparseio_status rocsparseio_write_sparse_csx(rocsparseio_handle     handle,
                                                 const char*            name,
                                                 ...);
 
+//! @brief Begin the streaming write of a sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] dir indicates if the matrix is using a Compressed Sparse Row or
+//! Column storage.
+//! @param[in] m number of rows.
+//! @param[in] n number of columns.
+//! @param[in] nnz number of non-zeros.
+//! @param[in] ptr_type type of elements of the array \p ptr.
+//! @param[in] ptr array of offsets.
+//! @param[in] ind_type type of elements of the indices.
+//! @param[in] val_type type of elements of the values.
+//! @param[in] base index base used in arrays \p ptr and of the indices.
+//! @param[in] name flexible C-printf style name.
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_mode \p handle is not opened for writing, a codec is
+//! set, or a streaming write is already in progress.
+//! @note
+//! - The indices and the values are then written in order by batches with
+//! \ref rocsparseiox_write_sparse_csx_stream, and the write is completed with
+//! \ref rocsparseiox_write_sparse_csx_stream_end.
+rocsparseio_status rocsparseiox_write_sparse_csx_stream_begin(rocsparseio_handle     handle,
+                                                              rocsparseio_direction  dir,
+                                                              uint64_t               m,
+                                                              uint64_t               n,
+                                                              uint64_t               nnz,
+                                                              rocsparseio_type       ptr_type,
+                                                              const void*            ptr,
+                                                              rocsparseio_type       ind_type,
+                                                              rocsparseio_type       val_type,
+                                                              rocsparseio_index_base base,
+                                                              const char*            name,
+                                                              ...);
+
+//! @brief Write the next batch of indices and values of a streamed sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] count number of non-zeros of the batch.
+//! @param[in] ind array of \p count column/row indices.
+//! @param[in] val array of \p count values.
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_size the batch exceeds the number of non-zeros.
+rocsparseio_status rocsparseiox_write_sparse_csx_stream(rocsparseio_handle handle,
+                                                        uint64_t           count,
+                                                        const void*        ind,
+                                                        const void*        val);
+
+//! @brief Complete the streaming write of a sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @retval rocsparseio_status
+//! @retval rocsparseio_status_invalid_size fewer non-zeros than declared have been written.
+rocsparseio_status rocsparseiox_write_sparse_csx_stream_end(rocsparseio_handle handle);
+
 //! @brief Read a sparse csr/csc matrix.
 //! @param[in] handle pointer to the rocsparseio handle.
 //! @param[out] name name of the matrix.
@@ -458,6 +654,62 @@ rocsparseio_status rocsparseiox_read_metadata_sparse_csx(rocsparseio_handle
 rocsparseio_status
     rocsparseiox_read_sparse_csx(rocsparseio_handle handle, void* ptr, void* ind, void* data);
 
+//! @brief Find the largest slab of rows (or columns) of a sparse csr/csc matrix starting
+//! at a given row (or column) with a bounded number of non-zeros.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] first first row (or column) of the slab.
+//! @param[in] nnz_max maximum number of non-zeros of the slab.
+//! @param[out] last the slab is [first, last).
+//! @param[out] nnz number of non-zeros of the slab.
+//! @retval rocsparseio_status
+//! @note
+//! - A slab contains at least one row (or column), even if it has more than \p nnz_max
+//! non-zeros.
+//! - Only the stored offsets are read, the position of the handle is not modified.
+rocsparseio_status rocsparseiox_read_sparse_csx_slab_range(rocsparseio_handle handle,
+                                                           uint64_t           first,
+                                                           uint64_t           nnz_max,
+                                                           uint64_t*          last,
+                                                           uint64_t*          nnz);
+
+//! @brief Read a slab of rows (or columns) of a sparse csr/csc matrix.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[in] first first row (or column) of the slab.
+//! @param[in] last the slab is [first, last).
+//! @param[out] ptr array of the \p last - \p first + 1 offsets to fill.
+//! @param[out] ind array of column/row indices of the slab to fill.
+//! @param[out] val array of values of the slab to fill.
+//! @retval rocsparseio_status
+//! @note
+//! - The offsets are the stored offsets, i.e. they are relative to the whole matrix, and
+//! \p ind and \p val are of size ptr[last - first] - ptr[0].
+//! - The position of the handle is not modified, slabs can be read in any order.
+rocsparseio_status rocsparseiox_read_sparse_csx_slab(rocsparseio_handle handle,
+                                                     uint64_t           first,
+                                                     uint64_t           last,
+                                                     void*              ptr,
+                                                     void*              ind,
+                                                     void*              val);
+
+//! @brief Map sparse csr/csc matrix data arrays.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[out] p_map pointer to the mapping to be created.
+//! @param[out] ptr array of offsets.
+//! @param[out] ind array of column/row indices.
+//! @param[out] val array of values.
+//! @retval rocsparseio_status
+//! @note
+//! - The arrays point directly into the memory-mapped file, an array is only copied if its
+//! data is not aligned with respect to its type.
+//! - The arrays remain valid until \ref rocsparseiox_unmap is called, even if the handle is
+//! closed before.
+//! - It is expected \ref rocsparseiox_read_metadata_sparse_csx to be called before.
+rocsparseio_status rocsparseiox_map_sparse_csx(rocsparseio_handle handle,
+                                               rocsparseio_map*   p_map,
+                                               const void**       ptr,
+                                               const void**       ind,
+                                               const void**       val);
+
 //! @brief Write a sparse modified csr/csc matrix.
 //! @param[in] handle pointer to the rocsparseio handle.
 //! @param[in] dir indicates if the matrix is using a Modified Compressed Sparse Row or
@@ -666,6 +918,22 @@ rocsparseio_status rocsparseiox_read_metadata_sparse_gebsx(rocsparseio_handle
 rocsparseio_status
     rocsparseiox_read_sparse_gebsx(rocsparseio_handle handle, void* ptr, void* ind, void* val);
 
+//! @brief Map sparse gebsr/gebsc matrix data arrays.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[out] p_map pointer to the mapping to be created.
+//! @param[out] ptr array of offsets.
+//! @param[out] ind array of column/row indices.
+//! @param[out] val array of values.
+//! @retval rocsparseio_status
+//! @note
+//! - The arrays remain valid until \ref rocsparseiox_unmap is called.
+//! - It is expected \ref rocsparseiox_read_metadata_sparse_gebsx to be called before.
+rocsparseio_status rocsparseiox_map_sparse_gebsx(rocsparseio_handle handle,
+                                                 rocsparseio_map*   p_map,
+                                                 const void**       ptr,
+                                                 const void**       ind,
+                                                 const void**       val);
+
 //! @brief Write a sparse matrix with coordinates format.
 //! @param[in] handle pointer to the rocsparseio handle.
 //! @param[in] m number of rows.
@@ -754,6 +1022,28 @@ rocsparseio_status rocsparseiox_read_sparse_coo(rocsparseio_handle handle,
                                                 void*              col_ind,
                                                 void*              val);
 
+//! @brief Map a sparse matrix with coordinates format.
+//! @param[in] handle pointer to the rocsparseio handle.
+//! @param[out] p_map pointer to the mapping to be created.
+//! @param[out] row_ind array of row indices.
+//! @param[out] col_ind array of column indices.
+//! @param[out] val     array of values.
+//! @retval rocsparseio_status
+//! @note
+//! - The arrays remain valid until \ref rocsparseiox_unmap is called.
+//! - It is expected \ref rocsparseiox_read_metadata_sparse_coo to be called before.
+rocsparseio_status rocsparseiox_map_sparse_coo(rocsparseio_handle handle,
+                                               rocsparseio_map*   p_map,
+                                               const void**       row_ind,
+                                               const void**       col_ind,
+                                               const void**       val);
+
+//! @brief Release a mapping created by one of the rocsparseiox_map routines.
+//! @param[in] map the mapping.
+//! @retval rocsparseio_status_success the operation completed successfully.
+//! @retval rocsparseio_status_invalid_pointer \p map is a null pointer.
+rocsparseio_status rocsparseiox_unmap(rocsparseio_map map);
+
 //! @brief Write a sparse ell matrix.
 //! @param[in] handle pointer to the rocsparseio handle.
 //! @param[out] name name of the matrix.
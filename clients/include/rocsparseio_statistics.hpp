@@ -0,0 +1,116 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSEIO_STATISTICS_HPP
+#define ROCSPARSEIO_STATISTICS_HPP
+
+#include "rocsparseio.h"
+
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+//
+// Statistics of a csr/csc matrix computed while streaming it by slabs of sequences (rows or
+// columns), in memory bounded by the size of a slab and of the symmetry sample.
+//
+struct rocsparseio_stream_statistics_csx
+{
+    static constexpr uint64_t min_block_dim = 2;
+    static constexpr uint64_t max_block_dim = 16;
+    static constexpr uint64_t max_samples   = 1 << 20;
+    static constexpr int      nbins         = 65;
+
+    uint64_t K{};
+    uint64_t M{};
+    uint64_t N{};
+    bool     is_row{};
+
+    uint64_t nnz{};
+    uint64_t min_nnz{std::numeric_limits<uint64_t>::max()};
+    uint64_t max_nnz{};
+    double   sum_nnz2{};
+    uint64_t histogram[nbins]{};
+
+    uint64_t lower_bandwidth{};
+    uint64_t upper_bandwidth{};
+    uint64_t profile{};
+    uint64_t ndiag{};
+
+    //
+    // The symmetry is estimated on the off-diagonal entries whose hash of {i, j} is a multiple
+    // of 2^sample_level, so an entry and its transpose are sampled together.
+    //
+    int                          sample_level{};
+    std::unordered_set<uint64_t> upper_samples{};
+    std::unordered_set<uint64_t> lower_samples{};
+
+    uint64_t             nnzb[max_block_dim + 1]{};
+    std::vector<int64_t> block_ind[max_block_dim + 1]{};
+
+    rocsparseio_stream_statistics_csx(rocsparseio_direction dir_, uint64_t M_, uint64_t N_);
+
+    //
+    // \brief Add the indices of sequence k_, sequences are added in order.
+    //
+    template <typename J>
+    void add(uint64_t k_, const J* ind_, uint64_t n_, rocsparseio_index_base base_);
+
+    //
+    // \brief Mean and standard deviation of the number of non-zeros per sequence.
+    //
+    double mean() const;
+    double stddev() const;
+
+    //
+    // \brief Estimated percentage of the off-diagonal entries whose transpose is present.
+    //
+    double symmetry() const;
+
+    //
+    // \brief Fill ratio of the blocks of dimension b.
+    //
+    double fill(uint64_t b) const;
+
+    void print() const;
+
+private:
+    static uint64_t hash(uint64_t a_, uint64_t b_);
+    void            sample(uint64_t i_, uint64_t j_);
+};
+
+//
+// \brief Compute the statistics of the csr/csc matrix the handle is positioned at, once its
+// metadata are read, holding at most slab_nnz non-zeros at a time.
+//
+rocsparseio_status rocsparseio_csx_stream_statistics(rocsparseio_handle                 handle,
+                                                     rocsparseio_type                   ptr_type,
+                                                     rocsparseio_type                   ind_type,
+                                                     rocsparseio_type                   val_type,
+                                                     rocsparseio_index_base             base,
+                                                     uint64_t                           slab_nnz,
+                                                     rocsparseio_stream_statistics_csx& stats);
+
+#endif // ROCSPARSEIO_STATISTICS_HPP
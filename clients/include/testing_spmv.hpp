@@ -172,7 +172,8 @@ struct testing_spmv_dispatch_traits<rocsparse_format_csr, I, J, A, X, Y, T>
                                      hA.base,
                                      matrix_type,
                                      alg,
-                                     false);
+                                     false,
+                                     rocsparse_get_warp_size());
     }
 
     static double gflop_count(host_sparse_matrix<A>& hA, bool nonzero_beta)
@@ -248,7 +249,8 @@ struct testing_spmv_dispatch_traits<rocsparse_format_csc, I, J, A, X, Y, T>
                                      hy,
                                      hA.base,
                                      matrix_type,
-                                     alg);
+                                     alg,
+                                     rocsparse_get_warp_size());
     }
 
     static double gflop_count(host_sparse_matrix<A>& hA, bool nonzero_beta)
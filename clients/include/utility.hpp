@@ -841,6 +841,10 @@ double get_time_us(void);
  */
 double get_time_us_sync(hipStream_t stream);
 
+/*! \brief Return the wavefront size of the current device, the host reference kernels
+ *  reproducing the device summation order take it as a parameter */
+uint32_t rocsparse_get_warp_size();
+
 /*! \brief Return path of this executable */
 std::string rocsparse_exepath();
 
@@ -0,0 +1,364 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include <algorithm>
+
+template <typename T>
+void testing_analysis_cache_bad_arg(const Arguments& arg)
+{
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle handle = local_handle;
+    size_t           max_size{};
+    int64_t          hits{};
+    int64_t          misses{};
+    size_t           size{};
+
+    // Test rocsparse_set_analysis_cache_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_analysis_cache_size(nullptr, max_size),
+                            rocsparse_status_invalid_handle);
+
+    // Test rocsparse_get_analysis_cache_info()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_analysis_cache_info(nullptr, &hits, &misses, &size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_analysis_cache_info(handle, nullptr, &misses, &size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_analysis_cache_info(handle, &hits, nullptr, &size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_analysis_cache_info(handle, &hits, &misses, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // The cache is disabled by default
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_analysis_cache_info(handle, &hits, &misses, &size));
+    unit_check_scalar<int64_t>(0, hits);
+    unit_check_scalar<int64_t>(0, misses);
+    unit_check_scalar<size_t>(0, size);
+
+    // Disabling a disabled cache is valid
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 1 << 20));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+}
+
+// csrmv with the adaptive algorithm, y = A * x
+template <typename T>
+static void testing_analysis_cache_csrmv(rocsparse_handle              handle,
+                                         const rocsparse_mat_descr     descr,
+                                         const device_csr_matrix<T>&   dA,
+                                         const device_dense_matrix<T>& dx,
+                                         device_dense_matrix<T>&       dy)
+{
+    rocsparse_local_mat_info info;
+
+    const T h_alpha = static_cast<T>(1);
+    const T h_beta  = static_cast<T>(0);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      dA.m,
+                                                      dA.n,
+                                                      dA.nnz,
+                                                      descr,
+                                                      dA.val,
+                                                      dA.ptr,
+                                                      dA.ind,
+                                                      info));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                             rocsparse_operation_none,
+                                             dA.m,
+                                             dA.n,
+                                             dA.nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dA.val,
+                                             dA.ptr,
+                                             dA.ind,
+                                             info,
+                                             dx,
+                                             &h_beta,
+                                             dy));
+}
+
+// Upper triangular solve, op(A) * y = x
+template <typename T>
+static void testing_analysis_cache_csrsv(rocsparse_handle              handle,
+                                         const rocsparse_mat_descr     descr,
+                                         const device_csr_matrix<T>&   dA,
+                                         const device_dense_matrix<T>& dx,
+                                         device_dense_matrix<T>&       dy,
+                                         rocsparse_int*                pivot)
+{
+    rocsparse_local_mat_info info;
+
+    const T h_alpha = static_cast<T>(1);
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         dA.m,
+                                                         dA.nnz,
+                                                         descr,
+                                                         dA.val,
+                                                         dA.ptr,
+                                                         dA.ind,
+                                                         info,
+                                                         &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      dA.m,
+                                                      dA.nnz,
+                                                      descr,
+                                                      dA.val,
+                                                      dA.ptr,
+                                                      dA.ind,
+                                                      info,
+                                                      rocsparse_analysis_policy_force,
+                                                      rocsparse_solve_policy_auto,
+                                                      dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                   rocsparse_operation_none,
+                                                   dA.m,
+                                                   dA.nnz,
+                                                   &h_alpha,
+                                                   descr,
+                                                   dA.val,
+                                                   dA.ptr,
+                                                   dA.ind,
+                                                   info,
+                                                   dx,
+                                                   dy,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+
+    auto st = rocsparse_csrsv_zero_pivot(handle, descr, info, pivot);
+    EXPECT_ROCSPARSE_STATUS(
+        st, (*pivot != -1) ? rocsparse_status_zero_pivot : rocsparse_status_success);
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+// Incomplete LU factorization of dLU in place
+template <typename T>
+static void testing_analysis_cache_csrilu0(rocsparse_handle          handle,
+                                           const rocsparse_mat_descr descr,
+                                           device_csr_matrix<T>&     dLU,
+                                           rocsparse_int*            pivot)
+{
+    rocsparse_local_mat_info info;
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(
+        handle, dLU.m, dLU.nnz, descr, dLU.val, dLU.ptr, dLU.ind, info, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(rocsparse_hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        dLU.m,
+                                                        dLU.nnz,
+                                                        descr,
+                                                        dLU.val,
+                                                        dLU.ptr,
+                                                        dLU.ind,
+                                                        info,
+                                                        rocsparse_analysis_policy_force,
+                                                        rocsparse_solve_policy_auto,
+                                                        dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0<T>(handle,
+                                               dLU.m,
+                                               dLU.nnz,
+                                               descr,
+                                               dLU.val,
+                                               dLU.ptr,
+                                               dLU.ind,
+                                               info,
+                                               rocsparse_solve_policy_auto,
+                                               dbuffer));
+
+    auto st = rocsparse_csrilu0_zero_pivot(handle, info, pivot);
+    EXPECT_ROCSPARSE_STATUS(
+        st, (*pivot != -1) ? rocsparse_status_zero_pivot : rocsparse_status_success);
+
+    CHECK_HIP_ERROR(rocsparse_hipFree(dbuffer));
+}
+
+// Check the hits, misses and that device memory is held if and only if
+// the cache is enabled
+static void testing_analysis_cache_check_info(rocsparse_handle handle,
+                                              int64_t          expected_hits,
+                                              int64_t          expected_misses,
+                                              bool             expected_empty)
+{
+    int64_t hits;
+    int64_t misses;
+    size_t  size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_analysis_cache_info(handle, &hits, &misses, &size));
+    unit_check_scalar<int64_t>(expected_hits, hits);
+    unit_check_scalar<int64_t>(expected_misses, misses);
+    unit_check_scalar<int32_t>(expected_empty, size == 0);
+}
+
+template <typename T>
+void testing_analysis_cache(const Arguments& arg)
+{
+    static constexpr size_t max_size = size_t(1) << 30;
+
+    const auto tol = get_near_check_tol<T>(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_int        N    = arg.N;
+    rocsparse_index_base base = arg.baseA;
+
+    // Sample a square matrix with a full diagonal, such that the triangular
+    // analyses apply
+    host_csr_matrix<T> hA;
+    {
+        static constexpr bool       to_int    = true;
+        static constexpr bool       full_rank = true;
+        rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    if(hA.m != hA.n || hA.nnz == 0)
+    {
+        return;
+    }
+
+    // Same matrix with its rows in reverse order, which has the same sizes but
+    // usually another sparsity pattern
+    host_csr_matrix<T> hB(hA.m, hA.n, hA.nnz, base);
+    hB.ptr[0] = base;
+    for(rocsparse_int i = 0; i < hA.m; ++i)
+    {
+        const rocsparse_int row   = hA.m - 1 - i;
+        const rocsparse_int begin = hA.ptr[row] - base;
+        const rocsparse_int count = hA.ptr[row + 1] - hA.ptr[row];
+        for(rocsparse_int k = 0; k < count; ++k)
+        {
+            hB.ind[hB.ptr[i] - base + k] = hA.ind[begin + k];
+            hB.val[hB.ptr[i] - base + k] = hA.val[begin + k];
+        }
+        hB.ptr[i + 1] = hB.ptr[i] + count;
+    }
+
+    const bool same_pattern
+        = std::equal(hA.ptr.data(), hA.ptr.data() + hA.ptr.size(), hB.ptr.data())
+          && std::equal(hA.ind.data(), hA.ind.data() + hA.ind.size(), hB.ind.data());
+
+    host_dense_matrix<T> hx(hA.m, 1);
+    rocsparse_matrix_utils::init(hx);
+    device_dense_matrix<T> dx(hx);
+
+    rocsparse_local_handle handle(arg);
+
+    rocsparse_local_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // The upper fill mode keeps the csrsv and csrilu0 analyses apart
+    rocsparse_local_mat_descr descr_upper;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_upper, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_upper, rocsparse_fill_mode_upper));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Results with the cache disabled
+    device_csr_matrix<T>   dA(hA), dB(hB), dLU(hA);
+    device_dense_matrix<T> dy_csrmv(hA.m, 1), dy_csrmv_B(hA.m, 1), dy_csrsv(hA.m, 1);
+    rocsparse_int          csrsv_pivot;
+    rocsparse_int          csrilu0_pivot;
+
+    testing_analysis_cache_csrmv<T>(handle, descr, dA, dx, dy_csrmv);
+    testing_analysis_cache_csrmv<T>(handle, descr, dB, dx, dy_csrmv_B);
+    testing_analysis_cache_csrsv<T>(handle, descr_upper, dA, dx, dy_csrsv, &csrsv_pivot);
+    testing_analysis_cache_csrilu0<T>(handle, descr, dLU, &csrilu0_pivot);
+    testing_analysis_cache_check_info(handle, 0, 0, true);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, max_size));
+
+    // First with the cache enabled, each analysis misses, then the same sparsity
+    // pattern at other addresses hits
+    for(int64_t cached_hits = 0; cached_hits <= 3; cached_hits += 3)
+    {
+        device_csr_matrix<T>   dA_cached(hA), dLU_cached(hA);
+        device_dense_matrix<T> dy(hA.m, 1);
+        rocsparse_int          pivot;
+
+        testing_analysis_cache_csrmv<T>(handle, descr, dA_cached, dx, dy);
+        dy_csrmv.near_check(dy, tol);
+
+        testing_analysis_cache_csrsv<T>(handle, descr_upper, dA_cached, dx, dy, &pivot);
+        unit_check_scalar<rocsparse_int>(csrsv_pivot, pivot);
+        if(csrsv_pivot == -1)
+        {
+            dy_csrsv.near_check(dy, tol);
+        }
+
+        testing_analysis_cache_csrilu0<T>(handle, descr, dLU_cached, &pivot);
+        unit_check_scalar<rocsparse_int>(csrilu0_pivot, pivot);
+        if(csrilu0_pivot == -1)
+        {
+            dLU.near_check(dLU_cached, tol);
+        }
+
+        testing_analysis_cache_check_info(handle, cached_hits, 3, false);
+    }
+
+    // Same sizes, another sparsity pattern
+    const int64_t hits   = same_pattern ? 4 : 3;
+    const int64_t misses = same_pattern ? 3 : 4;
+    {
+        device_dense_matrix<T> dy(hA.m, 1);
+        testing_analysis_cache_csrmv<T>(handle, descr, dB, dx, dy);
+        dy_csrmv_B.near_check(dy, tol);
+
+        testing_analysis_cache_check_info(handle, hits, misses, false);
+    }
+
+    // Disabling the cache releases its memory, the statistics are kept
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_analysis_cache_size(handle, 0));
+    testing_analysis_cache_check_info(handle, hits, misses, true);
+
+    {
+        device_dense_matrix<T> dy(hA.m, 1);
+        testing_analysis_cache_csrmv<T>(handle, descr, dA, dx, dy);
+        dy_csrmv.near_check(dy, tol);
+
+        testing_analysis_cache_check_info(handle, hits, misses, true);
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_analysis_cache_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_analysis_cache<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+void testing_analysis_cache_extra(const Arguments& arg) {}
@@ -126,7 +126,61 @@ void testing_csr2csc(const Arguments& arg)
         }
     }
 
-    if(arg.timing)
+    if(arg.timing && arg.host_timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Time the host reference implementation
+        host_csc_matrix<T> hC_host(M, N, nnz, base);
+
+        auto host_csr2csc = [&]() {
+            host_csr_to_csc(M,
+                            N,
+                            nnz,
+                            hA.ptr.data(),
+                            hA.ind.data(),
+                            hA.val.data(),
+                            hC_host.ind,
+                            hC_host.ptr,
+                            hC_host.val,
+                            action,
+                            base);
+        };
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            host_csr2csc();
+        }
+
+        double host_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            host_csr2csc();
+        }
+
+        host_time_used = (get_time_us() - host_time_used) / number_hot_calls;
+
+        double gbyte_count = csr2csc_gbyte_count<T>(M, N, nnz, action);
+        double host_gbyte  = get_gpu_gbyte(host_time_used, gbyte_count);
+
+        display_timing_info(display_key_t::M,
+                            M,
+                            display_key_t::N,
+                            N,
+                            display_key_t::nnz,
+                            nnz,
+                            display_key_t::action,
+                            rocsparse_action2string(action),
+                            display_key_t::bandwidth,
+                            host_gbyte,
+                            display_key_t::time_ms,
+                            get_gpu_time_msec(host_time_used));
+    }
+    else if(arg.timing)
     {
         int number_cold_calls = 2;
         int number_hot_calls  = arg.iters;
@@ -630,7 +630,8 @@ void testing_csrgemm(const Arguments& arg)
         // Host calculation.
         //
         {
-            rocsparse_int out_nnz;
+            rocsparse_int                                   out_nnz;
+            host_csrgemm_info<rocsparse_int, rocsparse_int> info;
 
             host_csrgemm_nnz<T, rocsparse_int, rocsparse_int>(h_A.m,
                                                               h_C.n,
@@ -648,7 +649,8 @@ void testing_csrgemm(const Arguments& arg)
                                                               h_A.base,
                                                               h_B.base,
                                                               h_C.base,
-                                                              h_D.base);
+                                                              h_D.base,
+                                                              &info);
 
             h_C.define(h_C.m, h_C.n, out_nnz, h_C.base);
 
@@ -672,7 +674,8 @@ void testing_csrgemm(const Arguments& arg)
                                                           h_A.base,
                                                           h_B.base,
                                                           h_C.base,
-                                                          h_D.base);
+                                                          h_D.base,
+                                                          info);
         }
 
         {
@@ -713,7 +713,8 @@ void testing_csrgemm_reuse(const Arguments& arg)
         // Host calculation.
         //
         {
-            rocsparse_int out_nnz;
+            rocsparse_int                                   out_nnz;
+            host_csrgemm_info<rocsparse_int, rocsparse_int> info;
 
             host_csrgemm_nnz<T, rocsparse_int, rocsparse_int>(h_A.m,
                                                               h_C.n,
@@ -731,7 +732,8 @@ void testing_csrgemm_reuse(const Arguments& arg)
                                                               h_A.base,
                                                               h_B.base,
                                                               h_C.base,
-                                                              h_D.base);
+                                                              h_D.base,
+                                                              &info);
 
             h_C.define(h_C.m, h_C.n, out_nnz, h_C.base);
 
@@ -755,7 +757,8 @@ void testing_csrgemm_reuse(const Arguments& arg)
                                                           h_A.base,
                                                           h_B.base,
                                                           h_C.base,
-                                                          h_D.base);
+                                                          h_D.base,
+                                                          info);
         }
 
         {
@@ -261,7 +261,8 @@ void testing_csricsv(const Arguments& arg)
                                                 rocsparse_fill_mode_lower,
                                                 base,
                                                 h_struct_pivot_gold,
-                                                h_numeric_pivot_L_gold);
+                                                h_numeric_pivot_L_gold,
+                                                rocsparse_get_warp_size());
     host_csrsv<rocsparse_int, rocsparse_int, T>(rocsparse_operation_transpose,
                                                 M,
                                                 nnz,
@@ -276,7 +277,8 @@ void testing_csricsv(const Arguments& arg)
                                                 rocsparse_fill_mode_lower,
                                                 base,
                                                 h_struct_pivot_gold,
-                                                h_numeric_pivot_LT_gold);
+                                                h_numeric_pivot_LT_gold,
+                                                rocsparse_get_warp_size());
 
     // Obtain csrsv buffer sizes
     size_t buffer_size_l;
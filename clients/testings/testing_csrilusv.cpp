@@ -266,7 +266,8 @@ void testing_csrilusv(const Arguments& arg)
                                                 rocsparse_fill_mode_lower,
                                                 base,
                                                 h_struct_pivot_gold,
-                                                h_numeric_pivot_L_gold);
+                                                h_numeric_pivot_L_gold,
+                                                rocsparse_get_warp_size());
     host_csrsv<rocsparse_int, rocsparse_int, T>(rocsparse_operation_none,
                                                 M,
                                                 nnz,
@@ -281,7 +282,8 @@ void testing_csrilusv(const Arguments& arg)
                                                 rocsparse_fill_mode_upper,
                                                 base,
                                                 h_struct_pivot_gold,
-                                                h_numeric_pivot_U_gold);
+                                                h_numeric_pivot_U_gold,
+                                                rocsparse_get_warp_size());
 
     // Obtain csrsv buffer sizes
     size_t buffer_size_l;
@@ -620,6 +620,31 @@ void testing_csritilu0(const Arguments& arg)
             {
                 ilu0.near_check(dA_csrilu0.val);
             }
+
+            //
+            // Compare with the host reference of the same algorithm, from the same initial guess.
+            //
+            host_vector<T> hilu0(hA.nnz, static_cast<T>(0));
+            rocsparse_int  hmaxiter = s_maxiter;
+            CHECK_ROCSPARSE_ERROR((host_csritilu0<T, rocsparse_int, rocsparse_int>(p.alg,
+                                                                                   p.options,
+                                                                                   &hmaxiter,
+                                                                                   p.tol,
+                                                                                   hA.m,
+                                                                                   hA.nnz,
+                                                                                   hA.ptr,
+                                                                                   hA.ind,
+                                                                                   hA.val,
+                                                                                   hilu0,
+                                                                                   hA.base)));
+            if(sizeof(floating_data_t<T>) == sizeof(double))
+            {
+                ilu0.near_check(hilu0, 1.0e-5);
+            }
+            else
+            {
+                ilu0.near_check(hilu0);
+            }
         }
     }
 
@@ -1046,7 +1046,8 @@ void testing_csritsv(const Arguments& arg)
                                                     uplo,
                                                     base,
                                                     h_analysis_pivot,
-                                                    h_solve_pivot);
+                                                    h_solve_pivot,
+                                                    rocsparse_get_warp_size());
 
         if(verbose)
         {
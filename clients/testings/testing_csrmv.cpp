@@ -22,6 +22,7 @@
  *
  * ************************************************************************ */
 
+#include "rocsparse_csrmv_row_blocks.hpp"
 #include "rocsparse_enum.hpp"
 #include "testing.hpp"
 
@@ -206,7 +207,8 @@ void testing_csrmv(const Arguments& arg)
                                                              base,
                                                              matrix_type,
                                                              alg,
-                                                             false);
+                                                             false,
+                                                             prop.warpSize);
 
         hy.near_check(dy, tol);
         dy = hy_copy;
@@ -285,4 +287,283 @@ INSTANTIATE(float);
 INSTANTIATE(double);
 INSTANTIATE(rocsparse_float_complex);
 INSTANTIATE(rocsparse_double_complex);
-void testing_csrmv_extra(const Arguments& arg) {}
+
+//
+// Parameters of the CSR-Adaptive row blocks of the library.
+//
+static constexpr uint32_t s_csrmv_adaptive_block_size       = 1024;
+static constexpr uint32_t s_csrmv_adaptive_block_multiplier = 3;
+static constexpr uint32_t s_csrmv_adaptive_rows_for_vector  = 1;
+static constexpr uint32_t s_csrmv_adaptive_wg_size          = 256;
+
+template <typename I, typename J>
+using testing_csrmv_row_blocks_builder
+    = rocsparse::csrmv_adaptive_row_blocks<s_csrmv_adaptive_block_size,
+                                           s_csrmv_adaptive_block_multiplier,
+                                           s_csrmv_adaptive_rows_for_vector,
+                                           s_csrmv_adaptive_wg_size,
+                                           I,
+                                           J>;
+
+static uint64_t testing_csrmv_num_threads_for_reduction(uint64_t num_rows)
+{
+    uint64_t nbits = 0;
+    for(uint64_t x = num_rows - 1; x > 0; x >>= 1)
+    {
+        ++nbits;
+    }
+    return s_csrmv_adaptive_wg_size >> nbits;
+}
+
+//
+// Serial construction of the row blocks and workgroup ids, in a single pass over the rows, the
+// reference of the library builder.
+//
+template <typename I, typename J>
+static void testing_csrmv_row_blocks_serial(I               nrow,
+                                            const I*        row_ptr,
+                                            std::vector<I>& row_blocks,
+                                            std::vector<J>& wg_ids)
+{
+    static constexpr I block_size      = static_cast<I>(s_csrmv_adaptive_block_size);
+    static constexpr I rows_for_vector = static_cast<I>(s_csrmv_adaptive_rows_for_vector);
+
+    row_blocks.assign(1, 0);
+    wg_ids.assign(1, 0);
+
+    // The workgroup id of a block is held by the entry of its first row
+    auto close_block = [&](I end, I num_rows) {
+        if(num_rows > rows_for_vector)
+        {
+            wg_ids.back() |= testing_csrmv_num_threads_for_reduction(num_rows);
+        }
+        row_blocks.push_back(end);
+        wg_ids.push_back(0);
+    };
+
+    I sum                   = 0;
+    I last_i                = 0;
+    I consecutive_long_rows = 0;
+    I i;
+    for(i = 1; i <= nrow; ++i)
+    {
+        const I row_length = row_ptr[i] - row_ptr[i - 1];
+        sum += row_length;
+
+        // Do not mix short and long rows
+        if(row_length > 128)
+        {
+            ++consecutive_long_rows;
+        }
+        else if(consecutive_long_rows > 0)
+        {
+            consecutive_long_rows = (row_length < 32) ? -1 : consecutive_long_rows + 1;
+        }
+
+        if(consecutive_long_rows == 1)
+        {
+            if(i - last_i > 1)
+            {
+                close_block(i - 1, (i - 1) - last_i);
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        else if(consecutive_long_rows == -1)
+        {
+            close_block(i - 1, (i - 1) - last_i);
+            last_i                = i - 1;
+            sum                   = row_length;
+            consecutive_long_rows = 0;
+        }
+
+        if((i - last_i == 1) && sum > block_size)
+        {
+            // csr-vector, the row is split among several workgroups
+            I num_wgs = static_cast<I>(
+                std::ceil(static_cast<double>(row_length)
+                          / (s_csrmv_adaptive_block_multiplier * s_csrmv_adaptive_block_size)));
+            num_wgs = std::min(num_wgs, static_cast<I>(INT_MAX));
+            for(I w = 1; w < num_wgs; ++w)
+            {
+                row_blocks.push_back(i - 1);
+                wg_ids.push_back(static_cast<J>(w));
+            }
+            row_blocks.push_back(i);
+            wg_ids.push_back(0);
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        else if((i - last_i > 1) && sum > block_size)
+        {
+            // csr-stream, the last row does not fit
+            --i;
+            close_block(i, i - last_i);
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+        else if(sum == block_size)
+        {
+            // csr-stream
+            close_block(i, i - last_i);
+            last_i                = i;
+            sum                   = 0;
+            consecutive_long_rows = 0;
+        }
+    }
+
+    // The last block ends with the matrix
+    if(row_blocks.back() != nrow)
+    {
+        if(nrow - last_i > rows_for_vector)
+        {
+            wg_ids.back() |= testing_csrmv_num_threads_for_reduction(i - last_i);
+        }
+        row_blocks.push_back(nrow);
+        wg_ids.push_back(0);
+    }
+}
+
+//
+// Row pointer array made of runs of empty, short, medium, long and very long rows, lengths at
+// the thresholds of the construction included.
+//
+template <typename I>
+static std::vector<I> testing_csrmv_row_blocks_row_ptr(I nrow, int very_long_length)
+{
+    static const int lengths[][2] = {{0, 0},
+                                     {0, 0},
+                                     {1, 8},
+                                     {1, 8},
+                                     {1, 8},
+                                     {24, 40},
+                                     {100, 160},
+                                     {128, 129},
+                                     {500, 1100},
+                                     {1024, 1024},
+                                     {1000, 4000}};
+    static constexpr int nkinds = sizeof(lengths) / sizeof(lengths[0]);
+
+    std::vector<I> row_ptr(nrow + 1);
+    row_ptr[0] = random_generator_exact<I>(0, 1);
+    I i        = 0;
+    while(i < nrow)
+    {
+        const int kind      = random_generator_exact<int>(0, nkinds);
+        const int very_long = (kind == nkinds);
+        const I   run       = std::min(nrow - i, random_generator_exact<I>(1, very_long ? 3 : 64));
+        const int lo        = very_long ? 1025 : lengths[kind][0];
+        const int hi        = very_long ? very_long_length : lengths[kind][1];
+        for(I r = 0; r < run; ++r, ++i)
+        {
+            row_ptr[i + 1] = row_ptr[i] + random_generator_exact<I>(lo, hi);
+        }
+    }
+    return row_ptr;
+}
+
+//
+// Compare the row blocks built at once and built from rows appended by pieces with the serial
+// construction, large constructions being split among num_threads chunks. The rows appended
+// after the first nvalid ones are the rows up to next(nvalid).
+//
+template <typename I, typename J, typename NEXT>
+static void testing_csrmv_row_blocks(const std::vector<I>& row_ptr, int num_threads, NEXT next)
+{
+    const I nrow = static_cast<I>(row_ptr.size() - 1);
+
+    std::vector<I> ref_row_blocks;
+    std::vector<J> ref_wg_ids;
+    testing_csrmv_row_blocks_serial(nrow, row_ptr.data(), ref_row_blocks, ref_wg_ids);
+
+    std::vector<I> row_blocks;
+    std::vector<J> wg_ids;
+    testing_csrmv_row_blocks_builder<I, J>(nrow, row_ptr.data(), num_threads)
+        .build(row_blocks, wg_ids);
+    unit_check_scalar<size_t>(ref_row_blocks.size(), row_blocks.size());
+    unit_check_scalar<size_t>(ref_wg_ids.size(), wg_ids.size());
+    unit_check_segments<I>(ref_row_blocks.size(), ref_row_blocks.data(), row_blocks.data());
+    unit_check_segments<J>(ref_wg_ids.size(), ref_wg_ids.data(), wg_ids.data());
+
+    testing_csrmv_row_blocks_builder<I, J> builder(nrow, row_ptr.data(), num_threads);
+    I                                      nvalid = 0;
+    while(nvalid < nrow)
+    {
+        nvalid = std::min(nrow, next(nvalid));
+        builder.append(nvalid);
+
+        // Appending the same rows again has no effect
+        builder.append(nvalid);
+    }
+    builder.finalize(row_blocks, wg_ids);
+    unit_check_scalar<size_t>(ref_row_blocks.size(), row_blocks.size());
+    unit_check_scalar<size_t>(ref_wg_ids.size(), wg_ids.size());
+    unit_check_segments<I>(ref_row_blocks.size(), ref_row_blocks.data(), row_blocks.data());
+    unit_check_segments<J>(ref_wg_ids.size(), ref_wg_ids.data(), wg_ids.data());
+}
+
+//
+// Rows appended by pieces of random sizes.
+//
+template <typename I, typename J>
+static void testing_csrmv_row_blocks(const std::vector<I>& row_ptr, int max_piece, int num_threads)
+{
+    testing_csrmv_row_blocks<I, J>(row_ptr, num_threads, [max_piece](I nvalid) {
+        return nvalid + random_generator_exact<I>(1, max_piece);
+    });
+}
+
+template <typename I, typename J>
+static void testing_csrmv_row_blocks_extra()
+{
+    // Empty matrix, empty rows
+    testing_csrmv_row_blocks<I, J>(std::vector<I>(1, 0), 1, 1);
+    testing_csrmv_row_blocks<I, J>(std::vector<I>(2, 0), 1, 1);
+    testing_csrmv_row_blocks<I, J>(std::vector<I>(1000, 0), 100, 1);
+
+    // A single very long row, split among several workgroups
+    testing_csrmv_row_blocks<I, J>(std::vector<I>{0, 1000000}, 1, 1);
+
+    // Rows of every kind, the construction is done by a single chunk
+    for(int k = 0; k < 16; ++k)
+    {
+        testing_csrmv_row_blocks<I, J>(
+            testing_csrmv_row_blocks_row_ptr<I>(random_generator_exact<I>(1, 5000), 100000),
+            random_generator_exact<int>(1, 500),
+            4);
+    }
+
+    // The construction is split in several chunks, whatever the number of cores, and the rows
+    // are appended by pieces of several chunks too
+    static constexpr I min_chunk_rows = static_cast<I>(1) << 18;
+    testing_csrmv_row_blocks<I, J>(std::vector<I>(min_chunk_rows * 4 + 1, 0), min_chunk_rows, 4);
+    for(int num_threads : {2, 3, 6})
+    {
+        testing_csrmv_row_blocks<I, J>(
+            testing_csrmv_row_blocks_row_ptr<I>(min_chunk_rows * 6 + 12345, 20000),
+            min_chunk_rows * 3,
+            num_threads);
+    }
+
+    // Rows appended as the analysis downloads the row pointer array by chunks of 2^20 entries,
+    // the rows of a chunk being appended once its last entry is known
+    static constexpr I download_chunk_size = static_cast<I>(1) << 20;
+    for(int num_threads : {1, 4})
+    {
+        testing_csrmv_row_blocks<I, J>(
+            testing_csrmv_row_blocks_row_ptr<I>(download_chunk_size * 2 + 4321, 20000),
+            num_threads,
+            [](I nvalid) {
+                return ((nvalid + 1) / download_chunk_size + 1) * download_chunk_size - 1;
+            });
+    }
+}
+
+void testing_csrmv_extra(const Arguments& arg)
+{
+    testing_csrmv_row_blocks_extra<int32_t, int32_t>();
+    testing_csrmv_row_blocks_extra<int64_t, int32_t>();
+    testing_csrmv_row_blocks_extra<int64_t, int64_t>();
+}
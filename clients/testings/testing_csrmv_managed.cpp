@@ -275,7 +275,8 @@ void testing_csrmv_managed(const Arguments& arg)
                    base,
                    rocsparse_matrix_type_general,
                    alg,
-                   false);
+                   false,
+                   prop.warpSize);
 
         near_check_segments<T>(M, &y_gold[0], y_1);
         near_check_segments<T>(M, &y_gold[0], y_2);
@@ -325,7 +325,8 @@ void testing_csrsm(const Arguments& arg)
                                                         uplo,
                                                         base,
                                                         h_analysis_pivot,
-                                                        h_solve_pivot);
+                                                        h_solve_pivot,
+                                                        rocsparse_get_warp_size());
 
             //
             // CHECK PIVOTS
@@ -242,7 +242,8 @@ void testing_csrsv(const Arguments& arg)
                                                     uplo,
                                                     base,
                                                     h_analysis_pivot,
-                                                    h_solve_pivot);
+                                                    h_solve_pivot,
+                                                    rocsparse_get_warp_size());
 
         // Pointer mode host
         {
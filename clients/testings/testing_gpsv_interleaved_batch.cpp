@@ -196,6 +196,69 @@ void testing_gpsv_interleaved_batch(const Arguments& arg)
 
         // Only check the actual relevant content
         near_check_segments<T>(m * batch_count, hx_original.data(), hresult.data());
+
+        // The host solver overwrites the matrix, and works on a buffer filled with NaN, which
+        // it must not read before writing
+        host_vector<T> hds_copy(hds);
+        host_vector<T> hdl_copy(hdl);
+        host_vector<T> hd_copy(hd);
+        host_vector<T> hdu_copy(hdu);
+        host_vector<T> hdw_copy(hdw);
+        host_vector<T> hx_copy(m * batch_stride);
+        for(rocsparse_int b = 0; b < batch_count; ++b)
+        {
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                hx_copy[batch_stride * i + b] = hx_original[batch_count * i + b];
+            }
+        }
+
+        size_t host_buffer_size;
+        host_gpsv_interleaved_batch_buffer_size<T>(alg, m, batch_count, &host_buffer_size);
+
+        host_vector<T> hbuffer((host_buffer_size + sizeof(T) - 1) / sizeof(T));
+        rocsparse_init_nan(hbuffer.data(), hbuffer.size());
+
+        host_gpsv_interleaved_batch(alg,
+                                    m,
+                                    hds_copy.data(),
+                                    hdl_copy.data(),
+                                    hd_copy.data(),
+                                    hdu_copy.data(),
+                                    hdw_copy.data(),
+                                    hx_copy.data(),
+                                    batch_count,
+                                    batch_stride,
+                                    (void*)hbuffer.data());
+
+        // verify CPU solution
+        for(rocsparse_int b = 0; b < batch_count; b++)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                T sum = hd[batch_stride * i + b] * hx_copy[batch_stride * (i - 0) + b];
+
+                sum += (i - 2 >= 0)
+                           ? hds[batch_stride * i + b] * hx_copy[batch_stride * (i - 2) + b]
+                           : static_cast<T>(0);
+                sum += (i - 1 >= 0)
+                           ? hdl[batch_stride * i + b] * hx_copy[batch_stride * (i - 1) + b]
+                           : static_cast<T>(0);
+                sum += (i + 1 < m)
+                           ? hdu[batch_stride * i + b] * hx_copy[batch_stride * (i + 1) + b]
+                           : static_cast<T>(0);
+                sum += (i + 2 < m)
+                           ? hdw[batch_stride * i + b] * hx_copy[batch_stride * (i + 2) + b]
+                           : static_cast<T>(0);
+
+                hresult[batch_count * i + b] = sum;
+            }
+        }
+
+        near_check_segments<T>(m * batch_count, hx_original.data(), hresult.data());
     }
 
     if(arg.timing)
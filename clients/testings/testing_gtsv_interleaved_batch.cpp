@@ -158,8 +158,23 @@ void testing_gtsv_interleaved_batch(const Arguments& arg)
         host_vector<T> hx_copy(hx);
         hx.transfer_from(dx);
 
-        host_gtsv_interleaved_batch(
-            alg, m, hdl.data(), hd.data(), hdu.data(), hx_copy.data(), batch_count, batch_stride);
+        // The host solver works on a buffer filled with NaN, which it must not read before
+        // writing
+        size_t host_buffer_size;
+        host_gtsv_interleaved_batch_buffer_size<T>(alg, m, batch_count, &host_buffer_size);
+
+        host_vector<T> hbuffer((host_buffer_size + sizeof(T) - 1) / sizeof(T));
+        rocsparse_init_nan(hbuffer.data(), hbuffer.size());
+
+        host_gtsv_interleaved_batch(alg,
+                                    m,
+                                    hdl.data(),
+                                    hd.data(),
+                                    hdu.data(),
+                                    hx_copy.data(),
+                                    batch_count,
+                                    batch_stride,
+                                    (void*)hbuffer.data());
 
         // Verify GPU solution
         host_vector<T> hresult = hx_original;
@@ -0,0 +1,430 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_matrix_file_cache.hpp"
+#include "testing_matrix_io_utils.hpp"
+
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparse_clients_matrices_dir.hpp"
+#include "rocsparse_matrix_file_cache.hpp"
+
+#include <sys/stat.h>
+#ifndef WIN32
+#include <dirent.h>
+#include <utime.h>
+#endif
+
+#ifndef WIN32
+//
+// Temporary matrices directory with the cache enabled, the previous configuration is restored
+// and the directory removed when going out of scope.
+//
+class testing_matrix_file_cache_dir
+{
+private:
+    std::string m_path{};
+    std::string m_matrices_dir{};
+    std::string m_cache_size{};
+    bool        m_cache{};
+
+public:
+    explicit testing_matrix_file_cache_dir(const char* cache_size_mb)
+    {
+        char name[] = "/tmp/rocsparse-cache-XXXXXX";
+        if(mkdtemp(name) != nullptr)
+        {
+            this->m_path = name;
+        }
+
+        // The matrices directory ends with a separator
+        this->m_matrices_dir = rocsparse_clients_matrices_dir_get(true);
+        if(!this->m_matrices_dir.empty())
+        {
+            this->m_matrices_dir.pop_back();
+        }
+        this->m_cache_size = rocsparse_clients_envariables::get(
+            rocsparse_clients_envariables::MATRICES_CACHE_SIZE);
+        this->m_cache
+            = rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_CACHE);
+
+        rocsparse_clients_matrices_dir_set(this->m_path.c_str());
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE_SIZE,
+                                           cache_size_mb);
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE, true);
+    }
+
+    ~testing_matrix_file_cache_dir()
+    {
+        rocsparse_clients_matrices_dir_set(this->m_matrices_dir.c_str());
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE_SIZE,
+                                           this->m_cache_size.c_str());
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE,
+                                           this->m_cache);
+
+        for(const std::string& filename : this->list(""))
+        {
+            remove(filename.c_str());
+        }
+        for(const std::string& filename : this->list("/.rocsparseio_cache"))
+        {
+            remove(filename.c_str());
+        }
+        rmdir((this->m_path + "/.rocsparseio_cache").c_str());
+        rmdir(this->m_path.c_str());
+    }
+
+    //
+    // Name of a source file of the directory.
+    //
+    std::string source(const char* name) const
+    {
+        return this->m_path + "/" + name;
+    }
+
+    //
+    // Regular files of a subdirectory, sorted by name.
+    //
+    std::vector<std::string> list(const char* subdir) const
+    {
+        std::vector<std::string> filenames;
+        const std::string        dir = this->m_path + subdir;
+        DIR*                     d   = opendir(dir.c_str());
+        if(d != nullptr)
+        {
+            for(struct dirent* e = readdir(d); e != nullptr; e = readdir(d))
+            {
+                const std::string filename = dir + "/" + e->d_name;
+                struct stat       st;
+                if(stat(filename.c_str(), &st) == 0 && S_ISREG(st.st_mode))
+                {
+                    filenames.push_back(filename);
+                }
+            }
+            closedir(d);
+        }
+        std::sort(filenames.begin(), filenames.end());
+        return filenames;
+    }
+
+    //
+    // Cached files.
+    //
+    std::vector<std::string> cached() const
+    {
+        return this->list("/.rocsparseio_cache");
+    }
+};
+
+//
+// Set the modification time of a file, relative to now.
+//
+static void testing_matrix_file_cache_set_mtime(const std::string& filename, int64_t delta)
+{
+    struct stat st;
+    ASSERT_EQ(stat(filename.c_str(), &st), 0);
+
+    struct utimbuf times;
+    times.actime  = st.st_atime;
+    times.modtime = time(nullptr) + delta;
+    ASSERT_EQ(utime(filename.c_str(), &times), 0);
+}
+
+//
+// The cached file created by the last store, given the cached files before it.
+//
+static std::string testing_matrix_file_cache_added(const testing_matrix_file_cache_dir& dir,
+                                                   const std::vector<std::string>&      before)
+{
+    for(const std::string& filename : dir.cached())
+    {
+        if(std::find(before.begin(), before.end(), filename) == before.end())
+        {
+            return filename;
+        }
+    }
+    return "";
+}
+
+//
+// Load the matrix cached for a source file.
+//
+template <typename T, typename I, typename J>
+static bool testing_matrix_file_cache_load(const std::string&              source,
+                                           testing_matrix_io_csr<T, I, J>& B,
+                                           rocsparse_index_base            base)
+{
+    B.base = base;
+    return rocsparse_matrix_file_cache::load(source, B.ptr, B.ind, B.val, B.m, B.n, B.nnz, base);
+}
+
+//
+// Store the matrix imported from a source file.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_file_cache_store(const std::string&                    source,
+                                            const testing_matrix_io_csr<T, I, J>& A)
+{
+    rocsparse_matrix_file_cache::store(source, A.ptr, A.ind, A.val, A.m, A.n, A.nnz, A.base);
+}
+
+//
+// Same matrix with another index base.
+//
+template <typename T, typename I, typename J>
+static testing_matrix_io_csr<T, I, J>
+    testing_matrix_file_cache_rebase(const testing_matrix_io_csr<T, I, J>& A,
+                                     rocsparse_index_base                  base)
+{
+    testing_matrix_io_csr<T, I, J> B = A;
+    B.base                           = base;
+    for(auto& p : B.ptr)
+    {
+        p = p - A.base + base;
+    }
+    for(auto& j : B.ind)
+    {
+        j = j - A.base + base;
+    }
+    return B;
+}
+
+//
+// Banded matrix of size m with nnz_per_row non-zeros per row, the values are shifted by shift.
+//
+static testing_matrix_io_csr<double, int32_t, int32_t>
+    testing_matrix_file_cache_banded(int32_t m, int32_t nnz_per_row, double shift)
+{
+    testing_matrix_io_csr<double, int32_t, int32_t> A;
+    A.m    = m;
+    A.n    = m;
+    A.nnz  = m * nnz_per_row;
+    A.base = rocsparse_index_base_zero;
+    A.ptr.resize(m + 1);
+    for(int32_t i = 0; i <= m; ++i)
+    {
+        A.ptr[i] = i * nnz_per_row;
+    }
+    for(int32_t i = 0; i < m; ++i)
+    {
+        for(int32_t k = 0; k < nnz_per_row; ++k)
+        {
+            A.ind.push_back((i + k) % m);
+            A.val.push_back(static_cast<double>(i) + 0.5 * k + shift);
+        }
+    }
+    return A;
+}
+#endif
+
+template <typename I, typename J, typename T>
+void testing_matrix_file_cache_bad_arg(const Arguments& arg)
+{
+#ifndef WIN32
+    testing_matrix_file_cache_dir  dir("64");
+    testing_matrix_io_csr<T, I, J> A;
+    A.init(3, 4, rocsparse_index_base_zero);
+
+    // A source file that does not exist is neither stored nor loaded
+    const std::string missing = dir.source("missing.mtx");
+    testing_matrix_file_cache_store(missing, A);
+    ASSERT_TRUE(dir.cached().empty());
+
+    testing_matrix_io_csr<T, I, J> B;
+    ASSERT_FALSE(testing_matrix_file_cache_load(missing, B, rocsparse_index_base_zero));
+
+    // Nothing is stored or loaded while the cache is disabled
+    const std::string source = dir.source("A.mtx");
+    testing_matrix_io_write_text(source.c_str(), "A");
+    rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE, false);
+    testing_matrix_file_cache_store(source, A);
+    ASSERT_TRUE(dir.cached().empty());
+
+    rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE, true);
+    testing_matrix_file_cache_store(source, A);
+    ASSERT_EQ(dir.cached().size(), size_t(1));
+    rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_CACHE, false);
+    ASSERT_FALSE(testing_matrix_file_cache_load(source, B, rocsparse_index_base_zero));
+#endif
+}
+
+template <typename I, typename J, typename T>
+void testing_matrix_file_cache(const Arguments& arg)
+{
+#ifndef WIN32
+    const J                    M    = arg.M;
+    const J                    N    = arg.N;
+    const rocsparse_index_base base = arg.baseA;
+
+    testing_matrix_file_cache_dir  dir("64");
+    testing_matrix_io_csr<T, I, J> A;
+    A.init(M, N, base);
+
+    const std::string source = dir.source("A.mtx");
+    testing_matrix_io_write_text(source.c_str(), "A");
+
+    // Miss, then hit once stored, in both index bases
+    {
+        testing_matrix_io_csr<T, I, J> B;
+        ASSERT_FALSE(testing_matrix_file_cache_load(source, B, base));
+
+        testing_matrix_file_cache_store(source, A);
+        ASSERT_EQ(dir.cached().size(), size_t(1));
+
+        ASSERT_TRUE(testing_matrix_file_cache_load(source, B, base));
+        A.unit_check(B);
+
+        const rocsparse_index_base other_base
+            = (base == rocsparse_index_base_zero) ? rocsparse_index_base_one
+                                                  : rocsparse_index_base_zero;
+        testing_matrix_io_csr<T, I, J> C;
+        ASSERT_TRUE(testing_matrix_file_cache_load(source, C, other_base));
+        testing_matrix_file_cache_rebase(A, other_base).unit_check(C);
+    }
+
+    // Another value type or index types miss
+    {
+        using U = typename std::conditional<std::is_same<T, double>::value, float, double>::type;
+        testing_matrix_io_csr<U, I, J> B;
+        ASSERT_FALSE(testing_matrix_file_cache_load(source, B, base));
+
+        using K =
+            typename std::conditional<std::is_same<I, int32_t>::value, int64_t, int32_t>::type;
+        testing_matrix_io_csr<T, K, int32_t> C;
+        ASSERT_FALSE(testing_matrix_file_cache_load(source, C, base));
+    }
+
+    // A change of the modification time of the source file misses
+    {
+        testing_matrix_file_cache_set_mtime(source, -3600);
+
+        testing_matrix_io_csr<T, I, J> B;
+        ASSERT_FALSE(testing_matrix_file_cache_load(source, B, base));
+
+        testing_matrix_file_cache_store(source, A);
+        ASSERT_TRUE(testing_matrix_file_cache_load(source, B, base));
+        A.unit_check(B);
+    }
+
+    // A change of the size of the source file misses, even with the same modification time
+    {
+        struct stat st;
+        ASSERT_EQ(stat(source.c_str(), &st), 0);
+        testing_matrix_io_write_text(source.c_str(), "AA");
+        struct utimbuf times;
+        times.actime  = st.st_atime;
+        times.modtime = st.st_mtime;
+        ASSERT_EQ(utime(source.c_str(), &times), 0);
+
+        testing_matrix_io_csr<T, I, J> B;
+        ASSERT_FALSE(testing_matrix_file_cache_load(source, B, base));
+    }
+#endif
+}
+
+void testing_matrix_file_cache_extra(const Arguments& arg)
+{
+#ifndef WIN32
+    // About 360 kB each, two of them fit in a 1 MB cache but not three
+    testing_matrix_file_cache_dir dir("1");
+    const auto                    A = testing_matrix_file_cache_banded(1000, 30, 0.0);
+    const auto                    B = testing_matrix_file_cache_banded(1000, 30, 1.0);
+    const auto                    C = testing_matrix_file_cache_banded(1000, 30, 2.0);
+
+    const std::string source_A = dir.source("A.mtx");
+    const std::string source_B = dir.source("B.mtx");
+    const std::string source_C = dir.source("C.mtx");
+    testing_matrix_io_write_text(source_A.c_str(), "A");
+    testing_matrix_io_write_text(source_B.c_str(), "B");
+    testing_matrix_io_write_text(source_C.c_str(), "C");
+
+    // A is stored before B, the modification times make the order unambiguous
+    testing_matrix_file_cache_store(source_A, A);
+    const std::string cached_A = testing_matrix_file_cache_added(dir, {});
+    ASSERT_FALSE(cached_A.empty());
+    testing_matrix_file_cache_set_mtime(cached_A, -200);
+
+    testing_matrix_file_cache_store(source_B, B);
+    const std::string cached_B = testing_matrix_file_cache_added(dir, {cached_A});
+    ASSERT_FALSE(cached_B.empty());
+    testing_matrix_file_cache_set_mtime(cached_B, -100);
+
+    // A hit on A makes B the least recently used matrix
+    testing_matrix_io_csr<double, int32_t, int32_t> D;
+    ASSERT_TRUE(testing_matrix_file_cache_load(source_A, D, rocsparse_index_base_zero));
+    A.unit_check(D);
+
+    struct stat st_A;
+    struct stat st_B;
+    ASSERT_EQ(stat(cached_A.c_str(), &st_A), 0);
+    ASSERT_EQ(stat(cached_B.c_str(), &st_B), 0);
+    ASSERT_GT(st_A.st_mtime, st_B.st_mtime);
+
+    // Storing C evicts B only, the cache holds at most 1 MB
+    testing_matrix_file_cache_store(source_C, C);
+    const auto cached = dir.cached();
+    ASSERT_EQ(cached.size(), size_t(2));
+    ASSERT_NE(std::find(cached.begin(), cached.end(), cached_A), cached.end());
+    ASSERT_EQ(std::find(cached.begin(), cached.end(), cached_B), cached.end());
+
+    uint64_t size = 0;
+    for(const std::string& filename : cached)
+    {
+        struct stat st;
+        ASSERT_EQ(stat(filename.c_str(), &st), 0);
+        size += st.st_size;
+    }
+    ASSERT_LE(size, uint64_t(1) << 20);
+
+    ASSERT_TRUE(testing_matrix_file_cache_load(source_A, D, rocsparse_index_base_zero));
+    A.unit_check(D);
+    ASSERT_FALSE(testing_matrix_file_cache_load(source_B, D, rocsparse_index_base_zero));
+    ASSERT_TRUE(testing_matrix_file_cache_load(source_C, D, rocsparse_index_base_zero));
+    C.unit_check(D);
+
+    // A matrix larger than the cache is not stored, and evicts nothing
+    const auto        E        = testing_matrix_file_cache_banded(10000, 10, 0.0);
+    const std::string source_E = dir.source("E.mtx");
+    testing_matrix_io_write_text(source_E.c_str(), "E");
+    testing_matrix_file_cache_store(source_E, E);
+    ASSERT_FALSE(testing_matrix_file_cache_load(source_E, D, rocsparse_index_base_zero));
+    ASSERT_EQ(dir.cached(), cached);
+#endif
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TYPE)                                                        \
+    template void testing_matrix_file_cache_bad_arg<ITYPE, JTYPE, TYPE>(const Arguments& arg); \
+    template void testing_matrix_file_cache<ITYPE, JTYPE, TYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,564 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_matrix_io.hpp"
+#include "testing_matrix_io_utils.hpp"
+
+#include "rocsparse_clients_envariables.hpp"
+#include "rocsparse_exporter_rocalution.hpp"
+#include "rocsparse_import.hpp"
+#include "rocsparse_importer_matrixmarket.hpp"
+#include "rocsparse_importer_mlbsr.hpp"
+#include "rocsparse_importer_mlcsr.hpp"
+#include "rocsparse_importer_rocalution.hpp"
+
+#include <sys/stat.h>
+#ifndef WIN32
+#include <utime.h>
+#endif
+
+//
+// Write A to a MatrixMarket file, entries are shuffled and interleaved with comments and blank
+// lines, and the last line has no newline.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_write_mtx(const char*                          filename,
+                                        const testing_matrix_io_csr<T, I, J>& A)
+{
+    const bool is_complex = !std::is_same<T, floating_data_t<T>>::value;
+
+    std::vector<std::pair<J, I>> entries(A.nnz);
+    for(J i = 0; i < A.m; ++i)
+    {
+        for(I k = A.ptr[i] - A.base; k < A.ptr[i + 1] - A.base; ++k)
+        {
+            entries[k] = std::make_pair(i, k);
+        }
+    }
+    std::shuffle(entries.begin(), entries.end(), rocsparse_rng_get());
+
+    FILE* f = fopen(filename, "w");
+    ASSERT_NE(f, nullptr);
+    fprintf(f,
+            "%%%%MatrixMarket matrix coordinate %s general\n",
+            is_complex ? "complex" : "real");
+    fprintf(f, "%% rocsparse matrix_io test\n");
+    fprintf(f, "%% shuffled entries\n");
+    fprintf(f, "%lld %lld %lld\n", (long long)A.m, (long long)A.n, (long long)A.nnz);
+    for(size_t e = 0; e < entries.size(); ++e)
+    {
+        const I k = entries[e].second;
+        fprintf(f,
+                "%lld %lld %.17g",
+                (long long)entries[e].first + 1,
+                (long long)(A.ind[k] - A.base) + 1,
+                static_cast<double>(std::real(A.val[k])));
+        if(is_complex)
+        {
+            fprintf(f, " %.17g", static_cast<double>(std::imag(A.val[k])));
+        }
+        if(e % 97 == 1)
+        {
+            fprintf(f, "\n%% comment\n");
+        }
+        if(e + 1 < entries.size())
+        {
+            fprintf(f, "\n");
+        }
+    }
+    fclose(f);
+}
+
+//
+// Write the sparsity pattern of A to a .smtx file, or to a .bsmtx file if blocked, A being the
+// pattern of the blocks.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_write_ml(const char*                           filename,
+                                       const testing_matrix_io_csr<T, I, J>& A,
+                                       bool                                  blocked,
+                                       int64_t                               block_dim_row,
+                                       int64_t                               block_dim_col)
+{
+    FILE* f = fopen(filename, "w");
+    ASSERT_NE(f, nullptr);
+    fprintf(f,
+            "%lld, %lld, %lld\n",
+            (long long)(A.m * block_dim_row),
+            (long long)(A.n * block_dim_col),
+            (long long)(A.nnz * block_dim_row * block_dim_col));
+    if(blocked)
+    {
+        fprintf(f, "%lld, %lld\n", (long long)block_dim_row, (long long)block_dim_col);
+    }
+    for(size_t i = 0; i < A.ptr.size(); ++i)
+    {
+        fprintf(f, (i + 1 < A.ptr.size()) ? "%lld " : "%lld\n", (long long)(A.ptr[i] - A.base));
+    }
+    for(size_t k = 0; k < A.ind.size(); ++k)
+    {
+        fprintf(f, (k + 1 < A.ind.size()) ? "%lld " : "%lld\n", (long long)(A.ind[k] - A.base));
+    }
+    fclose(f);
+}
+
+//
+// Overwrite the digits of a file with zeros, keeping its size and its modification time, such
+// that only a sidecar built from the original file can provide its content.
+//
+static void testing_matrix_io_scramble(const char* filename)
+{
+    struct stat st;
+    ASSERT_EQ(stat(filename, &st), 0);
+
+    FILE* f = fopen(filename, "rb");
+    ASSERT_NE(f, nullptr);
+    std::vector<char> data;
+    char              buffer[4096];
+    size_t            count;
+    while((count = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(f);
+
+    std::replace_if(
+        data.begin(), data.end(), [](char c) { return c >= '1' && c <= '9'; }, '0');
+    f = fopen(filename, "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(data.data(), 1, data.size(), f), data.size());
+    fclose(f);
+
+#ifndef WIN32
+    struct utimbuf times;
+    times.actime  = st.st_atime;
+    times.modtime = st.st_mtime;
+    ASSERT_EQ(utime(filename, &times), 0);
+#endif
+}
+
+#ifndef WIN32
+//
+// Prepend a comment line to a file such that its size becomes size, and set its modification
+// time.
+//
+static void testing_matrix_io_pad(const char* filename, size_t size, time_t mtime)
+{
+    FILE* f = fopen(filename, "rb");
+    ASSERT_NE(f, nullptr);
+    std::vector<char> data;
+    char              buffer[4096];
+    size_t            count;
+    while((count = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(f);
+
+    ASSERT_GE(size, data.size() + 2);
+    std::string comment(size - data.size(), ' ');
+    comment.front() = '%';
+    comment.back()  = '\n';
+    data.insert(data.begin(), comment.begin(), comment.end());
+
+    f = fopen(filename, "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(data.data(), 1, data.size(), f), data.size());
+    fclose(f);
+
+    struct utimbuf times;
+    times.actime  = mtime;
+    times.modtime = mtime;
+    ASSERT_EQ(utime(filename, &times), 0);
+}
+#endif
+
+//
+// Import the pattern of a .smtx file, or of a .bsmtx file if blocked.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_import_ml(const char*                     filename,
+                                        bool                            blocked,
+                                        testing_matrix_io_csr<T, I, J>& A,
+                                        rocsparse_index_base            base)
+{
+    A.base = base;
+    if(blocked)
+    {
+        rocsparse_importer_mlbsr importer(filename);
+        rocsparse_direction      dirb;
+        J                        block_dim_row;
+        J                        block_dim_col;
+        CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_gebsr(importer,
+                                                            A.ptr,
+                                                            A.ind,
+                                                            A.val,
+                                                            dirb,
+                                                            A.m,
+                                                            A.n,
+                                                            A.nnz,
+                                                            block_dim_row,
+                                                            block_dim_col,
+                                                            base));
+    }
+    else
+    {
+        rocsparse_importer_mlcsr importer(filename);
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_import_sparse_csr(importer, A.ptr, A.ind, A.val, A.m, A.n, A.nnz, base));
+    }
+}
+
+//
+// Import a MatrixMarket file and return the status, including the status thrown on parsing
+// errors.
+//
+template <typename T, typename I, typename J>
+static rocsparse_status testing_matrix_io_import_mtx(const char*                     filename,
+                                                     testing_matrix_io_csr<T, I, J>& A,
+                                                     rocsparse_index_base            base)
+{
+    try
+    {
+        rocsparse_importer_matrixmarket importer(filename);
+        A.base = base;
+        return rocsparse_import_sparse_csr(importer, A.ptr, A.ind, A.val, A.m, A.n, A.nnz, base);
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+}
+
+//
+// Export A to a rocALUTION file, import it back and compare it with A.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_check_rocalution(const testing_matrix_io_csr<T, I, J>& A)
+{
+    testing_matrix_io_file        file(".csr");
+    rocsparse_exporter_rocalution exporter(file.name());
+    CHECK_ROCSPARSE_ERROR(exporter.write_sparse_csx(rocsparse_direction_row,
+                                                    A.m,
+                                                    A.n,
+                                                    A.nnz,
+                                                    A.ptr.data(),
+                                                    A.ind.data(),
+                                                    A.val.data(),
+                                                    A.base));
+
+    testing_matrix_io_csr<T, I, J> B;
+    rocsparse_importer_rocalution  importer(file.name());
+    B.base = A.base;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_import_sparse_csr(importer, B.ptr, B.ind, B.val, B.m, B.n, B.nnz, A.base));
+    A.unit_check(B);
+}
+
+template <typename I, typename J, typename T>
+void testing_matrix_io_bad_arg(const Arguments& arg)
+{
+    testing_matrix_io_csr<T, I, J> A;
+
+    // Malformed files
+    static const char* texts[] = {"",
+                                  "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n",
+                                  "%%MatrixMarket matrix coordinate real unknown\n2 2 1\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 0 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n",
+                                  "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 1\n"
+                                  "2 2 1\n"};
+    for(const char* text : texts)
+    {
+        testing_matrix_io_file file(".mtx");
+        testing_matrix_io_write_text(file.name(), text);
+        EXPECT_ROCSPARSE_STATUS(
+            testing_matrix_io_import_mtx(file.name(), A, rocsparse_index_base_zero),
+            rocsparse_status_internal_error);
+    }
+}
+
+template <typename I, typename J, typename T>
+void testing_matrix_io(const Arguments& arg)
+{
+    const J                    M    = arg.M;
+    const J                    N    = arg.N;
+    const rocsparse_index_base base = arg.baseA;
+
+    testing_matrix_io_csr<T, I, J> A;
+    A.init(M, N, base);
+
+    // MatrixMarket
+    {
+        testing_matrix_io_file file(".mtx");
+        testing_matrix_io_write_mtx(file.name(), A);
+
+        testing_matrix_io_csr<T, I, J> B;
+        CHECK_ROCSPARSE_ERROR(testing_matrix_io_import_mtx(file.name(), B, base));
+        A.unit_check(B);
+    }
+
+    // rocALUTION
+    testing_matrix_io_check_rocalution(A);
+
+    // Machine learning formats, with and without sidecar. The second import of a file reads the
+    // sidecar written by the first one, even once the text is scrambled.
+    {
+        const bool enabled
+            = rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_SIDECAR);
+        for(int sidecar = 0; sidecar < 2; ++sidecar)
+        {
+            rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_SIDECAR,
+                                               sidecar != 0);
+
+            testing_matrix_io_file csr_file(".smtx");
+            testing_matrix_io_file bsr_file(".bsmtx");
+            testing_matrix_io_write_ml(csr_file.name(), A, false, 1, 1);
+            testing_matrix_io_write_ml(bsr_file.name(), A, true, 2, 3);
+            for(int pass = 0; pass < 2; ++pass)
+            {
+                testing_matrix_io_csr<T, I, J> B;
+                rocsparse_importer_mlcsr       csr_importer(csr_file.name());
+                B.base = base;
+                CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_csr(
+                    csr_importer, B.ptr, B.ind, B.val, B.m, B.n, B.nnz, base));
+                A.unit_check_pattern(B);
+
+                testing_matrix_io_csr<T, I, J> C;
+                rocsparse_importer_mlbsr       bsr_importer(bsr_file.name());
+                rocsparse_direction            dirb;
+                J                              block_dim_row;
+                J                              block_dim_col;
+                C.base = base;
+                CHECK_ROCSPARSE_ERROR(rocsparse_import_sparse_gebsr(bsr_importer,
+                                                                    C.ptr,
+                                                                    C.ind,
+                                                                    C.val,
+                                                                    dirb,
+                                                                    C.m,
+                                                                    C.n,
+                                                                    C.nnz,
+                                                                    block_dim_row,
+                                                                    block_dim_col,
+                                                                    base));
+                A.unit_check_pattern(C);
+                unit_check_scalar<J>(block_dim_row, 2);
+                unit_check_scalar<J>(block_dim_col, 3);
+
+                struct stat st;
+                ASSERT_EQ(stat((std::string(csr_file.name()) + ".sidecar").c_str(), &st) == 0,
+                          sidecar != 0);
+                ASSERT_EQ(stat((std::string(bsr_file.name()) + ".sidecar").c_str(), &st) == 0,
+                          sidecar != 0);
+#ifndef WIN32
+                if(sidecar != 0 && pass == 0)
+                {
+                    testing_matrix_io_scramble(csr_file.name());
+                    testing_matrix_io_scramble(bsr_file.name());
+                }
+#endif
+            }
+        }
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_SIDECAR,
+                                           enabled);
+    }
+
+#ifndef WIN32
+    // Machine learning formats, a sidecar is ignored once the modification time or the size of
+    // its file changes. The file is rewritten with the pattern of Z, of the same dimensions as A
+    // but without non-zeros, then with the pattern of A again.
+    if(A.nnz > 0)
+    {
+        const bool enabled
+            = rocsparse_clients_envariables::get(rocsparse_clients_envariables::MATRICES_SIDECAR);
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_SIDECAR, true);
+
+        testing_matrix_io_csr<T, I, J> Z = A;
+        std::fill(Z.ptr.begin(), Z.ptr.end(), static_cast<I>(base));
+        Z.ind.clear();
+        Z.val.clear();
+        Z.nnz = 0;
+
+        for(int blocked = 0; blocked < 2; ++blocked)
+        {
+            testing_matrix_io_file file(blocked ? ".bsmtx" : ".smtx");
+            const std::string      sidecar = std::string(file.name()) + ".sidecar";
+            struct stat            st;
+
+            testing_matrix_io_write_ml(file.name(), A, blocked != 0, 1, 1);
+            testing_matrix_io_csr<T, I, J> B;
+            testing_matrix_io_import_ml(file.name(), blocked != 0, B, base);
+            A.unit_check_pattern(B);
+            ASSERT_EQ(stat(sidecar.c_str(), &st), 0);
+            ASSERT_EQ(stat(file.name(), &st), 0);
+
+            // Same size, another modification time
+            const size_t size  = st.st_size;
+            const time_t mtime = st.st_mtime;
+            testing_matrix_io_write_ml(file.name(), Z, blocked != 0, 1, 1);
+            testing_matrix_io_pad(file.name(), size, mtime + 100);
+            testing_matrix_io_csr<T, I, J> C;
+            testing_matrix_io_import_ml(file.name(), blocked != 0, C, base);
+            Z.unit_check_pattern(C);
+
+            // Same modification time, another size
+            testing_matrix_io_write_ml(file.name(), A, blocked != 0, 1, 1);
+            testing_matrix_io_pad(file.name(), size + 2, mtime + 100);
+            testing_matrix_io_csr<T, I, J> D;
+            testing_matrix_io_import_ml(file.name(), blocked != 0, D, base);
+            A.unit_check_pattern(D);
+        }
+
+        rocsparse_clients_envariables::set(rocsparse_clients_envariables::MATRICES_SIDECAR,
+                                           enabled);
+    }
+#endif
+}
+
+void testing_matrix_io_extra(const Arguments& arg)
+{
+    // Symmetric matrix, the upper triangular part is expanded
+    {
+        testing_matrix_io_file file(".mtx");
+        testing_matrix_io_write_text(file.name(),
+                                     "%%MatrixMarket matrix coordinate real symmetric\n"
+                                     "3 3 4\n"
+                                     "3 1 4.0\n"
+                                     "1 1 1.0\n"
+                                     "2 2 2.0\n"
+                                     "3 2 3.0\n");
+
+        testing_matrix_io_csr<double, int32_t, int32_t> A;
+        CHECK_ROCSPARSE_ERROR(
+            testing_matrix_io_import_mtx(file.name(), A, rocsparse_index_base_zero));
+
+        const int32_t ptr[] = {0, 2, 4, 6};
+        const int32_t ind[] = {0, 2, 1, 2, 0, 1};
+        const double  val[] = {1.0, 4.0, 2.0, 3.0, 4.0, 3.0};
+        unit_check_scalar<int32_t>(A.m, 3);
+        unit_check_scalar<int32_t>(A.n, 3);
+        unit_check_scalar<int32_t>(A.nnz, 6);
+        unit_check_segments<int32_t>(4, ptr, A.ptr.data());
+        unit_check_segments<int32_t>(6, ind, A.ind.data());
+        unit_check_segments<double>(6, val, A.val.data());
+    }
+
+    // Pattern matrix with CRLF line endings and no newline at the end of the file
+    {
+        testing_matrix_io_file file(".mtx");
+        testing_matrix_io_write_text(file.name(),
+                                     "%%MatrixMarket matrix coordinate pattern general\r\n"
+                                     "% comment\r\n"
+                                     "2 4 3\r\n"
+                                     "2 4\r\n"
+                                     "1 3\r\n"
+                                     "2 1");
+
+        testing_matrix_io_csr<float, int64_t, int32_t> A;
+        CHECK_ROCSPARSE_ERROR(
+            testing_matrix_io_import_mtx(file.name(), A, rocsparse_index_base_one));
+
+        const int64_t ptr[] = {1, 2, 4};
+        const int32_t ind[] = {3, 1, 4};
+        const float   val[] = {1.0f, 1.0f, 1.0f};
+        unit_check_scalar<int32_t>(A.m, 2);
+        unit_check_scalar<int32_t>(A.n, 4);
+        unit_check_scalar<int64_t>(A.nnz, 3);
+        unit_check_segments<int64_t>(3, ptr, A.ptr.data());
+        unit_check_segments<int32_t>(3, ind, A.ind.data());
+        unit_check_segments<float>(3, val, A.val.data());
+    }
+
+    // rocALUTION, arrays converted by several blocks of the staging buffer
+    {
+        testing_matrix_io_csr<float, int64_t, int64_t> A;
+        A.m    = (int64_t(1) << 20) + 7;
+        A.n    = 1000;
+        A.base = rocsparse_index_base_one;
+        A.ptr.resize(A.m + 1);
+        A.ptr[0] = 1;
+        for(int64_t i = 0; i < A.m; ++i)
+        {
+            const int64_t len = (i % 3 == 0) ? 2 : 1;
+            for(int64_t k = 0; k < len; ++k)
+            {
+                A.ind.push_back((i * 7) % 500 + k * 500 + 1);
+                A.val.push_back(static_cast<float>(i % 1013) + 0.5f * k);
+            }
+            A.ptr[i + 1] = static_cast<int64_t>(A.ind.size()) + 1;
+        }
+        A.nnz = static_cast<int64_t>(A.ind.size());
+        testing_matrix_io_check_rocalution(A);
+    }
+
+    // Dimensions and indices that do not fit in 32 bits
+    {
+        testing_matrix_io_file file(".mtx");
+        testing_matrix_io_write_text(file.name(),
+                                     "%%MatrixMarket matrix coordinate real general\n"
+                                     "2 3000000000 3\n"
+                                     "1 2999999999 1.0\n"
+                                     "2 1 2.0\n"
+                                     "1 3000000000 3.0\n");
+
+        testing_matrix_io_csr<double, int64_t, int64_t> A;
+        CHECK_ROCSPARSE_ERROR(
+            testing_matrix_io_import_mtx(file.name(), A, rocsparse_index_base_zero));
+
+        const int64_t ptr[] = {0, 2, 3};
+        const int64_t ind[] = {2999999998, 2999999999, 0};
+        const double  val[] = {1.0, 3.0, 2.0};
+        unit_check_scalar<int64_t>(A.m, 2);
+        unit_check_scalar<int64_t>(A.n, 3000000000);
+        unit_check_scalar<int64_t>(A.nnz, 3);
+        unit_check_segments<int64_t>(3, ptr, A.ptr.data());
+        unit_check_segments<int64_t>(3, ind, A.ind.data());
+        unit_check_segments<double>(3, val, A.val.data());
+
+        // The number of columns does not fit in 32 bits indices
+        testing_matrix_io_csr<double, int32_t, int32_t> B;
+        EXPECT_ROCSPARSE_STATUS(
+            testing_matrix_io_import_mtx(file.name(), B, rocsparse_index_base_zero),
+            rocsparse_status_invalid_value);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TYPE)                                                \
+    template void testing_matrix_io_bad_arg<ITYPE, JTYPE, TYPE>(const Arguments& arg); \
+    template void testing_matrix_io<ITYPE, JTYPE, TYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -0,0 +1,194 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing.hpp"
+
+#include "rocsparseio.h"
+
+#include <cstdio>
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+#define EXPECT_ROCSPARSEIO_STATUS ASSERT_EQ
+#define CHECK_ROCSPARSEIO_ERROR(STATUS) \
+    EXPECT_ROCSPARSEIO_STATUS(STATUS, rocsparseio_status_success)
+
+//
+// Temporary file, removed with its sidecar when going out of scope.
+//
+class testing_matrix_io_file
+{
+private:
+    std::string m_base{};
+    std::string m_name{};
+
+public:
+    explicit testing_matrix_io_file(const char* suffix)
+    {
+#ifdef WIN32
+        char* name   = _tempnam(nullptr, "rocsparse-io-");
+        this->m_base = name;
+        free(name);
+#else
+        char      name[] = "/tmp/rocsparse-io-XXXXXX";
+        const int fd     = mkstemp(name);
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+        this->m_base = name;
+#endif
+        this->m_name = this->m_base + suffix;
+    }
+
+    ~testing_matrix_io_file()
+    {
+        remove((this->m_name + ".sidecar").c_str());
+        remove(this->m_name.c_str());
+        remove(this->m_base.c_str());
+    }
+
+    const char* name() const
+    {
+        return this->m_name.c_str();
+    }
+};
+
+//
+// Host CSR matrix with empty, short and long rows, the column indices of a row are distinct
+// and sorted.
+//
+template <typename T, typename I, typename J>
+struct testing_matrix_io_csr
+{
+    J                    m{};
+    J                    n{};
+    I                    nnz{};
+    rocsparse_index_base base{};
+    std::vector<I>       ptr{};
+    std::vector<J>       ind{};
+    std::vector<T>       val{};
+
+    void init(J m_, J n_, rocsparse_index_base base_)
+    {
+        this->m    = m_;
+        this->n    = n_;
+        this->base = base_;
+        this->ptr.resize(m_ + 1);
+        this->ind.clear();
+        this->val.clear();
+
+        this->ptr[0] = base_;
+        for(J i = 0; i < m_; ++i)
+        {
+            const int kind = random_generator_exact<int>(0, 7);
+            J         len  = (kind == 0) ? 0
+                                         : ((kind == 1) ? random_generator_exact<int>(64, 256)
+                                                        : random_generator_exact<int>(1, 8));
+            len            = std::min(len, n_);
+            if(len > 0)
+            {
+                const J      step  = std::max(n_ / len, static_cast<J>(1));
+                const J      start = random_generator_exact<int>(0, static_cast<int>(n_ - 1));
+                const size_t first = this->ind.size();
+                for(J k = 0; k < len; ++k)
+                {
+                    this->ind.push_back((start + k * step) % n_ + base_);
+                    this->val.push_back(random_generator_exact<T>());
+                }
+                std::sort(this->ind.begin() + first, this->ind.end());
+            }
+            this->ptr[i + 1] = static_cast<I>(this->ind.size()) + base_;
+        }
+        this->nnz = static_cast<I>(this->ind.size());
+    }
+
+    void unit_check_pattern(const testing_matrix_io_csr& that) const
+    {
+        unit_check_scalar(this->m, that.m);
+        unit_check_scalar(this->n, that.n);
+        unit_check_scalar(this->nnz, that.nnz);
+        unit_check_segments(this->ptr.size(), this->ptr.data(), that.ptr.data());
+        unit_check_segments(this->ind.size(), this->ind.data(), that.ind.data());
+    }
+
+    void unit_check(const testing_matrix_io_csr& that) const
+    {
+        this->unit_check_pattern(that);
+        unit_check_segments(this->val.size(), this->val.data(), that.val.data());
+    }
+};
+
+//
+// Write a file made of the given lines.
+//
+inline void testing_matrix_io_write_text(const char* filename, const char* text)
+{
+    FILE* f = fopen(filename, "wb");
+    ASSERT_NE(f, nullptr);
+    fputs(text, f);
+    fclose(f);
+}
+
+template <typename T>
+inline rocsparseio_type testing_matrix_io_type();
+
+template <>
+inline rocsparseio_type testing_matrix_io_type<int32_t>()
+{
+    return rocsparseio_type_int32;
+}
+
+template <>
+inline rocsparseio_type testing_matrix_io_type<int64_t>()
+{
+    return rocsparseio_type_int64;
+}
+
+template <>
+inline rocsparseio_type testing_matrix_io_type<float>()
+{
+    return rocsparseio_type_float32;
+}
+
+template <>
+inline rocsparseio_type testing_matrix_io_type<double>()
+{
+    return rocsparseio_type_float64;
+}
+
+template <>
+inline rocsparseio_type testing_matrix_io_type<rocsparse_float_complex>()
+{
+    return rocsparseio_type_complex32;
+}
+
+template <>
+inline rocsparseio_type testing_matrix_io_type<rocsparse_double_complex>()
+{
+    return rocsparseio_type_complex64;
+}
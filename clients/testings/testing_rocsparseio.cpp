@@ -0,0 +1,598 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_matrix_io_utils.hpp"
+#include "testing_rocsparseio.hpp"
+
+#include "rocsparse_importer.hpp"
+#include "rocsparseio_statistics.hpp"
+
+//
+// Write A as a rocsparseio csr object.
+//
+template <typename T, typename I, typename J>
+static rocsparseio_status testing_matrix_io_write_csr(rocsparseio_handle                    handle,
+                                                      const testing_matrix_io_csr<T, I, J>& A,
+                                                      const char*                           name)
+{
+    return rocsparseio_write_sparse_csx(handle,
+                                        rocsparseio_direction_row,
+                                        A.m,
+                                        A.n,
+                                        A.nnz,
+                                        testing_matrix_io_type<I>(),
+                                        A.ptr.data(),
+                                        testing_matrix_io_type<J>(),
+                                        A.ind.data(),
+                                        testing_matrix_io_type<T>(),
+                                        A.val.data(),
+                                        static_cast<rocsparseio_index_base>(A.base),
+                                        name);
+}
+
+//
+// Read the metadata of the csr object the handle is positioned at, check them against A and
+// size B accordingly.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_read_metadata_csr(rocsparseio_handle                    handle,
+                                                const testing_matrix_io_csr<T, I, J>& A,
+                                                testing_matrix_io_csr<T, I, J>&       B)
+{
+    rocsparseio_direction  dir;
+    uint64_t               m;
+    uint64_t               n;
+    uint64_t               nnz;
+    rocsparseio_type       ptr_type;
+    rocsparseio_type       ind_type;
+    rocsparseio_type       val_type;
+    rocsparseio_index_base base;
+    CHECK_ROCSPARSEIO_ERROR(rocsparseiox_read_metadata_sparse_csx(
+        handle, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &val_type, &base));
+
+    ASSERT_EQ(dir, rocsparseio_direction_row);
+    ASSERT_EQ(ptr_type, testing_matrix_io_type<I>());
+    ASSERT_EQ(ind_type, testing_matrix_io_type<J>());
+    ASSERT_EQ(val_type, testing_matrix_io_type<T>());
+    ASSERT_EQ(base, static_cast<rocsparseio_index_base>(A.base));
+
+    B.m    = static_cast<J>(m);
+    B.n    = static_cast<J>(n);
+    B.nnz  = static_cast<I>(nnz);
+    B.base = A.base;
+    B.ptr.resize(m + 1);
+    B.ind.resize(nnz);
+    B.val.resize(nnz);
+}
+
+//
+// Read the csr object the handle is positioned at and compare it with A.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_read_csr(rocsparseio_handle                    handle,
+                                       const testing_matrix_io_csr<T, I, J>& A)
+{
+    testing_matrix_io_csr<T, I, J> B;
+    testing_matrix_io_read_metadata_csr(handle, A, B);
+    CHECK_ROCSPARSEIO_ERROR(
+        rocsparseiox_read_sparse_csx(handle, B.ptr.data(), B.ind.data(), B.val.data()));
+    A.unit_check(B);
+}
+
+//
+// Remove the table of contents of a rocsparseio file, which is stored at its end and is
+// located by the trailer [nobjects, offset, magic].
+//
+static void testing_matrix_io_remove_toc(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    ASSERT_NE(f, nullptr);
+    std::vector<char> data;
+    char              buffer[4096];
+    size_t            count;
+    while((count = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(f);
+
+    uint64_t trailer[3];
+    ASSERT_GE(data.size(), sizeof(trailer));
+    memcpy(trailer, data.data() + data.size() - sizeof(trailer), sizeof(trailer));
+    ASSERT_EQ(trailer[2], uint64_t(0x434f54534f495352));
+    ASSERT_LT(trailer[1], data.size());
+
+    f = fopen(filename, "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(data.data(), 1, trailer[1], f), trailer[1]);
+    fclose(f);
+}
+
+//
+// Read the first object of a rocsparseio file as a whole, through a mapping and by slabs of
+// rows, and compare it with A.
+//
+template <typename T, typename I, typename J>
+static void testing_matrix_io_check_csr(const char*                           filename,
+                                        const testing_matrix_io_csr<T, I, J>& A)
+{
+    rocsparseio_handle handle;
+
+    CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, filename));
+    testing_matrix_io_read_csr(handle, A);
+    CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+    // The mapped arrays remain valid once the handle is closed
+    testing_matrix_io_csr<T, I, J> B;
+    rocsparseio_map                map;
+    const void*                    ptr;
+    const void*                    ind;
+    const void*                    val;
+    CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, filename));
+    testing_matrix_io_read_metadata_csr(handle, A, B);
+    CHECK_ROCSPARSEIO_ERROR(rocsparseiox_map_sparse_csx(handle, &map, &ptr, &ind, &val));
+    CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+    rocsparse_importer_copy_mixed_arrays(B.ptr.size(), B.ptr.data(), static_cast<const I*>(ptr));
+    rocsparse_importer_copy_mixed_arrays(B.nnz, B.ind.data(), static_cast<const J*>(ind));
+    rocsparse_importer_copy_mixed_arrays(B.nnz, B.val.data(), static_cast<const T*>(val));
+    CHECK_ROCSPARSEIO_ERROR(rocsparseiox_unmap(map));
+    A.unit_check(B);
+
+    // Read by slabs of rows with a bounded number of non-zeros
+    testing_matrix_io_csr<T, I, J> C;
+    CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, filename));
+    testing_matrix_io_read_metadata_csr(handle, A, C);
+
+    const uint64_t nnz_max = std::max(static_cast<uint64_t>(A.nnz / 7), uint64_t(1));
+    uint64_t       first   = 0;
+    C.ptr[0]               = A.ptr[0];
+    while(first < static_cast<uint64_t>(A.m))
+    {
+        uint64_t last;
+        uint64_t slab_nnz;
+        CHECK_ROCSPARSEIO_ERROR(
+            rocsparseiox_read_sparse_csx_slab_range(handle, first, nnz_max, &last, &slab_nnz));
+
+        // The slab is the largest one with at most nnz_max non-zeros, or a single row
+        ASSERT_GT(last, first);
+        ASSERT_LE(last, static_cast<uint64_t>(A.m));
+        ASSERT_EQ(slab_nnz, static_cast<uint64_t>(A.ptr[last] - A.ptr[first]));
+        ASSERT_TRUE(slab_nnz <= nnz_max || last == first + 1);
+        ASSERT_TRUE(last == static_cast<uint64_t>(A.m)
+                    || static_cast<uint64_t>(A.ptr[last + 1] - A.ptr[first]) > nnz_max);
+
+        const I offset = A.ptr[first] - A.base;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_read_sparse_csx_slab(handle,
+                                                                  first,
+                                                                  last,
+                                                                  C.ptr.data() + first,
+                                                                  C.ind.data() + offset,
+                                                                  C.val.data() + offset));
+        first = last;
+    }
+    CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+    A.unit_check(C);
+}
+
+template <typename I, typename J, typename T>
+void testing_rocsparseio_bad_arg(const Arguments& arg)
+{
+    testing_matrix_io_csr<T, I, J> A;
+
+    // Streaming write
+    {
+        testing_matrix_io_file file(".csr");
+        rocsparseio_handle     handle;
+        const int32_t          ptr[] = {0, 1, 2};
+        const int32_t          ind[] = {0, 1};
+        const double           val[] = {1.0, 2.0};
+
+        auto begin = [&]() {
+            return rocsparseiox_write_sparse_csx_stream_begin(handle,
+                                                              rocsparseio_direction_row,
+                                                              2,
+                                                              2,
+                                                              2,
+                                                              rocsparseio_type_int32,
+                                                              ptr,
+                                                              rocsparseio_type_int32,
+                                                              rocsparseio_type_float64,
+                                                              rocsparseio_index_base_zero,
+                                                              "A");
+        };
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+
+        // Not supported with a codec
+        CHECK_ROCSPARSEIO_ERROR(
+            rocsparseio_set_codec(handle, rocsparseio_codec_delta_varbyte, rocsparseio_codec_none));
+        EXPECT_ROCSPARSEIO_STATUS(begin(), rocsparseio_status_invalid_mode);
+        CHECK_ROCSPARSEIO_ERROR(
+            rocsparseio_set_codec(handle, rocsparseio_codec_none, rocsparseio_codec_none));
+
+        // Not begun
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseiox_write_sparse_csx_stream(handle, 1, ind, val),
+                                  rocsparseio_status_invalid_mode);
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseiox_write_sparse_csx_stream_end(handle),
+                                  rocsparseio_status_invalid_mode);
+
+        // Already in progress
+        CHECK_ROCSPARSEIO_ERROR(begin());
+        EXPECT_ROCSPARSEIO_STATUS(begin(), rocsparseio_status_invalid_mode);
+
+        // Null batch arrays, too many and too few non-zeros
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseiox_write_sparse_csx_stream(handle, 1, nullptr, val),
+                                  rocsparseio_status_invalid_pointer);
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseiox_write_sparse_csx_stream(handle, 1, ind, nullptr),
+                                  rocsparseio_status_invalid_pointer);
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseiox_write_sparse_csx_stream(handle, 3, ind, val),
+                                  rocsparseio_status_invalid_size);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_write_sparse_csx_stream(handle, 1, ind, val));
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseiox_write_sparse_csx_stream_end(handle),
+                                  rocsparseio_status_invalid_size);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_write_sparse_csx_stream(handle, 1, ind + 1, val + 1));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_write_sparse_csx_stream_end(handle));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+    }
+
+    // Configuration of the parallel transfers
+    {
+        testing_matrix_io_file file(".csr");
+        rocsparseio_handle     handle;
+        uint64_t               nthreads;
+        uint64_t               chunk_size;
+        int                    direct;
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseio_set_parallel_io(nullptr, 4, 4096, 0),
+                                  rocsparseio_status_invalid_handle);
+        EXPECT_ROCSPARSEIO_STATUS(
+            rocsparseio_get_parallel_io(nullptr, &nthreads, &chunk_size, &direct),
+            rocsparseio_status_invalid_handle);
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseio_set_parallel_io(handle, 0, 4096, 0),
+                                  rocsparseio_status_invalid_value);
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseio_set_parallel_io(handle, 4, 4095, 0),
+                                  rocsparseio_status_invalid_size);
+        EXPECT_ROCSPARSEIO_STATUS(
+            rocsparseio_get_parallel_io(handle, nullptr, &chunk_size, &direct),
+            rocsparseio_status_invalid_pointer);
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseio_get_parallel_io(handle, &nthreads, nullptr, &direct),
+                                  rocsparseio_status_invalid_pointer);
+        EXPECT_ROCSPARSEIO_STATUS(
+            rocsparseio_get_parallel_io(handle, &nthreads, &chunk_size, nullptr),
+            rocsparseio_status_invalid_pointer);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+    }
+}
+
+template <typename I, typename J, typename T>
+void testing_rocsparseio(const Arguments& arg)
+{
+    const J                    M    = arg.M;
+    const J                    N    = arg.N;
+    const rocsparse_index_base base = arg.baseA;
+
+    testing_matrix_io_csr<T, I, J> A;
+    A.init(M, N, base);
+
+    // rocsparseio, for every codec of the indices and of the values
+    static const rocsparseio_codec index_codecs[] = {rocsparseio_codec_none,
+                                                     rocsparseio_codec_delta_varbyte,
+                                                     rocsparseio_codec_delta_bitpack,
+                                                     rocsparseio_codec_byte_shuffle};
+    static const rocsparseio_codec value_codecs[]
+        = {rocsparseio_codec_none, rocsparseio_codec_byte_shuffle};
+    for(const rocsparseio_codec index_codec : index_codecs)
+    {
+        for(const rocsparseio_codec value_codec : value_codecs)
+        {
+            testing_matrix_io_file file(".csr");
+            rocsparseio_handle     handle;
+
+            CHECK_ROCSPARSEIO_ERROR(
+                rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+            CHECK_ROCSPARSEIO_ERROR(rocsparseio_set_codec(handle, index_codec, value_codec));
+            CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, A, "A"));
+            CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+            testing_matrix_io_check_csr(file.name(), A);
+        }
+    }
+
+    // rocsparseio, arrays of at least two chunks are transferred in parallel with pread/pwrite,
+    // with and without O_DIRECT, the configuration only applies to the handle it is set on
+    for(int parallel_direct = 0; parallel_direct < 2; ++parallel_direct)
+    {
+        testing_matrix_io_file file(".csr");
+        rocsparseio_handle     handle;
+        rocsparseio_handle     other;
+        uint64_t               nthreads;
+        uint64_t               chunk_size;
+        int                    direct;
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_set_parallel_io(handle, 4, 4096, parallel_direct));
+        CHECK_ROCSPARSEIO_ERROR(
+            rocsparseio_get_parallel_io(handle, &nthreads, &chunk_size, &direct));
+        ASSERT_EQ(nthreads, uint64_t(4));
+        ASSERT_EQ(chunk_size, uint64_t(4096));
+        ASSERT_EQ(direct, parallel_direct);
+        CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, A, "A"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_set_parallel_io(handle, 4, 4096, parallel_direct));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&other, rocsparseio_rwmode_read, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(
+            rocsparseio_get_parallel_io(other, &nthreads, &chunk_size, &direct));
+        ASSERT_NE(chunk_size, uint64_t(4096));
+        testing_matrix_io_read_csr(handle, A);
+        testing_matrix_io_read_csr(other, A);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(other));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        testing_matrix_io_check_csr(file.name(), A);
+    }
+
+    // rocsparseio, the indices and values are streamed by batches of increasing sizes, an
+    // object written afterwards follows the streamed one
+    {
+        testing_matrix_io_file file(".csr");
+        rocsparseio_handle     handle;
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(
+            rocsparseiox_write_sparse_csx_stream_begin(handle,
+                                                       rocsparseio_direction_row,
+                                                       A.m,
+                                                       A.n,
+                                                       A.nnz,
+                                                       testing_matrix_io_type<I>(),
+                                                       A.ptr.data(),
+                                                       testing_matrix_io_type<J>(),
+                                                       testing_matrix_io_type<T>(),
+                                                       static_cast<rocsparseio_index_base>(A.base),
+                                                       "A"));
+        I       count = 0;
+        int64_t batch = 0;
+        while(count < A.nnz)
+        {
+            const I size = std::min(static_cast<I>(++batch), A.nnz - count);
+            CHECK_ROCSPARSEIO_ERROR(rocsparseiox_write_sparse_csx_stream(
+                handle, size, A.ind.data() + count, A.val.data() + count));
+            count += size;
+        }
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_write_sparse_csx_stream_end(handle));
+        CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, A, "B"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        testing_matrix_io_check_csr(file.name(), A);
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, file.name()));
+        uint64_t nobjects;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_get_num_objects(handle, &nobjects));
+        ASSERT_EQ(nobjects, uint64_t(2));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_seek_object(handle, 1));
+        testing_matrix_io_read_csr(handle, A);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+    }
+
+    // rocsparseio, files without table of contents written before it was introduced
+    {
+        testing_matrix_io_file file(".csr");
+        rocsparseio_handle     handle;
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, A, "A"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        testing_matrix_io_remove_toc(file.name());
+        testing_matrix_io_check_csr(file.name(), A);
+
+        uint64_t nobjects;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_get_num_objects(handle, &nobjects));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+        ASSERT_EQ(nobjects, uint64_t(0));
+    }
+
+    // rocsparseio, several objects accessed through the table of contents
+    {
+        testing_matrix_io_file         file(".csr");
+        rocsparseio_handle             handle;
+        testing_matrix_io_csr<T, I, J> B;
+        testing_matrix_io_csr<T, I, J> C;
+        std::vector<T>                 x(N);
+        B.init(N, M, base);
+        C.init(M, N, base);
+        for(J i = 0; i < N; ++i)
+        {
+            x[i] = random_generator_exact<T>();
+        }
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, A, "A"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_write_dense_vector(
+            handle, testing_matrix_io_type<T>(), N, x.data(), 1, "x"));
+        CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, B, "B"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        // The appended object hides the first one with the same name
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_append, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(testing_matrix_io_write_csr(handle, C, "A"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, file.name()));
+
+        static const char*       names[]   = {"A", "x", "B", "A"};
+        const rocsparseio_format formats[] = {rocsparseio_format_sparse_csx,
+                                              rocsparseio_format_dense_vector,
+                                              rocsparseio_format_sparse_csx,
+                                              rocsparseio_format_sparse_csx};
+        uint64_t                 nobjects;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_get_num_objects(handle, &nobjects));
+        ASSERT_EQ(nobjects, uint64_t(4));
+        for(uint64_t i = 0; i < nobjects; ++i)
+        {
+            rocsparseio_string name;
+            rocsparseio_format format;
+            uint64_t           nbytes;
+            CHECK_ROCSPARSEIO_ERROR(rocsparseio_get_object(handle, i, name, &format, &nbytes));
+            ASSERT_STREQ(name, names[i]);
+            ASSERT_EQ(format, formats[i]);
+            ASSERT_GT(nbytes, uint64_t(0));
+        }
+
+        uint64_t index;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_find_object(handle, "A", &index));
+        ASSERT_EQ(index, uint64_t(3));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_find_object(handle, "B", &index));
+        ASSERT_EQ(index, uint64_t(2));
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseio_find_object(handle, "y", &index),
+                                  rocsparseio_status_invalid_value);
+        EXPECT_ROCSPARSEIO_STATUS(rocsparseio_seek_object(handle, nobjects),
+                                  rocsparseio_status_invalid_value);
+
+        // Objects are read in any order
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_seek_object(handle, 2));
+        testing_matrix_io_read_csr(handle, B);
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_seek_object(handle, 3));
+        testing_matrix_io_read_csr(handle, C);
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_seek_object(handle, 1));
+        rocsparseio_string name;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_read_name(handle, name));
+        ASSERT_STREQ(name, "x");
+        rocsparseio_type y_type;
+        uint64_t         y_size;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_read_metadata_dense_vector(handle, &y_type, &y_size));
+        ASSERT_EQ(y_type, testing_matrix_io_type<T>());
+        ASSERT_EQ(y_size, static_cast<uint64_t>(N));
+        std::vector<T> y(N);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_read_dense_vector(handle, y.data(), 1));
+        unit_check_segments(y.size(), x.data(), y.data());
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_seek_object(handle, 0));
+        testing_matrix_io_read_csr(handle, A);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+    }
+}
+
+void testing_rocsparseio_extra(const Arguments& arg)
+{
+    //
+    // Statistics reported by rocsparseio-info --stats of a known matrix, streamed by slabs of
+    // at most 3 non-zeros:
+    //
+    //   x x . .
+    //   x x . x
+    //   x . x .
+    //   . x . .
+    //
+    {
+        testing_matrix_io_file file(".csr");
+        rocsparseio_handle     handle;
+        const int32_t          ptr[] = {1, 3, 6, 8, 9};
+        const int32_t          ind[] = {1, 2, 1, 2, 4, 1, 3, 2};
+        const double           val[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_write, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_write_sparse_csx(handle,
+                                                             rocsparseio_direction_row,
+                                                             4,
+                                                             4,
+                                                             8,
+                                                             rocsparseio_type_int32,
+                                                             ptr,
+                                                             rocsparseio_type_int32,
+                                                             ind,
+                                                             rocsparseio_type_float64,
+                                                             val,
+                                                             rocsparseio_index_base_one,
+                                                             "A"));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        rocsparseio_direction  dir;
+        uint64_t               m;
+        uint64_t               n;
+        uint64_t               nnz;
+        rocsparseio_type       ptr_type;
+        rocsparseio_type       ind_type;
+        rocsparseio_type       val_type;
+        rocsparseio_index_base base;
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_open(&handle, rocsparseio_rwmode_read, file.name()));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseiox_read_metadata_sparse_csx(
+            handle, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &val_type, &base));
+
+        rocsparseio_stream_statistics_csx stats(dir, m, n);
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_csx_stream_statistics(
+            handle, ptr_type, ind_type, val_type, base, 3, stats));
+        CHECK_ROCSPARSEIO_ERROR(rocsparseio_close(handle));
+
+        EXPECT_EQ(stats.nnz, uint64_t(8));
+        EXPECT_EQ(stats.min_nnz, uint64_t(1));
+        EXPECT_EQ(stats.max_nnz, uint64_t(3));
+        EXPECT_DOUBLE_EQ(stats.mean(), 2.0);
+        EXPECT_DOUBLE_EQ(stats.stddev(), std::sqrt(0.5));
+
+        // Rows with 1 non-zero, then rows with 2 or 3 non-zeros
+        EXPECT_EQ(stats.histogram[1], uint64_t(1));
+        EXPECT_EQ(stats.histogram[2], uint64_t(3));
+
+        EXPECT_EQ(stats.lower_bandwidth, uint64_t(2));
+        EXPECT_EQ(stats.upper_bandwidth, uint64_t(2));
+        EXPECT_EQ(stats.profile, uint64_t(5));
+        EXPECT_EQ(stats.ndiag, uint64_t(3));
+
+        // (1, 0) and (3, 1) are matched, (2, 0) is not
+        EXPECT_DOUBLE_EQ(stats.symmetry(), 80.0);
+
+        EXPECT_EQ(stats.nnzb[2], uint64_t(4));
+        EXPECT_DOUBLE_EQ(stats.fill(2), 0.5);
+        EXPECT_EQ(stats.nnzb[3], uint64_t(3));
+        for(uint64_t b = 4; b <= rocsparseio_stream_statistics_csx::max_block_dim; ++b)
+        {
+            EXPECT_EQ(stats.nnzb[b], uint64_t(1));
+        }
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TYPE)                                                  \
+    template void testing_rocsparseio_bad_arg<ITYPE, JTYPE, TYPE>(const Arguments& arg); \
+    template void testing_rocsparseio<ITYPE, JTYPE, TYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
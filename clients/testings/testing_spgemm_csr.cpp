@@ -368,7 +368,8 @@ void testing_spgemm_csr(const Arguments& arg)
         //
         // Compute C on host.
         //
-        host_csr hC;
+        host_csr                hC;
+        host_csrgemm_info<I, J> info;
 
         {
             I hC_nnz = 0;
@@ -389,7 +390,8 @@ void testing_spgemm_csr(const Arguments& arg)
                                       hA.base,
                                       hB.base,
                                       hC.base,
-                                      hD.base);
+                                      hD.base,
+                                      &info);
             hC.define(hC.m, hC.n, hC_nnz, hC.base);
         }
 
@@ -413,7 +415,8 @@ void testing_spgemm_csr(const Arguments& arg)
                               hA.base,
                               hB.base,
                               hC.base,
-                              hD.base);
+                              hD.base,
+                              info);
 
         //
         // Compute C on device with mode host.
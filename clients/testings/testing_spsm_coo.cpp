@@ -469,7 +469,8 @@ void testing_spsm_coo(const Arguments& arg)
                          uplo,
                          base,
                          &analysis_pivot,
-                         &solve_pivot);
+                         &solve_pivot,
+                         rocsparse_get_warp_size());
 
         if(analysis_pivot == -1 && solve_pivot == -1)
         {
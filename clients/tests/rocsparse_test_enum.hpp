@@ -31,6 +31,7 @@ static constexpr std::size_t countof2(T (&)[N])
 
 // clang-format off
 #define ROCSPARSE_FOREACH_TEST_ENUM		\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(analysis_cache)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(axpby)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(axpyi)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(bsr2csr)				\
@@ -119,11 +120,14 @@ static constexpr std::size_t countof2(T (&)[N])
   TRANSFORM_ROCSPARSE_TEST_ENUM(hybmv)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(identity)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(inverse_permutation)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(matrix_file_cache)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(matrix_io)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(nnz)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr_by_percentage)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_csr2csr)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_dense2csr_by_percentage)		\
   TRANSFORM_ROCSPARSE_TEST_ENUM(prune_dense2csr)			\
+  TRANSFORM_ROCSPARSE_TEST_ENUM(rocsparseio)				\
   TRANSFORM_ROCSPARSE_TEST_ENUM(rot)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(roti)					\
   TRANSFORM_ROCSPARSE_TEST_ENUM(scatter)				\
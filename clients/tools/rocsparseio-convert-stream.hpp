@@ -0,0 +1,1432 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+//
+// Streaming conversion of sparse matrices between the MatrixMarket, rocALUTION and
+// rocsparseio formats.
+//
+// A source delivers the row pointer of the matrix followed by batches of column indices
+// and values in row order, a sink writes them to the output file. The driver overlaps
+// the production of the next batch with the writing of the current one, such that the
+// memory footprint of a conversion is bounded by a few batches, the row pointer and the
+// budget of the external sort of the MatrixMarket source.
+//
+// The MatrixMarket source reads the text by large chunks on a dedicated thread, parses
+// each chunk with OpenMP and sorts the entries in runs of at most half the memory budget.
+// Runs are spilled to temporary files and k-way merged, an input already sorted by rows
+// ends up in a single run and is merged at no cost.
+//
+
+#include "rocsparseio.h"
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+#ifndef WIN32
+#include <unistd.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace convert_stream
+{
+    struct options_t
+    {
+        uint64_t    memory{uint64_t(1) << 30}; //!< memory budget of the external sort, in bytes.
+        uint64_t    chunk_size{uint64_t(64) << 20}; //!< text chunk size, in bytes.
+        uint64_t    batch_size{uint64_t(1) << 20}; //!< number of non-zeros per batch.
+        std::string tmpdir{}; //!< directory of the sorted runs.
+        bool        verbose{};
+    };
+
+    template <typename T>
+    struct batch_t
+    {
+        std::vector<int64_t> ind{};
+        std::vector<T>       val{};
+    };
+
+    inline int num_threads()
+    {
+#ifdef _OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    template <typename T>
+    struct value_traits_t;
+
+    template <>
+    struct value_traits_t<double>
+    {
+        static constexpr rocsparseio_type type  = rocsparseio_type_float64;
+        static constexpr const char*      field = "real";
+    };
+
+    template <>
+    struct value_traits_t<std::complex<double>>
+    {
+        static constexpr rocsparseio_type type  = rocsparseio_type_complex64;
+        static constexpr const char*      field = "complex";
+    };
+
+    inline void set_value(double& v_, double re_, double)
+    {
+        v_ = re_;
+    }
+
+    inline void set_value(std::complex<double>& v_, double re_, double im_)
+    {
+        v_ = std::complex<double>(re_, im_);
+    }
+
+    inline double conj(double v_)
+    {
+        return v_;
+    }
+
+    inline std::complex<double> conj(const std::complex<double>& v_)
+    {
+        return std::conj(v_);
+    }
+
+    inline int format_value(char* buffer_, size_t size_, double v_)
+    {
+        return snprintf(buffer_, size_, " %.17g", v_);
+    }
+
+    inline int format_value(char* buffer_, size_t size_, const std::complex<double>& v_)
+    {
+        return snprintf(buffer_, size_, " %.17g %.17g", std::real(v_), std::imag(v_));
+    }
+
+    inline int64_t get_index(rocsparseio_type type_, const void* data_, uint64_t i_)
+    {
+        return (type_ == rocsparseio_type_int32) ? ((const int32_t*)data_)[i_]
+                                                 : ((const int64_t*)data_)[i_];
+    }
+
+    inline void get_value(rocsparseio_type type_, const void* data_, uint64_t i_, double& v_)
+    {
+        switch(type_)
+        {
+        case rocsparseio_type_int8:
+            v_ = ((const int8_t*)data_)[i_];
+            return;
+        case rocsparseio_type_int32:
+            v_ = ((const int32_t*)data_)[i_];
+            return;
+        case rocsparseio_type_int64:
+            v_ = double(((const int64_t*)data_)[i_]);
+            return;
+        case rocsparseio_type_float32:
+            v_ = ((const float*)data_)[i_];
+            return;
+        default:
+            v_ = ((const double*)data_)[i_];
+            return;
+        }
+    }
+
+    inline void get_value(rocsparseio_type      type_,
+                          const void*           data_,
+                          uint64_t              i_,
+                          std::complex<double>& v_)
+    {
+        if(type_ == rocsparseio_type_complex32)
+        {
+            const std::complex<float> z = ((const std::complex<float>*)data_)[i_];
+            v_                          = std::complex<double>(z.real(), z.imag());
+        }
+        else
+        {
+            v_ = ((const std::complex<double>*)data_)[i_];
+        }
+    }
+
+    //
+    // Sort a sequence in parallel, each thread sorts a contiguous part and the parts are
+    // merged pairwise.
+    //
+    template <typename E, typename C>
+    inline void parallel_sort(std::vector<E>& v_, C less_)
+    {
+        const size_t size     = v_.size();
+        const int    nthreads = std::max(1, std::min(num_threads(), int(size / 65536)));
+        if(nthreads == 1)
+        {
+            std::sort(v_.begin(), v_.end(), less_);
+            return;
+        }
+
+        std::vector<size_t> bounds(nthreads + 1);
+        for(int t = 0; t <= nthreads; ++t)
+        {
+            bounds[t] = (size * t) / nthreads;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+        for(int t = 0; t < nthreads; ++t)
+        {
+            std::sort(v_.begin() + bounds[t], v_.begin() + bounds[t + 1], less_);
+        }
+
+        for(int width = 1; width < nthreads; width *= 2)
+        {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for(int t = 0; t < nthreads - width; t += 2 * width)
+            {
+                const int last = std::min(t + 2 * width, nthreads);
+                std::inplace_merge(v_.begin() + bounds[t],
+                                   v_.begin() + bounds[t + width],
+                                   v_.begin() + bounds[last],
+                                   less_);
+            }
+        }
+    }
+
+    //
+    // Create an anonymous temporary file, removed when closed.
+    //
+    inline FILE* temporary_file(const std::string& tmpdir_)
+    {
+#ifndef WIN32
+        std::string dir = tmpdir_;
+        if(dir.empty())
+        {
+            const char* env = getenv("TMPDIR");
+            dir             = (env != nullptr && env[0] != '\0') ? env : "/tmp";
+        }
+
+        std::string path = dir + "/rocsparseio-convert-XXXXXX";
+        const int   fd   = mkstemp(&path[0]);
+        if(fd == -1)
+        {
+            return nullptr;
+        }
+
+        unlink(path.c_str());
+        FILE* f = fdopen(fd, "w+b");
+        if(f == nullptr)
+        {
+            close(fd);
+        }
+        return f;
+#else
+        return tmpfile();
+#endif
+    }
+
+    //
+    // Read a text file by chunks ending with a complete line, the chunks are read ahead on
+    // a dedicated thread.
+    //
+    class text_chunk_reader_t
+    {
+    public:
+        text_chunk_reader_t(FILE* f_, uint64_t chunk_size_)
+            : m_f(f_)
+            , m_chunk_size(std::max(chunk_size_, uint64_t(4096)))
+            , m_producer([this]() { this->produce(); })
+        {
+        }
+
+        ~text_chunk_reader_t()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_cv.notify_all();
+            m_producer.join();
+        }
+
+        text_chunk_reader_t(const text_chunk_reader_t&) = delete;
+        text_chunk_reader_t& operator=(const text_chunk_reader_t&) = delete;
+
+        //
+        // Get the next chunk, returns false at the end of the file.
+        //
+        bool next(std::vector<char>& chunk_)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return !m_queue.empty() || m_done; });
+            if(m_queue.empty())
+            {
+                return false;
+            }
+
+            chunk_ = std::move(m_queue.front());
+            m_queue.pop_front();
+            lock.unlock();
+            m_cv.notify_all();
+            return true;
+        }
+
+        bool failed() const
+        {
+            return ferror(m_f) != 0;
+        }
+
+    private:
+        void produce()
+        {
+            std::vector<char> carry;
+            for(;;)
+            {
+                std::vector<char> chunk(std::move(carry));
+                carry.clear();
+
+                const size_t offset = chunk.size();
+                chunk.resize(offset + m_chunk_size);
+                const size_t count = fread(chunk.data() + offset, 1, m_chunk_size, m_f);
+                chunk.resize(offset + count);
+
+                const bool eof = (count < m_chunk_size);
+                if(!eof)
+                {
+                    //
+                    // The trailing incomplete line is carried to the next chunk.
+                    //
+                    size_t end = chunk.size();
+                    while(end > 0 && chunk[end - 1] != '\n')
+                    {
+                        --end;
+                    }
+
+                    if(end == 0)
+                    {
+                        carry = std::move(chunk);
+                        continue;
+                    }
+
+                    carry.assign(chunk.begin() + end, chunk.end());
+                    chunk.resize(end);
+                }
+
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_cv.wait(lock, [this]() { return m_queue.size() < s_queue_size || m_stop; });
+                    if(m_stop)
+                    {
+                        return;
+                    }
+                    m_queue.push_back(std::move(chunk));
+                    m_done = eof;
+                }
+                m_cv.notify_all();
+
+                if(eof)
+                {
+                    return;
+                }
+            }
+        }
+
+        static constexpr size_t       s_queue_size = 2;
+        FILE*                         m_f;
+        uint64_t                      m_chunk_size;
+        std::mutex                    m_mutex{};
+        std::condition_variable       m_cv{};
+        std::deque<std::vector<char>> m_queue{};
+        bool                          m_done{};
+        bool                          m_stop{};
+        std::thread                   m_producer;
+    };
+
+    template <typename T>
+    struct mtx_entry_t
+    {
+        int64_t row;
+        int64_t col;
+        T       val;
+    };
+
+    template <typename T>
+    inline bool mtx_entry_less(const mtx_entry_t<T>& a_, const mtx_entry_t<T>& b_)
+    {
+        return (a_.row < b_.row) || (a_.row == b_.row && a_.col < b_.col);
+    }
+
+    typedef enum mtx_field_
+    {
+        mtx_field_real,
+        mtx_field_integer,
+        mtx_field_complex,
+        mtx_field_pattern
+    } mtx_field_t;
+
+    typedef enum mtx_symmetry_
+    {
+        mtx_symmetry_general,
+        mtx_symmetry_symmetric,
+        mtx_symmetry_skew_symmetric,
+        mtx_symmetry_hermitian
+    } mtx_symmetry_t;
+
+    struct mtx_banner_t
+    {
+        mtx_field_t    field{mtx_field_real};
+        mtx_symmetry_t symmetry{mtx_symmetry_general};
+        int64_t        m{};
+        int64_t        n{};
+        int64_t        nnz{};
+    };
+
+    //
+    // Read the banner and the size line of a MatrixMarket coordinate file.
+    //
+    inline bool read_mtx_banner(FILE* f_, mtx_banner_t& banner_)
+    {
+        char line[1024];
+        if(fgets(line, sizeof(line), f_) == nullptr)
+        {
+            std::cerr << "cannot read the MatrixMarket banner" << std::endl;
+            return false;
+        }
+
+        char banner[64], object[64], format[64], field[64], symmetry[64];
+        if(sscanf(line, "%63s %63s %63s %63s %63s", banner, object, format, field, symmetry)
+           != 5)
+        {
+            std::cerr << "invalid MatrixMarket banner" << std::endl;
+            return false;
+        }
+
+        for(char* p : {object, format, field, symmetry})
+        {
+            for(; *p != '\0'; ++p)
+            {
+                *p = char(tolower(*p));
+            }
+        }
+
+        if(strcmp(banner, "%%MatrixMarket") != 0 || strcmp(object, "matrix") != 0
+           || strcmp(format, "coordinate") != 0)
+        {
+            std::cerr << "only MatrixMarket coordinate matrices are supported" << std::endl;
+            return false;
+        }
+
+        if(strcmp(field, "real") == 0)
+            banner_.field = mtx_field_real;
+        else if(strcmp(field, "integer") == 0)
+            banner_.field = mtx_field_integer;
+        else if(strcmp(field, "complex") == 0)
+            banner_.field = mtx_field_complex;
+        else if(strcmp(field, "pattern") == 0)
+            banner_.field = mtx_field_pattern;
+        else
+        {
+            std::cerr << "unsupported MatrixMarket field '" << field << "'" << std::endl;
+            return false;
+        }
+
+        if(strcmp(symmetry, "general") == 0)
+            banner_.symmetry = mtx_symmetry_general;
+        else if(strcmp(symmetry, "symmetric") == 0)
+            banner_.symmetry = mtx_symmetry_symmetric;
+        else if(strcmp(symmetry, "skew-symmetric") == 0)
+            banner_.symmetry = mtx_symmetry_skew_symmetric;
+        else if(strcmp(symmetry, "hermitian") == 0)
+            banner_.symmetry = mtx_symmetry_hermitian;
+        else
+        {
+            std::cerr << "unsupported MatrixMarket symmetry '" << symmetry << "'" << std::endl;
+            return false;
+        }
+
+        //
+        // Skip the comments.
+        //
+        do
+        {
+            if(fgets(line, sizeof(line), f_) == nullptr)
+            {
+                std::cerr << "cannot read the MatrixMarket size line" << std::endl;
+                return false;
+            }
+        } while(line[0] == '%');
+
+        long long m, n, nnz;
+        if(sscanf(line, "%lld %lld %lld", &m, &n, &nnz) != 3 || m < 0 || n < 0 || nnz < 0)
+        {
+            std::cerr << "invalid MatrixMarket size line" << std::endl;
+            return false;
+        }
+
+        banner_.m   = m;
+        banner_.n   = n;
+        banner_.nnz = nnz;
+        return true;
+    }
+
+    //
+    // Parse the lines of [begin_, end_), the entries of the symmetric part are expanded.
+    //
+    template <typename T>
+    inline bool parse_mtx_lines(const char*                  begin_,
+                                const char*                  end_,
+                                const mtx_banner_t&          banner_,
+                                std::vector<mtx_entry_t<T>>& entries_,
+                                int64_t&                     nlines_)
+    {
+        const char* p = begin_;
+        while(p < end_)
+        {
+            const char* eol = (const char*)memchr(p, '\n', end_ - p);
+            if(eol == nullptr)
+            {
+                eol = end_;
+            }
+
+            while(p < eol && (*p == ' ' || *p == '\t' || *p == '\r'))
+            {
+                ++p;
+            }
+
+            if(p < eol && *p != '%')
+            {
+                char*         q;
+                const int64_t row = strtoll(p, &q, 10);
+                if(q == p || q > eol)
+                    return false;
+                p                 = q;
+                const int64_t col = strtoll(p, &q, 10);
+                if(q == p || q > eol)
+                    return false;
+                p = q;
+
+                double re = 1.0, im = 0.0;
+                if(banner_.field != mtx_field_pattern)
+                {
+                    re = strtod(p, &q);
+                    if(q == p || q > eol)
+                        return false;
+                    p = q;
+                    if(banner_.field == mtx_field_complex)
+                    {
+                        im = strtod(p, &q);
+                        if(q == p || q > eol)
+                            return false;
+                    }
+                }
+
+                if(row < 1 || row > banner_.m || col < 1 || col > banner_.n)
+                {
+                    return false;
+                }
+
+                mtx_entry_t<T> entry;
+                entry.row = row - 1;
+                entry.col = col - 1;
+                set_value(entry.val, re, im);
+                entries_.push_back(entry);
+                ++nlines_;
+
+                if(banner_.symmetry != mtx_symmetry_general && row != col)
+                {
+                    std::swap(entry.row, entry.col);
+                    switch(banner_.symmetry)
+                    {
+                    case mtx_symmetry_skew_symmetric:
+                        entry.val = -entry.val;
+                        break;
+                    case mtx_symmetry_hermitian:
+                        entry.val = conj(entry.val);
+                        break;
+                    default:
+                        break;
+                    }
+                    entries_.push_back(entry);
+                }
+            }
+
+            p = eol + 1;
+        }
+        return true;
+    }
+
+    //
+    // MatrixMarket source, the entries are sorted by rows with an external merge sort.
+    //
+    template <typename T>
+    class mtx_source_t
+    {
+    public:
+        typedef mtx_entry_t<T> entry_t;
+
+        int64_t              m{};
+        int64_t              n{};
+        int64_t              nnz{};
+        std::vector<int64_t> ptr{};
+
+        ~mtx_source_t()
+        {
+            for(auto& r : m_runs)
+            {
+                fclose(r.f);
+            }
+        }
+
+        bool open(const char* filename_, const options_t& options_)
+        {
+            m_options = options_;
+            m_batch   = std::max(options_.batch_size, uint64_t(1));
+
+            FILE* f = fopen(filename_, "rb");
+            if(f == nullptr)
+            {
+                std::cerr << "cannot open file '" << filename_ << "'" << std::endl;
+                return false;
+            }
+
+            const bool ok = read_mtx_banner(f, m_banner) && this->sort_entries(f);
+            fclose(f);
+            if(!ok)
+            {
+                return false;
+            }
+
+            this->m   = m_banner.m;
+            this->n   = m_banner.n;
+            for(int64_t i = 0; i < this->m; ++i)
+            {
+                this->ptr[i + 1] += this->ptr[i];
+            }
+            this->nnz = this->ptr[this->m];
+            return this->init_merge();
+        }
+
+        bool next(batch_t<T>& batch_)
+        {
+            batch_.ind.clear();
+            batch_.val.clear();
+            if(m_runs.empty())
+            {
+                const size_t count = std::min(size_t(m_batch), m_run.size() - m_position);
+                for(size_t k = 0; k < count; ++k)
+                {
+                    const entry_t& e = m_run[m_position + k];
+                    batch_.ind.push_back(e.col);
+                    batch_.val.push_back(e.val);
+                }
+                m_position += count;
+                return true;
+            }
+
+            while(batch_.ind.size() < m_batch && !m_heap.empty())
+            {
+                const size_t r = m_heap.top();
+                m_heap.pop();
+
+                run_t&         run = m_runs[r];
+                const entry_t& e   = run.buffer[run.position++];
+                batch_.ind.push_back(e.col);
+                batch_.val.push_back(e.val);
+
+                if(run.position == run.buffer.size())
+                {
+                    if(!this->fill(run))
+                    {
+                        return false;
+                    }
+                }
+
+                if(run.position < run.buffer.size())
+                {
+                    m_heap.push(r);
+                }
+            }
+            return true;
+        }
+
+    private:
+        struct run_t
+        {
+            FILE*                f{};
+            uint64_t             size{};
+            uint64_t             remaining{};
+            std::vector<entry_t> buffer{};
+            size_t               position{};
+        };
+
+        struct run_greater_t
+        {
+            const std::vector<run_t>* runs;
+            bool                      operator()(size_t a_, size_t b_) const
+            {
+                const run_t& a = (*runs)[a_];
+                const run_t& b = (*runs)[b_];
+                return mtx_entry_less(b.buffer[b.position], a.buffer[a.position]);
+            }
+        };
+
+        //
+        // First pass, parse the text and produce the sorted runs.
+        //
+        bool sort_entries(FILE* f_)
+        {
+            const uint64_t capacity
+                = std::max(m_options.memory / (2 * sizeof(entry_t)), uint64_t(1024));
+
+            this->ptr.assign(m_banner.m + 1, 0);
+            m_run.reserve(std::min(capacity, uint64_t(m_banner.nnz) * 2 + 1));
+
+            const int                                nthreads = num_threads();
+            std::vector<std::vector<entry_t>>        parts(nthreads);
+            std::vector<int64_t>                     nlines(nthreads);
+            std::vector<char>                        chunk;
+            int64_t                                  total_lines = 0;
+            const auto                               start = std::chrono::steady_clock::now();
+            text_chunk_reader_t                      reader(f_, m_options.chunk_size);
+            while(reader.next(chunk))
+            {
+                //
+                // Split the chunk at line boundaries and parse each part.
+                //
+                const char* data = chunk.data();
+                const char* end  = data + chunk.size();
+                bool        ok   = true;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) reduction(&& : ok)
+#endif
+                {
+#ifdef _OPENMP
+                    const int t  = omp_get_thread_num();
+                    const int nt = omp_get_num_threads();
+#else
+                    const int t  = 0;
+                    const int nt = 1;
+#endif
+                    const char* b = data + (chunk.size() * t) / nt;
+                    const char* e = data + (chunk.size() * (t + 1)) / nt;
+                    if(t > 0)
+                    {
+                        b = (const char*)memchr(b - 1, '\n', end - (b - 1));
+                        b = (b == nullptr) ? end : b + 1;
+                    }
+                    if(t + 1 < nt)
+                    {
+                        e = (const char*)memchr(e - 1, '\n', end - (e - 1));
+                        e = (e == nullptr) ? end : e + 1;
+                    }
+
+                    parts[t].clear();
+                    nlines[t] = 0;
+                    ok        = (b >= e) || parse_mtx_lines(b, e, m_banner, parts[t], nlines[t]);
+                }
+
+                if(!ok)
+                {
+                    std::cerr << "invalid MatrixMarket entry" << std::endl;
+                    return false;
+                }
+
+                for(int t = 0; t < nthreads; ++t)
+                {
+                    total_lines += nlines[t];
+                    for(const entry_t& e : parts[t])
+                    {
+                        if(m_run_sorted && !m_run.empty() && mtx_entry_less(e, m_run.back()))
+                        {
+                            m_run_sorted = false;
+                        }
+                        ++this->ptr[e.row + 1];
+                        m_run.push_back(e);
+                        if(m_run.size() >= capacity && !this->spill())
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            if(reader.failed())
+            {
+                std::cerr << "cannot read the MatrixMarket entries" << std::endl;
+                return false;
+            }
+
+            if(total_lines != m_banner.nnz)
+            {
+                std::cerr << "invalid MatrixMarket file, " << total_lines << " entries read, "
+                          << m_banner.nnz << " expected" << std::endl;
+                return false;
+            }
+
+            if(m_options.verbose)
+            {
+                const double seconds = std::chrono::duration<double>(
+                                           std::chrono::steady_clock::now() - start)
+                                           .count();
+                std::cout << "parse : " << total_lines << " entries, " << seconds << " s"
+                          << std::endl;
+            }
+            return true;
+        }
+
+        //
+        // Write the run buffer to a temporary file, the buffer is appended to the last run
+        // if it follows it in order.
+        //
+        bool spill()
+        {
+            if(m_run.empty())
+            {
+                return true;
+            }
+
+            if(!m_run_sorted)
+            {
+                parallel_sort(m_run, mtx_entry_less<T>);
+            }
+
+            if(m_runs.empty() || mtx_entry_less(m_run.front(), m_last))
+            {
+                run_t run;
+                run.f = temporary_file(m_options.tmpdir);
+                if(run.f == nullptr)
+                {
+                    std::cerr << "cannot create a temporary file" << std::endl;
+                    return false;
+                }
+                m_runs.push_back(std::move(run));
+            }
+
+            run_t& run = m_runs.back();
+            if(fwrite(m_run.data(), sizeof(entry_t), m_run.size(), run.f) != m_run.size())
+            {
+                std::cerr << "cannot write a temporary file" << std::endl;
+                return false;
+            }
+
+            run.size += m_run.size();
+            m_last       = m_run.back();
+            m_run_sorted = true;
+            m_run.clear();
+            return true;
+        }
+
+        bool fill(run_t& run_)
+        {
+            const uint64_t count = std::min(m_run_buffer_size, run_.remaining);
+            run_.buffer.resize(count);
+            run_.position = 0;
+            if(count > 0 && fread(run_.buffer.data(), sizeof(entry_t), count, run_.f) != count)
+            {
+                std::cerr << "cannot read a temporary file" << std::endl;
+                return false;
+            }
+            run_.remaining -= count;
+            return true;
+        }
+
+        bool init_merge()
+        {
+            if(m_runs.empty())
+            {
+                if(!m_run_sorted)
+                {
+                    parallel_sort(m_run, mtx_entry_less<T>);
+                }
+                m_position = 0;
+                return true;
+            }
+
+            if(!this->spill())
+            {
+                return false;
+            }
+            m_run = std::vector<entry_t>();
+
+            if(m_options.verbose)
+            {
+                std::cout << "sort  : " << m_runs.size() << " run(s)" << std::endl;
+            }
+
+            m_run_buffer_size = std::max(
+                m_options.memory / (2 * sizeof(entry_t) * m_runs.size()), uint64_t(1024));
+            m_heap = heap_t(run_greater_t{&m_runs});
+            for(size_t r = 0; r < m_runs.size(); ++r)
+            {
+                run_t& run    = m_runs[r];
+                run.remaining = run.size;
+                if(fseek(run.f, 0, SEEK_SET) != 0 || !this->fill(run))
+                {
+                    return false;
+                }
+                if(!run.buffer.empty())
+                {
+                    m_heap.push(r);
+                }
+            }
+            return true;
+        }
+
+        typedef std::priority_queue<size_t, std::vector<size_t>, run_greater_t> heap_t;
+
+        options_t            m_options{};
+        uint64_t             m_batch{};
+        mtx_banner_t         m_banner{};
+        std::vector<entry_t> m_run{};
+        bool                 m_run_sorted{true};
+        size_t               m_position{};
+        entry_t              m_last{};
+        std::vector<run_t>   m_runs{};
+        uint64_t             m_run_buffer_size{};
+        heap_t               m_heap{run_greater_t{nullptr}};
+    };
+
+    //
+    // rocALUTION binary csr source.
+    //
+    template <typename T>
+    class rocalution_source_t
+    {
+    public:
+        int64_t              m{};
+        int64_t              n{};
+        int64_t              nnz{};
+        std::vector<int64_t> ptr{};
+
+        ~rocalution_source_t()
+        {
+            if(m_fcol != nullptr)
+                fclose(m_fcol);
+            if(m_fval != nullptr)
+                fclose(m_fval);
+        }
+
+        bool open(const char* filename_, const options_t& options_)
+        {
+            m_batch = std::max(options_.batch_size, uint64_t(1));
+            m_fcol  = fopen(filename_, "rb");
+            m_fval  = fopen(filename_, "rb");
+            if(m_fcol == nullptr || m_fval == nullptr)
+            {
+                std::cerr << "cannot open file '" << filename_ << "'" << std::endl;
+                return false;
+            }
+
+            char line[256];
+            if(fgets(line, sizeof(line), m_fcol) == nullptr
+               || strcmp(line, "#rocALUTION binary csr file\n") != 0)
+            {
+                std::cerr << "invalid rocALUTION header" << std::endl;
+                return false;
+            }
+
+            int header[4];
+            if(fread(header, sizeof(int), 4, m_fcol) != 4)
+            {
+                std::cerr << "invalid rocALUTION header" << std::endl;
+                return false;
+            }
+
+            this->m   = header[1];
+            this->n   = header[2];
+            this->nnz = header[3];
+
+            std::vector<int> iptr(this->m + 1);
+            if(fread(iptr.data(), sizeof(int), this->m + 1, m_fcol) != size_t(this->m + 1))
+            {
+                std::cerr << "cannot read the rocALUTION row pointer" << std::endl;
+                return false;
+            }
+            this->ptr.assign(iptr.begin(), iptr.end());
+
+            const long col_offset = ftell(m_fcol);
+            const long val_offset = col_offset + long(sizeof(int) * this->nnz);
+            return fseek(m_fval, val_offset, SEEK_SET) == 0;
+        }
+
+        bool next(batch_t<T>& batch_)
+        {
+            const size_t count = size_t(std::min(uint64_t(this->nnz - m_position), m_batch));
+            m_col.resize(count);
+            batch_.ind.resize(count);
+            batch_.val.resize(count);
+            if(fread(m_col.data(), sizeof(int), count, m_fcol) != count
+               || fread(batch_.val.data(), sizeof(T), count, m_fval) != count)
+            {
+                std::cerr << "cannot read the rocALUTION entries" << std::endl;
+                return false;
+            }
+            std::copy(m_col.begin(), m_col.end(), batch_.ind.begin());
+            m_position += count;
+            return true;
+        }
+
+    private:
+        FILE*            m_fcol{};
+        FILE*            m_fval{};
+        uint64_t         m_batch{};
+        int64_t          m_position{};
+        std::vector<int> m_col{};
+    };
+
+    //
+    // rocsparseio csr source, the arrays are mapped and converted batch by batch.
+    //
+    template <typename T>
+    class rocsparseio_source_t
+    {
+    public:
+        int64_t              m{};
+        int64_t              n{};
+        int64_t              nnz{};
+        std::vector<int64_t> ptr{};
+
+        ~rocsparseio_source_t()
+        {
+            if(m_map != nullptr)
+                rocsparseiox_unmap(m_map);
+            if(m_handle != nullptr)
+                rocsparseio_close(m_handle);
+        }
+
+        bool open(const char* filename_, const options_t& options_)
+        {
+            m_batch = std::max(options_.batch_size, uint64_t(1));
+            if(rocsparseio_open(&m_handle, rocsparseio_rwmode_read, filename_)
+               != rocsparseio_status_success)
+            {
+                std::cerr << "cannot open file '" << filename_ << "'" << std::endl;
+                return false;
+            }
+
+            rocsparseio_direction dir;
+            uint64_t              m, n, nnz;
+            rocsparseio_type      ptr_type;
+            rocsparseio_index_base base;
+            if(rocsparseiox_read_metadata_sparse_csx(
+                   m_handle, &dir, &m, &n, &nnz, &ptr_type, &m_ind_type, &m_val_type, &base)
+               != rocsparseio_status_success)
+            {
+                std::cerr << "cannot read the csx metadata" << std::endl;
+                return false;
+            }
+
+            if(dir != rocsparseio_direction_row)
+            {
+                std::cerr << "only csr matrices are supported" << std::endl;
+                return false;
+            }
+
+            const void* ptr_data;
+            if(rocsparseiox_map_sparse_csx(m_handle, &m_map, &ptr_data, &m_ind, &m_val)
+               != rocsparseio_status_success)
+            {
+                std::cerr << "cannot map the csr matrix" << std::endl;
+                return false;
+            }
+
+            this->m = m;
+            this->n = n;
+            this->nnz = nnz;
+            m_base    = base;
+            this->ptr.resize(m + 1);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for(int64_t i = 0; i <= this->m; ++i)
+            {
+                this->ptr[i] = get_index(ptr_type, ptr_data, i) - m_base;
+            }
+            return true;
+        }
+
+        bool next(batch_t<T>& batch_)
+        {
+            const int64_t count = int64_t(std::min(uint64_t(this->nnz - m_position), m_batch));
+            batch_.ind.resize(count);
+            batch_.val.resize(count);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for(int64_t k = 0; k < count; ++k)
+            {
+                batch_.ind[k] = get_index(m_ind_type, m_ind, m_position + k) - m_base;
+                get_value(m_val_type, m_val, m_position + k, batch_.val[k]);
+            }
+            m_position += count;
+            return true;
+        }
+
+    private:
+        rocsparseio_handle m_handle{};
+        rocsparseio_map    m_map{};
+        const void*        m_ind{};
+        const void*        m_val{};
+        rocsparseio_type   m_ind_type{};
+        rocsparseio_type   m_val_type{};
+        int64_t            m_base{};
+        uint64_t           m_batch{};
+        int64_t            m_position{};
+    };
+
+    //
+    // MatrixMarket sink, the lines of a batch are formatted in parallel.
+    //
+    template <typename T>
+    class mtx_sink_t
+    {
+    public:
+        explicit mtx_sink_t(const char* filename_)
+            : m_filename(filename_)
+        {
+        }
+
+        ~mtx_sink_t()
+        {
+            if(m_f != nullptr)
+                fclose(m_f);
+        }
+
+        bool begin(int64_t m_, int64_t n_, int64_t nnz_, const std::vector<int64_t>& ptr_)
+        {
+            m_f = fopen(m_filename, "wb");
+            if(m_f == nullptr)
+            {
+                std::cerr << "cannot open file '" << m_filename << "'" << std::endl;
+                return false;
+            }
+
+            m_ptr = &ptr_;
+            fprintf(m_f,
+                    "%%%%MatrixMarket matrix coordinate %s general\n%lld %lld %lld\n",
+                    value_traits_t<T>::field,
+                    (long long)m_,
+                    (long long)n_,
+                    (long long)nnz_);
+            return ferror(m_f) == 0;
+        }
+
+        bool write(const batch_t<T>& batch_)
+        {
+            const int64_t count    = batch_.ind.size();
+            const int     nthreads = std::max(1, std::min(num_threads(), int(count / 4096)));
+            m_text.resize(nthreads);
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+            for(int t = 0; t < nthreads; ++t)
+            {
+                const int64_t kbeg = (count * t) / nthreads;
+                const int64_t kend = (count * (t + 1)) / nthreads;
+                const std::vector<int64_t>& ptr  = *m_ptr;
+                int64_t                     row  = std::upper_bound(ptr.begin(),
+                                                   ptr.end(),
+                                                   m_position + kbeg)
+                               - ptr.begin() - 1;
+                std::string&                text = m_text[t];
+                char                        line[128];
+                text.clear();
+                for(int64_t k = kbeg; k < kend; ++k)
+                {
+                    while(ptr[row + 1] <= m_position + k)
+                    {
+                        ++row;
+                    }
+                    int len = snprintf(line,
+                                       sizeof(line),
+                                       "%lld %lld",
+                                       (long long)(row + 1),
+                                       (long long)(batch_.ind[k] + 1));
+                    len += format_value(line + len, sizeof(line) - len, batch_.val[k]);
+                    line[len++] = '\n';
+                    text.append(line, len);
+                }
+            }
+
+            for(const std::string& text : m_text)
+            {
+                if(fwrite(text.data(), 1, text.size(), m_f) != text.size())
+                {
+                    std::cerr << "cannot write file '" << m_filename << "'" << std::endl;
+                    return false;
+                }
+            }
+            m_position += count;
+            return true;
+        }
+
+        bool end()
+        {
+            const bool ok = (fclose(m_f) == 0);
+            m_f           = nullptr;
+            return ok;
+        }
+
+    private:
+        const char*                 m_filename;
+        FILE*                       m_f{};
+        const std::vector<int64_t>* m_ptr{};
+        int64_t                     m_position{};
+        std::vector<std::string>    m_text{};
+    };
+
+    //
+    // rocALUTION binary csr sink, the column indices and the values are written to their
+    // respective regions of the file.
+    //
+    template <typename T>
+    class rocalution_sink_t
+    {
+    public:
+        explicit rocalution_sink_t(const char* filename_)
+            : m_filename(filename_)
+        {
+        }
+
+        ~rocalution_sink_t()
+        {
+            if(m_f != nullptr)
+                fclose(m_f);
+        }
+
+        bool begin(int64_t m_, int64_t n_, int64_t nnz_, const std::vector<int64_t>& ptr_)
+        {
+            const int64_t limit = std::numeric_limits<int>::max();
+            if(m_ > limit || n_ > limit || nnz_ > limit)
+            {
+                std::cerr << "the matrix is too large for the rocALUTION format" << std::endl;
+                return false;
+            }
+
+            m_f = fopen(m_filename, "wb");
+            if(m_f == nullptr)
+            {
+                std::cerr << "cannot open file '" << m_filename << "'" << std::endl;
+                return false;
+            }
+
+            const int        header[4] = {10602, int(m_), int(n_), int(nnz_)};
+            std::vector<int> iptr(ptr_.begin(), ptr_.end());
+            fputs("#rocALUTION binary csr file\n", m_f);
+            fwrite(header, sizeof(int), 4, m_f);
+            fwrite(iptr.data(), sizeof(int), iptr.size(), m_f);
+
+            m_col_offset = ftell(m_f);
+            m_val_offset = m_col_offset + long(sizeof(int) * nnz_);
+            return ferror(m_f) == 0;
+        }
+
+        bool write(const batch_t<T>& batch_)
+        {
+            const size_t count = batch_.ind.size();
+            m_col.assign(batch_.ind.begin(), batch_.ind.end());
+            if(fseek(m_f, m_col_offset + long(sizeof(int) * m_position), SEEK_SET) != 0
+               || fwrite(m_col.data(), sizeof(int), count, m_f) != count
+               || fseek(m_f, m_val_offset + long(sizeof(T) * m_position), SEEK_SET) != 0
+               || fwrite(batch_.val.data(), sizeof(T), count, m_f) != count)
+            {
+                std::cerr << "cannot write file '" << m_filename << "'" << std::endl;
+                return false;
+            }
+            m_position += count;
+            return true;
+        }
+
+        bool end()
+        {
+            const bool ok = (fclose(m_f) == 0);
+            m_f           = nullptr;
+            return ok;
+        }
+
+    private:
+        const char*      m_filename;
+        FILE*            m_f{};
+        long             m_col_offset{};
+        long             m_val_offset{};
+        int64_t          m_position{};
+        std::vector<int> m_col{};
+    };
+
+    //
+    // rocsparseio csr sink, with the streaming write of the csx format.
+    //
+    template <typename T>
+    class rocsparseio_sink_t
+    {
+    public:
+        explicit rocsparseio_sink_t(const char* filename_)
+            : m_filename(filename_)
+        {
+        }
+
+        ~rocsparseio_sink_t()
+        {
+            if(m_handle != nullptr)
+                rocsparseio_close(m_handle);
+        }
+
+        bool begin(int64_t m_, int64_t n_, int64_t nnz_, const std::vector<int64_t>& ptr_)
+        {
+            if(rocsparseio_open(&m_handle, rocsparseio_rwmode_write, m_filename)
+               != rocsparseio_status_success)
+            {
+                std::cerr << "cannot open file '" << m_filename << "'" << std::endl;
+                return false;
+            }
+
+            const int64_t          limit    = std::numeric_limits<int32_t>::max();
+            const rocsparseio_type ptr_type = (nnz_ <= limit) ? rocsparseio_type_int32
+                                                              : rocsparseio_type_int64;
+            m_ind_type = (n_ <= limit) ? rocsparseio_type_int32 : rocsparseio_type_int64;
+
+            std::vector<int32_t> ptr32;
+            const void*          ptr = ptr_.data();
+            if(ptr_type == rocsparseio_type_int32)
+            {
+                ptr32.assign(ptr_.begin(), ptr_.end());
+                ptr = ptr32.data();
+            }
+
+            if(rocsparseiox_write_sparse_csx_stream_begin(m_handle,
+                                                          rocsparseio_direction_row,
+                                                          m_,
+                                                          n_,
+                                                          nnz_,
+                                                          ptr_type,
+                                                          ptr,
+                                                          m_ind_type,
+                                                          value_traits_t<T>::type,
+                                                          rocsparseio_index_base_zero,
+                                                          "unknown")
+               != rocsparseio_status_success)
+            {
+                std::cerr << "cannot write file '" << m_filename << "'" << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        bool write(const batch_t<T>& batch_)
+        {
+            const void* ind = batch_.ind.data();
+            if(m_ind_type == rocsparseio_type_int32)
+            {
+                m_ind32.assign(batch_.ind.begin(), batch_.ind.end());
+                ind = m_ind32.data();
+            }
+
+            if(rocsparseiox_write_sparse_csx_stream(
+                   m_handle, batch_.ind.size(), ind, batch_.val.data())
+               != rocsparseio_status_success)
+            {
+                std::cerr << "cannot write file '" << m_filename << "'" << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        bool end()
+        {
+            const bool ok = rocsparseiox_write_sparse_csx_stream_end(m_handle)
+                            == rocsparseio_status_success;
+            const bool closed = rocsparseio_close(m_handle) == rocsparseio_status_success;
+            m_handle          = nullptr;
+            return ok && closed;
+        }
+
+    private:
+        const char*          m_filename;
+        rocsparseio_handle   m_handle{};
+        rocsparseio_type     m_ind_type{};
+        std::vector<int32_t> m_ind32{};
+    };
+
+    //
+    // Move the matrix from the source to the sink, the next batch is produced while the
+    // current one is written.
+    //
+    template <typename T, typename S, typename D>
+    inline int run(S& source_, D& sink_, const options_t& options_)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        if(!sink_.begin(source_.m, source_.n, source_.nnz, source_.ptr))
+        {
+            return -1;
+        }
+
+        batch_t<T> current, next;
+        int64_t    written = 0;
+        bool       ok      = source_.next(current);
+        while(ok && !current.ind.empty())
+        {
+            bool        produced = false;
+            std::thread producer([&]() { produced = source_.next(next); });
+            ok = sink_.write(current);
+            producer.join();
+            written += current.ind.size();
+            ok = ok && produced;
+            std::swap(current, next);
+        }
+
+        if(!ok || written != source_.nnz)
+        {
+            std::cerr << "conversion failed, " << written << " entries written, "
+                      << source_.nnz << " expected" << std::endl;
+            return -1;
+        }
+
+        if(!sink_.end())
+        {
+            return -1;
+        }
+
+        if(options_.verbose)
+        {
+            const double seconds
+                = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                      .count();
+            std::cout << "write : " << written << " entries, " << seconds << " s" << std::endl;
+        }
+        return 0;
+    }
+}
@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "app.hpp"
+#include "rocsparseio-convert-stream.hpp"
 #include "rocsparseio.h"
 #include <algorithm>
 #include <chrono>
@@ -169,407 +170,180 @@ inline std::ostream& operator<<(std::ostream& os, const rocsparseio::file_format
     return os;
 }
 
-struct mtx_header
-{
-    char banner[16];
-    char array[16];
-    char coord[16];
-    char data[16];
-    char type[16];
-    int  symmetric;
-};
-
-bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header)
+//
+// Get the value type of a streaming conversion, complex matrices are converted with double
+// precision complex values and real matrices with double precision values.
+//
+bool convert_stream_is_complex(rocsparseio::file_format_t format_,
+                               const char*                filename_,
+                               bool&                      is_complex_)
 {
-    char line[1024];
-
-    // Check for banner
-    if(!fgets(line, 1024, f))
-    {
-        return false;
-    }
-
-    // Extract banner
-    if(sscanf(line,
-              "%s %s %s %s %s",
-              header.banner,
-              header.array,
-              header.coord,
-              header.data,
-              header.type)
-       != 5)
-    {
-        return false;
-    }
-
-    // Convert to lower case
-    for(char* p = header.array; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = header.coord; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = header.data; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char* p = header.type; *p != '\0'; *p = tolower(*p), p++)
-        ;
-
-    // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14))
-    {
-        return false;
-    }
-
-    // Check array type
-    if(strcmp(header.array, "matrix"))
-    {
-        return false;
-    }
-
-    // Check coord
-    if(strcmp(header.coord, "coordinate"))
-    {
-        return false;
-    }
-
-    // Check data
-    if(strcmp(header.data, "real") && strcmp(header.data, "complex")
-       && strcmp(header.data, "integer") && strcmp(header.data, "pattern"))
-    {
-        return false;
-    }
-
-    // Check type
-    if(strcmp(header.type, "general") && strcmp(header.type, "symmetric")
-       && strcmp(header.type, "hermitian"))
+    switch(format_)
     {
-        return false;
-    }
-
-    // Symmetric flag
-    header.symmetric = !strcmp(header.type, "symmetric") || !strcmp(header.type, "hermitian");
-
-    // Skip comments
-    while(fgets(line, 1024, f))
+    case rocsparseio::file_format_t::mtx:
     {
-        if(line[0] != '%')
+        FILE* f = fopen(filename_, "rb");
+        if(f == nullptr)
         {
-            break;
+            std::cerr << "cannot open file '" << filename_ << "'" << std::endl;
+            return false;
         }
+        convert_stream::mtx_banner_t banner;
+        const bool                   ok = convert_stream::read_mtx_banner(f, banner);
+        fclose(f);
+        is_complex_ = (banner.field == convert_stream::mtx_field_complex);
+        return ok;
     }
 
-    // Read dimensions
-    sscanf(line, "%d %d %d", &nrow, &ncol, &nnz);
-
-    return true;
-}
-
-void set_value(double& dst, double rsrc, double isrc)
-{
-    dst = rsrc;
-}
-
-void set_value(std::complex<double>& dst, double rsrc, double isrc)
-{
-    dst = std::complex<double>(rsrc, isrc);
-}
-
-template <typename T>
-bool read_mtx_matrix(FILE*             f,
-                     const mtx_header& header,
-                     int               nrow,
-                     int               ncol,
-                     int&              nnz,
-                     std::vector<int>& row_ind,
-                     std::vector<int>& col_ind,
-                     std::vector<T>&   val)
-{
-    // Cache for line
-    char line[1024];
-
-    // Read unsorted data
-    std::vector<int> unsorted_row(header.symmetric ? nnz * 2 : nnz);
-    std::vector<int> unsorted_col(header.symmetric ? nnz * 2 : nnz);
-    std::vector<T>   unsorted_val(header.symmetric ? nnz * 2 : nnz);
+    case rocsparseio::file_format_t::csr:
+    {
+        is_complex_ = false;
+        return true;
+    }
 
-    // Read entries
-    int idx = 0;
-    while(fgets(line, 1024, f))
+    case rocsparseio::file_format_t::rocsparseio:
     {
-        if(idx >= (header.symmetric ? nnz * 2 : nnz))
+        rocsparseio_handle handle;
+        if(rocsparseio_open(&handle, rocsparseio_rwmode_read, filename_)
+           != rocsparseio_status_success)
         {
+            std::cerr << "cannot open file '" << filename_ << "'" << std::endl;
             return false;
         }
 
-        int    irow;
-        int    icol;
-        double rval;
-        double ival;
-
-        if(!strcmp(header.data, "pattern"))
-        {
-            sscanf(line, "%d %d", &irow, &icol);
-            rval = 1.0;
-        }
-        else
-        {
-            if(!strcmp(header.data, "complex"))
-            {
-                sscanf(line, "%d %d %lg %lg", &irow, &icol, &rval, &ival);
-            }
-            else
-            {
-                sscanf(line, "%d %d %lg", &irow, &icol, &rval);
-            }
-        }
-
-        --irow;
-        --icol;
-
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        set_value(unsorted_val[idx], rval, ival);
-
-        ++idx;
-
-        if(header.symmetric && irow != icol)
+        rocsparseio_direction  dir;
+        uint64_t               m, n, nnz;
+        rocsparseio_type       ptr_type, ind_type, val_type;
+        rocsparseio_index_base base;
+        const rocsparseio_status status = rocsparseiox_read_metadata_sparse_csx(
+            handle, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &val_type, &base);
+        rocsparseio_close(handle);
+        if(status != rocsparseio_status_success)
         {
-            if(idx >= (header.symmetric ? 2 * nnz : nnz))
-            {
-                return false;
-            }
-
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            set_value(unsorted_val[idx], rval, ival);
-            ++idx;
+            std::cerr << "only csx matrices can be converted from '" << filename_ << "'"
+                      << std::endl;
+            return false;
         }
+        is_complex_ = (val_type == rocsparseio_type_complex32
+                       || val_type == rocsparseio_type_complex64);
+        return true;
     }
 
-    // Store "real" number of non-zero entries
-    nnz = idx;
-
-    // Sort by row and column index
-    std::vector<int> perm(nnz);
-    for(int i = 0; i < nnz; ++i)
+    case rocsparseio::file_format_t::ascii:
     {
-        perm[i] = i;
+        break;
     }
-
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
-
-    // Resize arrays
-    row_ind.resize(nnz);
-    col_ind.resize(nnz);
-    val.resize(nnz);
-
-    for(int i = 0; i < nnz; ++i)
-    {
-        row_ind[i] = unsorted_row[perm[i]];
-        col_ind[i] = unsorted_col[perm[i]];
-        val[i]     = unsorted_val[perm[i]];
     }
-
-    return true;
+    return false;
 }
 
-template <typename T>
-bool write_csr_matrix(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const T* val)
+template <typename T, typename S>
+int convert_stream_to(S&                                source_,
+                      rocsparseio::file_format_t        format_,
+                      const char*                       filename_,
+                      const convert_stream::options_t& options_)
 {
-    std::ofstream out(filename, std::ios::out | std::ios::binary);
-
-    if(!out.is_open())
+    switch(format_)
+    {
+    case rocsparseio::file_format_t::mtx:
     {
-        return false;
+        convert_stream::mtx_sink_t<T> sink(filename_);
+        return convert_stream::run<T>(source_, sink, options_);
     }
 
-    // Header
-    out << "#rocALUTION binary csr file" << std::endl;
-
-    // rocALUTION version
-    int version = 10602;
-    out.write((char*)&version, sizeof(int));
-    out.write((char*)&m, sizeof(int));
-    out.write((char*)&n, sizeof(int));
-    out.write((char*)&nnz, sizeof(int));
-    out.write((char*)ptr, (m + 1) * sizeof(int));
-    out.write((char*)col, nnz * sizeof(int));
-    out.write((char*)val, nnz * sizeof(T));
-    out.close();
-    return true;
-}
-
-bool coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
-{
-    dst_ptr.resize(m + 1, 0);
-
-    // Compute nnz entries per row
-    for(int i = 0; i < nnz; ++i)
+    case rocsparseio::file_format_t::csr:
     {
-        ++dst_ptr[src_row[i] + 1];
+        convert_stream::rocalution_sink_t<T> sink(filename_);
+        return convert_stream::run<T>(source_, sink, options_);
     }
 
-    // Exclusive scan
-    for(int i = 0; i < m; ++i)
+    case rocsparseio::file_format_t::rocsparseio:
     {
-        dst_ptr[i + 1] += dst_ptr[i];
+        convert_stream::rocsparseio_sink_t<T> sink(filename_);
+        return convert_stream::run<T>(source_, sink, options_);
     }
-    return true;
-}
-
-int mtx2csr(const char* ifilename, const char* ofilename)
-{
-    // Matrix dimensions
-    int m;
-    int n;
-    int nnz;
 
-    // Matrix mtx header
-    mtx_header header;
-
-    // Open file for reading
-    FILE* f = fopen(ifilename, "r");
-    if(!f)
+    case rocsparseio::file_format_t::ascii:
     {
-        std::cerr << "Cannot open [read] .mtx file " << ifilename << std::endl;
-        return -1;
+        break;
+    }
     }
+    std::cerr << "not implemented LINE " << __LINE__ << std::endl;
+    return rocsparseio_status_invalid_value;
+}
 
-    if(!read_mtx_header(f, m, n, nnz, header))
+template <typename T, template <typename> class S>
+int convert_stream_from(const char*                       ifilename_,
+                        rocsparseio::file_format_t        oformat_,
+                        const char*                       ofilename_,
+                        const convert_stream::options_t& options_)
+{
+    S<T> source;
+    if(!source.open(ifilename_, options_))
     {
-        std::cerr << "Cannot read .mtx header from " << ifilename << std::endl;
-        return -1;
+        return rocsparseio_status_invalid_file;
     }
+    return convert_stream_to<T>(source, oformat_, ofilename_, options_);
+}
 
-    std::vector<int>                  row_ptr;
-    std::vector<int>                  row_ind;
-    std::vector<int>                  col_ind;
-    std::vector<double>               rval;
-    std::vector<std::complex<double>> cval;
-
-    bool status;
-    if(!strcmp(header.data, "complex"))
+template <typename T>
+int convert_stream_from(rocsparseio::file_format_t        iformat_,
+                        const char*                       ifilename_,
+                        rocsparseio::file_format_t        oformat_,
+                        const char*                       ofilename_,
+                        const convert_stream::options_t& options_)
+{
+    switch(iformat_)
     {
-        status = read_mtx_matrix(f, header, m, n, nnz, row_ind, col_ind, cval);
-    }
-    else
+    case rocsparseio::file_format_t::mtx:
     {
-        status = read_mtx_matrix(f, header, m, n, nnz, row_ind, col_ind, rval);
+        return convert_stream_from<T, convert_stream::mtx_source_t>(
+            ifilename_, oformat_, ofilename_, options_);
     }
 
-    if(!status)
+    case rocsparseio::file_format_t::csr:
     {
-        std::cerr << "Cannot read .mtx data from " << ifilename << std::endl;
-        return -1;
+        return convert_stream_from<T, convert_stream::rocalution_source_t>(
+            ifilename_, oformat_, ofilename_, options_);
     }
 
-    // Close file
-    fclose(f);
-
-    if(!coo_to_csr(m, nnz, row_ind.data(), row_ptr))
+    case rocsparseio::file_format_t::rocsparseio:
     {
-        std::cerr << "Cannot convert " << ifilename << " from COO to CSR." << std::endl;
-        return -1;
+        return convert_stream_from<T, convert_stream::rocsparseio_source_t>(
+            ifilename_, oformat_, ofilename_, options_);
     }
 
-    if(!strcmp(header.data, "complex"))
-    {
-        status
-            = write_csr_matrix(ofilename, m, n, nnz, row_ptr.data(), col_ind.data(), cval.data());
-    }
-    else
+    case rocsparseio::file_format_t::ascii:
     {
-        status
-            = write_csr_matrix(ofilename, m, n, nnz, row_ptr.data(), col_ind.data(), rval.data());
+        break;
     }
-
-    if(!status)
-    {
-        std::cerr << "Cannot open [write] " << ofilename << std::endl;
-        return -1;
     }
-
-    return 0;
+    std::cerr << "not implemented LINE " << __LINE__ << std::endl;
+    return rocsparseio_status_invalid_value;
 }
 
-int csr2rocsparseio(const char* ifilename, const char* ofilename)
+//
+// Convert a sparse matrix between the mtx, csr and rocsparseio formats, see
+// rocsparseio-convert-stream.hpp.
+//
+int convert_stream_files(rocsparseio::file_format_t        iformat_,
+                         const char*                       ifilename_,
+                         rocsparseio::file_format_t        oformat_,
+                         const char*                       ofilename_,
+                         const convert_stream::options_t& options_)
 {
-    // Read matrix
-    std::ifstream fin(ifilename, std::ios::in | std::ios::binary);
-    if(!fin.is_open())
+    bool is_complex;
+    if(!convert_stream_is_complex(iformat_, ifilename_, is_complex))
     {
-        fprintf(stderr, "Cannot open file %s\n", ifilename);
-        exit(1);
+        return rocsparseio_status_invalid_file;
     }
 
-    std::string header;
-    std::getline(fin, header);
-
-    if(header != "#rocALUTION binary csr file")
+    if(is_complex)
     {
-        fprintf(stderr, "Cannot open file %s\n", ifilename);
-        exit(1);
-    }
-
-    int version;
-    fin.read((char*)&version, sizeof(int));
-
-    int m;
-    int n;
-    int nnz;
-
-    fin.read((char*)&m, sizeof(int));
-    fin.read((char*)&n, sizeof(int));
-    fin.read((char*)&nnz, sizeof(int));
-
-    printf("Reading %d x %d matrix with %d nnz.\n", m, n, nnz);
-
-    std::vector<int>    hcsr_row_ptr(m + 1);
-    std::vector<int>    hcsr_col_ind(nnz);
-    std::vector<double> hcsr_val(nnz);
-
-    fin.read((char*)hcsr_row_ptr.data(), sizeof(int) * (m + 1));
-    fin.read((char*)hcsr_col_ind.data(), sizeof(int) * nnz);
-    fin.read((char*)hcsr_val.data(), sizeof(double) * nnz);
-
-    fin.close();
-
-    {
-        rocsparseio_status status;
-        rocsparseio_handle handle;
-        status = rocsparseio_open(&handle, rocsparseio_rwmode_write, ofilename);
-
-        status = rocsparseio_write_sparse_csx(handle,
-                                              rocsparseio_direction_row,
-                                              m,
-                                              n,
-                                              nnz,
-                                              rocsparseio_type_int32,
-                                              hcsr_row_ptr.data(),
-                                              rocsparseio_type_int32,
-                                              hcsr_col_ind.data(),
-                                              rocsparseio_type_float64,
-                                              hcsr_val.data(),
-                                              rocsparseio_index_base_zero,
-                                              nullptr);
-        //        // ROCSPARSEIO_CHECK(status);
-
-        status = rocsparseio_close(handle);
-        //        // ROCSPARSEIO_CHECK(status);
-        return status;
+        return convert_stream_from<std::complex<double>>(
+            iformat_, ifilename_, oformat_, ofilename_, options_);
     }
+    return convert_stream_from<double>(iformat_, ifilename_, oformat_, ofilename_, options_);
 }
 
 int csr2ascii(const char* ifilename, const char* ofilename)
@@ -976,277 +750,6 @@ rocsparseio_status rocsparseio2ascii(const char* ifilename, const char* ofilenam
     return rocsparseio_status_success;
 }
 
-rocsparseio_status rocsparseio2csr(const char* ifilename, const char* ofilename)
-{
-
-    rocsparseio_status status;
-    rocsparseio_handle handle;
-    status = rocsparseio_open(&handle, rocsparseio_rwmode_read, ifilename);
-    // ROCSPARSEIO_CHECK(status);
-
-    rocsparseio_type       ptr_type, ind_type, data_type;
-    rocsparseio_index_base base;
-    uint64_t               m, n, nnz;
-    rocsparseio_direction  dir;
-    void *                 ptr, *ind, *data;
-    status = rocsparseiox_read_metadata_sparse_csx(
-        handle, &dir, &m, &n, &nnz, &ptr_type, &ind_type, &data_type, &base);
-    // ROCSPARSEIO_CHECK(status);
-
-    int im   = (std::numeric_limits<int>::max() < m) ? -1 : m;
-    int in   = (std::numeric_limits<int>::max() < n) ? -1 : n;
-    int innz = (std::numeric_limits<int>::max() < nnz) ? -1 : nnz;
-    if(im < 0)
-    {
-        std::cerr << "out of bounds, m = " << m << " is not assignable to an int" << std::endl;
-        return rocsparseio_status_invalid_value;
-    }
-    if(in < 0)
-    {
-        std::cerr << "out of bounds, n = " << n << " is not assignable to an int" << std::endl;
-        return rocsparseio_status_invalid_value;
-    }
-    if(innz < 0)
-    {
-        std::cerr << "out of bounds, nnz = " << nnz << " is not assignable to an int" << std::endl;
-        return rocsparseio_status_invalid_value;
-    }
-
-    {
-        uint64_t size;
-        status = rocsparseio_type_get_size(ptr_type, &size);
-        ptr    = (m > 0) ? malloc(size * (m + 1)) : nullptr;
-    }
-
-    {
-        uint64_t size;
-        status = rocsparseio_type_get_size(ind_type, &size);
-        ind    = (nnz > 0) ? malloc(size * nnz) : nullptr;
-    }
-
-    {
-        uint64_t size;
-        status = rocsparseio_type_get_size(data_type, &size);
-        data   = (nnz > 0) ? malloc(size * nnz) : nullptr;
-    }
-
-    status = rocsparseiox_read_sparse_csx(handle, ptr, ind, data);
-    // ROCSPARSEIO_CHECK(status);
-    status = rocsparseio_close(handle);
-    // ROCSPARSEIO_CHECK(status);
-
-    int32_t* iptr  = nullptr;
-    int32_t* iind  = nullptr;
-    double*  idata = nullptr;
-    if(m > 0)
-    {
-        switch(ptr_type)
-        {
-        case rocsparseio_type_int32:
-        {
-            iptr = (int32_t*)ptr;
-            break;
-        }
-        case rocsparseio_type_int64:
-        {
-            iptr       = (int32_t*)malloc(sizeof(int32_t) * (m + 1));
-            int64_t* p = (int64_t*)ptr;
-            for(uint64_t i = 0; i < m + 1; ++i)
-            {
-                iptr[i] = p[i];
-            }
-            break;
-        }
-        case rocsparseio_type_int8:
-        case rocsparseio_type_float32:
-        case rocsparseio_type_float64:
-        case rocsparseio_type_complex32:
-        case rocsparseio_type_complex64:
-        {
-            break;
-        }
-        }
-    }
-    if(nnz > 0)
-    {
-        switch(ind_type)
-        {
-        case rocsparseio_type_int32:
-        {
-            iind = (int32_t*)ind;
-            break;
-        }
-        case rocsparseio_type_int64:
-        {
-            iind       = (int32_t*)malloc(sizeof(int32_t) * nnz);
-            int64_t* p = (int64_t*)ind;
-            for(uint64_t i = 0; i < nnz; ++i)
-            {
-                iind[i] = p[i];
-            }
-            break;
-        }
-        case rocsparseio_type_int8:
-        case rocsparseio_type_float32:
-        case rocsparseio_type_float64:
-        case rocsparseio_type_complex32:
-        case rocsparseio_type_complex64:
-        {
-            break;
-        }
-        }
-    }
-    if(nnz > 0)
-    {
-        switch(data_type)
-        {
-        case rocsparseio_type_float64:
-        {
-            idata = (double*)data;
-            break;
-        }
-        case rocsparseio_type_float32:
-        {
-            idata    = (double*)malloc(sizeof(double) * (nnz));
-            float* p = (float*)data;
-            for(uint64_t i = 0; i < nnz; ++i)
-            {
-                idata[i] = p[i];
-            }
-            break;
-        }
-        case rocsparseio_type_int8:
-        case rocsparseio_type_int32:
-        case rocsparseio_type_int64:
-        case rocsparseio_type_complex32:
-        case rocsparseio_type_complex64:
-        {
-            break;
-        }
-        }
-    }
-
-    write_csr_matrix<double>(ofilename, im, in, innz, iptr, iind, idata);
-
-    if(idata != data)
-    {
-        free(idata);
-    }
-    if(iind != ind)
-    {
-        free(iind);
-    }
-    if(idata != data)
-    {
-        free(idata);
-    }
-
-    return status;
-}
-
-int mtx2rocsparseio(const char* ifilename, const char* ofilename)
-{
-    // Matrix dimensions
-    int m;
-    int n;
-    int nnz;
-
-    // Matrix mtx header
-    mtx_header header;
-
-    // Open file for reading
-    FILE* f = fopen(ifilename, "r");
-    if(!f)
-    {
-        std::cerr << "Cannot open [read] .mtx file " << ifilename << std::endl;
-        return -1;
-    }
-
-    if(!read_mtx_header(f, m, n, nnz, header))
-    {
-        std::cerr << "Cannot read .mtx header from " << ifilename << std::endl;
-        return -1;
-    }
-
-    std::vector<int>                  row_ptr;
-    std::vector<int>                  row_ind;
-    std::vector<int>                  col_ind;
-    std::vector<double>               rval;
-    std::vector<std::complex<double>> cval;
-
-    bool status_mtx;
-    if(!strcmp(header.data, "complex"))
-    {
-        status_mtx = read_mtx_matrix(f, header, m, n, nnz, row_ind, col_ind, cval);
-    }
-    else
-    {
-        status_mtx = read_mtx_matrix(f, header, m, n, nnz, row_ind, col_ind, rval);
-    }
-
-    if(!status_mtx)
-    {
-        std::cerr << "Cannot read .mtx data from " << ifilename << std::endl;
-        return -1;
-    }
-
-    // Close file
-    fclose(f);
-
-    if(!coo_to_csr(m, nnz, row_ind.data(), row_ptr))
-    {
-        std::cerr << "Cannot convert " << ifilename << " from COO to CSR." << std::endl;
-        return -1;
-    }
-
-    bool is_complex = (!strcmp(header.data, "complex"));
-
-    {
-        rocsparseio_status status;
-        rocsparseio_handle handle;
-        status = rocsparseio_open(&handle, rocsparseio_rwmode_write, ofilename);
-
-        const char* name = nullptr;
-        if(is_complex)
-        {
-            status = rocsparseio_write_sparse_csx(handle,
-                                                  rocsparseio_direction_row,
-                                                  m,
-                                                  n,
-                                                  nnz,
-                                                  rocsparseio_type_int32,
-                                                  row_ptr.data(),
-                                                  rocsparseio_type_int32,
-                                                  col_ind.data(),
-                                                  rocsparseio_type_complex64,
-                                                  cval.data(),
-                                                  rocsparseio_index_base_zero,
-                                                  name);
-        }
-        else
-        {
-            status = rocsparseio_write_sparse_csx(handle,
-                                                  rocsparseio_direction_row,
-                                                  m,
-                                                  n,
-                                                  nnz,
-                                                  rocsparseio_type_int32,
-                                                  row_ptr.data(),
-                                                  rocsparseio_type_int32,
-                                                  col_ind.data(),
-                                                  rocsparseio_type_float64,
-                                                  rval.data(),
-                                                  rocsparseio_index_base_zero,
-                                                  name);
-        }
-        // ROCSPARSEIO_CHECK(status);
-
-        status = rocsparseio_close(handle);
-        // ROCSPARSEIO_CHECK(status);
-    }
-    return 0;
-}
-
 //
 //
 //
@@ -1263,11 +766,21 @@ void usage(const char* appname_)
     fprintf(stderr, "OPTIONS\n");
     fprintf(stderr, "       -v, --verbose\n");
     fprintf(stderr, "              use verbose of information.\n");
+    fprintf(stderr, "       --memory <MB>\n");
+    fprintf(stderr, "              memory budget in MB to sort mtx entries, default is 1024.\n");
+    fprintf(stderr, "       --tmpdir <directory>\n");
+    fprintf(stderr, "              directory of the temporary files of the sort of mtx entries,\n");
+    fprintf(stderr, "              default is $TMPDIR or /tmp.\n");
     fprintf(stderr, "       -h, --help\n");
     fprintf(stderr, "              produces this help and exit.\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "NOTES\n");
     fprintf(stderr, "\n");
+    fprintf(stderr, "       Conversions between the mtx, csr and rocsparseio formats are\n");
+    fprintf(stderr, "       streamed, the matrix is never fully loaded in memory. The entries\n");
+    fprintf(stderr, "       of a mtx file are sorted by rows with temporary files when they\n");
+    fprintf(stderr, "       exceed the memory budget.\n");
+    fprintf(stderr, "\n");
 }
 
 const char* get_file_extension(const char* filename)
@@ -1297,6 +810,22 @@ int main(int argc, char** argv)
 
     const bool verbose = cmd.option("-v");
 
+    convert_stream::options_t options;
+    options.verbose = verbose;
+    {
+        int n;
+        if(cmd.get_integer("--memory", &n) && n > 0)
+        {
+            options.memory = uint64_t(n) << 20;
+        }
+
+        char tmpdir[512];
+        if(cmd.option("--tmpdir", tmpdir))
+        {
+            options.tmpdir = tmpdir;
+        }
+    }
+
     char ofilename[512];
     if(false == cmd.option("-o", ofilename))
     {
@@ -1376,95 +905,33 @@ int main(int argc, char** argv)
 
     case rocsparseio::file_format_t::csr:
     {
-        switch(output_file_format)
-        {
-        case rocsparseio::file_format_t::csr:
-        {
-            //
-            // copy file.
-            //
-            std::cerr << "not implemented LINE " << __LINE__ << std::endl;
-            return rocsparseio_status_invalid_value;
-        }
-
-        case rocsparseio::file_format_t::mtx:
-        {
-            //
-            // convert csr 2 mtx
-            //
-            std::cerr << "not implemented LINE " << __LINE__ << std::endl;
-            return rocsparseio_status_invalid_value;
-        }
-
-        case rocsparseio::file_format_t::ascii:
+        if(output_file_format == rocsparseio::file_format_t::ascii)
         {
             return csr2ascii(ifilename, ofilename);
         }
-
-        case rocsparseio::file_format_t::rocsparseio:
-        {
-            //
-            // convert csr 2 rocsparseio
-            //
-            return csr2rocsparseio(ifilename, ofilename);
-        }
-        }
-        break;
+        return convert_stream_files(
+            input_file_format, ifilename, output_file_format, ofilename, options);
     }
 
     case rocsparseio::file_format_t::mtx:
     {
-        switch(output_file_format)
-        {
-        case rocsparseio::file_format_t::csr:
-        {
-            return mtx2csr(ifilename, ofilename);
-        }
-        case rocsparseio::file_format_t::mtx:
+        if(output_file_format == rocsparseio::file_format_t::ascii)
         {
-            //
-            // copy file.
-            //
             std::cerr << "not implemented LINE " << __LINE__ << std::endl;
             return rocsparseio_status_invalid_value;
         }
-        case rocsparseio::file_format_t::ascii:
-        {
-            std::cerr << "not implemented LINE " << __LINE__ << std::endl;
-            return rocsparseio_status_invalid_value;
-        }
-        case rocsparseio::file_format_t::rocsparseio:
-        {
-            return mtx2rocsparseio(ifilename, ofilename);
-        }
-        }
+        return convert_stream_files(
+            input_file_format, ifilename, output_file_format, ofilename, options);
     }
+
     case rocsparseio::file_format_t::rocsparseio:
     {
-        switch(output_file_format)
-        {
-        case rocsparseio::file_format_t::csr:
-        {
-            return rocsparseio2csr(ifilename, ofilename);
-        }
-        case rocsparseio::file_format_t::mtx:
-        {
-            std::cerr << "not implemented LINE " << __LINE__ << std::endl;
-            return rocsparseio_status_invalid_value;
-        }
-        case rocsparseio::file_format_t::ascii:
+        if(output_file_format == rocsparseio::file_format_t::ascii)
         {
             return rocsparseio2ascii(ifilename, ofilename);
         }
-        case rocsparseio::file_format_t::rocsparseio:
-        {
-            //
-            // copy file.
-            //
-            std::cerr << "not implemented LINE " << __LINE__ << std::endl;
-            return rocsparseio_status_invalid_value;
-        }
-        }
+        return convert_stream_files(
+            input_file_format, ifilename, output_file_format, ofilename, options);
     }
     }
     std::cerr << "not implemented LINE " << __LINE__ << std::endl;
@@ -22,6 +22,7 @@
 
 #include "app.hpp"
 #include "rocsparseio.h"
+#include "rocsparseio_statistics.hpp"
 #include <algorithm>
 #include <chrono>
 #include <complex>
@@ -333,7 +334,7 @@ void usage(const char* appname_)
     fprintf(stderr, "NAME\n");
     fprintf(stderr, "       %s -- Get ROCSPARSEIO file information\n", appname_);
     fprintf(stderr, "SYNOPSIS\n");
-    fprintf(stderr, "       %s [OPTION]... -o <output file> \n", appname_);
+    fprintf(stderr, "       %s [OPTION]... <input file> \n", appname_);
     fprintf(stderr, "DESCRIPTION\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "       List meta-data information.\n");
@@ -343,8 +344,20 @@ void usage(const char* appname_)
     fprintf(stderr, "              use verbose of information.\n");
     fprintf(stderr, "       -h, --help\n");
     fprintf(stderr, "              produces this help and exit.\n");
+    fprintf(stderr, "       --io-threads <n>\n");
+    fprintf(stderr, "              number of threads reading large arrays.\n");
+    fprintf(stderr, "       --io-chunk-size <n>\n");
+    fprintf(stderr, "              size in MB of the chunks read concurrently.\n");
+    fprintf(stderr, "       --direct\n");
+    fprintf(stderr, "              use O_DIRECT to read large arrays.\n");
+    fprintf(stderr, "       --stats\n");
+    fprintf(stderr, "              stream a csr/csc matrix once and report structural\n");
+    fprintf(stderr, "              statistics, without loading the whole matrix.\n");
+    fprintf(stderr, "       --slab-nnz <n>\n");
+    fprintf(stderr, "              number of non-zeros read at once with --stats.\n");
     fprintf(stderr, "\n");
     fprintf(stderr, "NOTES\n");
+    fprintf(stderr, "       The read bandwidth of the arrays is reported for csr/csc matrices.\n");
     fprintf(stderr, "\n");
 }
 
@@ -371,11 +384,73 @@ int main(int argc, char** argv)
 
     rocsparseio_handle handle;
     rocsparseio_status status;
+
+    int        io_threads    = 0;
+    int        io_chunk_size = 0;
+    const bool io_direct     = cmd.option("--direct");
+    cmd.get_integer("--io-threads", &io_threads);
+    cmd.get_integer("--io-chunk-size", &io_chunk_size);
+
+    const bool stats    = cmd.option("--stats");
+    uint64_t   slab_nnz = uint64_t(1) << 22;
+    {
+        int n;
+        if(cmd.get_integer("--slab-nnz", &n) && n > 0)
+        {
+            slab_nnz = n;
+        }
+    }
+
+    if(cmd.isempty())
+    {
+        std::cerr << "missing input file" << std::endl;
+        return 1;
+    }
+
     rocsparseio_rwmode mode = rocsparseio_rwmode_read;
-    status                  = rocsparseio_open(&handle, mode, argv[1]);
+    status                  = rocsparseio_open(&handle, mode, cmd.get_arg(1));
+    ROCSPARSEIO_CHECK(status);
+
+    {
+        uint64_t nthreads, chunk_size;
+        int      direct;
+        status = rocsparseio_get_parallel_io(handle, &nthreads, &chunk_size, &direct);
+        ROCSPARSEIO_CHECK(status);
+        if(io_threads > 0)
+        {
+            nthreads = io_threads;
+        }
+        if(io_chunk_size > 0)
+        {
+            chunk_size = uint64_t(io_chunk_size) << 20;
+        }
+        if(io_direct)
+        {
+            direct = 1;
+        }
+        status = rocsparseio_set_parallel_io(handle, nthreads, chunk_size, direct);
+        ROCSPARSEIO_CHECK(status);
+    }
 
     rocsparseio_string name;
     rocsparseio_format format;
+
+    uint64_t nobjects;
+    status = rocsparseio_get_num_objects(handle, &nobjects);
+    ROCSPARSEIO_CHECK(status);
+    if(nobjects > 1)
+    {
+        std::cout << "objects    : " << nobjects << std::endl;
+        for(uint64_t i = 0; i < nobjects; ++i)
+        {
+            uint64_t nbytes;
+            status = rocsparseio_get_object(handle, i, name, &format, &nbytes);
+            ROCSPARSEIO_CHECK(status);
+            std::cout << "  [" << i << "] " << name << ", format " << format << ", " << nbytes
+                      << " bytes" << std::endl;
+        }
+    }
+
     status = rocsparseio_read_name(handle, name);
     std::cout << "name       : " << name << std::endl;
 
@@ -483,6 +558,16 @@ int main(int argc, char** argv)
         std::cout << "memory     : " << ngb << " Go," << nmb << " Mb " << s % 1024 << " kb"
                   << std::endl;
 
+        if(stats)
+        {
+            rocsparseio_stream_statistics_csx statistics(dir, m, n);
+            status = rocsparseio_csx_stream_statistics(
+                handle, ptr_type, ind_type, val_type, base, slab_nnz, statistics);
+            ROCSPARSEIO_CHECK(status);
+            statistics.print();
+            break;
+        }
+
         uint64_t ptr_size = (dir == rocsparseio_direction_row) ? (m + 1) : (n + 1);
         void*    ptr      = malloc(ptr_type_size * ptr_size);
 
@@ -492,7 +577,15 @@ int main(int argc, char** argv)
         uint64_t val_size = nnz;
         void*    val      = malloc(val_type_size * val_size);
 
-        status = rocsparseiox_read_sparse_csx(handle, ptr, ind, val);
+        const auto t0 = std::chrono::steady_clock::now();
+        status        = rocsparseiox_read_sparse_csx(handle, ptr, ind, val);
+        ROCSPARSEIO_CHECK(status);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+
+        const uint64_t nbytes
+            = ptr_type_size * ptr_size + ind_type_size * ind_size + val_type_size * val_size;
+        std::cout << "read       : " << nbytes / elapsed.count() / 1e9 << " GB/s ("
+                  << elapsed.count() << " s)" << std::endl;
 
         status = rocsparseio_csx_statistics_dynamic_dispatch(
             ptr_type, ind_type, val_type, dir, m, n, nnz, ptr, ind, val, base);
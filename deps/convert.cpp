@@ -22,12 +22,14 @@
  * ************************************************************************ */
 
 #include <algorithm>
+#include <cinttypes>
 #include <cmath>
 #include <complex>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <vector>
 
@@ -41,7 +43,7 @@ struct mtx_header
     int  symmetric;
 };
 
-bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header)
+bool read_mtx_header(FILE* f, int64_t& nrow, int64_t& ncol, int64_t& nnz, mtx_header& header)
 {
     char line[1024];
 
@@ -118,10 +120,13 @@ bool read_mtx_header(FILE* f, int& nrow, int& ncol, int& nnz, mtx_header& header
         }
     }
 
-    // Read dimensions
-    sscanf(line, "%d %d %d", &nrow, &ncol, &nnz);
+    // Read dimensions, the number of entries may not fit in 32 bits
+    if(sscanf(line, "%" SCNd64 " %" SCNd64 " %" SCNd64, &nrow, &ncol, &nnz) != 3)
+    {
+        return false;
+    }
 
-    return true;
+    return nrow >= 0 && ncol >= 0 && nnz >= 0;
 }
 
 void set_value(double& dst, double rsrc, double isrc)
@@ -134,55 +139,83 @@ void set_value(std::complex<double>& dst, double rsrc, double isrc)
     dst = std::complex<double>(rsrc, isrc);
 }
 
+bool coo_to_csr(int64_t m, int64_t nnz, const int64_t* src_row, std::vector<int64_t>& dst_ptr)
+{
+    dst_ptr.assign(m + 1, 0);
+
+    // Compute nnz entries per row
+    for(int64_t i = 0; i < nnz; ++i)
+    {
+        ++dst_ptr[src_row[i] + 1];
+    }
+
+    // Exclusive scan
+    for(int64_t i = 0; i < m; ++i)
+    {
+        dst_ptr[i + 1] += dst_ptr[i];
+    }
+
+    return true;
+}
+
 template <typename T>
-bool read_mtx_matrix(FILE*             f,
-                     const mtx_header& header,
-                     int               nrow,
-                     int               ncol,
-                     int&              nnz,
-                     std::vector<int>& row_ind,
-                     std::vector<int>& col_ind,
-                     std::vector<T>&   val)
+bool read_mtx_matrix(FILE*                 f,
+                     const mtx_header&     header,
+                     int64_t               nrow,
+                     int64_t               ncol,
+                     int64_t&              nnz,
+                     std::vector<int64_t>& row_ind,
+                     std::vector<int64_t>& col_ind,
+                     std::vector<T>&       val)
 {
     // Cache for line
     char line[1024];
 
     // Read unsorted data
-    std::vector<int> unsorted_row(header.symmetric ? 2 * nnz : nnz);
-    std::vector<int> unsorted_col(header.symmetric ? 2 * nnz : nnz);
-    std::vector<T>   unsorted_val(header.symmetric ? 2 * nnz : nnz);
+    const int64_t        capacity = header.symmetric ? 2 * nnz : nnz;
+    std::vector<int64_t> unsorted_row(capacity);
+    std::vector<int64_t> unsorted_col(capacity);
+    std::vector<T>       unsorted_val(capacity);
 
     // Read entries
-    int idx = 0;
+    int64_t idx = 0;
     while(fgets(line, 1024, f))
     {
-        if(idx >= (header.symmetric ? 2 * nnz : nnz))
+        // Skip blank lines
+        const char* p = line + strspn(line, " \t\r\n");
+        if(*p == '\0' || *p == '%')
         {
-            return false;
+            continue;
         }
 
-        int    irow;
-        int    icol;
-        double rval;
-        double ival;
+        int64_t irow;
+        int64_t icol;
+        double  rval = 1.0;
+        double  ival = 0.0;
+        bool    ok;
 
         if(!strcmp(header.data, "pattern"))
         {
-            sscanf(line, "%d %d", &irow, &icol);
-            rval = 1.0;
+            ok = sscanf(line, "%" SCNd64 " %" SCNd64, &irow, &icol) == 2;
         }
         else
         {
             if(!strcmp(header.data, "complex"))
             {
-                sscanf(line, "%d %d %lg %lg", &irow, &icol, &rval, &ival);
+                ok = sscanf(line, "%" SCNd64 " %" SCNd64 " %lg %lg", &irow, &icol, &rval, &ival)
+                     == 4;
             }
             else
             {
-                sscanf(line, "%d %d %lg", &irow, &icol, &rval);
+                ok = sscanf(line, "%" SCNd64 " %" SCNd64 " %lg", &irow, &icol, &rval) == 3;
             }
         }
 
+        if(!ok || idx >= capacity || irow < 1 || irow > nrow || icol < 1 || icol > ncol)
+        {
+            return false;
+        }
+
         --irow;
         --icol;
 
@@ -194,7 +227,7 @@ bool read_mtx_matrix(FILE*             f,
 
         if(header.symmetric && irow != icol)
         {
-            if(idx >= (header.symmetric ? 2 * nnz : nnz))
+            if(idx >= capacity)
             {
                 return false;
             }
@@ -209,34 +242,32 @@ bool read_mtx_matrix(FILE*             f,
     // Store "real" number of non-zero entries
     nnz = idx;
 
-    // Sort by row and column index
-    std::vector<int> perm(nnz);
-    for(int i = 0; i < nnz; ++i)
+    // Bucket the entries by row, then sort each row by column index
+    std::vector<int64_t> ptr;
+    coo_to_csr(nrow, nnz, unsorted_row.data(), ptr);
+
+    std::vector<int64_t> perm(nnz);
+    std::vector<int64_t> next(ptr.begin(), ptr.end() - 1);
+    for(int64_t i = 0; i < nnz; ++i)
     {
-        perm[i] = i;
+        perm[next[unsorted_row[i]]++] = i;
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
+    for(int64_t i = 0; i < nrow; ++i)
+    {
+        std::stable_sort(perm.begin() + ptr[i],
+                         perm.begin() + ptr[i + 1],
+                         [&](const int64_t& a, const int64_t& b) {
+                             return unsorted_col[a] < unsorted_col[b];
+                         });
+    }
 
     // Resize arrays
     row_ind.resize(nnz);
     col_ind.resize(nnz);
     val.resize(nnz);
 
-    for(int i = 0; i < nnz; ++i)
+    for(int64_t i = 0; i < nnz; ++i)
     {
         row_ind[i] = unsorted_row[perm[i]];
         col_ind[i] = unsorted_col[perm[i]];
@@ -246,10 +277,52 @@ bool read_mtx_matrix(FILE*             f,
     return true;
 }
 
+// The rocALUTION binary format stores 32 bits sizes and indices
+bool fits_bin_matrix(int64_t m, int64_t n, int64_t nnz)
+{
+    static constexpr int64_t imax = std::numeric_limits<int>::max();
+    if(m > imax || n > imax || nnz > imax)
+    {
+        std::cerr << "Matrix of size " << m << " x " << n << " with " << nnz
+                  << " entries does not fit in the rocALUTION binary format" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// Write a 64 bits array as a 32 bits one, by blocks
+bool write_int_array(std::ofstream& out, int64_t size, const int64_t* data)
+{
+    static constexpr int64_t block = 1 << 20;
+    std::vector<int>         tmp(std::min(size, block));
+    for(int64_t i = 0; i < size; i += block)
+    {
+        const int64_t n = std::min(size - i, block);
+        for(int64_t j = 0; j < n; ++j)
+        {
+            tmp[j] = static_cast<int>(data[i + j]);
+        }
+        out.write((char*)tmp.data(), n * sizeof(int));
+    }
+
+    return out.good();
+}
+
 template <typename T>
-bool write_bin_matrix(
-    const char* filename, int m, int n, int nnz, const int* ptr, const int* col, const T* val)
+bool write_bin_matrix(const char*    filename,
+                      int64_t        m,
+                      int64_t        n,
+                      int64_t        nnz,
+                      const int64_t* ptr,
+                      const int64_t* col,
+                      const T*       val)
 {
+    if(!fits_bin_matrix(m, n, nnz))
+    {
+        return false;
+    }
+
     std::ofstream out(filename, std::ios::out | std::ios::binary);
 
     if(!out.is_open())
@@ -265,35 +338,19 @@ bool write_bin_matrix(
     out.write((char*)&version, sizeof(int));
 
     // Data
-    out.write((char*)&m, sizeof(int));
-    out.write((char*)&n, sizeof(int));
-    out.write((char*)&nnz, sizeof(int));
-    out.write((char*)ptr, (m + 1) * sizeof(int));
-    out.write((char*)col, nnz * sizeof(int));
+    const int im   = static_cast<int>(m);
+    const int in   = static_cast<int>(n);
+    const int innz = static_cast<int>(nnz);
+    out.write((char*)&im, sizeof(int));
+    out.write((char*)&in, sizeof(int));
+    out.write((char*)&innz, sizeof(int));
+    write_int_array(out, m + 1, ptr);
+    write_int_array(out, nnz, col);
     out.write((char*)val, nnz * sizeof(T));
 
     out.close();
 
-    return true;
-}
-
-bool coo_to_csr(int m, int nnz, const int* src_row, std::vector<int>& dst_ptr)
-{
-    dst_ptr.resize(m + 1, 0);
-
-    // Compute nnz entries per row
-    for(int i = 0; i < nnz; ++i)
-    {
-        ++dst_ptr[src_row[i] + 1];
-    }
-
-    // Exclusive scan
-    for(int i = 0; i < m; ++i)
-    {
-        dst_ptr[i + 1] += dst_ptr[i];
-    }
-
-    return true;
+    return !out.fail();
 }
 
 int main(int argc, char* argv[])
@@ -305,9 +362,9 @@ int main(int argc, char* argv[])
     }
 
     // Matrix dimensions
-    int m;
-    int n;
-    int nnz;
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
 
     // Matrix mtx header
     mtx_header header;
@@ -326,9 +383,14 @@ int main(int argc, char* argv[])
         return -1;
     }
 
-    std::vector<int>                  row_ptr;
-    std::vector<int>                  row_ind;
-    std::vector<int>                  col_ind;
+    if(!fits_bin_matrix(m, n, nnz))
+    {
+        return -1;
+    }
+
+    std::vector<int64_t>              row_ptr;
+    std::vector<int64_t>              row_ind;
+    std::vector<int64_t>              col_ind;
     std::vector<double>               rval;
     std::vector<std::complex<double>> cval;
 
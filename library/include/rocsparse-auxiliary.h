@@ -237,6 +237,68 @@ rocsparse_status rocsparse_get_version(rocsparse_handle handle, int* version);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_git_rev(rocsparse_handle handle, char* rev);
 
+/*! \ingroup aux_module
+ *  \brief Specify the size of the analysis cache
+ *
+ *  \details
+ *  \p rocsparse_set_analysis_cache_size enables the analysis cache of the rocSPARSE
+ *  library context and sets the maximum amount of device memory it can hold. With the
+ *  cache enabled, the results of the csrmv, csrsv, csrsm, csric0 and csrilu0 analysis
+ *  routines (and of their BSR and generic counterparts) are kept by the handle, keyed by
+ *  the dimensions, the matrix descriptor properties and a fingerprint of the sparsity
+ *  pattern. A subsequent analysis of a matrix with the same sparsity pattern, possibly
+ *  stored at another address, copies the cached result instead of repeating the
+ *  analysis. When the cache is full, the least recently used results are released.
+ *
+ *  The fingerprint is a 128 bit hash computed on the device. A cached result is only
+ *  used once the sparsity pattern it has been computed for, of which the cache keeps a
+ *  copy, compares equal to the analyzed one. The device memory held by the cache
+ *  includes these copies.
+ *
+ *  \note
+ *  The cache is disabled by default. Setting a maximum size of zero disables the cache
+ *  and releases all its device memory.
+ *
+ *  @param[inout]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  max_size    the maximum device memory in bytes held by the analysis cache.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_analysis_cache_size(rocsparse_handle handle, size_t max_size);
+
+/*! \ingroup aux_module
+ *  \brief Get the analysis cache statistics
+ *
+ *  \details
+ *  \p rocsparse_get_analysis_cache_info gets the number of analyses that have been
+ *  found in the analysis cache of the rocSPARSE library context, the number of analyses
+ *  that have not, and the device memory currently held by the cache. See
+ *  rocsparse_set_analysis_cache_size().
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  hits    the number of analyses found in the cache.
+ *  @param[out]
+ *  misses  the number of analyses not found in the cache.
+ *  @param[out]
+ *  size    the device memory in bytes held by the cache.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p hits, \p misses or \p size pointer is
+ *          invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_analysis_cache_info(rocsparse_handle handle,
+                                                   int64_t*         hits,
+                                                   int64_t*         misses,
+                                                   size_t*          size);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix descriptor
  *  \details
@@ -147,6 +147,17 @@ _rocsparse_handle::_rocsparse_handle()
 _rocsparse_handle::~_rocsparse_handle()
 {
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(buffer));
+    if(pinned_buffer != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(rocsparse_hipHostFree(pinned_buffer));
+    }
+    for(hipEvent_t event : pinned_events)
+    {
+        if(event != nullptr)
+        {
+            PRINT_IF_HIP_ERROR(hipEventDestroy(event));
+        }
+    }
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(sone));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(done));
     PRINT_IF_HIP_ERROR(rocsparse_hipFree(cone));
@@ -226,6 +237,38 @@ rocsparse_status _rocsparse_handle::get_pointer_mode(rocsparse_pointer_mode* use
     return rocsparse_status_success;
 }
 
+/*******************************************************************************
+ * reserve pinned buffer:
+   The buffer only grows, its content is not preserved. No transfer to the
+   buffer may be pending.
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::reserve_pinned_buffer(size_t size)
+{
+    for(hipEvent_t& event : this->pinned_events)
+    {
+        if(event == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+        }
+    }
+
+    if(size <= this->pinned_buffer_size)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(this->pinned_buffer != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipHostFree(this->pinned_buffer));
+        this->pinned_buffer      = nullptr;
+        this->pinned_buffer_size = 0;
+    }
+
+    RETURN_IF_HIP_ERROR(rocsparse_hipHostMalloc(&this->pinned_buffer, size));
+    this->pinned_buffer_size = size;
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_csrmv_info is a structure holding the rocsparse csrmv info
  * data gathered during csrmv_analysis. It must be initialized using the
@@ -258,6 +301,18 @@ rocsparse_status rocsparse::create_csrmv_info(rocsparse_csrmv_info* info)
  *******************************************************************************/
 rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
                                             const rocsparse_csrmv_info src)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_csrmv_info(dest, src, 0));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(0));
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Copy csrmv info, the device arrays are copied asynchronously on stream.
+ *******************************************************************************/
+rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
+                                            const rocsparse_csrmv_info src,
+                                            hipStream_t                stream)
 {
     if(dest == nullptr || src == nullptr || dest == src)
     {
@@ -356,10 +411,11 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
             RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&dest->adaptive.row_blocks,
                                                     I_size * src->adaptive.size));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(dest->adaptive.row_blocks,
-                                      src->adaptive.row_blocks,
-                                      I_size * src->adaptive.size,
-                                      hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->adaptive.row_blocks,
+                                           src->adaptive.row_blocks,
+                                           I_size * src->adaptive.size,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->adaptive.wg_flags != nullptr)
@@ -369,10 +425,11 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
             RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&dest->adaptive.wg_flags,
                                                     sizeof(uint32_t) * src->adaptive.size));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(dest->adaptive.wg_flags,
-                                      src->adaptive.wg_flags,
-                                      sizeof(uint32_t) * src->adaptive.size,
-                                      hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->adaptive.wg_flags,
+                                           src->adaptive.wg_flags,
+                                           sizeof(uint32_t) * src->adaptive.size,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->adaptive.wg_ids != nullptr)
@@ -382,10 +439,11 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
             RETURN_IF_HIP_ERROR(
                 rocsparse_hipMalloc((void**)&dest->adaptive.wg_ids, J_size * src->adaptive.size));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(dest->adaptive.wg_ids,
-                                      src->adaptive.wg_ids,
-                                      J_size * src->adaptive.size,
-                                      hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->adaptive.wg_ids,
+                                           src->adaptive.wg_ids,
+                                           J_size * src->adaptive.size,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->lrb.wg_flags != nullptr)
@@ -395,10 +453,11 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
             RETURN_IF_HIP_ERROR(
                 rocsparse_hipMalloc((void**)&dest->lrb.wg_flags, sizeof(uint32_t) * src->lrb.size));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(dest->lrb.wg_flags,
-                                      src->lrb.wg_flags,
-                                      sizeof(uint32_t) * src->lrb.size,
-                                      hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->lrb.wg_flags,
+                                           src->lrb.wg_flags,
+                                           sizeof(uint32_t) * src->lrb.size,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->lrb.rows_offsets_scratch != nullptr)
@@ -408,10 +467,11 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
             RETURN_IF_HIP_ERROR(
                 rocsparse_hipMalloc((void**)&dest->lrb.rows_offsets_scratch, J_size * src->m));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(dest->lrb.rows_offsets_scratch,
-                                      src->lrb.rows_offsets_scratch,
-                                      J_size * src->m,
-                                      hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->lrb.rows_offsets_scratch,
+                                           src->lrb.rows_offsets_scratch,
+                                           J_size * src->m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->lrb.rows_bins != nullptr)
@@ -420,8 +480,11 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
         {
             RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&dest->lrb.rows_bins, J_size * src->m));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            dest->lrb.rows_bins, src->lrb.rows_bins, J_size * src->m, hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->lrb.rows_bins,
+                                           src->lrb.rows_bins,
+                                           J_size * src->m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->lrb.n_rows_bins != nullptr)
@@ -430,8 +493,16 @@ rocsparse_status rocsparse::copy_csrmv_info(rocsparse_csrmv_info       dest,
         {
             RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&dest->lrb.n_rows_bins, J_size * 32));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            dest->lrb.n_rows_bins, src->lrb.n_rows_bins, J_size * 32, hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->lrb.n_rows_bins,
+                                           src->lrb.n_rows_bins,
+                                           J_size * 32,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    for(int i = 0; i < 32; ++i)
+    {
+        dest->lrb.nRowsBins[i] = src->lrb.nRowsBins[i];
     }
 
     dest->adaptive.size = src->adaptive.size;
@@ -527,6 +598,18 @@ rocsparse_status rocsparse::create_trm_info(rocsparse_trm_info* info)
  * \brief Copy trm info.
  *******************************************************************************/
 rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info dest, const rocsparse_trm_info src)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_trm_info(dest, src, 0));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(0));
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Copy trm info, the device arrays are copied asynchronously on stream.
+ *******************************************************************************/
+rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info       dest,
+                                          const rocsparse_trm_info src,
+                                          hipStream_t              stream)
 {
     if(dest == nullptr || src == nullptr || dest == src)
     {
@@ -613,8 +696,8 @@ rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info dest, const rocspar
         {
             RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&(dest->row_map), J_size * src->m));
         }
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(dest->row_map, src->row_map, J_size * src->m, hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dest->row_map, src->row_map, J_size * src->m, hipMemcpyDeviceToDevice, stream));
     }
 
     if(src->trm_diag_ind != nullptr)
@@ -624,8 +707,11 @@ rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info dest, const rocspar
             RETURN_IF_HIP_ERROR(
                 rocsparse_hipMalloc((void**)&(dest->trm_diag_ind), I_size * src->m));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            dest->trm_diag_ind, src->trm_diag_ind, I_size * src->m, hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->trm_diag_ind,
+                                           src->trm_diag_ind,
+                                           I_size * src->m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->trmt_perm != nullptr)
@@ -634,8 +720,8 @@ rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info dest, const rocspar
         {
             RETURN_IF_HIP_ERROR(rocsparse_hipMalloc((void**)&(dest->trmt_perm), I_size * src->nnz));
         }
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(dest->trmt_perm, src->trmt_perm, I_size * src->nnz, hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            dest->trmt_perm, src->trmt_perm, I_size * src->nnz, hipMemcpyDeviceToDevice, stream));
     }
 
     if(src->trmt_row_ptr != nullptr)
@@ -645,8 +731,11 @@ rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info dest, const rocspar
             RETURN_IF_HIP_ERROR(
                 rocsparse_hipMalloc((void**)&(dest->trmt_row_ptr), I_size * (src->m + 1)));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            dest->trmt_row_ptr, src->trmt_row_ptr, I_size * (src->m + 1), hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->trmt_row_ptr,
+                                           src->trmt_row_ptr,
+                                           I_size * (src->m + 1),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     if(src->trmt_col_ind != nullptr)
@@ -656,8 +745,11 @@ rocsparse_status rocsparse::copy_trm_info(rocsparse_trm_info dest, const rocspar
             RETURN_IF_HIP_ERROR(
                 rocsparse_hipMalloc((void**)&(dest->trmt_col_ind), J_size * src->nnz));
         }
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            dest->trmt_col_ind, src->trmt_col_ind, J_size * src->nnz, hipMemcpyDeviceToDevice));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dest->trmt_col_ind,
+                                           src->trmt_col_ind,
+                                           J_size * src->nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
     }
 
     dest->max_nnz      = src->max_nnz;
@@ -0,0 +1,215 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocsparse-types.h"
+#include <hip/hip_runtime_api.h>
+#include <list>
+
+typedef struct _rocsparse_trm_info*   rocsparse_trm_info;
+typedef struct _rocsparse_csrmv_info* rocsparse_csrmv_info;
+
+namespace rocsparse
+{
+    /********************************************************************************
+     * \brief Analysis whose result is stored in the analysis cache.
+     *******************************************************************************/
+    typedef enum analysis_cache_kind_
+    {
+        analysis_cache_kind_csrmv_adaptive,
+        analysis_cache_kind_csrmv_lrb,
+        analysis_cache_kind_trm
+    } analysis_cache_kind;
+
+    /********************************************************************************
+     * \brief Key of an analysis cache entry. Besides the sizes and the matrix
+     * descriptor properties, the sparsity pattern is identified by a 128 bit
+     * fingerprint of the row pointer and column index arrays.
+     *******************************************************************************/
+    struct analysis_cache_key
+    {
+        analysis_cache_kind   kind         = analysis_cache_kind_csrmv_adaptive;
+        rocsparse_operation   trans        = rocsparse_operation_none;
+        rocsparse_matrix_type type         = rocsparse_matrix_type_general;
+        rocsparse_index_base  base         = rocsparse_index_base_zero;
+        rocsparse_fill_mode   fill_mode    = rocsparse_fill_mode_lower;
+        rocsparse_diag_type   diag_type    = rocsparse_diag_type_non_unit;
+        rocsparse_indextype   index_type_I = rocsparse_indextype_u16;
+        rocsparse_indextype   index_type_J = rocsparse_indextype_u16;
+        int64_t               m{};
+        int64_t               n{};
+        int64_t               nnz{};
+        uint64_t              hash[2]{};
+
+        // Whether all but the fingerprint match
+        bool matches(const analysis_cache_key& that) const;
+        bool operator==(const analysis_cache_key& that) const;
+    };
+
+    /********************************************************************************
+     * \brief Create the analysis cache key of a matrix. The fingerprint is computed
+     * on the device using the handle buffer and downloaded asynchronously to the
+     * analysis cache of the handle, such that no stream synchronization is added
+     * when the cache holds no entry of the same sizes.
+     *******************************************************************************/
+    template <typename I, typename J>
+    rocsparse_status analysis_cache_create_key(rocsparse_handle          handle,
+                                               analysis_cache_kind       kind,
+                                               rocsparse_operation       trans,
+                                               const rocsparse_mat_descr descr,
+                                               int64_t                   m,
+                                               int64_t                   n,
+                                               int64_t                   nnz,
+                                               const I*                  row_ptr,
+                                               const J*                  col_ind,
+                                               analysis_cache_key*       key);
+
+    /********************************************************************************
+     * \brief analysis_cache holds copies of csrmv and trm analysis results of a
+     * handle, such that the analysis of a matrix with a sparsity pattern that has
+     * already been analyzed, possibly at another address, reduces to a device copy.
+     * The cache is disabled until a maximum size is set. Entries are evicted in
+     * least recently used order once the device memory they hold exceeds the
+     * maximum size.
+     *******************************************************************************/
+    class analysis_cache
+    {
+    public:
+        analysis_cache() = default;
+        ~analysis_cache();
+
+        analysis_cache(const analysis_cache&) = delete;
+        analysis_cache& operator=(const analysis_cache&) = delete;
+
+        bool enabled() const
+        {
+            return this->m_max_size > 0;
+        }
+
+        // Set the maximum device memory held by the cache, zero disables the cache.
+        rocsparse_status set_max_size(size_t max_size);
+
+        // Download the fingerprint of the key being created from the device.
+        rocsparse_status download_hash(hipStream_t stream, const uint64_t* hash);
+
+        int64_t get_hits() const
+        {
+            return this->m_hits;
+        }
+
+        int64_t get_misses() const
+        {
+            return this->m_misses;
+        }
+
+        size_t get_size() const
+        {
+            return this->m_size;
+        }
+
+        // Look up key and, if found, copy the cached result into the freshly created
+        // info. An entry whose fingerprint matches is only a hit if its sparsity
+        // pattern equals row_ptr and col_ind. The stream is synchronized only if an
+        // entry of the same sizes exists. Hits and misses are counted here.
+        rocsparse_status find(rocsparse_handle          handle,
+                              const analysis_cache_key& key,
+                              const void*               row_ptr,
+                              const void*               col_ind,
+                              rocsparse_csrmv_info      info,
+                              bool*                     found);
+        rocsparse_status find(rocsparse_handle          handle,
+                              const analysis_cache_key& key,
+                              const void*               row_ptr,
+                              const void*               col_ind,
+                              rocsparse_trm_info        info,
+                              void*                     zero_pivot,
+                              bool*                     found);
+
+        // Store a copy of the sparsity pattern and of the analysis result info under
+        // key. The copies are stream ordered, the fingerprint has arrived with the
+        // synchronization the analysis does.
+        rocsparse_status insert(rocsparse_handle           handle,
+                                const analysis_cache_key&  key,
+                                const void*                row_ptr,
+                                const void*                col_ind,
+                                const rocsparse_csrmv_info info);
+        rocsparse_status insert(rocsparse_handle          handle,
+                                const analysis_cache_key& key,
+                                const void*               row_ptr,
+                                const void*               col_ind,
+                                const rocsparse_trm_info  info,
+                                const void*               zero_pivot);
+
+    private:
+        struct entry
+        {
+            analysis_cache_key   key{};
+            rocsparse_csrmv_info csrmv_info{};
+            rocsparse_trm_info   trm_info{};
+
+            // device copies of the sparsity pattern and of the structural zero pivot
+            void* row_ptr{};
+            void* col_ind{};
+            void* zero_pivot{};
+
+            size_t size{};
+        };
+
+        // Find the entry of key whose sparsity pattern is row_ptr and col_ind, if any,
+        // and count the hit or miss.
+        rocsparse_status lookup(rocsparse_handle          handle,
+                                const analysis_cache_key& key,
+                                const void*               row_ptr,
+                                const void*               col_ind,
+                                entry**                   e);
+
+        // Wait for the fingerprint of the key being created.
+        rocsparse_status wait_hash(analysis_cache_key* key);
+
+        // Create an entry of key holding a copy of the sparsity pattern.
+        rocsparse_status create_entry(rocsparse_handle          handle,
+                                      const analysis_cache_key& key,
+                                      const void*               row_ptr,
+                                      const void*               col_ind,
+                                      entry*                    e);
+
+        rocsparse_status        push(entry& e);
+        rocsparse_status        evict(size_t max_size);
+        static rocsparse_status release(entry& e);
+
+        // Entries, most recently used first
+        std::list<entry> m_entries{};
+
+        // Pinned host buffer receiving the fingerprint and the pattern comparison,
+        // and event recorded once the fingerprint has been downloaded
+        uint64_t*  m_host{};
+        hipEvent_t m_event{};
+
+        size_t  m_max_size{};
+        size_t  m_size{};
+        int64_t m_hits{};
+        int64_t m_misses{};
+    };
+}
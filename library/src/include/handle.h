@@ -27,6 +27,7 @@
 #include "rocsparse-auxiliary.h"
 #include "rocsparse-version.h"
 
+#include "analysis_cache.h"
 #include "rocsparse_blas.h"
 #include <fstream>
 #include <hip/hip_runtime_api.h>
@@ -59,6 +60,8 @@ struct _rocsparse_handle
     rocsparse_status set_pointer_mode(rocsparse_pointer_mode user_mode);
     // get pointer mode
     rocsparse_status get_pointer_mode(rocsparse_pointer_mode* user_mode) const;
+    // make the pinned host buffer hold at least size bytes
+    rocsparse_status reserve_pinned_buffer(size_t size);
 
     // device id
     int device;
@@ -77,6 +80,11 @@ struct _rocsparse_handle
     // device buffer
     size_t buffer_size{};
     void*  buffer{};
+    // pinned host buffer staging downloads by two halves, and the events of the
+    // transfers to each half, allocated on first use
+    size_t     pinned_buffer_size{};
+    void*      pinned_buffer{};
+    hipEvent_t pinned_events[2]{};
     // device one
     float*  sone{};
     double* done{};
@@ -85,6 +93,8 @@ struct _rocsparse_handle
     rocsparse_double_complex* zone{};
     // blas handle
     rocsparse::blas_handle blas_handle;
+    // analysis cache, disabled by default
+    rocsparse::analysis_cache analysis_cache;
 
     // logging streams
     std::ofstream log_trace_ofs;
@@ -272,6 +282,13 @@ namespace rocsparse
  *******************************************************************************/
     rocsparse_status copy_csrmv_info(rocsparse_csrmv_info dest, const rocsparse_csrmv_info src);
 
+    /********************************************************************************
+ * \brief Copy csrmv info, the device arrays are copied asynchronously on stream.
+ *******************************************************************************/
+    rocsparse_status copy_csrmv_info(rocsparse_csrmv_info       dest,
+                                     const rocsparse_csrmv_info src,
+                                     hipStream_t                stream);
+
     /********************************************************************************
  * \brief Destroy csrmv info.
  *******************************************************************************/
@@ -319,6 +336,12 @@ namespace rocsparse
  *******************************************************************************/
     rocsparse_status copy_trm_info(rocsparse_trm_info dest, const rocsparse_trm_info src);
 
+    /********************************************************************************
+ * \brief Copy trm info, the device arrays are copied asynchronously on stream.
+ *******************************************************************************/
+    rocsparse_status
+        copy_trm_info(rocsparse_trm_info dest, const rocsparse_trm_info src, hipStream_t stream);
+
     /********************************************************************************
  * \brief Destroy trm info.
  *******************************************************************************/
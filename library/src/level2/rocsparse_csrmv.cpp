@@ -63,12 +63,54 @@ rocsparse_status rocsparse::csrmv_analysis_template(rocsparse_handle          ha
         return rocsparse_status_success;
     }
 
+    // Reuse the analysis of a matrix with the same sparsity pattern, if cached
+    rocsparse::analysis_cache_key key;
+    const bool                    use_cache
+        = handle->analysis_cache.enabled()
+          && (alg == rocsparse::csrmv_alg_adaptive || alg == rocsparse::csrmv_alg_lrb);
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::analysis_cache_create_key(
+            handle,
+            (alg == rocsparse::csrmv_alg_adaptive) ? rocsparse::analysis_cache_kind_csrmv_adaptive
+                                                   : rocsparse::analysis_cache_kind_csrmv_lrb,
+            trans,
+            descr,
+            m,
+            n,
+            nnz,
+            csr_row_ptr,
+            csr_col_ind,
+            &key));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(info->csrmv_info));
+        info->csrmv_info = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csrmv_info(&info->csrmv_info));
+
+        bool found;
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.find(
+            handle, key, csr_row_ptr, csr_col_ind, info->csrmv_info, &found));
+        if(found)
+        {
+            // The cached analysis refers to the matrix it has been computed for
+            info->csrmv_info->descr       = descr;
+            info->csrmv_info->csr_row_ptr = csr_row_ptr;
+            info->csrmv_info->csr_col_ind = csr_col_ind;
+            return rocsparse_status_success;
+        }
+    }
+
     switch(alg)
     {
     case rocsparse::csrmv_alg_adaptive:
     {
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_adaptive_template_dispatch(
             handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+        if(use_cache)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.insert(
+                handle, key, csr_row_ptr, csr_col_ind, info->csrmv_info));
+        }
         return rocsparse_status_success;
     }
 
@@ -76,6 +118,11 @@ rocsparse_status rocsparse::csrmv_analysis_template(rocsparse_handle          ha
     {
         RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_analysis_lrb_template_dispatch(
             handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info));
+        if(use_cache)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.insert(
+                handle, key, csr_row_ptr, csr_col_ind, info->csrmv_info));
+        }
         return rocsparse_status_success;
     }
 
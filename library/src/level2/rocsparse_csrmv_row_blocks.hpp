@@ -0,0 +1,445 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace rocsparse
+{
+    // Host construction of the CSR-Adaptive row blocks and workgroup ids.
+    //
+    // The row blocks builder is a state machine over the rows, but its state
+    // (accumulated nnz, long row counter) is reset at every block boundary. The
+    // block starting at a given row is therefore a function of that row only, and
+    // the whole array is the chain of blocks starting at row 0.
+    //
+    // For large matrices the rows are split into chunks, and each chunk builds
+    // in parallel the chain of blocks starting at its first row, as if a block
+    // boundary was there. The chunks are then stitched in order: the true chain
+    // enters each chunk at some row, and is extended serially from there until it
+    // reaches a block boundary of the chunk, from which the speculative blocks are
+    // reused as they are. The result is identical to the serial construction.
+    //
+    // A block is determined as soon as the row that closes it is known, so rows can
+    // also be appended progressively, e.g. while the row pointer array is downloaded.
+    template <uint32_t BLOCK_SIZE,
+              uint32_t BLOCK_MULTIPLIER,
+              uint32_t ROWS_FOR_VECTOR,
+              uint32_t WG_SIZE,
+              typename I,
+              typename J>
+    class csrmv_adaptive_row_blocks
+    {
+    private:
+        static uint32_t flp2(uint32_t x)
+        {
+            x |= (x >> 1);
+            x |= (x >> 2);
+            x |= (x >> 4);
+            x |= (x >> 8);
+            x |= (x >> 16);
+            return x - (x >> 1);
+        }
+
+        // Short rows in CSR-Adaptive are batched together into a single row block.
+        // If there are a relatively small number of these, then we choose to do
+        // a horizontal reduction (groups of threads all reduce the same row).
+        // If there are many threads (e.g. more threads than the maximum size
+        // of our workgroup) then we choose to have each thread serially reduce
+        // the row.
+        // This function calculates the number of threads that could team up
+        // to reduce these groups of rows. For instance, if you have a
+        // workgroup size of 256 and 4 rows, you could have 64 threads
+        // working on each row. If you have 5 rows, only 32 threads could
+        // reliably work on each row because our reduction assumes power-of-2.
+        static uint64_t numThreadsForReduction(uint64_t num_rows)
+        {
+#if defined(__INTEL_COMPILER)
+            return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
+#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
+    || !defined(__clang) && defined(__GNUG__)             \
+           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
+            return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
+#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
+            uint64_t bit_returned;
+            _BitScanReverse(&bit_returned, (num_rows - 1));
+            return WG_SIZE >> (bit_returned + 1);
+#else
+            return flp2(WG_SIZE / num_rows);
+#endif
+        }
+
+        // Appends of less than s_min_parallel_rows rows are built by the calling thread
+        // only, larger ones are split in chunks of at least s_min_chunk_rows rows.
+        static constexpr I s_min_chunk_rows    = 1 << 18;
+        static constexpr I s_min_parallel_rows = 2 * s_min_chunk_rows;
+
+        // Maximum number of threads of an append, including the calling thread.
+        static constexpr uint32_t s_max_threads = 8;
+
+        // State of the scan of a block that cannot be determined yet.
+        struct scan_state
+        {
+            I b{-1};
+            I i{};
+            I sum{};
+            I consecutive_long_rows{};
+        };
+
+        const I*       m_row_ptr;
+        I              m_nrow;
+        uint32_t       m_num_threads;
+        I              m_next{};
+        scan_state     m_scan{};
+        std::vector<I> m_row_blocks{};
+        std::vector<J> m_wg_ids{};
+
+        // Determine the block starting at row b < nrow, with a fresh state, from the rows
+        // [0, nvalid). Returns the first row of the next block, or b if the block cannot
+        // be determined without the rows that follow, in which case the scan is saved in
+        // state to be resumed later. The workgroup id of the block start is returned in
+        // wg_id, and num_wgs holds the number of workgroups of a csr-vector block (zero
+        // otherwise).
+        I next_block(I b, I nvalid, J& wg_id, I& num_wgs, scan_state& state) const
+        {
+            const I* rowDelimiters = this->m_row_ptr;
+            const I  nRows         = this->m_nrow;
+
+            I i                     = b + 1;
+            I sum                   = 0;
+            I consecutive_long_rows = 0;
+            if(state.b == b)
+            {
+                i                     = state.i;
+                sum                   = state.sum;
+                consecutive_long_rows = state.consecutive_long_rows;
+            }
+
+            wg_id   = 0;
+            num_wgs = 0;
+
+            for(; i <= nvalid; ++i)
+            {
+                const I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
+                sum += row_length;
+
+                // The following section of code calculates whether you're moving between
+                // a series of "short" rows and a series of "long" rows.
+                // This is because the reduction in CSR-Adaptive likes things to be
+                // roughly the same length. Long rows can be reduced horizontally.
+                // Short rows can be reduced one-thread-per-row. Try not to mix them.
+                if(row_length > 128)
+                {
+                    ++consecutive_long_rows;
+                }
+                else if(consecutive_long_rows > 0)
+                {
+                    // If it turns out we WERE in a long-row region, cut if off now.
+                    if(row_length < 32) // Now we're in a short-row region
+                    {
+                        consecutive_long_rows = -1;
+                    }
+                    else
+                    {
+                        consecutive_long_rows++;
+                    }
+                }
+
+                // If you just entered into a "long" row from a series of short rows,
+                // then we need to make sure we cut off those short rows. Put them in
+                // their own workgroup. The same applies to the first short row after
+                // some long ones that didn't previously fill up a row block.
+                if((consecutive_long_rows == 1 && i - b > 1) || consecutive_long_rows == -1)
+                {
+                    // If this row fits into CSR-Stream, calculate how many rows
+                    // can be used to do a parallel reduction.
+                    if(((i - 1) - b) > static_cast<I>(ROWS_FOR_VECTOR))
+                    {
+                        wg_id |= numThreadsForReduction((i - 1) - b);
+                    }
+                    return i - 1;
+                }
+
+                // exactly one row results in non-zero elements to be greater than blockSize
+                // This is csr-vector case;
+                if((i - b == 1) && sum > static_cast<I>(BLOCK_SIZE))
+                {
+                    num_wgs = static_cast<I>(std::ceil(static_cast<double>(row_length)
+                                                       / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+
+                    // Check to ensure #workgroups can fit in 32 bits, if not
+                    // then the last workgroup will do all the remaining work
+                    // Note: Maximum number of workgroups is 2^31-1 = 2147483647
+                    static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
+                    num_wgs = (num_wgs < maxNumberOfWorkgroups) ? num_wgs : maxNumberOfWorkgroups;
+                    return i;
+                }
+
+                // more than one row results in non-zero elements to be greater than blockSize
+                // This is csr-stream case; wgIds holds number of parallel reduction threads
+                else if((i - b > 1) && sum > static_cast<I>(BLOCK_SIZE))
+                {
+                    // This row won't fit, so back off one.
+                    --i;
+                    if((i - b) > static_cast<I>(ROWS_FOR_VECTOR))
+                    {
+                        wg_id |= numThreadsForReduction(i - b);
+                    }
+                    return i;
+                }
+                // This is csr-stream case; wgIds holds number of parallel reduction threads
+                else if(sum == static_cast<I>(BLOCK_SIZE))
+                {
+                    if((i - b) > static_cast<I>(ROWS_FOR_VECTOR))
+                    {
+                        wg_id |= numThreadsForReduction(i - b);
+                    }
+                    return i;
+                }
+            }
+
+            if(nvalid < nRows)
+            {
+                state.b                     = b;
+                state.i                     = i;
+                state.sum                   = sum;
+                state.consecutive_long_rows = consecutive_long_rows;
+                return b;
+            }
+
+            // The last row block ends with the matrix.
+            if((nRows - b) > static_cast<I>(ROWS_FOR_VECTOR))
+            {
+                wg_id |= numThreadsForReduction((nRows - b) + 1);
+            }
+            return nRows;
+        }
+
+        // Append the chain of blocks starting at row b, until a block starts at or after
+        // row stop, or cannot be determined from the rows [0, nvalid). Returns the start
+        // of that block.
+        I append_blocks(I               b,
+                        I               stop,
+                        I               nvalid,
+                        std::vector<I>& row_blocks,
+                        std::vector<J>& wg_ids,
+                        scan_state&     state) const
+        {
+            while(b < stop && b < this->m_nrow)
+            {
+                J       wg_id;
+                I       num_wgs;
+                const I next = this->next_block(b, nvalid, wg_id, num_wgs, state);
+                if(next == b)
+                {
+                    break;
+                }
+
+                row_blocks.push_back(b);
+                wg_ids.push_back(wg_id);
+                for(I w = 1; w < num_wgs; ++w)
+                {
+                    row_blocks.push_back(b);
+                    wg_ids.push_back(static_cast<J>(w));
+                }
+                b = next;
+            }
+            return b;
+        }
+
+        // Reserve room for the blocks of rows [b, stop), most of them hold about
+        // BLOCK_SIZE nonzeros and none is empty.
+        void reserve_blocks(I b, I stop, std::vector<I>& row_blocks, std::vector<J>& wg_ids) const
+        {
+            const int64_t nnz = int64_t(this->m_row_ptr[stop]) - int64_t(this->m_row_ptr[b]);
+            const size_t  nblocks
+                = std::min(int64_t(stop - b), std::max(int64_t(0), nnz / BLOCK_SIZE) * 2) + 1;
+            const size_t size = row_blocks.size() + nblocks;
+            if(size > row_blocks.capacity())
+            {
+                row_blocks.reserve(std::max(size, 2 * row_blocks.capacity()));
+                wg_ids.reserve(std::max(size, 2 * wg_ids.capacity()));
+            }
+        }
+
+    public:
+        // The row pointer array of size nrow + 1 can be filled progressively, see append.
+        // At most num_threads chunks are built in parallel, capped to s_max_threads.
+        csrmv_adaptive_row_blocks(I        nrow,
+                                  const I* row_ptr,
+                                  uint32_t num_threads = std::thread::hardware_concurrency())
+            : m_row_ptr(row_ptr)
+            , m_nrow(nrow)
+            , m_num_threads(std::min(std::max(num_threads, 1u), s_max_threads))
+        {
+        }
+
+        // Extend the row blocks with the rows [0, nvalid), i.e. once the entries
+        // [0, nvalid] of the row pointer array are available. The result does not
+        // depend on how the rows are appended.
+        void append(I nvalid)
+        {
+            const I       b0         = this->m_next;
+            const int64_t nrow       = int64_t(nvalid) - int64_t(b0);
+            const int64_t max_chunks
+                = (nrow < s_min_parallel_rows) ? int64_t(1) : nrow / s_min_chunk_rows;
+            const int64_t num_chunks = std::min(max_chunks, int64_t(this->m_num_threads));
+
+            if(nrow <= 0)
+            {
+                return;
+            }
+
+            if(num_chunks == 1)
+            {
+                this->reserve_blocks(b0, nvalid, this->m_row_blocks, this->m_wg_ids);
+                this->m_next = this->append_blocks(
+                    b0, nvalid, nvalid, this->m_row_blocks, this->m_wg_ids, this->m_scan);
+                return;
+            }
+
+            std::vector<I> chunk_start(num_chunks + 1);
+            for(int64_t c = 0; c <= num_chunks; ++c)
+            {
+                chunk_start[c] = static_cast<I>(b0 + (nrow * c) / num_chunks);
+            }
+
+            // Speculative chains, the first one is exact.
+            std::vector<std::vector<I>> chunk_row_blocks(num_chunks);
+            std::vector<std::vector<J>> chunk_wg_ids(num_chunks);
+            std::vector<I>              chunk_exit(num_chunks);
+            std::vector<scan_state>     chunk_scan(num_chunks);
+            chunk_scan[0] = this->m_scan;
+
+            auto speculate = [&](int64_t c) {
+                this->reserve_blocks(
+                    chunk_start[c], chunk_start[c + 1], chunk_row_blocks[c], chunk_wg_ids[c]);
+                chunk_exit[c] = this->append_blocks(chunk_start[c],
+                                                    chunk_start[c + 1],
+                                                    nvalid,
+                                                    chunk_row_blocks[c],
+                                                    chunk_wg_ids[c],
+                                                    chunk_scan[c]);
+            };
+
+            // If a thread cannot be created, the calling thread builds the remaining chunks,
+            // the result does not depend on which thread builds a chunk.
+            std::vector<std::thread> threads;
+            threads.reserve(num_chunks - 1);
+            int64_t next_chunk = 1;
+            try
+            {
+                for(; next_chunk < num_chunks; ++next_chunk)
+                {
+                    threads.emplace_back(speculate, next_chunk);
+                }
+            }
+            catch(const std::system_error&)
+            {
+            }
+            speculate(0);
+            for(; next_chunk < num_chunks; ++next_chunk)
+            {
+                speculate(next_chunk);
+            }
+            for(auto& t : threads)
+            {
+                t.join();
+            }
+
+            // Stitch the chunks.
+            std::vector<I>& row_blocks = this->m_row_blocks;
+            std::vector<J>& wg_ids     = this->m_wg_ids;
+            this->reserve_blocks(b0, nvalid, row_blocks, wg_ids);
+            row_blocks.insert(
+                row_blocks.end(), chunk_row_blocks[0].begin(), chunk_row_blocks[0].end());
+            wg_ids.insert(wg_ids.end(), chunk_wg_ids[0].begin(), chunk_wg_ids[0].end());
+            I          b     = chunk_exit[0];
+            scan_state state = chunk_scan[0];
+            for(int64_t c = 1; c < num_chunks && b >= chunk_start[c]; ++c)
+            {
+                const std::vector<I>& spec_row_blocks = chunk_row_blocks[c];
+                const std::vector<J>& spec_wg_ids     = chunk_wg_ids[c];
+                auto                  it              = spec_row_blocks.begin();
+                while(b < chunk_start[c + 1])
+                {
+                    it = std::lower_bound(it, spec_row_blocks.end(), b);
+                    if(it != spec_row_blocks.end() && *it == b)
+                    {
+                        // Synchronized with the speculative chain.
+                        const size_t pos = it - spec_row_blocks.begin();
+                        row_blocks.insert(row_blocks.end(), it, spec_row_blocks.end());
+                        wg_ids.insert(wg_ids.end(), spec_wg_ids.begin() + pos, spec_wg_ids.end());
+                        b     = chunk_exit[c];
+                        state = chunk_scan[c];
+                        break;
+                    }
+
+                    // Extend the exact chain by one block.
+                    const I next
+                        = this->append_blocks(b, b + 1, nvalid, row_blocks, wg_ids, state);
+                    if(next == b)
+                    {
+                        break;
+                    }
+                    b = next;
+                }
+
+                // Release memory early.
+                std::vector<I>().swap(chunk_row_blocks[c]);
+                std::vector<J>().swap(chunk_wg_ids[c]);
+            }
+            this->m_next = b;
+            this->m_scan = state;
+        }
+
+        // Complete the row blocks with the rows not appended yet, and move them to
+        // row_blocks and wg_ids. The row pointer array must be complete.
+        void finalize(std::vector<I>& row_blocks, std::vector<J>& wg_ids)
+        {
+            this->append(this->m_nrow);
+
+            // If we didn't fill a row block with the last row, make sure we don't lose it.
+            this->m_row_blocks.push_back(this->m_nrow);
+            this->m_wg_ids.push_back(0);
+
+            row_blocks.swap(this->m_row_blocks);
+            wg_ids.swap(this->m_wg_ids);
+        }
+
+        // Build the row blocks and workgroup ids from the complete row pointer array. The
+        // arrays are identical to the ones of the serial construction.
+        void build(std::vector<I>& row_blocks, std::vector<J>& wg_ids)
+        {
+            this->finalize(row_blocks, wg_ids);
+        }
+    };
+}
@@ -29,6 +29,8 @@
 
 #include "csrmv_device.h"
 #include "csrmv_symm_device.h"
+#include "rocsparse_csrmv_row_blocks.hpp"
+#include <cstring>
 #include <vector>
 
 #define BLOCK_SIZE 1024
@@ -38,44 +40,6 @@
 
 namespace rocsparse
 {
-    __attribute__((unused)) static uint32_t flp2(uint32_t x)
-    {
-        x |= (x >> 1);
-        x |= (x >> 2);
-        x |= (x >> 4);
-        x |= (x >> 8);
-        x |= (x >> 16);
-        return x - (x >> 1);
-    }
-
-    // Short rows in CSR-Adaptive are batched together into a single row block.
-    // If there are a relatively small number of these, then we choose to do
-    // a horizontal reduction (groups of threads all reduce the same row).
-    // If there are many threads (e.g. more threads than the maximum size
-    // of our workgroup) then we choose to have each thread serially reduce
-    // the row.
-    // This function calculates the number of threads that could team up
-    // to reduce these groups of rows. For instance, if you have a
-    // workgroup size of 256 and 4 rows, you could have 64 threads
-    // working on each row. If you have 5 rows, only 32 threads could
-    // reliably work on each row because our reduction assumes power-of-2.
-    static uint64_t numThreadsForReduction(uint64_t num_rows)
-    {
-#if defined(__INTEL_COMPILER)
-        return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-        return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-        uint64_t bit_returned;
-        _BitScanReverse(&bit_returned, (num_rows - 1));
-        return WG_SIZE >> (bit_returned + 1);
-#else
-        return flp2(WG_SIZE / num_rows);
-#endif
-    }
-
     template <typename I>
     static inline I maxRowsInABlock(const I* rowBlocks, size_t rowBlockSize)
     {
@@ -91,219 +55,86 @@ namespace rocsparse
         return max;
     }
 
-    template <typename I, typename J>
-    static inline void ComputeRowBlocks(I*       rowBlocks,
-                                        J*       wgIds,
-                                        size_t&  rowBlockSize,
-                                        const I* rowDelimiters,
-                                        I        nRows,
-                                        bool     allocate_row_blocks = true)
+    // Number of row pointer entries per pinned chunk of the download.
+    static constexpr int64_t s_csrmv_adaptive_download_chunk_size = 1 << 20;
+
+    // Download the row pointer array to hptr and append the rows to the row blocks
+    // builder. Large arrays are staged through the two halves of the pinned buffer of
+    // the handle, the rows of a chunk are appended while the next chunk is in flight.
+    template <typename I, typename BUILDER>
+    static rocsparse_status csrmv_adaptive_download_row_ptr(rocsparse_handle handle,
+                                                            I                m,
+                                                            const I*         csr_row_ptr,
+                                                            I*               hptr,
+                                                            BUILDER&         builder)
     {
-        I* rowBlocksBase;
-
-        // Start at one because of rowBlock[0]
-        I total_row_blocks = 1;
+        static constexpr int64_t chunk_size = s_csrmv_adaptive_download_chunk_size;
 
-        if(allocate_row_blocks)
+        hipStream_t   stream = handle->stream;
+        const int64_t size   = int64_t(m) + 1;
+        if(size <= 2 * chunk_size)
         {
-            rowBlocksBase = rowBlocks;
-            *rowBlocks    = 0;
-            *wgIds        = 0;
-            ++rowBlocks;
-            ++wgIds;
-        }
-
-        I sum = 0;
-        I i;
-        I last_i = 0;
-
-        I consecutive_long_rows = 0;
-        for(i = 1; i <= nRows; ++i)
-        {
-            I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-            sum += row_length;
-
-            // The following section of code calculates whether you're moving between
-            // a series of "short" rows and a series of "long" rows.
-            // This is because the reduction in CSR-Adaptive likes things to be
-            // roughly the same length. Long rows can be reduced horizontally.
-            // Short rows can be reduced one-thread-per-row. Try not to mix them.
-            if(row_length > 128)
-            {
-                ++consecutive_long_rows;
-            }
-            else if(consecutive_long_rows > 0)
-            {
-                // If it turns out we WERE in a long-row region, cut if off now.
-                if(row_length < 32) // Now we're in a short-row region
-                {
-                    consecutive_long_rows = -1;
-                }
-                else
-                {
-                    consecutive_long_rows++;
-                }
-            }
-
-            // If you just entered into a "long" row from a series of short rows,
-            // then we need to make sure we cut off those short rows. Put them in
-            // their own workgroup.
-            if(consecutive_long_rows == 1)
-            {
-                // Assuming there *was* a previous workgroup. If not, nothing to do here.
-                if(i - last_i > 1)
-                {
-                    if(allocate_row_blocks)
-                    {
-                        *rowBlocks = i - 1;
-
-                        // If this row fits into CSR-Stream, calculate how many rows
-                        // can be used to do a parallel reduction.
-                        // Fill in the low-order bits with the numThreadsForRed
-                        if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                        {
-                            *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                        }
-
-                        ++rowBlocks;
-                        ++wgIds;
-                    }
-
-                    ++total_row_blocks;
-                    last_i = i - 1;
-                    sum    = row_length;
-                }
-            }
-            else if(consecutive_long_rows == -1)
-            {
-                // We see the first short row after some long ones that
-                // didn't previously fill up a row block.
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i - 1;
-                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                hptr, csr_row_ptr, sizeof(I) * size, hipMemcpyDeviceToHost, stream));
 
-                ++total_row_blocks;
-                last_i                = i - 1;
-                sum                   = row_length;
-                consecutive_long_rows = 0;
-            }
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-            // Now, what's up with this row? What did it do?
+            builder.append(m);
+            return rocsparse_status_success;
+        }
 
-            // exactly one row results in non-zero elements to be greater than blockSize
-            // This is csr-vector case;
-            if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
+        RETURN_IF_ROCSPARSE_ERROR(handle->reserve_pinned_buffer(sizeof(I) * 2 * chunk_size));
+        I*          pinned = static_cast<I*>(handle->pinned_buffer);
+        hipEvent_t* events = handle->pinned_events;
+
+        auto download = [&]() -> rocsparse_status {
+            const int64_t num_chunks = (size - 1) / chunk_size + 1;
+
+            auto enqueue = [&](int64_t k) -> rocsparse_status {
+                const int64_t offset = k * chunk_size;
+                const int64_t count  = std::min(chunk_size, size - offset);
+                RETURN_IF_HIP_ERROR(hipMemcpyAsync(pinned + (k % 2) * chunk_size,
+                                                   csr_row_ptr + offset,
+                                                   sizeof(I) * count,
+                                                   hipMemcpyDeviceToHost,
+                                                   stream));
+                RETURN_IF_HIP_ERROR(hipEventRecord(events[k % 2], stream));
+                return rocsparse_status_success;
+            };
+
+            RETURN_IF_ROCSPARSE_ERROR(enqueue(0));
+            RETURN_IF_ROCSPARSE_ERROR(enqueue(1));
+            for(int64_t k = 0; k < num_chunks; ++k)
             {
-                I numWGReq = static_cast<I>(rocsparse::ceil(static_cast<double>(row_length)
-                                                            / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
+                const int64_t offset = k * chunk_size;
+                const int64_t count  = std::min(chunk_size, size - offset);
 
-                // Check to ensure #workgroups can fit in 32 bits, if not
-                // then the last workgroup will do all the remaining work
-                // Note: Maximum number of workgroups is 2^31-1 = 2147483647
-                static constexpr I maxNumberOfWorkgroups = static_cast<I>(INT_MAX);
-                numWGReq = (numWGReq < maxNumberOfWorkgroups) ? numWGReq : maxNumberOfWorkgroups;
+                RETURN_IF_HIP_ERROR(hipEventSynchronize(events[k % 2]));
+                memcpy(hptr + offset, pinned + (k % 2) * chunk_size, sizeof(I) * count);
 
-                if(allocate_row_blocks)
+                // The staging chunk is free again.
+                if(k + 2 < num_chunks)
                 {
-                    for(I w = 1; w < numWGReq; ++w)
-                    {
-                        *rowBlocks = (i - 1);
-                        *wgIds |= static_cast<J>(w);
-
-                        ++rowBlocks;
-                        ++wgIds;
-                    }
-
-                    *rowBlocks = i;
-                    ++rowBlocks;
-                    ++wgIds;
+                    RETURN_IF_ROCSPARSE_ERROR(enqueue(k + 2));
                 }
 
-                total_row_blocks += numWGReq;
-                last_i                = i;
-                sum                   = 0;
-                consecutive_long_rows = 0;
+                // Append the rows whose both bounds are known.
+                builder.append(static_cast<I>(offset + count - 1));
             }
-            // more than one row results in non-zero elements to be greater than blockSize
-            // This is csr-stream case; wgIds holds number of parallel reduction threads
-            else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
-            {
-                // This row won't fit, so back off one.
-                --i;
-
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i;
-                    if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
+            return rocsparse_status_success;
+        };
 
-                ++total_row_blocks;
-                last_i                = i;
-                sum                   = 0;
-                consecutive_long_rows = 0;
-            }
-            // This is csr-stream case; wgIds holds number of parallel reduction threads
-            else if(sum == static_cast<I>(BLOCK_SIZE))
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i;
-                    if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i                = i;
-                sum                   = 0;
-                consecutive_long_rows = 0;
-            }
-        }
+        const rocsparse_status status = download();
 
-        // If we didn't fill a row block with the last row, make sure we don't lose it.
-        if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
+        // Make sure no transfer to the pinned buffer is pending once it is released to
+        // the handle.
+        if(status != rocsparse_status_success)
         {
-            *rowBlocks = nRows;
-            if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-            {
-                *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-            }
-
-            ++rowBlocks;
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
         }
 
-        ++total_row_blocks;
-
-        if(allocate_row_blocks)
-        {
-            size_t dist = std::distance(rowBlocksBase, rowBlocks);
-            rocsparse_host_assert((dist) <= rowBlockSize,
-                                  "Calculated distance is expected to be bounded by rowBlockSize.");
-            // Update the size of rowBlocks to reflect the actual amount of memory used
-            rowBlockSize = dist;
-        }
-        else
-        {
-            rowBlockSize = total_row_blocks;
-        }
+        return status;
     }
 }
 
@@ -334,23 +165,24 @@ rocsparse_status
 
     // Temporary arrays to hold device data
     std::vector<I> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
 
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Create row blocks and workgroup data structures, while the row pointer array is
+    // downloaded
+    rocsparse::csrmv_adaptive_row_blocks<BLOCK_SIZE,
+                                         BLOCK_MULTIPLIER,
+                                         ROWS_FOR_VECTOR,
+                                         WG_SIZE,
+                                         I,
+                                         J>
+        builder(m, hptr.data());
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::csrmv_adaptive_download_row_ptr(
+        handle, static_cast<I>(m), csr_row_ptr, hptr.data(), builder));
 
-    // Determine row blocks array size
-    ComputeRowBlocks<I, J>(
-        (I*)NULL, (J*)NULL, info->csrmv_info->adaptive.size, hptr.data(), m, false);
+    std::vector<I> row_blocks;
+    std::vector<J> wg_ids;
+    builder.finalize(row_blocks, wg_ids);
 
-    // Create row blocks, workgroup flag, and workgroup data structures
-    std::vector<I>        row_blocks(info->csrmv_info->adaptive.size, 0);
-    std::vector<uint32_t> wg_flags(info->csrmv_info->adaptive.size, 0);
-    std::vector<J>        wg_ids(info->csrmv_info->adaptive.size, 0);
-
-    ComputeRowBlocks<I, J>(
-        row_blocks.data(), wg_ids.data(), info->csrmv_info->adaptive.size, hptr.data(), m, true);
+    info->csrmv_info->adaptive.size = row_blocks.size();
 
     if(descr->type == rocsparse_matrix_type_symmetric)
     {
@@ -378,10 +210,9 @@ rocsparse_status
                                            sizeof(I) * info->csrmv_info->adaptive.size,
                                            hipMemcpyHostToDevice,
                                            stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->adaptive.wg_flags,
-                                           wg_flags.data(),
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info->csrmv_info->adaptive.wg_flags,
+                                           0,
                                            sizeof(uint32_t) * info->csrmv_info->adaptive.size,
-                                           hipMemcpyHostToDevice,
                                            stream));
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->adaptive.wg_ids,
                                            wg_ids.data(),
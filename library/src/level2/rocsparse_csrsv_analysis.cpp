@@ -49,6 +49,43 @@ rocsparse_status rocsparse::trm_analysis(rocsparse_handle          handle,
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Reuse the analysis of a matrix with the same sparsity pattern, if cached
+    rocsparse::analysis_cache_key key;
+    const bool                    use_cache = handle->analysis_cache.enabled();
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::analysis_cache_create_key(
+            handle,
+            rocsparse::analysis_cache_kind_trm,
+            trans,
+            descr,
+            m,
+            m,
+            nnz,
+            csr_row_ptr,
+            csr_col_ind,
+            &key));
+
+        if(*zero_pivot == nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipMallocAsync((void**)zero_pivot, sizeof(J), stream));
+        }
+
+        bool found;
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.find(
+            handle, key, csr_row_ptr, csr_col_ind, info, *zero_pivot, &found));
+        if(found)
+        {
+            // The cached analysis refers to the matrix it has been computed for
+            info->descr = descr;
+            info->trm_row_ptr
+                = (trans == rocsparse_operation_none) ? csr_row_ptr : info->trmt_row_ptr;
+            info->trm_col_ind
+                = (trans == rocsparse_operation_none) ? csr_col_ind : info->trmt_col_ind;
+            return rocsparse_status_success;
+        }
+    }
+
     // If analyzing transposed, allocate some info memory to hold the transposed matrix
     if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
     {
@@ -509,6 +546,12 @@ rocsparse_status rocsparse::trm_analysis(rocsparse_handle          handle,
                              : ((sizeof(J) == sizeof(int32_t)) ? rocsparse_indextype_i32
                                                                : rocsparse_indextype_i64);
 
+    if(use_cache)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.insert(
+            handle, key, csr_row_ptr, csr_col_ind, info, *zero_pivot));
+    }
+
     return rocsparse_status_success;
 }
 
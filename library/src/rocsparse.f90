@@ -114,6 +114,29 @@ module rocsparse
             character(c_char) :: rev(*)
         end function rocsparse_get_git_rev
 
+!       rocsparse_analysis_cache
+        function rocsparse_set_analysis_cache_size(handle, max_size) &
+                bind(c, name = 'rocsparse_set_analysis_cache_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_analysis_cache_size
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: max_size
+        end function rocsparse_set_analysis_cache_size
+
+        function rocsparse_get_analysis_cache_info(handle, hits, misses, size) &
+                bind(c, name = 'rocsparse_get_analysis_cache_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_analysis_cache_info
+            type(c_ptr), value :: handle
+            integer(c_int64_t) :: hits
+            integer(c_int64_t) :: misses
+            integer(c_size_t) :: size
+        end function rocsparse_get_analysis_cache_info
+
 !       rocsparse_mat_descr
         function rocsparse_create_mat_descr(descr) &
                 bind(c, name = 'rocsparse_create_mat_descr')
@@ -0,0 +1,572 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "analysis_cache.h"
+#include "common.h"
+#include "control.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <algorithm>
+
+namespace rocsparse
+{
+    // splitmix64 finalizer
+    __device__ __forceinline__ uint64_t fingerprint_mix(uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    //
+    // Kernel computing a 128 bit fingerprint of the row pointer and column index arrays.
+    // Each entry contributes a mix of its position and its value to both halves, and the
+    // contributions are summed such that the result does not depend on the order of the
+    // reduction.
+    //
+    template <uint32_t BLOCKSIZE, typename I, typename J>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void fingerprint_kernel(int64_t m,
+                            int64_t nnz,
+                            const I* __restrict__ row_ptr,
+                            const J* __restrict__ col_ind,
+                            uint64_t* __restrict__ hash)
+    {
+        const int     tid    = hipThreadIdx_x;
+        const int64_t stride = int64_t(BLOCKSIZE) * hipGridDim_x;
+
+        __shared__ uint64_t shd0[BLOCKSIZE];
+        __shared__ uint64_t shd1[BLOCKSIZE];
+
+        uint64_t h0 = 0;
+        uint64_t h1 = 0;
+        for(int64_t i = tid + int64_t(BLOCKSIZE) * hipBlockIdx_x; i < m + 1 + nnz; i += stride)
+        {
+            const uint64_t v = (i <= m) ? uint64_t(row_ptr[i]) : uint64_t(col_ind[i - m - 1]);
+
+            const uint64_t p0 = rocsparse::fingerprint_mix(i + 0x9e3779b97f4a7c15ULL);
+            const uint64_t p1 = rocsparse::fingerprint_mix(i ^ 0xc2b2ae3d27d4eb4fULL);
+
+            h0 += rocsparse::fingerprint_mix(p0 ^ v);
+            h1 += rocsparse::fingerprint_mix(p1 + v * 0x165667b19e3779f9ULL);
+        }
+
+        shd0[tid] = h0;
+        shd1[tid] = h1;
+
+        __syncthreads();
+        rocsparse::blockreduce_sum<BLOCKSIZE>(tid, shd0);
+        rocsparse::blockreduce_sum<BLOCKSIZE>(tid, shd1);
+
+        if(tid == 0)
+        {
+            rocsparse::atomic_add(&hash[0], shd0[0]);
+            rocsparse::atomic_add(&hash[1], shd1[0]);
+        }
+    }
+
+    //
+    // Kernel flagging a difference between two arrays of 32 bit words.
+    //
+    template <uint32_t BLOCKSIZE>
+    ROCSPARSE_KERNEL(BLOCKSIZE)
+    void pattern_compare_kernel(int64_t size,
+                                const uint32_t* __restrict__ x,
+                                const uint32_t* __restrict__ y,
+                                uint64_t* __restrict__ differ)
+    {
+        const int64_t stride = int64_t(BLOCKSIZE) * hipGridDim_x;
+        for(int64_t i = hipThreadIdx_x + int64_t(BLOCKSIZE) * hipBlockIdx_x; i < size;
+            i += stride)
+        {
+            if(x[i] != y[i])
+            {
+                *differ = 1;
+                return;
+            }
+        }
+    }
+
+    static rocsparse_status pattern_compare(hipStream_t stream,
+                                            size_t      size,
+                                            const void* x,
+                                            const void* y,
+                                            uint64_t*   differ)
+    {
+        static constexpr uint32_t BLOCKSIZE = 256;
+
+        // Index arrays hold 32 or 64 bit integers
+        const int64_t nwords  = size / sizeof(uint32_t);
+        const int64_t nblocks = std::min(nwords / BLOCKSIZE + 1, int64_t(1024));
+        RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::pattern_compare_kernel<BLOCKSIZE>),
+                                           dim3(nblocks),
+                                           dim3(BLOCKSIZE),
+                                           0,
+                                           stream,
+                                           nwords,
+                                           reinterpret_cast<const uint32_t*>(x),
+                                           reinterpret_cast<const uint32_t*>(y),
+                                           differ);
+        return rocsparse_status_success;
+    }
+
+    static size_t row_ptr_size(const analysis_cache_key& key)
+    {
+        return rocsparse::indextype_sizeof(key.index_type_I) * (key.m + 1);
+    }
+
+    static size_t col_ind_size(const analysis_cache_key& key)
+    {
+        return rocsparse::indextype_sizeof(key.index_type_J) * key.nnz;
+    }
+
+    static size_t csrmv_info_size(const _rocsparse_csrmv_info* info)
+    {
+        const size_t I_size = rocsparse::indextype_sizeof(info->index_type_I);
+        const size_t J_size = rocsparse::indextype_sizeof(info->index_type_J);
+
+        size_t size = 0;
+        size += (info->adaptive.row_blocks != nullptr) ? I_size * info->adaptive.size : 0;
+        size += (info->adaptive.wg_flags != nullptr) ? sizeof(uint32_t) * info->adaptive.size : 0;
+        size += (info->adaptive.wg_ids != nullptr) ? J_size * info->adaptive.size : 0;
+        size += (info->lrb.wg_flags != nullptr) ? sizeof(uint32_t) * info->lrb.size : 0;
+        size += (info->lrb.rows_offsets_scratch != nullptr) ? J_size * info->m : 0;
+        size += (info->lrb.rows_bins != nullptr) ? J_size * info->m : 0;
+        size += (info->lrb.n_rows_bins != nullptr) ? J_size * 32 : 0;
+        return size;
+    }
+
+    static size_t trm_info_size(const _rocsparse_trm_info* info)
+    {
+        const size_t I_size = rocsparse::indextype_sizeof(info->index_type_I);
+        const size_t J_size = rocsparse::indextype_sizeof(info->index_type_J);
+
+        size_t size = 0;
+        size += (info->row_map != nullptr) ? J_size * info->m : 0;
+        size += (info->trm_diag_ind != nullptr) ? I_size * info->m : 0;
+        size += (info->trmt_perm != nullptr) ? I_size * info->nnz : 0;
+        size += (info->trmt_row_ptr != nullptr) ? I_size * (info->m + 1) : 0;
+        size += (info->trmt_col_ind != nullptr) ? J_size * info->nnz : 0;
+        return size;
+    }
+}
+
+bool rocsparse::analysis_cache_key::matches(const analysis_cache_key& that) const
+{
+    return this->kind == that.kind && this->trans == that.trans && this->type == that.type
+           && this->base == that.base && this->fill_mode == that.fill_mode
+           && this->diag_type == that.diag_type && this->index_type_I == that.index_type_I
+           && this->index_type_J == that.index_type_J && this->m == that.m && this->n == that.n
+           && this->nnz == that.nnz;
+}
+
+bool rocsparse::analysis_cache_key::operator==(const analysis_cache_key& that) const
+{
+    return this->matches(that) && this->hash[0] == that.hash[0] && this->hash[1] == that.hash[1];
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse::analysis_cache_create_key(rocsparse_handle          handle,
+                                                      analysis_cache_kind       kind,
+                                                      rocsparse_operation       trans,
+                                                      const rocsparse_mat_descr descr,
+                                                      int64_t                   m,
+                                                      int64_t                   n,
+                                                      int64_t                   nnz,
+                                                      const I*                  row_ptr,
+                                                      const J*                  col_ind,
+                                                      analysis_cache_key*       key)
+{
+    static constexpr uint32_t BLOCKSIZE = 256;
+
+    hipStream_t stream = handle->stream;
+
+    key->kind         = kind;
+    key->trans        = trans;
+    key->type         = descr->type;
+    key->base         = descr->base;
+    key->fill_mode    = descr->fill_mode;
+    key->diag_type    = descr->diag_type;
+    key->index_type_I = rocsparse::get_indextype<I>();
+    key->index_type_J = rocsparse::get_indextype<J>();
+    key->m            = m;
+    key->n            = n;
+    key->nnz          = nnz;
+
+    uint64_t* dhash = reinterpret_cast<uint64_t*>(handle->buffer);
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(dhash, 0, sizeof(uint64_t) * 2, stream));
+
+    const int64_t nblocks = std::min((m + nnz) / BLOCKSIZE + 1, int64_t(1024));
+    RETURN_IF_HIPLAUNCHKERNELGGL_ERROR((rocsparse::fingerprint_kernel<BLOCKSIZE, I, J>),
+                                       dim3(nblocks),
+                                       dim3(BLOCKSIZE),
+                                       0,
+                                       stream,
+                                       m,
+                                       nnz,
+                                       row_ptr,
+                                       col_ind,
+                                       dhash);
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.download_hash(stream, dhash));
+
+    return rocsparse_status_success;
+}
+
+rocsparse::analysis_cache::~analysis_cache()
+{
+    const rocsparse_status status = this->set_max_size(0);
+    if(status != rocsparse_status_success)
+    {
+        ROCSPARSE_ERROR_MESSAGE(status, "analysis cache error");
+    }
+}
+
+rocsparse_status rocsparse::analysis_cache::set_max_size(size_t max_size)
+{
+    RETURN_IF_ROCSPARSE_ERROR(this->evict(max_size));
+    this->m_max_size = max_size;
+
+    if(max_size == 0)
+    {
+        if(this->m_host != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(rocsparse_hipHostFree(this->m_host));
+            this->m_host = nullptr;
+        }
+        if(this->m_event != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipEventDestroy(this->m_event));
+            this->m_event = nullptr;
+        }
+        return rocsparse_status_success;
+    }
+
+    if(this->m_event == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&this->m_event, hipEventDisableTiming));
+    }
+    if(this->m_host == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipHostMalloc((void**)&this->m_host, sizeof(uint64_t) * 3));
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::download_hash(hipStream_t stream, const uint64_t* hash)
+{
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        this->m_host, hash, sizeof(uint64_t) * 2, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipEventRecord(this->m_event, stream));
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::wait_hash(analysis_cache_key* key)
+{
+    // Returns at once if the stream has been synchronized since the download
+    RETURN_IF_HIP_ERROR(hipEventSynchronize(this->m_event));
+    key->hash[0] = this->m_host[0];
+    key->hash[1] = this->m_host[1];
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::lookup(rocsparse_handle          handle,
+                                                   const analysis_cache_key& key,
+                                                   const void*               row_ptr,
+                                                   const void*               col_ind,
+                                                   entry**                   e)
+{
+    *e = nullptr;
+
+    // Without an entry of the same sizes, the fingerprint is not waited for
+    if(std::none_of(this->m_entries.begin(), this->m_entries.end(), [&key](const entry& that) {
+           return that.key.matches(key);
+       }))
+    {
+        ++this->m_misses;
+        return rocsparse_status_success;
+    }
+
+    analysis_cache_key hashed = key;
+    RETURN_IF_ROCSPARSE_ERROR(this->wait_hash(&hashed));
+
+    hipStream_t stream = handle->stream;
+    uint64_t*   differ = reinterpret_cast<uint64_t*>(handle->buffer);
+    for(auto it = this->m_entries.begin(); it != this->m_entries.end(); ++it)
+    {
+        if(!(it->key == hashed))
+        {
+            continue;
+        }
+
+        // Rule out a fingerprint collision
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(differ, 0, sizeof(uint64_t), stream));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::pattern_compare(
+            stream, rocsparse::row_ptr_size(key), it->row_ptr, row_ptr, differ));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::pattern_compare(
+            stream, rocsparse::col_ind_size(key), it->col_ind, col_ind, differ));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            this->m_host + 2, differ, sizeof(uint64_t), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(this->m_host[2] == 0)
+        {
+            // Mark as most recently used
+            this->m_entries.splice(this->m_entries.begin(), this->m_entries, it);
+            ++this->m_hits;
+            *e = &this->m_entries.front();
+            return rocsparse_status_success;
+        }
+    }
+
+    ++this->m_misses;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::create_entry(rocsparse_handle          handle,
+                                                         const analysis_cache_key& key,
+                                                         const void*               row_ptr,
+                                                         const void*               col_ind,
+                                                         entry*                    e)
+{
+    hipStream_t stream = handle->stream;
+
+    e->key = key;
+    RETURN_IF_ROCSPARSE_ERROR(this->wait_hash(&e->key));
+
+    const size_t row_ptr_size = rocsparse::row_ptr_size(key);
+    const size_t col_ind_size = rocsparse::col_ind_size(key);
+
+    RETURN_IF_HIP_ERROR(rocsparse_hipMalloc(&e->row_ptr, row_ptr_size));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(e->row_ptr, row_ptr, row_ptr_size, hipMemcpyDeviceToDevice, stream));
+
+    if(col_ind_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipMalloc(&e->col_ind, col_ind_size));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(e->col_ind, col_ind, col_ind_size, hipMemcpyDeviceToDevice, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::release(entry& e)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_csrmv_info(e.csrmv_info));
+    e.csrmv_info = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse::destroy_trm_info(e.trm_info));
+    e.trm_info = nullptr;
+
+    if(e.row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(e.row_ptr));
+        e.row_ptr = nullptr;
+    }
+    if(e.col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(e.col_ind));
+        e.col_ind = nullptr;
+    }
+    if(e.zero_pivot != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(rocsparse_hipFree(e.zero_pivot));
+        e.zero_pivot = nullptr;
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::evict(size_t max_size)
+{
+    // Release least recently used entries first
+    while(this->m_size > max_size)
+    {
+        entry& e = this->m_entries.back();
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::analysis_cache::release(e));
+        this->m_size -= e.size;
+        this->m_entries.pop_back();
+    }
+
+    if(max_size == 0)
+    {
+        // Entries holding no device memory
+        for(entry& e : this->m_entries)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse::analysis_cache::release(e));
+        }
+        this->m_entries.clear();
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::push(entry& e)
+{
+    RETURN_IF_ROCSPARSE_ERROR(this->evict(this->m_max_size - e.size));
+    this->m_entries.push_front(e);
+    this->m_size += e.size;
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::find(rocsparse_handle          handle,
+                                                 const analysis_cache_key& key,
+                                                 const void*               row_ptr,
+                                                 const void*               col_ind,
+                                                 rocsparse_csrmv_info      info,
+                                                 bool*                     found)
+{
+    entry* e;
+    RETURN_IF_ROCSPARSE_ERROR(this->lookup(handle, key, row_ptr, col_ind, &e));
+
+    *found = (e != nullptr);
+    if(e != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_csrmv_info(info, e->csrmv_info, handle->stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::find(rocsparse_handle          handle,
+                                                 const analysis_cache_key& key,
+                                                 const void*               row_ptr,
+                                                 const void*               col_ind,
+                                                 rocsparse_trm_info        info,
+                                                 void*                     zero_pivot,
+                                                 bool*                     found)
+{
+    entry* e;
+    RETURN_IF_ROCSPARSE_ERROR(this->lookup(handle, key, row_ptr, col_ind, &e));
+
+    *found = (e != nullptr);
+    if(e != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_trm_info(info, e->trm_info, handle->stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(zero_pivot,
+                                           e->zero_pivot,
+                                           rocsparse::indextype_sizeof(key.index_type_J),
+                                           hipMemcpyDeviceToDevice,
+                                           handle->stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::insert(rocsparse_handle           handle,
+                                                   const analysis_cache_key&  key,
+                                                   const void*                row_ptr,
+                                                   const void*                col_ind,
+                                                   const rocsparse_csrmv_info info)
+{
+    const size_t size = rocsparse::csrmv_info_size(info) + rocsparse::row_ptr_size(key)
+                        + rocsparse::col_ind_size(key);
+    if(size > this->m_max_size)
+    {
+        return rocsparse_status_success;
+    }
+
+    entry e;
+    e.size = size;
+
+    const rocsparse_status status = [&]() -> rocsparse_status {
+        RETURN_IF_ROCSPARSE_ERROR(this->create_entry(handle, key, row_ptr, col_ind, &e));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_csrmv_info(&e.csrmv_info));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse::copy_csrmv_info(e.csrmv_info, info, handle->stream));
+        return rocsparse_status_success;
+    }();
+
+    if(status != rocsparse_status_success)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::analysis_cache::release(e));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(this->push(e));
+    return rocsparse_status_success;
+}
+
+rocsparse_status rocsparse::analysis_cache::insert(rocsparse_handle          handle,
+                                                   const analysis_cache_key& key,
+                                                   const void*               row_ptr,
+                                                   const void*               col_ind,
+                                                   const rocsparse_trm_info  info,
+                                                   const void*               zero_pivot)
+{
+    const size_t J_size = rocsparse::indextype_sizeof(key.index_type_J);
+    const size_t size   = rocsparse::trm_info_size(info) + rocsparse::row_ptr_size(key)
+                        + rocsparse::col_ind_size(key) + J_size;
+    if(size > this->m_max_size)
+    {
+        return rocsparse_status_success;
+    }
+
+    entry e;
+    e.size = size;
+
+    const rocsparse_status status = [&]() -> rocsparse_status {
+        RETURN_IF_ROCSPARSE_ERROR(this->create_entry(handle, key, row_ptr, col_ind, &e));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::create_trm_info(&e.trm_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::copy_trm_info(e.trm_info, info, handle->stream));
+
+        // Structural zero pivot found by the analysis
+        RETURN_IF_HIP_ERROR(rocsparse_hipMalloc(&e.zero_pivot, J_size));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            e.zero_pivot, zero_pivot, J_size, hipMemcpyDeviceToDevice, handle->stream));
+        return rocsparse_status_success;
+    }();
+
+    if(status != rocsparse_status_success)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse::analysis_cache::release(e));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(this->push(e));
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                   \
+    template rocsparse_status rocsparse::analysis_cache_create_key( \
+        rocsparse_handle               handle,                      \
+        rocsparse::analysis_cache_kind kind,                        \
+        rocsparse_operation            trans,                       \
+        const rocsparse_mat_descr      descr,                       \
+        int64_t                        m,                           \
+        int64_t                        n,                           \
+        int64_t                        nnz,                         \
+        const ITYPE*                   row_ptr,                     \
+        const JTYPE*                   col_ind,                     \
+        rocsparse::analysis_cache_key* key);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
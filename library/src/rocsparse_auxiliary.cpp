@@ -275,6 +275,51 @@ catch(...)
     RETURN_ROCSPARSE_EXCEPTION();
 }
 
+/********************************************************************************
+ * \brief Set the maximum device memory held by the analysis cache, zero disables
+ * the cache.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_analysis_cache_size(rocsparse_handle handle, size_t max_size)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    rocsparse::log_trace(handle, "rocsparse_set_analysis_cache_size", max_size);
+
+    RETURN_IF_ROCSPARSE_ERROR(handle->analysis_cache.set_max_size(max_size));
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
+/********************************************************************************
+ * \brief Get the analysis cache hits, misses and device memory size.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_analysis_cache_info(rocsparse_handle handle,
+                                                   int64_t*         hits,
+                                                   int64_t*         misses,
+                                                   size_t*          size)
+try
+{
+    ROCSPARSE_CHECKARG_HANDLE(0, handle);
+    ROCSPARSE_CHECKARG_POINTER(1, hits);
+    ROCSPARSE_CHECKARG_POINTER(2, misses);
+    ROCSPARSE_CHECKARG_POINTER(3, size);
+
+    *hits   = handle->analysis_cache.get_hits();
+    *misses = handle->analysis_cache.get_misses();
+    *size   = handle->analysis_cache.get_size();
+
+    rocsparse::log_trace(handle, "rocsparse_get_analysis_cache_info", *hits, *misses, *size);
+
+    return rocsparse_status_success;
+}
+catch(...)
+{
+    RETURN_ROCSPARSE_EXCEPTION();
+}
+
 /********************************************************************************
  * \brief rocsparse_create_mat_descr_t is a structure holding the rocsparse matrix
  * descriptor. It must be initialized using rocsparse_create_mat_descr()